@@ -0,0 +1,171 @@
+// Level-load cost of the cooked container. Cooks a scene of large meshes
+// to a temporary file, then loads it twice: mapped in place the way
+// uploadMesh() consumes it (open, validate, touch every page as the driver
+// would) and read into heap buffers, the intermediate copy the mapping
+// avoids. On Linux the file is evicted from the page cache before each cold
+// run, so both include the disk. Usage: bloom_bench_asset [MiB]
+
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+#include "GLFW/glfw3.h"
+
+#include "asset/asset_file.hpp"
+#include "asset/asset_writer.hpp"
+#include "core/clock.hpp"
+
+#if !defined(_WIN32)
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+namespace
+{
+    constexpr uint32_t kMeshCount = 256;
+    constexpr uint32_t kStride = 32;
+    constexpr uint32_t kFloatType = 0x1406;     // GL_FLOAT
+    constexpr uint32_t kIndexType = 0x1405;     // GL_UNSIGNED_INT
+
+    void evict(const char* path)
+    {
+#if !defined(_WIN32)
+        const int fd = open(path, O_RDONLY);
+        if (fd >= 0)
+        {
+            fdatasync(fd);
+            posix_fadvise(fd, 0, 0, POSIX_FADV_DONTNEED);
+            close(fd);
+        }
+#else
+        (void)path;
+#endif
+    }
+
+    double gibPerSecond(uint64_t bytes, double ms)
+    {
+        return bytes / (1024.0 * 1024.0 * 1024.0) / (ms / 1000.0);
+    }
+
+    // One load from the mapping: what glNamedBufferStorage reads.
+    uint64_t touchMapped(const bloom::AssetFile& file)
+    {
+        uint64_t sum = 0;
+        for (const bloom::AssetEntry& entry : file.entries())
+        {
+            const std::span<const std::byte> data = file.data(entry);
+            for (std::size_t offset = 0; offset < data.size(); offset += 4096)
+                sum += static_cast<uint8_t>(data[offset]);
+        }
+        return sum;
+    }
+
+    double mappedLoad(const char* path, uint64_t& checksum, double& openMs)
+    {
+        const uint64_t start = bloom::Clock::now();
+        bloom::AssetFile file;
+        if (!file.open(path))
+            std::exit(EXIT_FAILURE);
+        openMs = bloom::Clock::toMilliseconds(bloom::Clock::now() - start);
+        for (const bloom::AssetEntry& entry : file.entries())
+            file.prefetch(entry);
+        checksum = touchMapped(file);
+        return bloom::Clock::toMilliseconds(bloom::Clock::now() - start);
+    }
+
+    // The copy path: read each blob into its own heap buffer before use.
+    double copiedLoad(const char* path, uint64_t& checksum)
+    {
+        const uint64_t start = bloom::Clock::now();
+        bloom::AssetFile index;
+        if (!index.open(path))
+            std::exit(EXIT_FAILURE);
+
+        std::FILE* file = std::fopen(path, "rb");
+        std::vector<std::vector<std::byte>> buffers;
+        checksum = 0;
+        for (const bloom::AssetEntry& entry : index.entries())
+        {
+            std::vector<std::byte>& buffer = buffers.emplace_back(entry.dataSize);
+            std::fseek(file, static_cast<long>(entry.dataOffset), SEEK_SET);
+            if (std::fread(buffer.data(), 1, buffer.size(), file) != buffer.size())
+                std::exit(EXIT_FAILURE);
+            for (std::size_t offset = 0; offset < buffer.size(); offset += 4096)
+                checksum += static_cast<uint8_t>(buffer[offset]);
+        }
+        std::fclose(file);
+        return bloom::Clock::toMilliseconds(bloom::Clock::now() - start);
+    }
+}
+
+int main(int argc, char** argv)
+{
+    glfwInitHint(GLFW_PLATFORM, GLFW_PLATFORM_NULL);
+    if (!glfwInit())
+        return EXIT_FAILURE;
+    bloom::Clock::init();
+
+    const uint64_t totalBytes = (argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 1024) << 20;
+    const uint32_t vertexCount = static_cast<uint32_t>(totalBytes / kMeshCount / (kStride + 4));
+    const std::string path = (std::filesystem::temp_directory_path() / "bloom_asset_bench.bloom").string();
+
+    // Every mesh shares one synthetic vertex/index stream; only the size
+    // matters here.
+    std::vector<float> vertices(std::size_t{vertexCount} * kStride / sizeof(float));
+    for (std::size_t i = 0; i < vertices.size(); ++i)
+        vertices[i] = static_cast<float>(i % 1021) * 0.001f;
+    std::vector<uint32_t> indices(vertexCount);
+    for (uint32_t i = 0; i < vertexCount; ++i)
+        indices[i] = (i * 7919u) % vertexCount;
+    const bloom::VertexAttribute layout[] = {{0, 3, kFloatType, 0, 0, 0}, {1, 3, kFloatType, 0, 0, 12}, {2, 2, kFloatType, 0, 0, 24}};
+
+    uint64_t start = bloom::Clock::now();
+    bloom::AssetWriter writer;
+    if (!writer.open(path.c_str()))
+        return EXIT_FAILURE;
+    for (uint32_t i = 0; i < kMeshCount; ++i)
+    {
+        char name[32];
+        std::snprintf(name, sizeof(name), "mesh_%03u", i);
+        bloom::MeshSource mesh;
+        mesh.vertices = vertices.data();
+        mesh.vertexCount = vertexCount;
+        mesh.vertexStride = kStride;
+        mesh.attributes = layout;
+        mesh.indices = indices.data();
+        mesh.indexCount = vertexCount;
+        mesh.indexType = kIndexType;
+        writer.addMesh(name, mesh);
+    }
+    if (!writer.finish())
+        return EXIT_FAILURE;
+    const double cookMs = bloom::Clock::toMilliseconds(bloom::Clock::now() - start);
+    const uint64_t bytes = writer.bytesWritten();
+    std::printf("%u meshes, %.1f MiB cooked in %.1f ms\n", kMeshCount, bytes / (1024.0 * 1024.0), cookMs);
+
+    uint64_t mappedSum = 0, copiedSum = 0;
+    double openMs = 0.0;
+
+    evict(path.c_str());
+    const double mappedCold = mappedLoad(path.c_str(), mappedSum, openMs);
+    std::printf("%-22s %10.1f ms %8.2f GiB/s  (open + validate %.3f ms)\n", "mapped, cold", mappedCold,
+                gibPerSecond(bytes, mappedCold), openMs);
+    evict(path.c_str());
+    const double copiedCold = copiedLoad(path.c_str(), copiedSum);
+    std::printf("%-22s %10.1f ms %8.2f GiB/s\n", "read + copy, cold", copiedCold, gibPerSecond(bytes, copiedCold));
+
+    const double mappedWarm = mappedLoad(path.c_str(), mappedSum, openMs);
+    std::printf("%-22s %10.1f ms %8.2f GiB/s  (open + validate %.3f ms)\n", "mapped, cached", mappedWarm,
+                gibPerSecond(bytes, mappedWarm), openMs);
+    const double copiedWarm = copiedLoad(path.c_str(), copiedSum);
+    std::printf("%-22s %10.1f ms %8.2f GiB/s\n", "read + copy, cached", copiedWarm, gibPerSecond(bytes, copiedWarm));
+
+    if (mappedSum != copiedSum)
+        std::printf("checksum mismatch: %llu vs %llu\n", static_cast<unsigned long long>(mappedSum), static_cast<unsigned long long>(copiedSum));
+
+    std::filesystem::remove(path);
+    glfwTerminate();
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,197 @@
+// BloomEffect cost per resolution. Feeds an HDR frame (a dim background
+// with a scatter of small bright squares) through the downsample, upsample
+// and tonemap passes at 720p, 1080p, 1440p and 4K and reports the GPU time
+// of each pass from GpuProfiler, along with the CPU time and heap
+// allocations of the per-frame setup (graph declarations, compile,
+// execute and sort). Needs OSMesa, so the GPU numbers are llvmpipe's
+// unless the driver says otherwise.
+// Usage: bloom_bench_bloom [frames]
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+#include "glad/glad.h"
+#include "GLFW/glfw3.h"
+
+#include "core/clock.hpp"
+#include "core/profiler.hpp"
+#include "memory/memory.hpp"
+#include "render/bloom_effect.hpp"
+#include "render/gl_backend.hpp"
+#include "render/gpu_profiler.hpp"
+#include "render/render_graph.hpp"
+#include "render/render_queue.hpp"
+
+namespace
+{
+    constexpr int kWarmupFrames = 4;
+    constexpr int kSpots = 64;
+
+    struct Resolution
+    {
+        const char* name;
+        int width;
+        int height;
+    };
+
+    constexpr Resolution kResolutions[] = {
+        {"720p", 1280, 720},
+        {"1080p", 1920, 1080},
+        {"1440p", 2560, 1440},
+        {"4K", 3840, 2160},
+    };
+
+    const char* const kPasses[] = {"bloom downsample", "bloom upsample", "tonemap"};
+
+    GLuint createScene(int width, int height)
+    {
+        GLuint texture = 0;
+        glCreateTextures(GL_TEXTURE_2D, 1, &texture);
+        glTextureStorage2D(texture, 1, GL_RGBA16F, width, height);
+        glTextureParameteri(texture, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+        glTextureParameteri(texture, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+        glTextureParameteri(texture, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+        glTextureParameteri(texture, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+
+        const float background[4] = {0.05f, 0.05f, 0.08f, 1.f};
+        glClearTexImage(texture, 0, GL_RGBA, GL_FLOAT, background);
+        uint32_t seed = 1;
+        for (int spot = 0; spot < kSpots; ++spot)
+        {
+            seed = seed * 1664525u + 1013904223u;
+            const int x = static_cast<int>(seed >> 8) % (width - 8);
+            seed = seed * 1664525u + 1013904223u;
+            const int y = static_cast<int>(seed >> 8) % (height - 8);
+            const float bright[4] = {20.f, 12.f, 6.f, 1.f};
+            glClearTexSubImage(texture, 0, x, y, 0, 8, 8, 1, GL_RGBA, GL_FLOAT, bright);
+        }
+        return texture;
+    }
+
+    // GPU milliseconds per call of `name`, from the profiler's summary.
+    double gpuMs(const std::vector<bloom::ZoneSummary>& zones, const char* name)
+    {
+        for (const bloom::ZoneSummary& zone : zones)
+        {
+            if (std::strcmp(zone.track, "GPU") == 0 && std::strcmp(zone.name, name) == 0 && zone.callsPerFrame > 0.0)
+                return zone.meanMs / zone.callsPerFrame;
+        }
+        return 0.0;
+    }
+}
+
+int main(int argc, char** argv)
+{
+    const int frames = argc > 1 ? std::atoi(argv[1]) : 32;
+    if (frames <= 0 || frames + kWarmupFrames + bloom::GpuProfiler::kFrameLatency > static_cast<int>(bloom::Profiler::kSummaryFrames))
+    {
+        std::fprintf(stderr, "frames must be between 1 and %zu\n",
+                     bloom::Profiler::kSummaryFrames - kWarmupFrames - bloom::GpuProfiler::kFrameLatency);
+        return EXIT_FAILURE;
+    }
+
+    glfwInitHint(GLFW_PLATFORM, GLFW_PLATFORM_NULL);
+    if (!glfwInit())
+        return EXIT_FAILURE;
+    bloom::Clock::init();
+
+    // As large as the largest resolution, so the tonemap pass is not
+    // clipped to a smaller window.
+    glfwWindowHint(GLFW_CONTEXT_CREATION_API, GLFW_OSMESA_CONTEXT_API);
+    glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 4);
+    glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 5);
+    glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+    glfwWindowHint(GLFW_VISIBLE, GLFW_FALSE);
+    GLFWwindow* window = glfwCreateWindow(3840, 2160, "bloom", nullptr, nullptr);
+    if (!window)
+    {
+        std::fprintf(stderr, "No GL 4.5 context (is OSMesa installed?)\n");
+        glfwTerminate();
+        return EXIT_FAILURE;
+    }
+    glfwMakeContextCurrent(window);
+    if (!gladLoadGLLoaderVersion(reinterpret_cast<GLADloadproc>(glfwGetProcAddress), 4, 5))
+        return EXIT_FAILURE;
+    std::printf("%s, %s\n", reinterpret_cast<const char*>(glGetString(GL_RENDERER)),
+                reinterpret_cast<const char*>(glGetString(GL_VERSION)));
+
+    bloom::Profiler::setEnabled(true);
+    bloom::GpuProfiler gpu;
+    bloom::BloomEffect effect;
+    if (!gpu.init() || !effect.init())
+        return EXIT_FAILURE;
+    effect.settings().levels = bloom::BloomEffect::kMaxLevels;
+
+    bloom::RenderQueue queue;
+    bloom::GLBackend backend;
+    backend.setProfiler(&gpu);
+    bloom::RenderGraph graph;
+
+    std::printf("%-6s %6s %12s %12s %12s %12s %10s %8s\n", "", "levels", "downsample", "upsample", "tonemap", "total",
+                "setup", "allocs");
+    for (const Resolution& resolution : kResolutions)
+    {
+        const GLuint scene = createScene(resolution.width, resolution.height);
+        int levels = 0;
+        uint64_t setupTicks = 0;
+        uint64_t allocations = 0;
+
+        // One profiler summary window per resolution. The first frames
+        // create the pyramid's pooled textures at this size and stay out of
+        // the setup and allocs columns; the window is padded with empty
+        // frames, so the pass timings come from this resolution alone.
+        for (int frame = 0; frame < static_cast<int>(bloom::Profiler::kSummaryFrames); ++frame)
+        {
+            const bool working = frame < kWarmupFrames + frames;
+            const bool measured = working && frame >= kWarmupFrames;
+            gpu.beginFrame();
+            if (working)
+            {
+                const uint64_t allocationsBefore = bloom::Memory::allocationCount();
+                const uint64_t start = bloom::Clock::now();
+                queue.reset();
+                graph.reset(resolution.width, resolution.height);
+                const bloom::GraphTexture input =
+                    graph.importTexture("scene", scene, {resolution.width, resolution.height, GL_RGBA16F});
+                levels = effect.addPasses(graph, input);
+                if (!graph.compile())
+                    return EXIT_FAILURE;
+                graph.execute(queue, backend, 0);
+                queue.sort();
+                if (measured)
+                {
+                    setupTicks += bloom::Clock::now() - start;
+                    allocations += bloom::Memory::allocationCount() - allocationsBefore;
+                }
+
+                BLOOM_PROFILE_GPU_ZONE(gpu, "bloom");
+                backend.execute(queue);
+            }
+            glFinish();
+            gpu.endFrame();
+            bloom::Profiler::endFrame();
+        }
+
+        const std::vector<bloom::ZoneSummary> zones = bloom::Profiler::summary();
+        std::printf("%-6s %6d", resolution.name, levels);
+        for (const char* pass : kPasses)
+            std::printf(" %9.3f ms", gpuMs(zones, pass));
+        std::printf(" %9.3f ms %7.3f ms %8.1f\n", gpuMs(zones, "bloom"),
+                    bloom::Clock::toMilliseconds(setupTicks) / frames, static_cast<double>(allocations) / frames);
+
+        backend.state().forgetTexture(scene);
+        glDeleteTextures(1, &scene);
+    }
+
+    if (gpu.droppedFrames() > 0)
+        std::printf("%llu frames of GPU timings dropped\n", static_cast<unsigned long long>(gpu.droppedFrames()));
+
+    graph.release();
+    effect.release();
+    gpu.release();
+    glfwDestroyWindow(window);
+    glfwTerminate();
+    return EXIT_SUCCESS;
+}
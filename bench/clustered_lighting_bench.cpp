@@ -0,0 +1,333 @@
+// ClusteredLighting on a synthetic scene: a field of 2304 boxes on a floor,
+// lit by up to 10k moving point lights, drawn in one instanced forward
+// pass whose fragments walk only the lights of their froxel. Runs 2.5k, 5k
+// and 10k lights (or the count given) and reports the GPU time of the
+// "light binning" and "forward" passes from GpuProfiler, the CPU time to
+// write the lights, and the froxel occupancy read back after the last
+// frame. Needs OSMesa, so the GPU numbers are llvmpipe's unless the driver
+// says otherwise.
+// Usage: bloom_bench_clustered_lighting [lights [width height]]
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <numbers>
+#include <span>
+#include <vector>
+
+#include "glad/glad.h"
+#include "GLFW/glfw3.h"
+
+#include "core/clock.hpp"
+#include "core/profiler.hpp"
+#include "math/mat4.hpp"
+#include "render/clustered_lighting.hpp"
+#include "render/gl_backend.hpp"
+#include "render/gl_shader.hpp"
+#include "render/gpu_profiler.hpp"
+#include "render/render_graph.hpp"
+#include "render/render_queue.hpp"
+
+namespace
+{
+    constexpr int kWarmupFrames = 4;
+    constexpr int kMeasuredFrames = 24;
+    constexpr int kBoxesPerSide = 48;
+    constexpr float kFieldSize = 120.f;
+    constexpr uint32_t kMaxLights = 10000;
+
+    const char* const kPasses[] = {"light binning", "forward"};
+
+    // Instance 0 is the floor; the rest are boxes on a grid, their height
+    // hashed from the instance index. The cube comes from gl_VertexID.
+    const char* const kVertexShader = R"(#version 450 core
+layout(location = 0) uniform mat4 u_viewProjection;
+out vec3 v_position;
+out vec3 v_albedo;
+
+const vec3 kCorners[8] = vec3[8](vec3(0, 0, 0), vec3(1, 0, 0), vec3(0, 1, 0), vec3(1, 1, 0),
+                                 vec3(0, 0, 1), vec3(1, 0, 1), vec3(0, 1, 1), vec3(1, 1, 1));
+const int kIndices[36] = int[36](0, 2, 1, 1, 2, 3,  4, 5, 6, 5, 7, 6,  0, 1, 4, 1, 5, 4,
+                                 2, 6, 3, 3, 6, 7,  0, 4, 2, 2, 4, 6,  1, 3, 5, 3, 7, 5);
+
+uint hash(uint x)
+{
+    x ^= x >> 16;
+    x *= 0x7feb352du;
+    x ^= x >> 15;
+    x *= 0x846ca68bu;
+    return x ^ (x >> 16);
+}
+
+void main()
+{
+    vec3 corner = kCorners[kIndices[gl_VertexID]];
+    const float field = 120.0;
+    const int side = 48;
+    vec3 origin;
+    vec3 size;
+    if (gl_InstanceID == 0)
+    {
+        origin = vec3(-field * 0.5, -1.0, -field * 0.5);
+        size = vec3(field, 1.0, field);
+        v_albedo = vec3(0.6);
+    }
+    else
+    {
+        int box = gl_InstanceID - 1;
+        float cell = field / float(side);
+        uint h = hash(uint(box));
+        origin = vec3(-field * 0.5 + (float(box % side) + 0.25) * cell, 0.0, -field * 0.5 + (float(box / side) + 0.25) * cell);
+        size = vec3(cell * 0.5, 0.5 + float(h & 255u) / 255.0 * 3.5, cell * 0.5);
+        v_albedo = vec3(0.5 + 0.3 * float(h >> 8 & 1u), 0.6, 0.5 + 0.3 * float(h >> 9 & 1u));
+    }
+    v_position = origin + corner * size;
+    gl_Position = u_viewProjection * vec4(v_position, 1.0);
+}
+)";
+
+    const char* const kFragmentShader = R"(#version 450 core
+in vec3 v_position;
+in vec3 v_albedo;
+out vec4 o_color;
+
+vec3 clusteredLighting(vec3 position, vec3 normal, vec3 albedo);
+
+void main()
+{
+    vec3 normal = normalize(cross(dFdx(v_position), dFdy(v_position)));
+    vec3 ambient = 0.02 * v_albedo;
+    o_color = vec4(ambient + clusteredLighting(v_position, normal, v_albedo), 1.0);
+}
+)";
+
+    struct Scene
+    {
+        GLuint program = 0;
+        GLuint vertexArray = 0;
+        bloom::Mat4 viewProjection;
+        bloom::ClusteredLighting* lighting = nullptr;
+        bloom::GraphTexture color;
+        bloom::GraphTexture depth;
+    };
+
+    void forward(const bloom::PassContext& context, void* user)
+    {
+        const auto* scene = static_cast<const Scene*>(user);
+
+        bloom::ClearCommand clear;
+        context.commands->record(context.key(0, 0, 0), clear);
+
+        bloom::DrawCommand draw;
+        draw.program = scene->program;
+        draw.vertexArray = scene->vertexArray;
+        draw.count = 36;
+        draw.instanceCount = 1 + kBoxesPerSide * kBoxesPerSide;
+        draw.state.depthTest = true;
+        draw.state.cull = bloom::CullMode::Back;
+        scene->lighting->bind(draw);
+        context.commands->record(context.key(0, 0, 1), draw);
+    }
+
+    struct LightSeed
+    {
+        float x, y, z;
+        float phase;
+    };
+
+    std::vector<LightSeed> makeSeeds(uint32_t count)
+    {
+        std::vector<LightSeed> seeds(count);
+        uint32_t state = 7;
+        const auto next = [&state]()
+        {
+            state = state * 1664525u + 1013904223u;
+            return static_cast<float>(state >> 8) / static_cast<float>(1u << 24);
+        };
+        for (LightSeed& seed : seeds)
+            seed = {(next() - 0.5f) * kFieldSize, 0.3f + next() * 3.f, (next() - 0.5f) * kFieldSize, next() * 6.2831853f};
+        return seeds;
+    }
+
+    // Each light circles its seed point; colours cycle through six hues.
+    void writeLights(std::span<bloom::PointLight> out, const std::vector<LightSeed>& seeds, uint32_t count, float time)
+    {
+        static constexpr float kHues[6][3] = {{1.f, 0.3f, 0.2f}, {1.f, 0.8f, 0.3f}, {0.4f, 1.f, 0.3f},
+                                              {0.3f, 0.9f, 1.f}, {0.4f, 0.4f, 1.f}, {1.f, 0.4f, 0.9f}};
+        for (uint32_t i = 0; i < count; ++i)
+        {
+            const LightSeed& seed = seeds[i];
+            const float angle = seed.phase + time;
+            const float* hue = kHues[i % 6];
+            // One whole-struct store: the ring is write-combined memory.
+            out[i] = bloom::PointLight{{seed.x + std::cos(angle), seed.y, seed.z + std::sin(angle)},
+                                       2.5f + 2.5f * (seed.phase / 6.2831853f),
+                                       {hue[0], hue[1], hue[2]},
+                                       6.f};
+        }
+    }
+
+    double gpuMs(const std::vector<bloom::ZoneSummary>& zones, const char* name)
+    {
+        for (const bloom::ZoneSummary& zone : zones)
+        {
+            if (std::strcmp(zone.track, "GPU") == 0 && std::strcmp(zone.name, name) == 0 && zone.callsPerFrame > 0.0)
+                return zone.meanMs / zone.callsPerFrame;
+        }
+        return 0.0;
+    }
+}
+
+int main(int argc, char** argv)
+{
+    const auto requested = static_cast<uint32_t>(argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 0);
+    const int width = argc > 3 ? std::atoi(argv[2]) : 1920;
+    const int height = argc > 3 ? std::atoi(argv[3]) : 1080;
+    if (requested > kMaxLights || width <= 0 || height <= 0)
+    {
+        std::fprintf(stderr, "Usage: bloom_bench_clustered_lighting [lights (up to %u) [width height]]\n", kMaxLights);
+        return EXIT_FAILURE;
+    }
+
+    glfwInitHint(GLFW_PLATFORM, GLFW_PLATFORM_NULL);
+    if (!glfwInit())
+        return EXIT_FAILURE;
+    bloom::Clock::init();
+
+    glfwWindowHint(GLFW_CONTEXT_CREATION_API, GLFW_OSMESA_CONTEXT_API);
+    glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 4);
+    glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 5);
+    glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+    glfwWindowHint(GLFW_VISIBLE, GLFW_FALSE);
+    GLFWwindow* window = glfwCreateWindow(width, height, "clustered lighting", nullptr, nullptr);
+    if (!window)
+    {
+        std::fprintf(stderr, "No GL 4.5 context (is OSMesa installed?)\n");
+        glfwTerminate();
+        return EXIT_FAILURE;
+    }
+    glfwMakeContextCurrent(window);
+    if (!gladLoadGLLoaderVersion(reinterpret_cast<GLADloadproc>(glfwGetProcAddress), 4, 5))
+        return EXIT_FAILURE;
+    std::printf("%s, %s\n", reinterpret_cast<const char*>(glGetString(GL_RENDERER)),
+                reinterpret_cast<const char*>(glGetString(GL_VERSION)));
+
+    bloom::Profiler::setEnabled(true);
+    bloom::GpuProfiler gpu;
+    bloom::ClusteredLighting lighting;
+    bloom::ClusterSettings settings;
+    settings.maxLights = kMaxLights;
+    if (!gpu.init() || !lighting.init(settings))
+        return EXIT_FAILURE;
+
+    Scene scene;
+    scene.lighting = &lighting;
+    const bloom::ShaderStage stages[] = {{GL_VERTEX_SHADER, kVertexShader},
+                                         {GL_FRAGMENT_SHADER, kFragmentShader},
+                                         lighting.fragmentStage()};
+    scene.program = bloom::compileProgram(stages);
+    if (!scene.program)
+        return EXIT_FAILURE;
+    glCreateVertexArrays(1, &scene.vertexArray);
+
+    const bloom::Mat4 view = bloom::Mat4::lookAt({0.f, 28.f, -78.f}, {0.f, 0.f, -8.f}, {0.f, 1.f, 0.f});
+    const bloom::Mat4 projection =
+        bloom::Mat4::perspective(std::numbers::pi_v<float> / 3.f, static_cast<float>(width) / static_cast<float>(height), 0.5f, 250.f);
+    scene.viewProjection = projection * view;
+    glProgramUniformMatrix4fv(scene.program, 0, 1, GL_FALSE, scene.viewProjection.data());
+
+    bloom::RenderQueue queue;
+    bloom::GLBackend backend;
+    backend.setProfiler(&gpu);
+    bloom::RenderGraph graph;
+    const std::vector<LightSeed> seeds = makeSeeds(kMaxLights);
+
+    std::printf("%ux%ux%u froxels at %dx%d\n", settings.tilesX, settings.tilesY, settings.slices, width, height);
+    std::printf("%7s %12s %12s %12s %12s %14s %10s\n", "lights", "binning", "forward", "write", "total", "per froxel", "max");
+
+    const uint32_t defaults[] = {2500, 5000, kMaxLights};
+    const std::span<const uint32_t> counts = requested ? std::span<const uint32_t>(&requested, 1) : std::span<const uint32_t>(defaults);
+    for (const uint32_t count : counts)
+    {
+        uint64_t writeTicks = 0;
+
+        // Warm-up frames grow the graph, queue and pool; the rest are
+        // measured. The profiler's summary window is then flushed with
+        // empty frames, so it holds this light count's zones only.
+        for (int frame = 0; frame < static_cast<int>(bloom::Profiler::kSummaryFrames); ++frame)
+        {
+            const bool working = frame < kWarmupFrames + kMeasuredFrames;
+            gpu.beginFrame();
+            if (working)
+            {
+                const uint64_t start = bloom::Clock::now();
+                writeLights(lighting.beginLights(), seeds, count, static_cast<float>(frame) * 0.05f);
+                lighting.endLights(count);
+                if (frame >= kWarmupFrames)
+                    writeTicks += bloom::Clock::now() - start;
+
+                queue.reset();
+                graph.reset(width, height);
+                lighting.setCamera(view, projection, width, height);
+                const bloom::GraphBuffer clusters = lighting.addPasses(graph);
+                scene.color = graph.createTexture("hdr", {width, height, GL_RGBA16F});
+                scene.depth = graph.createTexture("depth", {width, height, GL_DEPTH_COMPONENT24});
+                const uint32_t pass = graph.addPass("forward", bloom::PassKind::Graphics, forward, &scene);
+                graph.read(pass, clusters, bloom::BufferAccess::Storage);
+                graph.write(pass, scene.color, bloom::TextureAccess::ColorTarget);
+                graph.write(pass, scene.depth, bloom::TextureAccess::DepthTarget);
+                graph.markOutput(pass);
+                if (!graph.compile())
+                    return EXIT_FAILURE;
+                graph.execute(queue, backend, 0);
+                queue.sort();
+                backend.execute(queue);
+                lighting.endFrame();
+            }
+            glFinish();
+            gpu.endFrame();
+            bloom::Profiler::endFrame();
+        }
+
+        // The last frame's binning is complete after glFinish.
+        const uint32_t clusterCount = lighting.clusterCount();
+        std::vector<uint32_t> grid(clusterCount * 2);
+        glGetNamedBufferSubData(lighting.clusterBuffer(), 0, static_cast<GLsizeiptr>(grid.size() * sizeof(uint32_t)), grid.data());
+        uint64_t references = 0;
+        uint32_t occupied = 0;
+        uint32_t most = 0;
+        for (uint32_t cluster = 0; cluster < clusterCount; ++cluster)
+        {
+            const uint32_t lights = grid[cluster * 2 + 1];
+            references += lights;
+            occupied += lights > 0;
+            most = std::max(most, lights);
+        }
+
+        const std::vector<bloom::ZoneSummary> zones = bloom::Profiler::summary();
+        double total = 0.0;
+        std::printf("%7u", count);
+        for (const char* pass : kPasses)
+        {
+            const double ms = gpuMs(zones, pass);
+            total += ms;
+            std::printf(" %9.3f ms", ms);
+        }
+        std::printf(" %9.3f ms %9.3f ms %14.1f %10u\n", bloom::Clock::toMilliseconds(writeTicks) / kMeasuredFrames, total,
+                    occupied ? static_cast<double>(references) / occupied : 0.0, most);
+    }
+
+    if (gpu.droppedFrames() > 0)
+        std::printf("%llu frames of GPU timings dropped\n", static_cast<unsigned long long>(gpu.droppedFrames()));
+
+    graph.release();
+    lighting.release();
+    gpu.release();
+    glDeleteVertexArrays(1, &scene.vertexArray);
+    glDeleteProgram(scene.program);
+    glfwDestroyWindow(window);
+    glfwTerminate();
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,99 @@
+// ECS iteration: integrates 1M particles the way particles.c update_particle
+// does, once over an array of structs and once through ECS queries (serial
+// and one job per chunk), and reports time per update.
+
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+#include "GLFW/glfw3.h"
+
+#include "core/clock.hpp"
+#include "ecs/world.hpp"
+#include "jobs/job_system.hpp"
+
+namespace
+{
+    constexpr uint32_t kParticleCount = 1u << 20;
+    constexpr int kIterations = 20;
+    constexpr float kDeltaTime = 1.f / 60.f;
+    constexpr float kGravity = 9.8f;
+    constexpr float kLifeSpan = 8.f;
+
+    struct Position { float x, y, z; };
+    struct Velocity { float x, y, z; };
+    struct Life { float value; };
+
+    struct Particle
+    {
+        float x, y, z;
+        float vx, vy, vz;
+        float r, g, b;
+        float life;
+        int active;
+    };
+
+    void integrate(Position& p, Velocity& v, Life& life)
+    {
+        life.value -= kDeltaTime * (1.f / kLifeSpan);
+        v.z -= kGravity * kDeltaTime;
+        p.x += v.x * kDeltaTime;
+        p.y += v.y * kDeltaTime;
+        p.z += v.z * kDeltaTime;
+    }
+
+    template <typename F>
+    double timeIt(F&& fn)
+    {
+        const uint64_t start = bloom::Clock::now();
+        for (int i = 0; i < kIterations; ++i)
+            fn();
+        return bloom::Clock::toMilliseconds(bloom::Clock::now() - start) / kIterations;
+    }
+}
+
+int main()
+{
+    glfwInitHint(GLFW_PLATFORM, GLFW_PLATFORM_NULL);
+    if (!glfwInit())
+        return EXIT_FAILURE;
+    bloom::Clock::init();
+
+    std::vector<Particle> particles(kParticleCount);
+    for (uint32_t i = 0; i < kParticleCount; ++i)
+        particles[i] = Particle{0.f, 0.f, 3.f, 0.1f * (i % 7), 0.1f * (i % 5), 8.f, 1.f, 1.f, 1.f, 1.f, 1};
+
+    bloom::World world;
+    world.reserve(kParticleCount);
+    for (uint32_t i = 0; i < kParticleCount; ++i)
+        world.create(Position{0.f, 0.f, 3.f}, Velocity{0.1f * (i % 7), 0.1f * (i % 5), 8.f}, Life{1.f});
+
+    bloom::JobSystem jobs;
+    jobs.registerThread();
+    auto query = world.query<Position, Velocity, Life>();
+
+    const double aos = timeIt([&]
+    {
+        for (Particle& p : particles)
+        {
+            if (!p.active)
+                continue;
+            p.life -= kDeltaTime * (1.f / kLifeSpan);
+            p.vz -= kGravity * kDeltaTime;
+            p.x += p.vx * kDeltaTime;
+            p.y += p.vy * kDeltaTime;
+            p.z += p.vz * kDeltaTime;
+        }
+    });
+
+    const double serial = timeIt([&] { query.each(integrate); });
+    const double parallel = timeIt([&] { query.parallelEach(jobs, integrate); });
+
+    std::printf("%u entities, %u worker threads\n", kParticleCount, jobs.workerCount());
+    std::printf("%-20s %10.3f ms\n", "array of structs", aos);
+    std::printf("%-20s %10.3f ms\n", "ecs serial", serial);
+    std::printf("%-20s %10.3f ms\n", "ecs parallel", parallel);
+
+    glfwTerminate();
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,156 @@
+// GL loader cold start: runs itself as a child process once per sample, so
+// every measurement starts from a fresh process like a batch render worker
+// does, and compares eager glad loading with the lazy trampolines and with
+// version-limited loading. Needs OSMesa; the context is created on GLFW's
+// null platform.
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "glad/glad.h"
+#include "GLFW/glfw3.h"
+
+#include "core/clock.hpp"
+
+namespace
+{
+    constexpr int kSamples = 25;
+
+    struct Mode
+    {
+        const char* name;
+        bool lazy;
+        int major;
+        int minor;
+    };
+
+    constexpr Mode kModes[] = {
+        {"eager", false, 4, 6},
+        {"eager-3.3", false, 3, 3},
+        {"lazy", true, 4, 6},
+        {"lazy-3.3", true, 3, 3},
+    };
+
+    int s_lookups = 0;
+
+    void* countingLoader(const char* name)
+    {
+        ++s_lookups;
+        return reinterpret_cast<void*>(glfwGetProcAddress(name));
+    }
+
+    // Child side: create an OSMesa context, load GL and issue a typical
+    // first frame's worth of calls. Prints "<load us> <first frame us> <lookups>".
+    int runChild(const Mode& mode)
+    {
+        glfwInitHint(GLFW_PLATFORM, GLFW_PLATFORM_NULL);
+        if (!glfwInit())
+            return EXIT_FAILURE;
+        bloom::Clock::init();
+
+        glfwWindowHint(GLFW_CONTEXT_CREATION_API, GLFW_OSMESA_CONTEXT_API);
+        glfwWindowHint(GLFW_VISIBLE, GLFW_FALSE);
+        GLFWwindow* window = glfwCreateWindow(64, 64, "loader", nullptr, nullptr);
+        if (!window)
+        {
+            glfwTerminate();
+            return EXIT_FAILURE;
+        }
+        glfwMakeContextCurrent(window);
+
+        const uint64_t loadStart = bloom::Clock::now();
+        const int loaded = mode.lazy ? gladLoadGLLoaderLazyVersion(countingLoader, mode.major, mode.minor)
+                                     : gladLoadGLLoaderVersion(countingLoader, mode.major, mode.minor);
+        const uint64_t loadEnd = bloom::Clock::now();
+        if (!loaded)
+            return EXIT_FAILURE;
+
+        GLint viewport[4];
+        glGetIntegerv(GL_VIEWPORT, viewport);
+        glViewport(0, 0, 64, 64);
+        glClearColor(0.f, 0.f, 0.f, 1.f);
+        glClear(GL_COLOR_BUFFER_BIT);
+        GLuint buffer = 0;
+        glGenBuffers(1, &buffer);
+        glBindBuffer(GL_ARRAY_BUFFER, buffer);
+        glBufferData(GL_ARRAY_BUFFER, 256, nullptr, GL_STATIC_DRAW);
+        glDeleteBuffers(1, &buffer);
+        glFinish();
+        const uint64_t frameEnd = bloom::Clock::now();
+
+        std::printf("%.1f %.1f %d\n",
+                    bloom::Clock::toSeconds(loadEnd - loadStart) * 1e6,
+                    bloom::Clock::toSeconds(frameEnd - loadEnd) * 1e6,
+                    s_lookups);
+
+        glfwDestroyWindow(window);
+        glfwTerminate();
+        return EXIT_SUCCESS;
+    }
+
+    double median(std::vector<double> values)
+    {
+        if (values.empty())
+            return 0.0;
+        std::sort(values.begin(), values.end());
+        return values[values.size() / 2];
+    }
+}
+
+int main(int argc, char** argv)
+{
+    if (argc == 3 && std::strcmp(argv[1], "--child") == 0)
+    {
+        for (const Mode& mode : kModes)
+        {
+            if (std::strcmp(argv[2], mode.name) == 0)
+                return runChild(mode);
+        }
+        return EXIT_FAILURE;
+    }
+
+    glfwInitHint(GLFW_PLATFORM, GLFW_PLATFORM_NULL);
+    if (!glfwInit())
+        return EXIT_FAILURE;
+    bloom::Clock::init();
+
+    std::printf("%-10s %12s %14s %10s %14s\n", "mode", "load us", "first frame us", "lookups", "process ms");
+
+    for (const Mode& mode : kModes)
+    {
+        std::vector<double> load, frame, process;
+        int lookups = 0;
+
+        for (int sample = 0; sample < kSamples; ++sample)
+        {
+            const std::string command = std::string(argv[0]) + " --child " + mode.name;
+            const uint64_t start = bloom::Clock::now();
+            FILE* child = popen(command.c_str(), "r");
+            if (!child)
+                break;
+
+            double loadUs = 0.0, frameUs = 0.0;
+            const int fields = std::fscanf(child, "%lf %lf %d", &loadUs, &frameUs, &lookups);
+            const int status = pclose(child);
+            if (fields != 3 || status != 0)
+            {
+                std::fprintf(stderr, "%s: child failed (is OSMesa installed?)\n", mode.name);
+                break;
+            }
+
+            process.push_back(bloom::Clock::toMilliseconds(bloom::Clock::now() - start));
+            load.push_back(loadUs);
+            frame.push_back(frameUs);
+        }
+
+        std::printf("%-10s %12.1f %14.1f %10d %14.2f\n", mode.name, median(load), median(frame), lookups,
+                    median(process));
+    }
+
+    glfwTerminate();
+    return EXIT_SUCCESS;
+}
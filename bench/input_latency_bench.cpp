@@ -0,0 +1,152 @@
+// Input latency, after GLFW's tests/inputlag.c: how long an event waits
+// between the GLFW callback and the simulation tick that applies it.
+//
+// The main thread plays the event pump and fires cursor events at mouse
+// polling rate, plus a key tap shorter than a tick every few milliseconds,
+// through the callbacks InputSystem installed on the window. A simulation
+// thread ticks at a fixed rate and drains the queue. For comparison it
+// also samples the latest cursor position the way inputlag.c's "sync query"
+// mode does, which is fresher but silently skips intermediate events.
+// Runs on GLFW's null platform, so no display is needed.
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <thread>
+
+#include "GLFW/glfw3.h"
+
+#include "core/clock.hpp"
+#include "input/input_system.hpp"
+
+namespace
+{
+    constexpr double kSeconds = 2.0;
+    constexpr double kEventRate = 1000.0;   // Hz, typical USB mouse polling
+    constexpr int kEventsPerTap = 40;   // over two 60 Hz ticks apart
+
+    struct Result
+    {
+        bloom::InputLatencySummary queued;
+        uint64_t tapsSent = 0;
+        uint64_t tapsSeen = 0;
+        uint64_t cursorEvents = 0;
+        uint64_t samplesSeen = 0;   // distinct cursor samples seen by polling
+        double polledMeanMs = 0.0;
+    };
+
+    Result measure(GLFWwindow* window, double tickRate)
+    {
+        auto input = std::make_unique<bloom::InputSystem>();
+        input->attach(window);
+        if (!input->actions().parse("tap key SPACE\n"))
+            std::exit(EXIT_FAILURE);
+        const int tap = input->actions().find("tap");
+
+        // The same function pointers GLFW's _glfwInputKey and
+        // _glfwInputCursorPos would call.
+        const GLFWkeyfun keyCallback = glfwSetKeyCallback(window, nullptr);
+        const GLFWcursorposfun cursorCallback = glfwSetCursorPosCallback(window, nullptr);
+        glfwSetKeyCallback(window, keyCallback);
+        glfwSetCursorPosCallback(window, cursorCallback);
+
+        Result result;
+        std::atomic<bool> stop{false};
+        std::atomic<uint64_t> latestSample{0};
+
+        std::thread simulation([&]()
+        {
+            const uint64_t interval = bloom::Clock::fromSeconds(1.0 / tickRate);
+            uint64_t next = bloom::Clock::now();
+            uint64_t lastSample = 0;
+            uint64_t polledTotal = 0;
+
+            while (!stop.load(std::memory_order_acquire))
+            {
+                const bloom::InputState& state = input->update(next);
+                result.tapsSeen += state.wasPressed(tap) ? 1 : 0;
+
+                const uint64_t sample = latestSample.load(std::memory_order_acquire);
+                if (sample != lastSample)
+                {
+                    polledTotal += bloom::Clock::now() - sample;
+                    ++result.samplesSeen;
+                    lastSample = sample;
+                }
+
+                next += interval;
+                bloom::Clock::sleepUntil(next);
+            }
+
+            if (result.samplesSeen > 0)
+                result.polledMeanMs = bloom::Clock::toMilliseconds(polledTotal) / result.samplesSeen;
+        });
+
+        const uint64_t period = bloom::Clock::fromSeconds(1.0 / kEventRate);
+        const uint64_t start = bloom::Clock::now();
+        const uint64_t events = static_cast<uint64_t>(kSeconds * kEventRate);
+        for (uint64_t i = 0; i < events; ++i)
+        {
+            bloom::Clock::sleepUntil(start + i * period);
+
+            cursorCallback(window, static_cast<double>(i % 640), static_cast<double>(i % 480));
+            latestSample.store(bloom::Clock::now(), std::memory_order_release);
+            ++result.cursorEvents;
+
+            if (i % kEventsPerTap == 0)
+            {
+                keyCallback(window, GLFW_KEY_SPACE, 0, GLFW_PRESS, 0);
+                keyCallback(window, GLFW_KEY_SPACE, 0, GLFW_RELEASE, 0);
+                ++result.tapsSent;
+            }
+        }
+
+        // Let the last events reach a tick before stopping.
+        bloom::Clock::sleepUntil(bloom::Clock::now() + bloom::Clock::fromSeconds(3.0 / tickRate));
+        stop.store(true, std::memory_order_release);
+        simulation.join();
+
+        result.queued = input->latency();
+        return result;
+    }
+}
+
+int main()
+{
+    glfwInitHint(GLFW_PLATFORM, GLFW_PLATFORM_NULL);
+    if (!glfwInit())
+        return EXIT_FAILURE;
+    bloom::Clock::init();
+
+    glfwWindowHint(GLFW_CLIENT_API, GLFW_NO_API);
+    glfwWindowHint(GLFW_VISIBLE, GLFW_FALSE);
+    GLFWwindow* window = glfwCreateWindow(640, 480, "Input latency", nullptr, nullptr);
+    if (!window)
+    {
+        glfwTerminate();
+        return EXIT_FAILURE;
+    }
+
+    std::printf("%.0f Hz cursor events for %.0f s, one tap every %d events\n", kEventRate, kSeconds, kEventsPerTap);
+    std::printf("%6s | %9s %9s %9s %9s %7s %9s | %9s %9s\n", "tick", "mean ms", "p50 ms", "p99 ms", "max ms",
+                "dropped", "taps", "poll ms", "skipped");
+
+    for (const double tickRate : {60.0, 120.0, 240.0, 1000.0})
+    {
+        const Result result = measure(window, tickRate);
+        char taps[32];
+        std::snprintf(taps, sizeof(taps), "%llu/%llu", static_cast<unsigned long long>(result.tapsSeen),
+                      static_cast<unsigned long long>(result.tapsSent));
+        std::printf("%4.0fHz | %9.3f %9.3f %9.3f %9.3f %7llu %9s | %9.3f %9llu\n", tickRate,
+                    result.queued.meanMs, result.queued.p50Ms, result.queued.p99Ms, result.queued.maxMs,
+                    static_cast<unsigned long long>(result.queued.dropped), taps, result.polledMeanMs,
+                    static_cast<unsigned long long>(result.cursorEvents - result.samplesSeen));
+    }
+
+    glfwDestroyWindow(window);
+    glfwTerminate();
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,219 @@
+// AsyncReader against blocking reads. Writes a scratch file, then for each
+// backend measures bulk throughput (cold and cached), the longest a
+// read() call held up the submitting thread, how long a High read waits
+// behind a queue of Low ones, and how quickly cancelAll() drains a queue.
+// On Linux the file is evicted from the page cache before each cold run.
+// Usage: bloom_bench_io [MiB]
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "GLFW/glfw3.h"
+
+#include "core/clock.hpp"
+#include "io/async_reader.hpp"
+
+#if !defined(_WIN32)
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+namespace
+{
+    constexpr uint64_t kRequestSize = 4u << 20;
+    constexpr uint64_t kSmallSize = 64u << 10;
+
+    void evict(const char* path)
+    {
+#if !defined(_WIN32)
+        const int fd = open(path, O_RDONLY);
+        if (fd >= 0)
+        {
+            posix_fadvise(fd, 0, 0, POSIX_FADV_DONTNEED);
+            close(fd);
+        }
+#else
+        (void)path;
+#endif
+    }
+
+    double gibPerSecond(uint64_t bytes, double ms)
+    {
+        return bytes / (1024.0 * 1024.0 * 1024.0) / (ms / 1000.0);
+    }
+
+    struct Tracker
+    {
+        std::atomic<uint64_t> bytes{0};
+        std::atomic<uint32_t> done{0};
+        std::atomic<uint64_t> finished{0};  // Clock value of the last callback
+
+        static void callback(const bloom::IoCompletion& completion)
+        {
+            auto* tracker = static_cast<Tracker*>(completion.user);
+            tracker->bytes.fetch_add(completion.size, std::memory_order_relaxed);
+            tracker->finished.store(bloom::Clock::now(), std::memory_order_relaxed);
+            tracker->done.fetch_add(1, std::memory_order_release);
+        }
+    };
+
+    struct Submission
+    {
+        double maxCallMs = 0.0;
+        uint32_t requests = 0;
+    };
+
+    Submission readWhole(bloom::AsyncReader& reader, const char* path, uint64_t fileSize, std::byte* destination,
+                         bloom::IoPriority priority, Tracker& tracker)
+    {
+        Submission submission;
+        for (uint64_t offset = 0; offset < fileSize; offset += kRequestSize)
+        {
+            bloom::IoRead read;
+            read.path = path;
+            read.offset = offset;
+            read.size = kRequestSize;
+            read.destination = destination + offset;
+            read.priority = priority;
+            read.callback = Tracker::callback;
+            read.user = &tracker;
+
+            const uint64_t start = bloom::Clock::now();
+            reader.read(read);
+            submission.maxCallMs = std::max(submission.maxCallMs, bloom::Clock::toMilliseconds(bloom::Clock::now() - start));
+            ++submission.requests;
+        }
+        return submission;
+    }
+
+    void bulk(bloom::AsyncReader& reader, const char* path, uint64_t fileSize, std::byte* destination, bool cold)
+    {
+        if (cold)
+            evict(path);
+
+        Tracker tracker;
+        const uint64_t start = bloom::Clock::now();
+        const Submission submission = readWhole(reader, path, fileSize, destination, bloom::IoPriority::Normal, tracker);
+        const double submitMs = bloom::Clock::toMilliseconds(bloom::Clock::now() - start);
+        reader.waitIdle();
+        const double ms = bloom::Clock::toMilliseconds(bloom::Clock::now() - start);
+
+        std::printf("  %-22s %9.1f ms %7.2f GiB/s   submit %.3f ms total, worst call %.1f us\n", cold ? "bulk, cold" : "bulk, cached", ms,
+                    gibPerSecond(tracker.bytes.load(), ms), submitMs, submission.maxCallMs * 1000.0);
+    }
+
+    void priority(bloom::AsyncReader& reader, const char* path, uint64_t fileSize, std::byte* destination, bloom::IoPriority urgent)
+    {
+        evict(path);
+
+        Tracker backlog;
+        Tracker small;
+        std::vector<std::byte> smallBuffer(kSmallSize);
+
+        const uint64_t start = bloom::Clock::now();
+        readWhole(reader, path, fileSize, destination, bloom::IoPriority::Low, backlog);
+
+        bloom::IoRead read;
+        read.path = path;
+        read.offset = fileSize - kSmallSize;
+        read.size = kSmallSize;
+        read.destination = smallBuffer.data();
+        read.priority = urgent;
+        read.callback = Tracker::callback;
+        read.user = &small;
+        const uint64_t issued = bloom::Clock::now();
+        reader.read(read);
+        reader.waitIdle();
+
+        std::printf("  %-22s %9.2f ms latency behind %.1f ms of Low reads\n",
+                    urgent == bloom::IoPriority::High ? "High read" : "Low read (FIFO)",
+                    bloom::Clock::toMilliseconds(small.finished.load() - issued),
+                    bloom::Clock::toMilliseconds(backlog.finished.load() - start));
+    }
+
+    void cancellation(bloom::AsyncReader& reader, const char* path, uint64_t fileSize, std::byte* destination)
+    {
+        evict(path);
+
+        Tracker tracker;
+        readWhole(reader, path, fileSize, destination, bloom::IoPriority::Normal, tracker);
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+
+        const uint64_t start = bloom::Clock::now();
+        reader.cancelAll();
+        reader.waitIdle();
+        const double ms = bloom::Clock::toMilliseconds(bloom::Clock::now() - start);
+        std::printf("  %-22s %9.2f ms to drain, %.1f of %.1f MiB read\n", "cancelAll", ms, tracker.bytes.load() / (1024.0 * 1024.0),
+                    fileSize / (1024.0 * 1024.0));
+    }
+
+    double blockingRead(const char* path, uint64_t fileSize, std::byte* destination)
+    {
+        evict(path);
+
+        const uint64_t start = bloom::Clock::now();
+        std::FILE* file = std::fopen(path, "rb");
+        const std::size_t read = std::fread(destination, 1, fileSize, file);
+        std::fclose(file);
+        const double ms = bloom::Clock::toMilliseconds(bloom::Clock::now() - start);
+        return read == fileSize ? ms : 0.0;
+    }
+}
+
+int main(int argc, char** argv)
+{
+    glfwInitHint(GLFW_PLATFORM, GLFW_PLATFORM_NULL);
+    if (!glfwInit())
+        return EXIT_FAILURE;
+    bloom::Clock::init();
+
+    const uint64_t fileSize = (argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 512) << 20;
+    const std::string path = (std::filesystem::temp_directory_path() / "bloom_io_bench.bin").string();
+
+    auto destination = std::make_unique<std::byte[]>(fileSize);
+    {
+        for (uint64_t i = 0; i < fileSize; i += 4096)
+            destination[i] = static_cast<std::byte>(i >> 12);
+        std::FILE* file = std::fopen(path.c_str(), "wb");
+        if (!file || std::fwrite(destination.get(), 1, fileSize, file) != fileSize)
+            return EXIT_FAILURE;
+        std::fclose(file);
+    }
+
+    const double blockingMs = blockingRead(path.c_str(), fileSize, destination.get());
+    std::printf("%.0f MiB file, %llu KiB requests\n", fileSize / (1024.0 * 1024.0), static_cast<unsigned long long>(kRequestSize >> 10));
+    std::printf("blocking fread, cold       %9.1f ms %7.2f GiB/s   (the calling thread is stalled throughout)\n", blockingMs,
+                gibPerSecond(fileSize, blockingMs));
+
+    for (const bloom::IoBackendKind kind : {bloom::IoBackendKind::Uring, bloom::IoBackendKind::Threads})
+    {
+        bloom::AsyncReader reader(kind);
+        if (kind == bloom::IoBackendKind::Uring && std::string(reader.backendName()) != "io_uring")
+            continue;
+
+        std::printf("%s\n", reader.backendName());
+        bulk(reader, path.c_str(), fileSize, destination.get(), true);
+        bulk(reader, path.c_str(), fileSize, destination.get(), false);
+        priority(reader, path.c_str(), fileSize, destination.get(), bloom::IoPriority::High);
+        priority(reader, path.c_str(), fileSize, destination.get(), bloom::IoPriority::Low);
+        cancellation(reader, path.c_str(), fileSize, destination.get());
+
+        const bloom::AsyncReader::Stats stats = reader.stats();
+        std::printf("  %llu requests, %llu done, %llu cancelled, %llu failed, %llu chunks\n",
+                    static_cast<unsigned long long>(stats.requests), static_cast<unsigned long long>(stats.completed),
+                    static_cast<unsigned long long>(stats.cancelled), static_cast<unsigned long long>(stats.failed),
+                    static_cast<unsigned long long>(stats.chunks));
+    }
+
+    std::filesystem::remove(path);
+    glfwTerminate();
+    return EXIT_SUCCESS;
+}
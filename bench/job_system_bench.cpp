@@ -0,0 +1,88 @@
+// Job system throughput: pushes a fixed batch of small jobs through the
+// scheduler for every thread count from 1 to the hardware concurrency and
+// reports jobs per second and scaling relative to a single thread.
+
+#include <cstdio>
+#include <cstdlib>
+#include <thread>
+
+#include "GLFW/glfw3.h"
+
+#include "core/clock.hpp"
+#include "jobs/job_system.hpp"
+
+namespace
+{
+    constexpr uint32_t kJobCount = 1u << 20;
+    constexpr int kWorkPerJob = 256;
+    constexpr int kRepeats = 3;
+
+    uint32_t spin(uint32_t seed)
+    {
+        for (int i = 0; i < kWorkPerJob; ++i)
+            seed = seed * 1664525u + 1013904223u;
+        return seed;
+    }
+
+    double measure(unsigned threads)
+    {
+        // The submitting thread is one of the threads, so the single-thread
+        // baseline has no workers at all.
+        bloom::JobSystem jobs(threads - 1);
+        jobs.registerThread();
+
+        std::atomic<uint32_t> sink{0};
+        double best = 0.0;
+
+        for (int repeat = 0; repeat < kRepeats; ++repeat)
+        {
+            const uint64_t start = bloom::Clock::now();
+
+            // Fan out from the submitting thread in batches that fit its
+            // deque, which is the pattern engine systems use.
+            bloom::JobCounter counter;
+            for (uint32_t i = 0; i < kJobCount; ++i)
+            {
+                jobs.run([&sink, i]()
+                {
+                    sink.fetch_add(spin(i) & 1u, std::memory_order_relaxed);
+                }, &counter);
+
+                if ((i & (bloom::JobSystem::kDequeCapacity / 2 - 1)) == 0)
+                    jobs.helpOnce();
+            }
+            jobs.wait(counter);
+
+            const double seconds = bloom::Clock::toSeconds(bloom::Clock::now() - start);
+            best = std::max(best, kJobCount / seconds);
+        }
+
+        return best;
+    }
+}
+
+int main(int argc, char** argv)
+{
+    glfwInitHint(GLFW_PLATFORM, GLFW_PLATFORM_NULL);
+    if (!glfwInit())
+        return EXIT_FAILURE;
+    bloom::Clock::init();
+
+    unsigned maxThreads = std::max(1u, std::thread::hardware_concurrency());
+    if (argc > 1)
+        maxThreads = static_cast<unsigned>(std::max(1, std::atoi(argv[1])));
+
+    std::printf("%8s %16s %10s\n", "threads", "jobs/sec", "scaling");
+
+    double baseline = 0.0;
+    for (unsigned threads = 1; threads <= maxThreads; ++threads)
+    {
+        const double rate = measure(threads);
+        if (threads == 1)
+            baseline = rate;
+        std::printf("%8u %16.0f %9.2fx\n", threads, rate, rate / baseline);
+    }
+
+    glfwTerminate();
+    return EXIT_SUCCESS;
+}
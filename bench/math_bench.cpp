@@ -0,0 +1,168 @@
+// Math core against GLFW's linmath.h: 1M each of matrix multiply,
+// matrix * vec4 and general inverse, plus the SoA point batch against a
+// linmath loop. Operands cycle through a small pool so the numbers show
+// arithmetic cost rather than memory bandwidth. Build with
+// -DBLOOM_ENABLE_AVX2=ON to compare the AVX2 path.
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <vector>
+
+#include "GLFW/glfw3.h"
+#include "linmath.h"
+
+#include "core/clock.hpp"
+#include "math/batch.hpp"
+
+namespace
+{
+    constexpr uint32_t kOps = 1u << 20;
+    constexpr uint32_t kPool = 1024;
+    constexpr int kRepeats = 5;
+
+    struct Pools
+    {
+        std::vector<bloom::Mat4> a;
+        std::vector<bloom::Mat4> b;
+        std::vector<bloom::Mat4> out;
+        std::vector<bloom::Vec4> v;
+        std::vector<bloom::Vec4> vOut;
+    };
+
+    template <typename F>
+    double best(F&& body)
+    {
+        double fastest = 1e30;
+        for (int repeat = 0; repeat < kRepeats; ++repeat)
+        {
+            const uint64_t start = bloom::Clock::now();
+            body();
+            fastest = std::min(fastest, bloom::Clock::toMilliseconds(bloom::Clock::now() - start));
+        }
+        return fastest;
+    }
+
+    // linmath takes float[4][4]; Mat4 has the same column-major layout.
+    vec4* lm(bloom::Mat4& m) { return reinterpret_cast<vec4*>(m.data()); }
+
+    float checksum(const std::vector<bloom::Mat4>& matrices)
+    {
+        float sum = 0.f;
+        for (const bloom::Mat4& m : matrices)
+            sum += m.cols[0].x + m.cols[3].w;
+        return sum;
+    }
+
+    void report(const char* name, double linmath, double bloomMs)
+    {
+        std::printf("%-18s %12.3f %12.3f %9.2fx\n", name, linmath, bloomMs, linmath / bloomMs);
+    }
+}
+
+int main()
+{
+    glfwInitHint(GLFW_PLATFORM, GLFW_PLATFORM_NULL);
+    if (!glfwInit())
+        return EXIT_FAILURE;
+    bloom::Clock::init();
+
+    std::mt19937 rng(42);
+    std::uniform_real_distribution<float> value(-1.f, 1.f);
+
+    Pools pools;
+    pools.a.resize(kPool);
+    pools.b.resize(kPool);
+    pools.out.resize(kPool);
+    pools.v.resize(kPool);
+    pools.vOut.resize(kPool);
+    for (uint32_t i = 0; i < kPool; ++i)
+    {
+        // Well-conditioned TRS matrices, so the inverse is meaningful.
+        const bloom::Quat q = bloom::normalize(bloom::Quat(value(rng), value(rng), value(rng), value(rng)));
+        pools.a[i] = bloom::Mat4::trs({value(rng), value(rng), value(rng)}, q, bloom::Vec3(1.5f + value(rng)));
+        pools.a[i].cols[0].w = 0.1f * value(rng);   // keep the general inverse honest
+        pools.b[i] = bloom::Mat4::trs({value(rng), value(rng), value(rng)}, q, bloom::Vec3(1.f));
+        pools.v[i] = {value(rng), value(rng), value(rng), 1.f};
+    }
+
+    float sink = 0.f;
+    std::printf("%u ops, %s\n", kOps, bloom::simd::kInstructionSet);
+    std::printf("%-18s %12s %12s %10s\n", "", "linmath ms", "bloom ms", "speedup");
+
+    const double linMul = best([&]()
+    {
+        for (uint32_t i = 0; i < kOps; ++i)
+            mat4x4_mul(lm(pools.out[i & (kPool - 1)]), lm(pools.a[i & (kPool - 1)]), lm(pools.b[(i * 7) & (kPool - 1)]));
+    });
+    sink += checksum(pools.out);
+    const double bloomMul = best([&]()
+    {
+        for (uint32_t i = 0; i < kOps; ++i)
+            pools.out[i & (kPool - 1)] = pools.a[i & (kPool - 1)] * pools.b[(i * 7) & (kPool - 1)];
+    });
+    sink += checksum(pools.out);
+    report("mat4x4_mul", linMul, bloomMul);
+
+    const double linVec = best([&]()
+    {
+        for (uint32_t i = 0; i < kOps; ++i)
+            mat4x4_mul_vec4(pools.vOut[i & (kPool - 1)].data(), lm(pools.a[(i >> 10) & (kPool - 1)]), pools.v[i & (kPool - 1)].data());
+    });
+    sink += pools.vOut[5].x;
+    const double bloomVec = best([&]()
+    {
+        for (uint32_t i = 0; i < kOps; ++i)
+            pools.vOut[i & (kPool - 1)] = pools.a[(i >> 10) & (kPool - 1)] * pools.v[i & (kPool - 1)];
+    });
+    sink += pools.vOut[5].x;
+    report("mat4x4_mul_vec4", linVec, bloomVec);
+
+    const double linInv = best([&]()
+    {
+        for (uint32_t i = 0; i < kOps; ++i)
+            mat4x4_invert(lm(pools.out[i & (kPool - 1)]), lm(pools.a[(i * 3) & (kPool - 1)]));
+    });
+    sink += checksum(pools.out);
+    const double bloomInv = best([&]()
+    {
+        for (uint32_t i = 0; i < kOps; ++i)
+            pools.out[i & (kPool - 1)] = bloom::inverse(pools.a[(i * 3) & (kPool - 1)]);
+    });
+    sink += checksum(pools.out);
+    report("mat4x4_invert", linInv, bloomInv);
+
+    // SoA batch: 1M points through one matrix.
+    std::vector<float> x(kOps), y(kOps), z(kOps), ox(kOps), oy(kOps), oz(kOps);
+    for (uint32_t i = 0; i < kOps; ++i)
+    {
+        x[i] = value(rng);
+        y[i] = value(rng);
+        z[i] = value(rng);
+    }
+
+    const double linPoints = best([&]()
+    {
+        for (uint32_t i = 0; i < kOps; ++i)
+        {
+            vec4 p = {x[i], y[i], z[i], 1.f};
+            vec4 r;
+            mat4x4_mul_vec4(r, lm(pools.a[0]), p);
+            ox[i] = r[0];
+            oy[i] = r[1];
+            oz[i] = r[2];
+        }
+    });
+    sink += ox[17];
+    const double bloomPoints = best([&]()
+    {
+        bloom::transformPoints(pools.a[0], x.data(), y.data(), z.data(), ox.data(), oy.data(), oz.data(), kOps);
+    });
+    sink += ox[17];
+    report("points (SoA)", linPoints, bloomPoints);
+
+    std::printf("checksum %g\n", static_cast<double>(sink));
+    glfwTerminate();
+    return EXIT_SUCCESS;
+}
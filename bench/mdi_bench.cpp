@@ -0,0 +1,284 @@
+// MeshBatchRenderer against one draw call per object. The scene is N
+// instances of 64 sphere meshes of different tessellation in 8 materials.
+// The per-object path gives every mesh its own buffers and vertex array
+// and records one DrawCommand per instance, sorted by material and mesh
+// so the backend changes state as little as it can. The batched path
+// submits the same instances and issues one glMultiDrawElementsIndirect
+// per material. Both use the same program and per-instance storage
+// buffer, so the difference is the draw submission alone. Reports the
+// CPU time to record and execute a frame, the time until glFinish returns
+// and the GL draw calls per frame. Needs OSMesa.
+// Usage: bloom_bench_mdi [instances]
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <numbers>
+#include <vector>
+
+#include "glad/glad.h"
+#include "GLFW/glfw3.h"
+
+#include "core/clock.hpp"
+#include "render/asset_upload.hpp"
+#include "render/gl_backend.hpp"
+#include "render/mesh_batch.hpp"
+#include "render/render_queue.hpp"
+#include "render/sort_key.hpp"
+
+namespace
+{
+    constexpr uint32_t kMeshCount = 64;
+    constexpr uint32_t kMaterialCount = 8;
+    constexpr int kFrames = 30;
+    constexpr uint32_t kPass = 1;
+
+    struct Vertex
+    {
+        float position[3];
+        float normal[3];
+    };
+
+    struct Sphere
+    {
+        std::vector<Vertex> vertices;
+        std::vector<uint32_t> indices;
+    };
+
+    Sphere makeSphere(int rings, int segments)
+    {
+        Sphere sphere;
+        for (int ring = 0; ring <= rings; ++ring)
+        {
+            const float theta = std::numbers::pi_v<float> * static_cast<float>(ring) / static_cast<float>(rings);
+            for (int segment = 0; segment <= segments; ++segment)
+            {
+                const float phi = 2.f * std::numbers::pi_v<float> * static_cast<float>(segment) / static_cast<float>(segments);
+                const float x = std::sin(theta) * std::cos(phi);
+                const float y = std::cos(theta);
+                const float z = std::sin(theta) * std::sin(phi);
+                sphere.vertices.push_back({{x * 0.4f, y * 0.4f, z * 0.4f}, {x, y, z}});
+            }
+        }
+        for (int ring = 0; ring < rings; ++ring)
+        {
+            for (int segment = 0; segment < segments; ++segment)
+            {
+                const auto a = static_cast<uint32_t>(ring * (segments + 1) + segment);
+                const auto b = a + static_cast<uint32_t>(segments + 1);
+                sphere.indices.insert(sphere.indices.end(), {a, b, a + 1, a + 1, b, b + 1});
+            }
+        }
+        return sphere;
+    }
+
+    bloom::MeshInfo vertexLayout()
+    {
+        bloom::MeshInfo layout{};
+        layout.vertexStride = sizeof(Vertex);
+        layout.indexType = GL_UNSIGNED_INT;
+        layout.attributeCount = 2;
+        layout.attributes[0] = {0, 3, GL_FLOAT, 0, 0, 0};
+        layout.attributes[1] = {1, 3, GL_FLOAT, 0, 0, 12};
+        return layout;
+    }
+
+    struct Object
+    {
+        uint32_t mesh;
+        uint32_t material;
+        bloom::MeshInstance instance;
+    };
+
+    std::vector<Object> makeScene(uint32_t count)
+    {
+        std::vector<Object> objects(count);
+        const auto side = static_cast<uint32_t>(std::ceil(std::sqrt(static_cast<double>(count))));
+        for (uint32_t i = 0; i < count; ++i)
+        {
+            Object& object = objects[i];
+            object.mesh = (i * 2654435761u >> 8) % kMeshCount;
+            object.material = (i * 40503u >> 4) % kMaterialCount;
+            const float x = (static_cast<float>(i % side) / static_cast<float>(side) - 0.5f) * 2.f;
+            const float z = (static_cast<float>(i / side) / static_cast<float>(side) - 0.5f) * 2.f;
+            object.instance.transform = bloom::Mat4::trs({x, 0.f, z}, {}, bloom::Vec3{1.f, 1.f, 1.f} * (1.6f / static_cast<float>(side)));
+            object.instance.params[0] = 0.3f + 0.1f * static_cast<float>(object.material % 4);
+            object.instance.params[1] = 0.4f + 0.07f * static_cast<float>(object.material);
+            object.instance.params[2] = 0.9f - 0.1f * static_cast<float>(object.material % 5);
+        }
+        return objects;
+    }
+
+    struct FrameTimes
+    {
+        double cpuMs = 0.0;
+        double gpuMs = 0.0;
+        uint32_t drawCalls = 0;
+    };
+
+    double median(std::vector<double> values)
+    {
+        std::sort(values.begin(), values.end());
+        return values[values.size() / 2];
+    }
+
+    template <typename Record, typename Finish>
+    FrameTimes measure(bloom::GLBackend& backend, bloom::RenderQueue& queue, Record&& record, Finish&& finish)
+    {
+        std::vector<double> cpu;
+        std::vector<double> total;
+        for (int frame = 0; frame < kFrames; ++frame)
+        {
+            const uint64_t start = bloom::Clock::now();
+            queue.reset();
+            bloom::ClearCommand clear;
+            queue.acquireBucket().record(bloom::SortKey::encode(kPass, 0, 0, 0), clear);
+            record(queue.acquireBucket());
+            queue.sort();
+            backend.execute(queue);
+            finish();
+            const uint64_t recorded = bloom::Clock::now();
+            glFinish();
+            const uint64_t finished = bloom::Clock::now();
+            cpu.push_back(bloom::Clock::toMilliseconds(recorded - start));
+            total.push_back(bloom::Clock::toMilliseconds(finished - start));
+        }
+        return {median(cpu), median(total), backend.stats().draws};
+    }
+}
+
+int main(int argc, char** argv)
+{
+    glfwInitHint(GLFW_PLATFORM, GLFW_PLATFORM_NULL);
+    if (!glfwInit())
+        return EXIT_FAILURE;
+    bloom::Clock::init();
+
+    const auto count = static_cast<uint32_t>(argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 50000);
+
+    glfwWindowHint(GLFW_CONTEXT_CREATION_API, GLFW_OSMESA_CONTEXT_API);
+    glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 4);
+    glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 5);
+    glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+    glfwWindowHint(GLFW_VISIBLE, GLFW_FALSE);
+    GLFWwindow* window = glfwCreateWindow(256, 256, "mdi", nullptr, nullptr);
+    if (!window)
+    {
+        std::fprintf(stderr, "No GL 4.5 context (is OSMesa installed?)\n");
+        glfwTerminate();
+        return EXIT_FAILURE;
+    }
+    glfwMakeContextCurrent(window);
+    if (!gladLoadGLLoaderVersion(reinterpret_cast<GLADloadproc>(glfwGetProcAddress), 4, 5))
+        return EXIT_FAILURE;
+
+    const bloom::MeshInfo layout = vertexLayout();
+    bloom::MeshBatchRenderer::Capacity capacity;
+    capacity.instancesPerFrame = count;
+    bloom::MeshBatchRenderer batch;
+    if (!batch.init(layout, capacity))
+        return EXIT_FAILURE;
+
+    // The same meshes twice: packed into the batch, and one set of buffers
+    // each for the per-object path.
+    std::vector<bloom::GpuMesh> meshes(kMeshCount);
+    uint32_t triangles = 0;
+    for (uint32_t i = 0; i < kMeshCount; ++i)
+    {
+        const Sphere sphere = makeSphere(4 + static_cast<int>(i % 8) * 2, 6 + static_cast<int>(i / 8) * 2);
+        batch.addMesh(sphere.vertices.data(), static_cast<uint32_t>(sphere.vertices.size()), sphere.indices.data(),
+                      static_cast<uint32_t>(sphere.indices.size()));
+        triangles += static_cast<uint32_t>(sphere.indices.size() / 3);
+
+        bloom::MeshInfo info = layout;
+        info.vertexCount = static_cast<uint32_t>(sphere.vertices.size());
+        info.indexCount = static_cast<uint32_t>(sphere.indices.size());
+        info.vertexSize = sphere.vertices.size() * sizeof(Vertex);
+        info.indexSize = sphere.indices.size() * sizeof(uint32_t);
+        meshes[i] = bloom::uploadMesh({&info, reinterpret_cast<const std::byte*>(sphere.vertices.data()),
+                                       reinterpret_cast<const std::byte*>(sphere.indices.data())});
+    }
+
+    bloom::BatchMaterial material;
+    material.program = batch.defaultProgram();
+    material.state.depthTest = true;
+    for (uint32_t i = 0; i < kMaterialCount; ++i)
+        batch.addMaterial(material);
+    batch.setCamera(bloom::Mat4::perspective(1.f, 1.f, 0.1f, 10.f) *
+                    bloom::Mat4::lookAt({0.f, 1.5f, 1.5f}, {0.f, 0.f, 0.f}, {0.f, 1.f, 0.f}));
+
+    const std::vector<Object> objects = makeScene(count);
+
+    // Per-object path: the instances in a plain storage buffer, and an
+    // identity buffer behind the instance attribute so baseInstance picks
+    // the slot.
+    GLuint instanceBuffer = 0;
+    glCreateBuffers(1, &instanceBuffer);
+    glNamedBufferStorage(instanceBuffer, static_cast<GLsizeiptr>(count * sizeof(bloom::MeshInstance)), nullptr, GL_DYNAMIC_STORAGE_BIT);
+    std::vector<uint32_t> identity(count);
+    for (uint32_t i = 0; i < count; ++i)
+        identity[i] = i;
+    GLuint identityBuffer = 0;
+    glCreateBuffers(1, &identityBuffer);
+    glNamedBufferStorage(identityBuffer, static_cast<GLsizeiptr>(count * sizeof(uint32_t)), identity.data(), 0);
+    for (bloom::GpuMesh& mesh : meshes)
+    {
+        glVertexArrayVertexBuffer(mesh.vertexArray, 1, identityBuffer, 0, sizeof(uint32_t));
+        glVertexArrayBindingDivisor(mesh.vertexArray, 1, 1);
+        glVertexArrayAttribIFormat(mesh.vertexArray, bloom::MeshBatchRenderer::kInstanceAttribute, 1, GL_UNSIGNED_INT, 0);
+        glVertexArrayAttribBinding(mesh.vertexArray, bloom::MeshBatchRenderer::kInstanceAttribute, 1);
+        glEnableVertexArrayAttrib(mesh.vertexArray, bloom::MeshBatchRenderer::kInstanceAttribute);
+    }
+    std::vector<bloom::MeshInstance> staging(count);
+
+    bloom::RenderQueue queue;
+    bloom::GLBackend backend;
+    backend.setPass(kPass, bloom::PassDesc{0, {0, 0, 256, 256}});
+
+    const FrameTimes perObject = measure(backend, queue, [&](bloom::CommandBuffer& bucket)
+    {
+        for (uint32_t i = 0; i < count; ++i)
+            staging[i] = objects[i].instance;
+        glNamedBufferSubData(instanceBuffer, 0, static_cast<GLsizeiptr>(count * sizeof(bloom::MeshInstance)), staging.data());
+
+        for (uint32_t i = 0; i < count; ++i)
+        {
+            const Object& object = objects[i];
+            const bloom::GpuMesh& mesh = meshes[object.mesh];
+            bloom::DrawCommand draw;
+            draw.program = material.program;
+            draw.vertexArray = mesh.vertexArray;
+            draw.indexType = GL_UNSIGNED_INT;
+            draw.count = mesh.indexCount;
+            draw.baseInstance = i;
+            draw.state = material.state;
+            draw.storageBuffers[bloom::MeshBatchRenderer::kInstanceBinding].buffer = instanceBuffer;
+            bucket.record(bloom::SortKey::encode(kPass, 0, object.material, object.mesh), draw);
+        }
+    }, [] {});
+
+    const FrameTimes batched = measure(backend, queue, [&](bloom::CommandBuffer& bucket)
+    {
+        batch.beginFrame();
+        for (const Object& object : objects)
+            batch.submit(object.mesh, object.material, object.instance);
+        batch.record(bucket, kPass);
+    }, [&] { batch.endFrame(); });
+
+    std::printf("%u instances of %u meshes (%u triangles) in %u materials, median of %d frames\n", count, kMeshCount, triangles,
+                kMaterialCount, kFrames);
+    std::printf("%-22s %10s %12s %12s\n", "", "cpu ms", "finished ms", "draw calls");
+    std::printf("%-22s %10.2f %12.2f %12u\n", "one draw per object", perObject.cpuMs, perObject.gpuMs, perObject.drawCalls);
+    std::printf("%-22s %10.2f %12.2f %12u   (%u indirect sub-draws)\n", "multi-draw indirect", batched.cpuMs, batched.gpuMs,
+                batched.drawCalls, batch.stats().commands);
+
+    glDeleteBuffers(1, &instanceBuffer);
+    glDeleteBuffers(1, &identityBuffer);
+    for (bloom::GpuMesh& mesh : meshes)
+        bloom::releaseMesh(backend.state(), mesh);
+    batch.release(&backend.state());
+    glfwDestroyWindow(window);
+    glfwTerminate();
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,428 @@
+// Compute-shader particles (GpuParticleSystem) against a CPU path modelled
+// on particle_engine() in GLFW's particles.c: an array of structs walked
+// once per step by one thread, each live particle aged, pulled by gravity,
+// moved and bounced off the ground, then copied out for drawing. The CPU
+// path spawns through the same ring cursor and hash as the kernels (not
+// particles.c's linear search for a free slot) and bounces off the same
+// height field, so both sides do the same work per particle.
+//
+// Both run to steady state (one lifetime of 60 Hz steps), then time the
+// same number of steps; the GPU side is timed with GL_TIME_ELAPSED. With
+// --verify the GPU pool is read back and checked against the CPU run: the
+// indirect instance count must equal the live particles, nothing may be
+// below the ground or non-finite, and the population and mean height must
+// agree. The GPU side needs OSMesa (llvmpipe is enough); --verify fails
+// without it.
+// Usage: bloom_bench_particles [--verify] [count ...]
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <span>
+#include <vector>
+
+#include "glad/glad.h"
+#include "GLFW/glfw3.h"
+
+#include "core/clock.hpp"
+#include "render/gl_backend.hpp"
+#include "render/gpu_particles.hpp"
+#include "render/particle_renderer.hpp"
+#include "render/render_queue.hpp"
+#include "render/sort_key.hpp"
+
+namespace
+{
+    constexpr float kStep = 1.f / 60.f;
+    constexpr int kTimedSteps = 60;
+    constexpr int kFieldSize = 128;
+    constexpr bloom::HeightFieldRect kFieldRect{-2.f, -2.f, 4.f, 4.f};
+
+    bloom::EmitterParams makeEmitter(uint32_t capacity)
+    {
+        bloom::EmitterParams emitter;
+        emitter.position = {0.f, 0.3f, 0.f};
+        emitter.velocity = {0.f, 3.5f, 0.f};
+        emitter.spread = 1.5f;
+        emitter.lifetime = 2.f;
+        // Leaves headroom, so no live particle is ever recycled.
+        emitter.rate = 0.9f * static_cast<float>(capacity) / emitter.lifetime;
+        return emitter;
+    }
+
+    std::vector<float> makeHeightField()
+    {
+        std::vector<float> heights(kFieldSize * kFieldSize);
+        for (int z = 0; z < kFieldSize; ++z)
+        {
+            for (int x = 0; x < kFieldSize; ++x)
+            {
+                const float wx = kFieldRect.x + (static_cast<float>(x) + 0.5f) * kFieldRect.width / kFieldSize;
+                const float wz = kFieldRect.z + (static_cast<float>(z) + 0.5f) * kFieldRect.depth / kFieldSize;
+                heights[z * kFieldSize + x] = 0.15f * std::sin(3.f * wx) * std::cos(3.f * wz) - 0.2f;
+            }
+        }
+        return heights;
+    }
+
+    // Bilinear with clamp-to-edge, the way GL_LINEAR samples the texture.
+    float sampleHeight(std::span<const float> heights, float x, float z)
+    {
+        const float u = (x - kFieldRect.x) / kFieldRect.width * kFieldSize - 0.5f;
+        const float v = (z - kFieldRect.z) / kFieldRect.depth * kFieldSize - 0.5f;
+        const float fu = std::floor(u);
+        const float fv = std::floor(v);
+        const float tu = u - fu;
+        const float tv = v - fv;
+        auto at = [&](int ix, int iz)
+        {
+            ix = std::clamp(ix, 0, kFieldSize - 1);
+            iz = std::clamp(iz, 0, kFieldSize - 1);
+            return heights[iz * kFieldSize + ix];
+        };
+        const int ix = static_cast<int>(fu);
+        const int iz = static_cast<int>(fv);
+        const float top = at(ix, iz) + (at(ix + 1, iz) - at(ix, iz)) * tu;
+        const float bottom = at(ix, iz + 1) + (at(ix + 1, iz + 1) - at(ix, iz + 1)) * tu;
+        return top + (bottom - top) * tv;
+    }
+
+    uint32_t hash(uint32_t x)
+    {
+        x ^= x >> 16;
+        x *= 0x7feb352du;
+        x ^= x >> 15;
+        x *= 0x846ca68bu;
+        return x ^ (x >> 16);
+    }
+
+    float random(uint32_t& rng)
+    {
+        rng = hash(rng);
+        return static_cast<float>(rng >> 8) * (1.f / 16777216.f);
+    }
+
+    uint32_t packColor(uint32_t rgba, float alpha)
+    {
+        const auto a = static_cast<uint32_t>(static_cast<float>(rgba >> 24) * std::clamp(alpha, 0.f, 1.f) + 0.5f);
+        return (rgba & 0x00ffffffu) | a << 24;
+    }
+
+    // Same layout as the GPU pool, so both can be summarised alike.
+    struct Particle
+    {
+        float x, y, z, life;
+        float vx, vy, vz, size;
+    };
+
+    class CpuParticles
+    {
+    public:
+        CpuParticles(uint32_t capacity, const bloom::EmitterParams& emitter, std::span<const float> heights)
+            : m_particles(capacity)
+            , m_instances(capacity)
+            , m_emitter(emitter)
+            , m_heights(heights)
+        {
+        }
+
+        void step(float dt)
+        {
+            const auto capacity = static_cast<uint32_t>(m_particles.size());
+            const float due = m_carry + dt * m_emitter.rate;
+            const auto emitCount = static_cast<uint32_t>(std::min(std::floor(due), static_cast<float>(capacity)));
+            m_carry = emitCount == capacity ? 0.f : due - static_cast<float>(emitCount);
+            const uint32_t emitStart = m_cursor;
+            m_cursor = (m_cursor + emitCount) % capacity;
+            ++m_seed;
+
+            const bloom::EmitterParams& e = m_emitter;
+            m_instanceCount = 0;
+            for (uint32_t i = 0; i < capacity; ++i)
+            {
+                Particle& p = m_particles[i];
+                if ((i + capacity - emitStart) % capacity < emitCount)
+                {
+                    uint32_t rng = hash(i ^ hash(m_seed));
+                    const float z = random(rng) * 2.f - 1.f;
+                    const float phi = random(rng) * 6.2831853f;
+                    const float r = std::sqrt(1.f - z * z);
+                    const float speed = e.spread * random(rng);
+                    p.vx = e.velocity.x + r * std::cos(phi) * speed;
+                    p.vy = e.velocity.y + r * std::sin(phi) * speed;
+                    p.vz = e.velocity.z + z * speed;
+                    const float age = dt * random(rng);
+                    p.x = e.position.x + p.vx * age;
+                    p.y = e.position.y + p.vy * age;
+                    p.z = e.position.z + p.vz * age;
+                    p.life = e.lifetime - age;
+                    p.size = e.size;
+                }
+                else if (p.life > 0.f)
+                {
+                    p.vx += e.gravity.x * dt;
+                    p.vy += e.gravity.y * dt;
+                    p.vz += e.gravity.z * dt;
+                    p.x += p.vx * dt;
+                    p.y += p.vy * dt;
+                    p.z += p.vz * dt;
+                    p.life -= dt;
+                    bounce(p);
+                }
+                else
+                    continue;
+
+                if (p.life > 0.f)
+                    m_instances[m_instanceCount++] = {{p.x, p.y, p.z}, p.size, packColor(e.color, p.life / e.lifetime)};
+            }
+        }
+
+        std::span<const Particle> particles() const { return m_particles; }
+        uint32_t instanceCount() const { return m_instanceCount; }
+
+    private:
+        void bounce(Particle& p) const
+        {
+            const float ground = sampleHeight(m_heights, p.x, p.z);
+            if (p.y >= ground)
+                return;
+
+            const float tx = kFieldRect.width / kFieldSize;
+            const float tz = kFieldRect.depth / kFieldSize;
+            const float sx = (sampleHeight(m_heights, p.x + tx, p.z) - sampleHeight(m_heights, p.x - tx, p.z)) / (2.f * tx);
+            const float sz = (sampleHeight(m_heights, p.x, p.z + tz) - sampleHeight(m_heights, p.x, p.z - tz)) / (2.f * tz);
+            const float length = std::sqrt(sx * sx + 1.f + sz * sz);
+            const float nx = -sx / length;
+            const float ny = 1.f / length;
+            const float nz = -sz / length;
+
+            p.y = ground;
+            const float into = p.vx * nx + p.vy * ny + p.vz * nz;
+            if (into < 0.f)
+            {
+                const float keep = 1.f - m_emitter.friction;
+                const float normal = -into * m_emitter.restitution;
+                p.vx = (p.vx - into * nx) * keep + normal * nx;
+                p.vy = (p.vy - into * ny) * keep + normal * ny;
+                p.vz = (p.vz - into * nz) * keep + normal * nz;
+            }
+        }
+
+        std::vector<Particle> m_particles;
+        std::vector<bloom::ParticleInstance> m_instances;
+        bloom::EmitterParams m_emitter;
+        std::span<const float> m_heights;
+        uint32_t m_instanceCount = 0;
+        uint32_t m_cursor = 0;
+        uint32_t m_seed = 0;
+        float m_carry = 0.f;
+    };
+
+    struct Summary
+    {
+        uint32_t alive = 0;
+        uint32_t belowGround = 0;
+        uint32_t nonFinite = 0;
+        double meanHeight = 0.0;
+    };
+
+    Summary summarize(std::span<const Particle> particles, std::span<const float> heights)
+    {
+        Summary summary;
+        for (const Particle& p : particles)
+        {
+            if (!(p.life > 0.f))
+                continue;
+            ++summary.alive;
+            if (!std::isfinite(p.x) || !std::isfinite(p.y) || !std::isfinite(p.z) || !std::isfinite(p.vx + p.vy + p.vz))
+                ++summary.nonFinite;
+            else if (p.y < sampleHeight(heights, p.x, p.z) - 0.01f)
+                ++summary.belowGround;
+            summary.meanHeight += p.y;
+        }
+        if (summary.alive)
+            summary.meanHeight /= summary.alive;
+        return summary;
+    }
+
+    int warmupSteps(const bloom::EmitterParams& emitter)
+    {
+        return static_cast<int>(std::ceil(emitter.lifetime / kStep));
+    }
+
+    struct CpuResult
+    {
+        double msPerStep = 0.0;
+        Summary summary;
+    };
+
+    CpuResult runCpu(uint32_t capacity, std::span<const float> heights)
+    {
+        const bloom::EmitterParams emitter = makeEmitter(capacity);
+        CpuParticles particles(capacity, emitter, heights);
+        for (int i = warmupSteps(emitter); i > 0; --i)
+            particles.step(kStep);
+
+        const uint64_t start = bloom::Clock::now();
+        for (int i = 0; i < kTimedSteps; ++i)
+            particles.step(kStep);
+        CpuResult result;
+        result.msPerStep = bloom::Clock::toMilliseconds(bloom::Clock::now() - start) / kTimedSteps;
+        result.summary = summarize(particles.particles(), heights);
+        return result;
+    }
+
+    struct GpuResult
+    {
+        double msPerStep = 0.0;
+        uint32_t drawCount = 0;
+        Summary summary;
+    };
+
+    bool runGpu(uint32_t capacity, std::span<const float> heights, GpuResult& result)
+    {
+        bloom::GpuParticleSystem system;
+        if (!system.init(capacity))
+            return false;
+        const bloom::EmitterParams emitter = makeEmitter(capacity);
+        system.setEmitter(emitter);
+
+        bloom::RenderQueue queue;
+        bloom::GLBackend backend;
+        backend.setPass(1, bloom::PassDesc{0, {0, 0, 64, 64}});
+        system.setHeightField(backend.state(), heights.data(), kFieldSize, kFieldSize, kFieldRect);
+        auto step = [&](bool withDraw)
+        {
+            queue.reset();
+            bloom::CommandBuffer& bucket = queue.acquireBucket();
+            system.recordStep(bucket, bloom::SortKey::encode(0, 0, 0, 0), kStep);
+            if (withDraw)
+                bucket.record(bloom::SortKey::encode(1, 0, 0, 0), system.draw());
+            queue.sort();
+            backend.execute(queue);
+        };
+
+        // Warm up through the real draw path, then time the simulation alone.
+        for (int i = warmupSteps(emitter); i > 0; --i)
+            step(true);
+        glFinish();
+
+        GLuint query = 0;
+        glCreateQueries(GL_TIME_ELAPSED, 1, &query);
+        glBeginQuery(GL_TIME_ELAPSED, query);
+        for (int i = 0; i < kTimedSteps; ++i)
+            step(false);
+        glEndQuery(GL_TIME_ELAPSED);
+        GLuint64 elapsed = 0;
+        glGetQueryObjectui64v(query, GL_QUERY_RESULT, &elapsed);
+        glDeleteQueries(1, &query);
+        result.msPerStep = static_cast<double>(elapsed) / 1e6 / kTimedSteps;
+
+        bloom::DrawArraysIndirectCommand command;
+        glGetNamedBufferSubData(system.indirectBuffer(), 0, sizeof(command), &command);
+        std::vector<Particle> pool(capacity);
+        glGetNamedBufferSubData(system.particleBuffer(), 0, static_cast<GLsizeiptr>(pool.size() * sizeof(Particle)), pool.data());
+        result.drawCount = command.count == 4 ? command.instanceCount : ~0u;
+        result.summary = summarize(pool, heights);
+        return true;
+    }
+
+    bool check(bool ok, const char* what)
+    {
+        if (!ok)
+            std::fprintf(stderr, "  FAILED: %s\n", what);
+        return ok;
+    }
+
+    bool verify(const CpuResult& cpu, const GpuResult& gpu)
+    {
+        const double population = std::abs(static_cast<double>(gpu.summary.alive) - cpu.summary.alive) / std::max(cpu.summary.alive, 1u);
+        bool ok = true;
+        ok &= check(gpu.drawCount == gpu.summary.alive, "indirect instance count differs from the live particles");
+        ok &= check(gpu.summary.nonFinite == 0, "non-finite particles");
+        ok &= check(gpu.summary.belowGround == 0, "particles below the height field");
+        ok &= check(population < 0.02, "live population differs from the CPU path by more than 2%");
+        ok &= check(std::abs(gpu.summary.meanHeight - cpu.summary.meanHeight) < 0.05, "mean height differs from the CPU path");
+        return ok;
+    }
+
+    GLFWwindow* createContext()
+    {
+        glfwWindowHint(GLFW_CONTEXT_CREATION_API, GLFW_OSMESA_CONTEXT_API);
+        glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 4);
+        glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 5);
+        glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+        glfwWindowHint(GLFW_VISIBLE, GLFW_FALSE);
+        GLFWwindow* window = glfwCreateWindow(64, 64, "particles", nullptr, nullptr);
+        if (!window)
+            return nullptr;
+        glfwMakeContextCurrent(window);
+        if (!gladLoadGLLoaderVersion(reinterpret_cast<GLADloadproc>(glfwGetProcAddress), 4, 5))
+        {
+            glfwDestroyWindow(window);
+            return nullptr;
+        }
+        return window;
+    }
+}
+
+int main(int argc, char** argv)
+{
+    glfwInitHint(GLFW_PLATFORM, GLFW_PLATFORM_NULL);
+    if (!glfwInit())
+        return EXIT_FAILURE;
+    bloom::Clock::init();
+
+    bool verifyGpu = false;
+    std::vector<uint32_t> counts;
+    for (int i = 1; i < argc; ++i)
+    {
+        if (std::strcmp(argv[i], "--verify") == 0)
+            verifyGpu = true;
+        else
+            counts.push_back(static_cast<uint32_t>(std::strtoul(argv[i], nullptr, 10)));
+    }
+    if (counts.empty())
+        counts = {65536, 262144, 1048576};
+
+    GLFWwindow* window = createContext();
+    if (!window)
+        std::fprintf(stderr, "No GL 4.5 context (is OSMesa installed?); CPU path only\n");
+    else
+        std::printf("GL: %s\n", reinterpret_cast<const char*>(glGetString(GL_RENDERER)));
+
+    const std::vector<float> heights = makeHeightField();
+    bool ok = window || !verifyGpu;
+    std::printf("%-10s %10s %12s %10s %12s %8s\n", "particles", "cpu ms", "cpu Mp/s", "gpu ms", "gpu Mp/s", "speedup");
+    for (const uint32_t count : counts)
+    {
+        if (count == 0)
+            continue;
+        const CpuResult cpu = runCpu(count, heights);
+        std::printf("%-10u %10.3f %12.1f", count, cpu.msPerStep, count / cpu.msPerStep / 1000.0);
+
+        GpuResult gpu;
+        if (window && runGpu(count, heights, gpu))
+        {
+            std::printf(" %10.3f %12.1f %7.1fx\n", gpu.msPerStep, count / gpu.msPerStep / 1000.0, cpu.msPerStep / gpu.msPerStep);
+            if (verifyGpu)
+            {
+                std::printf("  live %u/%u (cpu/gpu), drawn %u, mean height %.3f/%.3f\n", cpu.summary.alive, gpu.summary.alive,
+                            gpu.drawCount, cpu.summary.meanHeight, gpu.summary.meanHeight);
+                ok &= verify(cpu, gpu);
+            }
+        }
+        else
+        {
+            std::printf(" %10s %12s %8s\n", "-", "-", "-");
+            ok &= !verifyGpu;
+        }
+    }
+
+    if (window)
+        glfwDestroyWindow(window);
+    glfwTerminate();
+    return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,142 @@
+// Profiler overhead: cost of one CPU zone while the profiler is disabled,
+// enabled, and enabled with every thread of the machine recording at once
+// while a collector drains the tracks the way the render thread does each
+// frame. The bare timer pair is printed as the floor a zone cannot beat.
+
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <thread>
+#include <vector>
+
+#include "GLFW/glfw3.h"
+
+#include "core/clock.hpp"
+#include "core/profiler.hpp"
+
+namespace
+{
+    constexpr uint32_t kZones = 1u << 22;
+    // Drains happen far more often than ProfileTrack::kCapacity zones are
+    // recorded, the same budget a frame has.
+    constexpr uint32_t kZonesPerFrame = 4096;
+
+    double timerPair()
+    {
+        uint64_t sink = 0;
+        const uint64_t start = bloom::Clock::now();
+        for (uint32_t i = 0; i < kZones; ++i)
+        {
+            const uint64_t begin = bloom::Clock::now();
+            sink += bloom::Clock::now() - begin;
+        }
+        const uint64_t elapsed = bloom::Clock::now() - start;
+        std::atomic_signal_fence(std::memory_order_seq_cst);
+        return sink == ~0ull ? 0.0 : bloom::Clock::toSeconds(elapsed) * 1e9 / kZones;
+    }
+
+    double zones(uint32_t count, std::atomic<uint32_t>* frames)
+    {
+        const uint64_t start = bloom::Clock::now();
+        for (uint32_t i = 0; i < count; ++i)
+        {
+            BLOOM_PROFILE_ZONE("bench");
+            if (frames && (i % kZonesPerFrame) == kZonesPerFrame - 1)
+                frames->fetch_add(1, std::memory_order_relaxed);
+        }
+        return bloom::Clock::toSeconds(bloom::Clock::now() - start) * 1e9 / count;
+    }
+
+    // Drains between frames, outside the timed part, like the render thread.
+    double framed(uint32_t count)
+    {
+        uint64_t elapsed = 0;
+        for (uint32_t done = 0; done < count; done += kZonesPerFrame)
+        {
+            const uint64_t start = bloom::Clock::now();
+            for (uint32_t i = 0; i < kZonesPerFrame; ++i)
+            {
+                BLOOM_PROFILE_ZONE("bench");
+            }
+            elapsed += bloom::Clock::now() - start;
+            bloom::Profiler::endFrame();
+        }
+        return bloom::Clock::toSeconds(elapsed) * 1e9 / count;
+    }
+
+    // Every thread records its share while the calling thread drains.
+    double contended(unsigned threads)
+    {
+        std::atomic<uint32_t> frames{0};
+        std::atomic<unsigned> finished{0};
+        std::vector<double> costs(threads);
+        std::vector<std::thread> pool;
+
+        for (unsigned t = 0; t < threads; ++t)
+        {
+            pool.emplace_back([&, t]()
+            {
+                costs[t] = zones(kZones / threads, &frames);
+                finished.fetch_add(1, std::memory_order_release);
+            });
+        }
+
+        uint32_t drained = 0;
+        while (finished.load(std::memory_order_acquire) < threads)
+        {
+            const uint32_t pending = frames.load(std::memory_order_relaxed);
+            if (pending != drained)
+            {
+                bloom::Profiler::endFrame();
+                drained = pending;
+            }
+            else
+            {
+                std::this_thread::yield();
+            }
+        }
+
+        for (std::thread& thread : pool)
+            thread.join();
+        bloom::Profiler::endFrame();
+
+        double total = 0.0;
+        for (double cost : costs)
+            total += cost;
+        return total / threads;
+    }
+}
+
+int main(int argc, char** argv)
+{
+    glfwInitHint(GLFW_PLATFORM, GLFW_PLATFORM_NULL);
+    if (!glfwInit())
+        return EXIT_FAILURE;
+    bloom::Clock::init();
+
+    unsigned threads = std::max(1u, std::thread::hardware_concurrency());
+    if (argc > 1)
+        threads = static_cast<unsigned>(std::max(1, std::atoi(argv[1])));
+
+    const double floor = timerPair();
+
+    bloom::Profiler::setEnabled(false);
+    const double disabled = zones(kZones, nullptr);
+
+    bloom::Profiler::setEnabled(true);
+    const double enabled = framed(kZones);
+
+    const double shared = contended(threads);
+    bloom::Profiler::setEnabled(false);
+
+    std::printf("%u zones per run\n", kZones);
+    std::printf("%-28s %8.1f ns\n", "timer pair", floor);
+    std::printf("%-28s %8.1f ns\n", "zone, disabled", disabled);
+    std::printf("%-28s %8.1f ns\n", "zone, enabled", enabled);
+    std::printf("%-22s %2u thr %8.1f ns\n", "zone, enabled", threads, shared);
+    std::printf("%llu events dropped\n", static_cast<unsigned long long>(bloom::Profiler::droppedEvents()));
+
+    glfwTerminate();
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,184 @@
+// Transient target memory with and without RenderGraph's aliasing. Declares
+// a deferred 4K frame: G-buffer, half-resolution SSAO with two blur passes,
+// HDR lighting, a compute light-binning pass feeding an indirect draw, TAA,
+// a bloom mip chain, tone mapping, FXAA to the backbuffer and a debug view
+// nothing reads. Compiles it repeatedly (no GL needed) and reports the
+// compile time, the pass order with barriers and culling, and the bytes the
+// transients would take one allocation each against what the shared slots
+// take.
+// Usage: bloom_bench_render_graph [width height]
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+#include "GLFW/glfw3.h"
+
+#include "core/clock.hpp"
+#include "render/render_graph.hpp"
+
+namespace
+{
+    constexpr int kRuns = 200;
+    constexpr int kBloomLevels = 6;
+
+    void declareFrame(bloom::RenderGraph& graph, int width, int height)
+    {
+        using bloom::BufferAccess;
+        using bloom::PassKind;
+        using bloom::TextureAccess;
+
+        graph.reset(width, height);
+        const int halfWidth = width / 2;
+        const int halfHeight = height / 2;
+
+        const bloom::GraphTexture albedo = graph.createTexture("albedo", {width, height, GL_RGBA8});
+        const bloom::GraphTexture normals = graph.createTexture("normals", {width, height, GL_RGBA16F});
+        const bloom::GraphTexture depth = graph.createTexture("depth", {width, height, GL_DEPTH24_STENCIL8});
+        const uint32_t gbuffer = graph.addPass("gbuffer", PassKind::Graphics, nullptr, nullptr);
+        graph.write(gbuffer, albedo, TextureAccess::ColorTarget);
+        graph.write(gbuffer, normals, TextureAccess::ColorTarget);
+        graph.write(gbuffer, depth, TextureAccess::DepthTarget);
+
+        const bloom::GraphBuffer lights = graph.createBuffer("light grid", 16 << 20);
+        const bloom::GraphBuffer args = graph.createBuffer("light draw args", 4096);
+        const uint32_t binning = graph.addPass("light binning", PassKind::Compute, nullptr, nullptr);
+        graph.read(binning, depth, TextureAccess::Sampled);
+        graph.write(binning, lights, BufferAccess::Storage);
+        graph.write(binning, args, BufferAccess::Storage);
+
+        const bloom::GraphTexture ao = graph.createTexture("ssao", {halfWidth, halfHeight, GL_R8});
+        const uint32_t ssao = graph.addPass("ssao", PassKind::Compute, nullptr, nullptr);
+        graph.read(ssao, depth, TextureAccess::Sampled);
+        graph.read(ssao, normals, TextureAccess::Sampled);
+        graph.write(ssao, ao, TextureAccess::Image);
+
+        const bloom::GraphTexture aoBlurX = graph.createTexture("ssao blur x", {halfWidth, halfHeight, GL_R8});
+        const uint32_t blurX = graph.addPass("ssao blur x", PassKind::Compute, nullptr, nullptr);
+        graph.read(blurX, ao, TextureAccess::Sampled);
+        graph.write(blurX, aoBlurX, TextureAccess::Image);
+
+        const bloom::GraphTexture aoBlurY = graph.createTexture("ssao blur y", {halfWidth, halfHeight, GL_R8});
+        const uint32_t blurY = graph.addPass("ssao blur y", PassKind::Compute, nullptr, nullptr);
+        graph.read(blurY, aoBlurX, TextureAccess::Sampled);
+        graph.write(blurY, aoBlurY, TextureAccess::Image);
+
+        const bloom::GraphTexture hdr = graph.createTexture("hdr", {width, height, GL_RGBA16F});
+        const uint32_t lighting = graph.addPass("lighting", PassKind::Graphics, nullptr, nullptr);
+        graph.read(lighting, albedo, TextureAccess::Sampled);
+        graph.read(lighting, normals, TextureAccess::Sampled);
+        graph.read(lighting, depth, TextureAccess::Sampled);
+        graph.read(lighting, aoBlurY, TextureAccess::Sampled);
+        graph.read(lighting, lights, BufferAccess::Storage);
+        graph.write(lighting, hdr, TextureAccess::ColorTarget);
+
+        const uint32_t volumes = graph.addPass("light volumes", PassKind::Graphics, nullptr, nullptr);
+        graph.read(volumes, args, BufferAccess::Indirect);
+        graph.read(volumes, depth, TextureAccess::DepthTarget);
+        graph.read(volumes, hdr, TextureAccess::ColorTarget);
+        graph.write(volumes, hdr, TextureAccess::ColorTarget);
+
+        // Normals and albedo are dead from here on; the full-resolution
+        // targets below take over their slots.
+        const bloom::GraphTexture resolved = graph.createTexture("taa", {width, height, GL_RGBA16F});
+        const uint32_t taa = graph.addPass("taa", PassKind::Compute, nullptr, nullptr);
+        graph.read(taa, hdr, TextureAccess::Sampled);
+        graph.read(taa, depth, TextureAccess::Sampled);
+        graph.write(taa, resolved, TextureAccess::Image);
+
+        // A mip chain in one texture, each level written as an image.
+        const bloom::GraphTexture bloomChain =
+            graph.createTexture("bloom chain", {halfWidth, halfHeight, GL_RGBA16F, kBloomLevels});
+        const uint32_t downsample = graph.addPass("bloom downsample", PassKind::Compute, nullptr, nullptr);
+        graph.read(downsample, resolved, TextureAccess::Sampled);
+        for (int level = 0; level < kBloomLevels; ++level)
+            graph.write(downsample, bloomChain, TextureAccess::Image, level);
+        const uint32_t upsample = graph.addPass("bloom upsample", PassKind::Compute, nullptr, nullptr);
+        graph.read(upsample, bloomChain, TextureAccess::Sampled);
+        graph.write(upsample, bloomChain, TextureAccess::Image);
+
+        const bloom::GraphTexture ldr = graph.createTexture("ldr", {width, height, GL_RGBA8});
+        const uint32_t tonemap = graph.addPass("tonemap", PassKind::Graphics, nullptr, nullptr);
+        graph.read(tonemap, resolved, TextureAccess::Sampled);
+        graph.read(tonemap, bloomChain, TextureAccess::Sampled);
+        graph.write(tonemap, ldr, TextureAccess::ColorTarget);
+
+        const uint32_t fxaa = graph.addPass("fxaa", PassKind::Graphics, nullptr, nullptr);
+        graph.read(fxaa, ldr, TextureAccess::Sampled);
+        graph.markOutput(fxaa);
+
+        // Left in the frame but switched off: nothing reads its target.
+        const bloom::GraphTexture overlay = graph.createTexture("debug overlay", {width, height, GL_RGBA8});
+        const uint32_t debug = graph.addPass("debug normals", PassKind::Graphics, nullptr, nullptr);
+        graph.read(debug, normals, TextureAccess::Sampled);
+        graph.write(debug, overlay, TextureAccess::ColorTarget);
+    }
+
+    const char* barrierName(GLbitfield bit)
+    {
+        switch (bit)
+        {
+        case GL_TEXTURE_FETCH_BARRIER_BIT: return "texture fetch";
+        case GL_SHADER_IMAGE_ACCESS_BARRIER_BIT: return "image access";
+        case GL_FRAMEBUFFER_BARRIER_BIT: return "framebuffer";
+        case GL_SHADER_STORAGE_BARRIER_BIT: return "storage";
+        case GL_UNIFORM_BARRIER_BIT: return "uniform";
+        case GL_COMMAND_BARRIER_BIT: return "command";
+        case GL_VERTEX_ATTRIB_ARRAY_BARRIER_BIT: return "vertex";
+        case GL_ELEMENT_ARRAY_BARRIER_BIT: return "index";
+        }
+        return "?";
+    }
+
+    double megabytes(uint64_t bytes)
+    {
+        return static_cast<double>(bytes) / (1024.0 * 1024.0);
+    }
+}
+
+int main(int argc, char** argv)
+{
+    const int width = argc > 2 ? std::atoi(argv[1]) : 3840;
+    const int height = argc > 2 ? std::atoi(argv[2]) : 2160;
+
+    glfwInitHint(GLFW_PLATFORM, GLFW_PLATFORM_NULL);
+    if (!glfwInit())
+        return EXIT_FAILURE;
+    bloom::Clock::init();
+
+    bloom::RenderGraph graph;
+    std::vector<double> times;
+    for (int run = 0; run < kRuns; ++run)
+    {
+        const uint64_t start = bloom::Clock::now();
+        declareFrame(graph, width, height);
+        const bool compiled = graph.compile();
+        times.push_back(bloom::Clock::toMilliseconds(bloom::Clock::now() - start));
+        if (!compiled)
+            return EXIT_FAILURE;
+    }
+    std::sort(times.begin(), times.end());
+
+    std::printf("%dx%d frame\n", width, height);
+    for (uint32_t pass : graph.order())
+    {
+        std::printf("  %-18s", graph.passName(pass));
+        const GLbitfield barrier = graph.passBarrier(pass);
+        for (GLbitfield bits = barrier; bits; bits &= bits - 1)
+            std::printf(" [%s]", barrierName(bits & ~(bits - 1)));
+        std::printf("\n");
+    }
+
+    const bloom::RenderGraph::Stats& stats = graph.stats();
+    std::printf("passes %u live, %u culled, %u barriers\n", stats.passes, stats.culled, stats.barriers);
+    std::printf("textures %u in %u slots, buffers %u in %u slots\n", stats.transientTextures, stats.textureSlots,
+                stats.transientBuffers, stats.bufferSlots);
+    std::printf("transient memory %8.1f MB unaliased, %8.1f MB aliased (%.0f%% saved)\n", megabytes(stats.transientBytes),
+                megabytes(stats.allocatedBytes),
+                stats.transientBytes ? 100.0 * (1.0 - static_cast<double>(stats.allocatedBytes) / stats.transientBytes) : 0.0);
+    std::printf("declare + compile  median %.3f ms, best %.3f ms\n", times[times.size() / 2], times.front());
+
+    glfwTerminate();
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,238 @@
+// Program build time with and without ShaderCache. Builds 16 define
+// permutations of one vertex/fragment pair four ways: straight from
+// source, through a cold cache (compile plus store), through a warm cache
+// (glProgramBinary only) and through request() on the shared-context
+// thread, where the interesting number is how long the calling thread
+// itself is busy. Needs OSMesa; llvmpipe's compiler is slow enough for
+// the difference to show at startup.
+// Usage: bloom_bench_shader_cache [directory]
+
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+#include "glad/glad.h"
+#include "GLFW/glfw3.h"
+
+#include "core/clock.hpp"
+#include "render/gl_shader.hpp"
+#include "render/shader_cache.hpp"
+
+namespace
+{
+    constexpr int kFeatures = 4;
+    constexpr int kVariants = 1 << kFeatures;
+
+    const char* kFeatureNames[kFeatures] = {"NORMAL_MAP", "FOG", "RIM", "DITHER"};
+
+    const char* kVertexShader = R"(#version 450 core
+layout(location = 0) in vec3 position;
+layout(location = 1) in vec3 normal;
+layout(location = 2) in vec2 uv;
+layout(location = 1) uniform mat4 viewProjection;
+out vec3 vNormal;
+out vec3 vWorld;
+out vec2 vUv;
+void main()
+{
+    vNormal = normal;
+    vWorld = position;
+    vUv = uv;
+    gl_Position = viewProjection * vec4(position, 1.0);
+}
+)";
+
+    const char* kFragmentShader = R"(#version 450 core
+in vec3 vNormal;
+in vec3 vWorld;
+in vec2 vUv;
+layout(binding = 0) uniform sampler2D albedo;
+layout(binding = 1) uniform sampler2D normals;
+layout(location = 2) uniform vec3 cameraPosition;
+layout(location = 3) uniform vec4 lights[16];
+out vec4 color;
+
+vec3 shade(vec3 n, vec3 v, vec3 base)
+{
+    vec3 result = base * 0.05;
+    for (int i = 0; i < 8; ++i)
+    {
+        vec3 l = lights[i * 2].xyz - vWorld;
+        float attenuation = 1.0 / (1.0 + dot(l, l));
+        l = normalize(l);
+        vec3 h = normalize(l + v);
+        float diffuse = max(dot(n, l), 0.0);
+        float specular = pow(max(dot(n, h), 0.0), 32.0);
+        result += (base * diffuse + vec3(specular)) * lights[i * 2 + 1].rgb * attenuation;
+    }
+    return result;
+}
+
+void main()
+{
+    vec3 n = normalize(vNormal);
+#if NORMAL_MAP
+    vec3 t = normalize(cross(n, vec3(0.0, 1.0, 0.0)) + vec3(1e-4));
+    mat3 tbn = mat3(t, cross(n, t), n);
+    n = normalize(tbn * (texture(normals, vUv).xyz * 2.0 - 1.0));
+#endif
+    vec3 v = normalize(cameraPosition - vWorld);
+    vec3 base = texture(albedo, vUv).rgb;
+    vec3 result = shade(n, v, base);
+#if RIM
+    result += vec3(pow(1.0 - max(dot(n, v), 0.0), 4.0)) * 0.3;
+#endif
+#if FOG
+    float fog = exp(-length(cameraPosition - vWorld) * 0.02);
+    result = mix(vec3(0.6, 0.7, 0.8), result, fog);
+#endif
+#if DITHER
+    result += (fract(sin(dot(gl_FragCoord.xy, vec2(12.9898, 78.233))) * 43758.5453) - 0.5) / 255.0;
+#endif
+    color = vec4(result, 1.0);
+}
+)";
+
+    std::string definesFor(int variant)
+    {
+        std::string defines;
+        for (int feature = 0; feature < kFeatures; ++feature)
+            defines += std::string("#define ") + kFeatureNames[feature] + ((variant >> feature) & 1 ? " 1\n" : " 0\n");
+        return defines;
+    }
+
+    const bloom::ShaderStage kStages[] = {{GL_VERTEX_SHADER, kVertexShader}, {GL_FRAGMENT_SHADER, kFragmentShader}};
+
+    struct Delivered
+    {
+        int count = 0;
+        int failed = 0;
+        std::vector<GLuint> programs;
+    };
+
+    void onProgram(GLuint program, void* user)
+    {
+        auto* delivered = static_cast<Delivered*>(user);
+        ++delivered->count;
+        if (program == 0)
+            ++delivered->failed;
+        delivered->programs.push_back(program);
+    }
+
+    template <typename F>
+    double buildAll(F&& build)
+    {
+        std::vector<GLuint> programs;
+        const uint64_t start = bloom::Clock::now();
+        for (int variant = 0; variant < kVariants; ++variant)
+            programs.push_back(build(definesFor(variant)));
+        glFinish();
+        const double ms = bloom::Clock::toMilliseconds(bloom::Clock::now() - start);
+        for (GLuint program : programs)
+        {
+            if (program == 0)
+                std::fprintf(stderr, "A variant failed to build\n");
+            glDeleteProgram(program);
+        }
+        return ms;
+    }
+
+    void report(const char* name, double ms)
+    {
+        std::printf("%-28s %9.1f ms %8.2f ms/program\n", name, ms, ms / kVariants);
+    }
+}
+
+int main(int argc, char** argv)
+{
+    const std::filesystem::path directory = argc > 1 ? argv[1] : "bench_shader_cache";
+
+    glfwInitHint(GLFW_PLATFORM, GLFW_PLATFORM_NULL);
+    if (!glfwInit())
+        return EXIT_FAILURE;
+    bloom::Clock::init();
+
+    glfwWindowHint(GLFW_CONTEXT_CREATION_API, GLFW_OSMESA_CONTEXT_API);
+    glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 4);
+    glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 5);
+    glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+    glfwWindowHint(GLFW_VISIBLE, GLFW_FALSE);
+    GLFWwindow* window = glfwCreateWindow(64, 64, "shader cache", nullptr, nullptr);
+    if (!window)
+    {
+        std::fprintf(stderr, "No GL 4.5 context (is OSMesa installed?)\n");
+        glfwTerminate();
+        return EXIT_FAILURE;
+    }
+
+    // The threaded cache needs its shared context before the main one is
+    // made current.
+    bloom::ShaderCache threaded;
+    threaded.createContext(window);
+
+    glfwMakeContextCurrent(window);
+    if (!gladLoadGLLoaderVersion(reinterpret_cast<GLADloadproc>(glfwGetProcAddress), 4, 5))
+        return EXIT_FAILURE;
+
+    std::printf("%s, %s, %d variants\n", reinterpret_cast<const char*>(glGetString(GL_RENDERER)),
+                reinterpret_cast<const char*>(glGetString(GL_VERSION)), kVariants);
+
+    std::error_code error;
+    std::filesystem::remove_all(directory, error);
+
+    report("from source", buildAll([](const std::string& defines) { return bloom::linkProgram(kStages, defines, false); }));
+
+    bloom::ShaderCache::Stats warmStats;
+    {
+        bloom::ShaderCache cold;
+        if (!cold.open(directory.string().c_str()))
+            return EXIT_FAILURE;
+        report("cold cache", buildAll([&](const std::string& defines) { return cold.program(kStages, defines); }));
+    }
+    {
+        // A fresh instance, as on the next launch.
+        bloom::ShaderCache warm;
+        warm.open(directory.string().c_str());
+        report("warm cache", buildAll([&](const std::string& defines) { return warm.program(kStages, defines); }));
+        warmStats = warm.stats();
+    }
+
+    std::filesystem::remove_all(directory, error);
+    if (!threaded.open(directory.string().c_str()))
+        return EXIT_FAILURE;
+    Delivered delivered;
+    uint64_t busy = 0;
+    const uint64_t start = bloom::Clock::now();
+    for (int variant = 0; variant < kVariants; ++variant)
+    {
+        const uint64_t before = bloom::Clock::now();
+        threaded.request(kStages, definesFor(variant), onProgram, &delivered);
+        busy += bloom::Clock::now() - before;
+    }
+    while (delivered.count < kVariants)
+    {
+        const uint64_t before = bloom::Clock::now();
+        threaded.collect();
+        busy += bloom::Clock::now() - before;
+        glfwWaitEventsTimeout(0.001);
+    }
+    const double asyncMs = bloom::Clock::toMilliseconds(bloom::Clock::now() - start);
+    threaded.drain();
+    for (GLuint program : delivered.programs)
+        glDeleteProgram(program);
+
+    report(threaded.threaded() ? "cold, compile thread" : "cold, inline in collect()", asyncMs);
+    std::printf("%-28s %9.1f ms\n", "  calling thread busy", bloom::Clock::toMilliseconds(busy));
+
+    std::printf("warm run: %llu hits, %llu misses, %llu rejected\n", static_cast<unsigned long long>(warmStats.hits),
+                static_cast<unsigned long long>(warmStats.misses), static_cast<unsigned long long>(warmStats.rejected));
+
+    glfwMakeContextCurrent(nullptr);
+    threaded.stop();
+    glfwDestroyWindow(window);
+    glfwTerminate();
+    std::filesystem::remove_all(directory, error);
+    return delivered.failed == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,181 @@
+// Transform hierarchy update for 500k nodes (2000 trees of 250, four
+// children per node) against the glPushMatrix-style traversal of boing.c
+// and gears.c: recurse from each root, push, multiply by the local
+// transform, visit the children, pop. The traversal recomputes every node
+// every frame; TransformHierarchy only touches what changed, so the
+// scenarios go from fully animated down to fully static. Exits with a
+// failure if the parallel update disagrees with the traversal.
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+#include "GLFW/glfw3.h"
+
+#include "core/clock.hpp"
+#include "scene/transform_hierarchy.hpp"
+
+namespace
+{
+    constexpr uint32_t kTrees = 2000;
+    constexpr uint32_t kNodesPerTree = 250;
+    constexpr uint32_t kBranching = 4;
+    constexpr uint32_t kNodes = kTrees * kNodesPerTree;
+    constexpr int kFrames = 30;
+    constexpr double kBudgetMs = 1000.0 / 60.0;
+
+    struct SceneNode
+    {
+        bloom::LocalTransform local;
+        std::vector<uint32_t> children;
+    };
+
+    // The fixed-function matrix stack, with Mat4 in place of GL state.
+    void traverse(std::vector<SceneNode>& nodes, std::vector<bloom::Mat4>& world, uint32_t index,
+                  std::vector<bloom::Mat4>& stack)
+    {
+        const SceneNode& node = nodes[index];
+        stack.push_back(stack.back() * bloom::Mat4::trs(node.local.position, node.local.rotation, node.local.scale));
+        world[index] = stack.back();
+        for (uint32_t child : node.children)
+            traverse(nodes, world, child, stack);
+        stack.pop_back();
+    }
+
+    bloom::Quat spin(uint32_t node, int frame)
+    {
+        return bloom::Quat::fromAxisAngle({0.f, 1.f, 0.f}, 0.01f * static_cast<float>(frame) + 0.001f * node);
+    }
+
+    template <typename F>
+    double perFrame(F&& frame)
+    {
+        const uint64_t start = bloom::Clock::now();
+        for (int i = 0; i < kFrames; ++i)
+            frame(i);
+        return bloom::Clock::toMilliseconds(bloom::Clock::now() - start) / kFrames;
+    }
+
+    void report(const char* name, double ms, uint32_t recomputed)
+    {
+        std::printf("%-22s %9.3f ms %7.1f%% of 60 Hz %9u recomputed\n", name, ms, 100.0 * ms / kBudgetMs, recomputed);
+    }
+}
+
+int main()
+{
+    glfwInitHint(GLFW_PLATFORM, GLFW_PLATFORM_NULL);
+    if (!glfwInit())
+        return EXIT_FAILURE;
+    bloom::Clock::init();
+
+    std::mt19937 rng(7);
+    std::uniform_real_distribution<float> offset(-1.f, 1.f);
+
+    // Node k of a tree hangs off node (k - 1) / kBranching; both sides get
+    // the same nodes in the same order.
+    std::vector<SceneNode> scene(kNodes);
+    std::vector<uint32_t> roots;
+    bloom::TransformHierarchy hierarchy;
+    hierarchy.reserve(kNodes);
+    std::vector<bloom::TransformHandle> handles(kNodes);
+    for (uint32_t tree = 0; tree < kTrees; ++tree)
+    {
+        const uint32_t base = tree * kNodesPerTree;
+        for (uint32_t k = 0; k < kNodesPerTree; ++k)
+        {
+            SceneNode& node = scene[base + k];
+            node.local.position = {offset(rng), offset(rng), offset(rng)};
+            node.local.rotation = bloom::Quat::fromEuler(offset(rng), offset(rng), offset(rng));
+            node.local.scale = bloom::Vec3(0.9f);
+
+            bloom::TransformHandle parent;
+            if (k == 0)
+            {
+                roots.push_back(base);
+            }
+            else
+            {
+                const uint32_t parentIndex = base + (k - 1) / kBranching;
+                scene[parentIndex].children.push_back(base + k);
+                parent = handles[parentIndex];
+            }
+            handles[base + k] = hierarchy.create(parent, node.local);
+        }
+    }
+
+    bloom::JobSystem jobs;
+    jobs.registerThread();
+    hierarchy.update(jobs);
+
+    std::vector<bloom::Mat4> world(kNodes);
+    std::vector<bloom::Mat4> stack;
+    stack.reserve(64);
+
+    std::printf("%u nodes in %u trees, %zu levels, %u worker threads\n", kNodes, kTrees, hierarchy.levelCount(),
+                jobs.workerCount());
+
+    const double naive = perFrame([&](int frame)
+    {
+        for (uint32_t i = 0; i < kNodes; ++i)
+            scene[i].local.rotation = spin(i, frame);
+        for (uint32_t root : roots)
+        {
+            stack.assign(1, bloom::Mat4::identity());
+            traverse(scene, world, root, stack);
+        }
+    });
+    report("push/pop traversal", naive, kNodes);
+
+    const double animated = perFrame([&](int frame)
+    {
+        for (uint32_t i = 0; i < kNodes; ++i)
+            hierarchy.setRotation(handles[i], spin(i, frame));
+        hierarchy.update(jobs);
+    });
+    report("hierarchy, all", animated, hierarchy.lastUpdate().recomputed);
+
+    // Same final rotations on both sides, so the results must agree.
+    float maxError = 0.f;
+    for (uint32_t i = 0; i < kNodes; ++i)
+    {
+        const bloom::Mat4& a = world[i];
+        const bloom::Mat4& b = hierarchy.world(handles[i]);
+        for (int c = 0; c < 4; ++c)
+        {
+            for (int r = 0; r < 4; ++r)
+                maxError = std::max(maxError, std::abs(a.cols[c][r] - b.cols[c][r]));
+        }
+    }
+
+    const double rootsOnly = perFrame([&](int frame)
+    {
+        for (uint32_t root : roots)
+            hierarchy.setRotation(handles[root], spin(root, frame + kFrames));
+        hierarchy.update(jobs);
+    });
+    report("hierarchy, roots", rootsOnly, hierarchy.lastUpdate().recomputed);
+
+    std::uniform_int_distribution<uint32_t> pick(0, kNodes - 1);
+    std::vector<uint32_t> animatedNodes(kNodes / 10);
+    for (uint32_t& node : animatedNodes)
+        node = pick(rng);
+    const double tenth = perFrame([&](int frame)
+    {
+        for (uint32_t node : animatedNodes)
+            hierarchy.setRotation(handles[node], spin(node, frame));
+        hierarchy.update(jobs);
+    });
+    report("hierarchy, 10% nodes", tenth, hierarchy.lastUpdate().recomputed);
+
+    const double still = perFrame([&](int) { hierarchy.update(jobs); });
+    report("hierarchy, static", still, hierarchy.lastUpdate().recomputed);
+
+    std::printf("max difference from traversal: %g\n", maxError);
+
+    glfwTerminate();
+    return maxError == 0.f ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,323 @@
+// Per-draw constants three ways, for N small draws that each need a mat4
+// and a colour:
+//   - glUniform: the render thread sets both uniforms before every draw,
+//     the way the GLFW examples do with glUniformMatrix4fv.
+//   - bind range: jobs write each draw's block into the UniformRing and
+//     record a DrawCommand whose uniform buffer range points at it; the
+//     backend rebinds the range for every draw.
+//   - base instance: jobs pack the blocks into one array of the ring and
+//     each draw selects its element with baseInstance, so draws differ in
+//     nothing but the draw call itself.
+// Reports the CPU time to write and record, to sort and submit, the time
+// until glFinish returns, and the uniform and buffer binding calls per
+// frame. Needs OSMesa.
+// Usage: bloom_bench_uniform_ring [draws]
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+#include "glad/glad.h"
+#include "GLFW/glfw3.h"
+
+#include "core/clock.hpp"
+#include "jobs/job_system.hpp"
+#include "math/mat4.hpp"
+#include "render/gl_backend.hpp"
+#include "render/gl_shader.hpp"
+#include "render/render_queue.hpp"
+#include "render/sort_key.hpp"
+#include "render/uniform_ring.hpp"
+
+namespace
+{
+    constexpr int kFrames = 30;
+    constexpr uint32_t kPass = 1;
+    constexpr uint32_t kGrain = 1024;
+
+    // Matches both `uniform Draw { mat4 transform; vec4 color; }` (std140)
+    // and the std430 array element below.
+    struct DrawData
+    {
+        bloom::Mat4 transform;
+        float color[4];
+    };
+
+    const char* const kFragmentShader = R"(#version 450 core
+in vec4 v_color;
+out vec4 o_color;
+void main()
+{
+    o_color = v_color;
+}
+)";
+
+    const char* const kUniformVertexShader = R"(#version 450 core
+layout(location = 0) uniform mat4 u_transform;
+layout(location = 4) uniform vec4 u_color;
+out vec4 v_color;
+void main()
+{
+    vec2 corner = vec2(gl_VertexID == 1, gl_VertexID == 2);
+    v_color = u_color;
+    gl_Position = u_transform * vec4(corner, 0.0, 1.0);
+}
+)";
+
+    const char* const kRangeVertexShader = R"(#version 450 core
+layout(std140, binding = 0) uniform Draw
+{
+    mat4 u_transform;
+    vec4 u_color;
+};
+out vec4 v_color;
+void main()
+{
+    vec2 corner = vec2(gl_VertexID == 1, gl_VertexID == 2);
+    v_color = u_color;
+    gl_Position = u_transform * vec4(corner, 0.0, 1.0);
+}
+)";
+
+    const char* const kIndexVertexShader = R"(#version 450 core
+struct Draw
+{
+    mat4 transform;
+    vec4 color;
+};
+layout(location = 15) in uint a_drawIndex;
+layout(std430, binding = 0) readonly buffer Draws
+{
+    Draw u_draws[];
+};
+out vec4 v_color;
+void main()
+{
+    vec2 corner = vec2(gl_VertexID == 1, gl_VertexID == 2);
+    Draw draw = u_draws[a_drawIndex];
+    v_color = draw.color;
+    gl_Position = draw.transform * vec4(corner, 0.0, 1.0);
+}
+)";
+
+    DrawData makeDraw(uint32_t index, uint32_t count, int frame)
+    {
+        const auto side = static_cast<uint32_t>(std::ceil(std::sqrt(static_cast<double>(count))));
+        const float cell = 2.f / static_cast<float>(side);
+        const float x = -1.f + cell * static_cast<float>(index % side);
+        const float y = -1.f + cell * static_cast<float>(index / side);
+        const float pulse = 0.8f + 0.2f * std::sin(static_cast<float>(frame + static_cast<int>(index)) * 0.1f);
+
+        DrawData draw;
+        draw.transform = bloom::Mat4::trs({x, y, 0.f}, {}, bloom::Vec3{cell, cell, 1.f} * pulse);
+        draw.color[0] = static_cast<float>(index % 7) / 6.f;
+        draw.color[1] = static_cast<float>(index % 5) / 4.f;
+        draw.color[2] = static_cast<float>(index % 3) / 2.f;
+        draw.color[3] = 1.f;
+        return draw;
+    }
+
+    struct Result
+    {
+        double recordMs = 0.0;
+        double submitMs = 0.0;
+        double totalMs = 0.0;
+        uint32_t uniformCalls = 0;
+        uint32_t bufferBinds = 0;
+    };
+
+    double median(std::vector<double> values)
+    {
+        std::sort(values.begin(), values.end());
+        return values[values.size() / 2];
+    }
+
+    // record(frame) writes the constants and records or issues the draws;
+    // submit() issues whatever record() left queued.
+    template <typename Record, typename Submit>
+    Result measure(bloom::GLBackend& backend, Record&& record, Submit&& submit)
+    {
+        std::vector<double> recordTimes;
+        std::vector<double> submitTimes;
+        std::vector<double> totalTimes;
+        for (int frame = 0; frame < kFrames; ++frame)
+        {
+            const uint64_t start = bloom::Clock::now();
+            record(frame);
+            const uint64_t recorded = bloom::Clock::now();
+            submit();
+            const uint64_t submitted = bloom::Clock::now();
+            glFinish();
+            const uint64_t finished = bloom::Clock::now();
+            backend.state().endFrame();
+            recordTimes.push_back(bloom::Clock::toMilliseconds(recorded - start));
+            submitTimes.push_back(bloom::Clock::toMilliseconds(submitted - recorded));
+            totalTimes.push_back(bloom::Clock::toMilliseconds(finished - start));
+        }
+
+        Result result;
+        result.recordMs = median(recordTimes);
+        result.submitMs = median(submitTimes);
+        result.totalMs = median(totalTimes);
+        result.bufferBinds = backend.state().lastFrame().issued[static_cast<std::size_t>(bloom::GLStateCache::Category::Buffer)];
+        return result;
+    }
+
+    void print(const char* name, const Result& result)
+    {
+        std::printf("%-14s %9.3f ms %9.3f ms %9.3f ms %10u %10u\n", name, result.recordMs, result.submitMs, result.totalMs,
+                    result.uniformCalls, result.bufferBinds);
+    }
+}
+
+int main(int argc, char** argv)
+{
+    glfwInitHint(GLFW_PLATFORM, GLFW_PLATFORM_NULL);
+    if (!glfwInit())
+        return EXIT_FAILURE;
+    bloom::Clock::init();
+
+    const auto count = static_cast<uint32_t>(argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 10000);
+    if (count == 0)
+        return EXIT_FAILURE;
+
+    glfwWindowHint(GLFW_CONTEXT_CREATION_API, GLFW_OSMESA_CONTEXT_API);
+    glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 4);
+    glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 5);
+    glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+    glfwWindowHint(GLFW_VISIBLE, GLFW_FALSE);
+    GLFWwindow* window = glfwCreateWindow(256, 256, "uniform ring", nullptr, nullptr);
+    if (!window)
+    {
+        std::fprintf(stderr, "No GL 4.5 context (is OSMesa installed?)\n");
+        glfwTerminate();
+        return EXIT_FAILURE;
+    }
+    glfwMakeContextCurrent(window);
+    if (!gladLoadGLLoaderVersion(reinterpret_cast<GLADloadproc>(glfwGetProcAddress), 4, 5))
+        return EXIT_FAILURE;
+
+    const GLuint uniformProgram = bloom::compileProgram(kUniformVertexShader, kFragmentShader);
+    const GLuint rangeProgram = bloom::compileProgram(kRangeVertexShader, kFragmentShader);
+    const GLuint indexProgram = bloom::compileProgram(kIndexVertexShader, kFragmentShader);
+    if (!uniformProgram || !rangeProgram || !indexProgram)
+        return EXIT_FAILURE;
+
+    // Room for every draw's block at the uniform offset alignment, which
+    // is what the bind-range path pads each one to.
+    GLint alignment = 0;
+    glGetIntegerv(GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT, &alignment);
+    const GLsizeiptr blockBytes = (static_cast<GLsizeiptr>(sizeof(DrawData)) + alignment - 1) / alignment * alignment;
+    bloom::UniformRing ring;
+    if (!ring.init(blockBytes * count))
+        return EXIT_FAILURE;
+
+    GLuint emptyArray = 0;
+    GLuint indexArray = 0;
+    glCreateVertexArrays(1, &emptyArray);
+    glCreateVertexArrays(1, &indexArray);
+    ring.attachDrawIndex(indexArray);
+
+    bloom::JobSystem jobs;
+    jobs.registerThread();
+    bloom::RenderQueue queue;
+    bloom::GLBackend backend;
+    backend.setPass(kPass, bloom::PassDesc{0, {0, 0, 256, 256}});
+
+    std::printf("%u draws, %zu bytes of constants each, %u workers\n", count, sizeof(DrawData), jobs.workerCount());
+    std::printf("%-14s %12s %12s %12s %10s %10s\n", "", "record", "submit", "finish", "uniforms", "binds");
+
+    // The constants are computed on the render thread too, so every path
+    // does the same work per draw.
+    Result uniforms = measure(backend,
+        [&](int frame)
+        {
+            backend.state().useProgram(uniformProgram);
+            backend.state().bindVertexArray(emptyArray);
+            for (uint32_t i = 0; i < count; ++i)
+            {
+                const DrawData draw = makeDraw(i, count, frame);
+                glUniformMatrix4fv(0, 1, GL_FALSE, draw.transform.data());
+                glUniform4fv(4, 1, draw.color);
+                glDrawArrays(GL_TRIANGLES, 0, 3);
+            }
+        },
+        []() {});
+    uniforms.uniformCalls = count * 2;
+    print("glUniform", uniforms);
+
+    const auto submitQueue = [&]()
+    {
+        queue.sort();
+        backend.execute(queue);
+        ring.endFrame();
+    };
+
+    const Result ranges = measure(backend,
+        [&](int frame)
+        {
+            queue.reset();
+            ring.beginFrame();
+            jobs.parallelFor(count, kGrain, [&](uint32_t begin, uint32_t end)
+            {
+                bloom::CommandBuffer& bucket = queue.acquireBucket();
+                for (uint32_t i = begin; i < end; ++i)
+                {
+                    const bloom::UniformRing::Allocation block = ring.push(makeDraw(i, count, frame));
+                    bloom::DrawCommand draw;
+                    draw.program = rangeProgram;
+                    draw.vertexArray = emptyArray;
+                    draw.count = 3;
+                    draw.uniformBuffers[0] = block.range;
+                    bucket.record(bloom::SortKey::encode(kPass, 0, 0, 0), draw);
+                }
+            });
+        },
+        submitQueue);
+    print("bind range", ranges);
+
+    const Result indices = measure(backend,
+        [&](int frame)
+        {
+            queue.reset();
+            ring.beginFrame();
+            jobs.parallelFor(count, kGrain, [&](uint32_t begin, uint32_t end)
+            {
+                uint32_t first = 0;
+                DrawData* blocks = ring.allocateArray<DrawData>(end - begin, first);
+                if (!blocks)
+                    return;
+                bloom::CommandBuffer& bucket = queue.acquireBucket();
+                for (uint32_t i = begin; i < end; ++i)
+                {
+                    blocks[i - begin] = makeDraw(i, count, frame);
+                    bloom::DrawCommand draw;
+                    draw.program = indexProgram;
+                    draw.vertexArray = indexArray;
+                    draw.count = 3;
+                    draw.storageBuffers[0] = ring.frameRange();
+                    draw.baseInstance = first + (i - begin);
+                    bucket.record(bloom::SortKey::encode(kPass, 0, 0, 0), draw);
+                }
+            });
+        },
+        submitQueue);
+    print("base instance", indices);
+
+    const bloom::UniformRing::Stats& stats = ring.stats();
+    std::printf("ring: %llu bytes in the last frame, %u allocations, %u failed, %llu stalls\n",
+                static_cast<unsigned long long>(stats.bytes), stats.allocations, stats.failed,
+                static_cast<unsigned long long>(ring.stalls()));
+
+    ring.release();
+    glDeleteVertexArrays(1, &emptyArray);
+    glDeleteVertexArrays(1, &indexArray);
+    glDeleteProgram(uniformProgram);
+    glDeleteProgram(rangeProgram);
+    glDeleteProgram(indexProgram);
+    glfwDestroyWindow(window);
+    glfwTerminate();
+    return EXIT_SUCCESS;
+}
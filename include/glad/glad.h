@@ -86,6 +86,15 @@ GLAPI int gladLoadGL(void);
 
 GLAPI int gladLoadGLLoader(GLADloadproc);
 
+/* Loads only the entry points of GL versions up to major.minor. */
+GLAPI int gladLoadGLLoaderVersion(GLADloadproc, int major, int minor);
+
+/* Points every entry point at a trampoline that resolves it through the
+ * loader on its first call. The loader must stay valid, and a context must
+ * be current, whenever a GL function is first called. */
+GLAPI int gladLoadGLLoaderLazy(GLADloadproc);
+GLAPI int gladLoadGLLoaderLazyVersion(GLADloadproc, int major, int minor);
+
 #include <KHR/khrplatform.h>
 typedef unsigned int GLenum;
 typedef unsigned char GLboolean;
@@ -0,0 +1,249 @@
+#include "asset/asset_file.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cstdio>
+
+#include "glad/glad.h"
+
+namespace bloom
+{
+    namespace
+    {
+        bool inBounds(uint64_t offset, uint64_t size, uint64_t limit)
+        {
+            return offset <= limit && size <= limit - offset;
+        }
+
+        // Sub-range of an entry's blob.
+        bool within(const AssetEntry& entry, uint64_t offset, uint64_t size)
+        {
+            return offset >= entry.dataOffset && inBounds(offset - entry.dataOffset, size, entry.dataSize);
+        }
+
+        uint64_t indexSize(uint32_t type)
+        {
+            switch (type)
+            {
+            case GL_UNSIGNED_SHORT: return 2;
+            case GL_UNSIGNED_INT: return 4;
+            default: return 0;
+            }
+        }
+
+        bool validMesh(const AssetEntry& entry)
+        {
+            const MeshInfo& mesh = entry.mesh;
+            if (mesh.attributeCount > kMaxVertexAttributes || mesh.vertexStride == 0)
+                return false;
+            for (uint32_t i = 0; i < mesh.attributeCount; ++i)
+            {
+                if (mesh.attributes[i].offset >= mesh.vertexStride || mesh.attributes[i].components - 1 > 3)
+                    return false;
+            }
+            if (mesh.vertexSize != uint64_t{mesh.vertexCount} * mesh.vertexStride || !within(entry, mesh.vertexOffset, mesh.vertexSize))
+                return false;
+            if (mesh.indexCount == 0)
+                return mesh.indexSize == 0;
+            return mesh.indexSize == mesh.indexCount * indexSize(mesh.indexType) && mesh.indexSize != 0 &&
+                   within(entry, mesh.indexOffset, mesh.indexSize);
+        }
+
+        // Bytes per pixel of tightly packed client data; 0 for a format and
+        // type the loader does not know.
+        uint64_t pixelSize(uint32_t format, uint32_t type)
+        {
+            uint64_t components = 0;
+            switch (format)
+            {
+            case GL_RED: case GL_RED_INTEGER: case GL_DEPTH_COMPONENT: components = 1; break;
+            case GL_RG: case GL_RG_INTEGER: components = 2; break;
+            case GL_RGB: case GL_BGR: case GL_RGB_INTEGER: components = 3; break;
+            case GL_RGBA: case GL_BGRA: case GL_RGBA_INTEGER: components = 4; break;
+            default: return 0;
+            }
+
+            switch (type)
+            {
+            case GL_UNSIGNED_BYTE: case GL_BYTE: return components;
+            case GL_UNSIGNED_SHORT: case GL_SHORT: case GL_HALF_FLOAT: return components * 2;
+            case GL_UNSIGNED_INT: case GL_INT: case GL_FLOAT: return components * 4;
+            case GL_UNSIGNED_SHORT_5_6_5: return components == 3 ? 2 : 0;
+            case GL_UNSIGNED_SHORT_4_4_4_4: case GL_UNSIGNED_SHORT_5_5_5_1: return components == 4 ? 2 : 0;
+            case GL_UNSIGNED_INT_8_8_8_8_REV: case GL_UNSIGNED_INT_2_10_10_10_REV: return components == 4 ? 4 : 0;
+            case GL_UNSIGNED_INT_10F_11F_11F_REV: case GL_UNSIGNED_INT_5_9_9_9_REV: return components == 3 ? 4 : 0;
+            default: return 0;
+            }
+        }
+
+        // Bytes per 4x4 block of a compressed format; 0 if unknown.
+        uint64_t blockSize(uint32_t internalFormat)
+        {
+            switch (internalFormat)
+            {
+            case GL_COMPRESSED_RED_RGTC1:
+            case GL_COMPRESSED_SIGNED_RED_RGTC1:
+            case GL_COMPRESSED_RGB8_ETC2:
+            case GL_COMPRESSED_SRGB8_ETC2:
+            case GL_COMPRESSED_RGB8_PUNCHTHROUGH_ALPHA1_ETC2:
+            case GL_COMPRESSED_SRGB8_PUNCHTHROUGH_ALPHA1_ETC2:
+            case GL_COMPRESSED_R11_EAC:
+            case GL_COMPRESSED_SIGNED_R11_EAC:
+                return 8;
+            case GL_COMPRESSED_RG_RGTC2:
+            case GL_COMPRESSED_SIGNED_RG_RGTC2:
+            case GL_COMPRESSED_RGBA_BPTC_UNORM:
+            case GL_COMPRESSED_SRGB_ALPHA_BPTC_UNORM:
+            case GL_COMPRESSED_RGB_BPTC_SIGNED_FLOAT:
+            case GL_COMPRESSED_RGB_BPTC_UNSIGNED_FLOAT:
+            case GL_COMPRESSED_RGBA8_ETC2_EAC:
+            case GL_COMPRESSED_SRGB8_ALPHA8_ETC2_EAC:
+            case GL_COMPRESSED_RG11_EAC:
+            case GL_COMPRESSED_SIGNED_RG11_EAC:
+                return 16;
+            default:
+                return 0;
+            }
+        }
+
+        // Each level must hold exactly the bytes uploadTexture() hands GL
+        // for it, so a truncated or mislabelled level is caught here and not
+        // read past by the driver.
+        bool validTexture(const AssetEntry& entry)
+        {
+            const TextureInfo& texture = entry.texture;
+            if (texture.levels == 0 || texture.levels > kMaxTextureLevels || texture.width == 0 || texture.height == 0)
+                return false;
+            if (texture.levels > static_cast<uint32_t>(std::bit_width(std::max(texture.width, texture.height))))
+                return false;
+
+            const bool compressed = texture.format == 0;
+            const uint64_t unit = compressed ? blockSize(texture.internalFormat) : pixelSize(texture.format, texture.type);
+            if (unit == 0)
+                return false;
+
+            for (uint32_t level = 0; level < texture.levels; ++level)
+            {
+                const uint64_t width = std::max(texture.width >> level, 1u);
+                const uint64_t height = std::max(texture.height >> level, 1u);
+                const uint64_t expected = compressed ? (width + 3) / 4 * ((height + 3) / 4) * unit : width * height * unit;
+                if (texture.levelSize[level] != expected || !within(entry, texture.levelOffset[level], texture.levelSize[level]))
+                    return false;
+            }
+            return true;
+        }
+    }
+
+    bool AssetFile::open(const char* path)
+    {
+        close();
+        if (!m_file.open(path))
+            return false;
+
+        if (!validate(path))
+        {
+            close();
+            return false;
+        }
+
+        const AssetHeader& header = *reinterpret_cast<const AssetHeader*>(m_file.data());
+        m_entries = reinterpret_cast<const AssetEntry*>(m_file.data() + header.entryOffset);
+        m_entryCount = header.entryCount;
+        m_strings = reinterpret_cast<const char*>(m_file.data() + header.stringOffset);
+        return true;
+    }
+
+    void AssetFile::close()
+    {
+        m_file.close();
+        m_entries = nullptr;
+        m_entryCount = 0;
+        m_strings = nullptr;
+    }
+
+    bool AssetFile::validate(const char* path) const
+    {
+        const std::size_t fileSize = m_file.size();
+        if (fileSize < sizeof(AssetHeader))
+        {
+            std::fprintf(stderr, "%s: too small to be an asset container\n", path);
+            return false;
+        }
+
+        const AssetHeader& header = *reinterpret_cast<const AssetHeader*>(m_file.data());
+        if (header.magic != kAssetMagic)
+        {
+            std::fprintf(stderr, "%s: not an asset container\n", path);
+            return false;
+        }
+        if (header.version != kAssetVersion)
+        {
+            std::fprintf(stderr, "%s: container version %u, expected %u; re-cook it\n", path, header.version, kAssetVersion);
+            return false;
+        }
+        if (header.fileSize != fileSize || header.entryOffset % alignof(AssetEntry) != 0 ||
+            !inBounds(header.entryOffset, uint64_t{header.entryCount} * sizeof(AssetEntry), fileSize) ||
+            !inBounds(header.stringOffset, header.stringSize, fileSize))
+        {
+            std::fprintf(stderr, "%s: truncated or corrupt header\n", path);
+            return false;
+        }
+
+        const AssetEntry* entries = reinterpret_cast<const AssetEntry*>(m_file.data() + header.entryOffset);
+        for (uint32_t i = 0; i < header.entryCount; ++i)
+        {
+            const AssetEntry& entry = entries[i];
+            bool valid = entry.dataOffset % kAssetAlignment == 0 && inBounds(entry.dataOffset, entry.dataSize, fileSize) &&
+                         inBounds(entry.nameOffset, entry.nameLength, header.stringSize) &&
+                         (i == 0 || entries[i - 1].nameHash <= entry.nameHash);
+            if (valid && entry.type == AssetType::Mesh)
+                valid = validMesh(entry);
+            else if (valid && entry.type == AssetType::Texture)
+                valid = validTexture(entry);
+            else if (valid && entry.type != AssetType::Blob)
+                valid = false;
+
+            if (!valid)
+            {
+                std::fprintf(stderr, "%s: entry %u is corrupt\n", path, i);
+                return false;
+            }
+        }
+        return true;
+    }
+
+    std::string_view AssetFile::name(const AssetEntry& entry) const
+    {
+        return {m_strings + entry.nameOffset, entry.nameLength};
+    }
+
+    const AssetEntry* AssetFile::find(std::string_view name) const
+    {
+        const uint64_t hash = hashAssetName(name);
+        const AssetEntry* end = m_entries + m_entryCount;
+        const AssetEntry* it = std::lower_bound(m_entries, end, hash,
+                                                [](const AssetEntry& entry, uint64_t value) { return entry.nameHash < value; });
+        for (; it != end && it->nameHash == hash; ++it)
+        {
+            if (this->name(*it) == name)
+                return it;
+        }
+        return nullptr;
+    }
+
+    MeshView AssetFile::mesh(const AssetEntry& entry) const
+    {
+        const std::byte* base = m_file.data();
+        return {&entry.mesh, base + entry.mesh.vertexOffset, entry.mesh.indexCount ? base + entry.mesh.indexOffset : nullptr};
+    }
+
+    TextureView AssetFile::texture(const AssetEntry& entry) const
+    {
+        return {&entry.texture, m_file.data()};
+    }
+
+    std::span<const std::byte> AssetFile::data(const AssetEntry& entry) const
+    {
+        return {m_file.data() + entry.dataOffset, static_cast<std::size_t>(entry.dataSize)};
+    }
+}
@@ -0,0 +1,63 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string_view>
+
+#include "asset/asset_format.hpp"
+#include "asset/mapped_file.hpp"
+
+namespace bloom
+{
+    // Pointers into a mapped container; valid while the AssetFile is open.
+    struct MeshView
+    {
+        const MeshInfo* info = nullptr;
+        const std::byte* vertices = nullptr;
+        const std::byte* indices = nullptr;
+    };
+
+    struct TextureView
+    {
+        const TextureInfo* info = nullptr;
+        const std::byte* base = nullptr;    // file start; add levelOffset[i]
+
+        const std::byte* level(uint32_t index) const { return base + info->levelOffset[index]; }
+    };
+
+    // A cooked container, mapped and used in place. open() checks the
+    // header and every entry's ranges against the file size, which is all
+    // the parsing there is: its cost depends on the number of assets, not
+    // their size, so loading is bound by how fast pages arrive.
+    class AssetFile
+    {
+    public:
+        bool open(const char* path);
+        void close();
+        bool isOpen() const { return m_file.isOpen(); }
+
+        std::span<const AssetEntry> entries() const { return {m_entries, m_entryCount}; }
+        std::string_view name(const AssetEntry& entry) const;
+
+        // Binary search on the name hash; null if absent.
+        const AssetEntry* find(std::string_view name) const;
+
+        MeshView mesh(const AssetEntry& entry) const;
+        TextureView texture(const AssetEntry& entry) const;
+        std::span<const std::byte> data(const AssetEntry& entry) const;
+
+        // Starts reading an asset in ahead of its upload.
+        void prefetch(const AssetEntry& entry) const { m_file.prefetch(entry.dataOffset, entry.dataSize); }
+
+        const MappedFile& file() const { return m_file; }
+
+    private:
+        bool validate(const char* path) const;
+
+        MappedFile m_file;
+        const AssetEntry* m_entries = nullptr;
+        std::size_t m_entryCount = 0;
+        const char* m_strings = nullptr;
+    };
+}
@@ -0,0 +1,120 @@
+#pragma once
+
+#include <cstdint>
+#include <string_view>
+#include <type_traits>
+
+namespace bloom
+{
+    // On-disk layout of a cooked asset container (.bloom). Everything is
+    // little-endian and naturally aligned, so a mapped file is used in place:
+    //
+    //   AssetHeader
+    //   asset data, each blob starting on a kAssetAlignment boundary
+    //   name strings
+    //   AssetEntry[entryCount], sorted by name hash
+    //
+    // The entry table goes last so the cook can stream blobs out without
+    // knowing the final asset count. All offsets are from the file start.
+    // Any change to these structs must bump kAssetVersion.
+
+    constexpr uint32_t kAssetMagic = 0x414d4c42;   // "BLMA"
+    constexpr uint32_t kAssetVersion = 1;
+    // Page alignment: blobs can be prefetched and read with direct I/O one
+    // by one, and GL can take them straight from the mapping.
+    constexpr uint64_t kAssetAlignment = 4096;
+    constexpr uint32_t kMaxVertexAttributes = 8;
+    constexpr uint32_t kMaxTextureLevels = 16;
+
+    enum class AssetType : uint32_t
+    {
+        Blob = 0,
+        Mesh = 1,
+        Texture = 2,
+    };
+
+    struct AssetHeader
+    {
+        uint32_t magic;
+        uint32_t version;
+        uint32_t entryCount;
+        uint32_t reserved;
+        uint64_t entryOffset;
+        uint64_t stringOffset;
+        uint64_t stringSize;
+        uint64_t fileSize;
+    };
+
+    // Mirrors glVertexAttribFormat / glVertexAttribIFormat arguments.
+    struct VertexAttribute
+    {
+        uint32_t location;
+        uint32_t components;
+        uint32_t type;          // GLenum, e.g. GL_FLOAT
+        uint32_t normalized;
+        uint32_t integer;       // bound with glVertexArrayAttribIFormat
+        uint32_t offset;        // within the vertex
+    };
+
+    struct MeshInfo
+    {
+        uint32_t vertexCount;
+        uint32_t vertexStride;
+        uint32_t indexCount;
+        uint32_t indexType;     // GL_UNSIGNED_SHORT or GL_UNSIGNED_INT
+        uint32_t attributeCount;
+        uint32_t reserved;
+        VertexAttribute attributes[kMaxVertexAttributes];
+        uint64_t vertexOffset;
+        uint64_t vertexSize;
+        uint64_t indexOffset;
+        uint64_t indexSize;
+        float boundsMin[3];
+        float boundsMax[3];
+    };
+
+    // Mirrors glTextureStorage2D plus the per-level upload arguments.
+    struct TextureInfo
+    {
+        uint32_t width;
+        uint32_t height;
+        uint32_t levels;
+        uint32_t internalFormat;    // GLenum
+        uint32_t format;            // GLenum; 0 for compressed data
+        uint32_t type;              // GLenum; 0 for compressed data
+        uint64_t levelOffset[kMaxTextureLevels];
+        uint64_t levelSize[kMaxTextureLevels];
+    };
+
+    struct AssetEntry
+    {
+        uint64_t nameHash;
+        uint32_t nameOffset;        // into the string table
+        uint32_t nameLength;
+        AssetType type;
+        uint32_t reserved;
+        uint64_t dataOffset;        // whole blob, covering every range below
+        uint64_t dataSize;
+        union
+        {
+            MeshInfo mesh;
+            TextureInfo texture;
+        };
+    };
+
+    static_assert(std::is_trivially_copyable_v<AssetHeader> && std::is_trivially_copyable_v<AssetEntry>);
+    static_assert(sizeof(AssetHeader) == 48);
+    static_assert(sizeof(AssetEntry) % 8 == 0);
+
+    // FNV-1a, 64-bit.
+    constexpr uint64_t hashAssetName(std::string_view name)
+    {
+        uint64_t hash = 0xcbf29ce484222325ull;
+        for (char c : name)
+        {
+            hash ^= static_cast<unsigned char>(c);
+            hash *= 0x100000001b3ull;
+        }
+        return hash;
+    }
+}
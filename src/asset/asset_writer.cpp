@@ -0,0 +1,211 @@
+#include "asset/asset_writer.hpp"
+
+#include <algorithm>
+#include <cfloat>
+#include <cstring>
+
+#include "glad/glad.h"
+
+namespace bloom
+{
+    namespace
+    {
+        uint64_t alignUp(uint64_t value, uint64_t alignment)
+        {
+            return (value + alignment - 1) / alignment * alignment;
+        }
+    }
+
+    AssetWriter::~AssetWriter()
+    {
+        if (m_file)
+            std::fclose(m_file);
+    }
+
+    bool AssetWriter::open(const char* path)
+    {
+        m_file = std::fopen(path, "wb");
+        if (!m_file)
+        {
+            std::fprintf(stderr, "Failed to create %s\n", path);
+            return false;
+        }
+
+        m_path = path;
+        m_offset = 0;
+        m_failed = false;
+
+        // Placeholder; finish() writes the real header once the tables are
+        // placed.
+        const AssetHeader header{};
+        append(&header, sizeof(header));
+        return !m_failed;
+    }
+
+    AssetEntry* AssetWriter::beginEntry(std::string_view name, AssetType type)
+    {
+        if (!m_file || m_failed)
+            return nullptr;
+        if (!m_names.emplace(name).second)
+        {
+            std::fprintf(stderr, "%s: duplicate asset name '%.*s'\n", m_path.c_str(), static_cast<int>(name.size()), name.data());
+            return nullptr;
+        }
+
+        padTo(kAssetAlignment);
+
+        AssetEntry& entry = m_entries.emplace_back();
+        std::memset(&entry, 0, sizeof(entry));
+        entry.nameHash = hashAssetName(name);
+        entry.nameOffset = static_cast<uint32_t>(m_strings.size());
+        entry.nameLength = static_cast<uint32_t>(name.size());
+        entry.type = type;
+        entry.dataOffset = m_offset;
+        m_strings.append(name);
+        return &entry;
+    }
+
+    uint64_t AssetWriter::append(const void* data, std::size_t size)
+    {
+        const uint64_t offset = m_offset;
+        if (size > 0 && std::fwrite(data, 1, size, m_file) != size)
+            m_failed = true;
+        m_offset += size;
+        return offset;
+    }
+
+    void AssetWriter::padTo(uint64_t alignment)
+    {
+        static constexpr std::byte kZeros[kAssetAlignment] = {};
+        append(kZeros, static_cast<std::size_t>(alignUp(m_offset, alignment) - m_offset));
+    }
+
+    bool AssetWriter::addBlob(std::string_view name, std::span<const std::byte> data)
+    {
+        AssetEntry* entry = beginEntry(name, AssetType::Blob);
+        if (!entry)
+            return false;
+
+        append(data.data(), data.size());
+        entry->dataSize = m_offset - entry->dataOffset;
+        return !m_failed;
+    }
+
+    bool AssetWriter::addMesh(std::string_view name, const MeshSource& source)
+    {
+        const uint32_t indexSize = source.indexType == GL_UNSIGNED_SHORT ? 2 : 4;
+        if (source.attributes.size() > kMaxVertexAttributes || source.vertexStride == 0 ||
+            (source.indexCount > 0 && source.indexType != GL_UNSIGNED_SHORT && source.indexType != GL_UNSIGNED_INT))
+        {
+            std::fprintf(stderr, "%s: mesh '%.*s' has an unsupported layout\n", m_path.c_str(), static_cast<int>(name.size()), name.data());
+            return false;
+        }
+
+        AssetEntry* entry = beginEntry(name, AssetType::Mesh);
+        if (!entry)
+            return false;
+
+        MeshInfo& mesh = entry->mesh;
+        mesh.vertexCount = source.vertexCount;
+        mesh.vertexStride = source.vertexStride;
+        mesh.indexCount = source.indexCount;
+        mesh.indexType = source.indexCount > 0 ? source.indexType : 0;
+        mesh.attributeCount = static_cast<uint32_t>(source.attributes.size());
+        std::copy(source.attributes.begin(), source.attributes.end(), mesh.attributes);
+
+        std::fill_n(mesh.boundsMin, 3, 0.f);
+        std::fill_n(mesh.boundsMax, 3, 0.f);
+        for (const VertexAttribute& attribute : source.attributes)
+        {
+            if (attribute.location != 0 || attribute.type != GL_FLOAT || source.vertexCount == 0)
+                continue;
+
+            std::fill_n(mesh.boundsMin, 3, FLT_MAX);
+            std::fill_n(mesh.boundsMax, 3, -FLT_MAX);
+            const auto* base = static_cast<const std::byte*>(source.vertices) + attribute.offset;
+            const uint32_t components = std::min(attribute.components, 3u);
+            for (uint32_t v = 0; v < source.vertexCount; ++v)
+            {
+                float position[3] = {};
+                std::memcpy(position, base + std::size_t{v} * source.vertexStride, components * sizeof(float));
+                for (uint32_t c = 0; c < 3; ++c)
+                {
+                    mesh.boundsMin[c] = std::min(mesh.boundsMin[c], position[c]);
+                    mesh.boundsMax[c] = std::max(mesh.boundsMax[c], position[c]);
+                }
+            }
+        }
+
+        mesh.vertexSize = uint64_t{source.vertexCount} * source.vertexStride;
+        mesh.vertexOffset = append(source.vertices, static_cast<std::size_t>(mesh.vertexSize));
+        if (source.indexCount > 0)
+        {
+            padTo(indexSize);
+            mesh.indexSize = uint64_t{source.indexCount} * indexSize;
+            mesh.indexOffset = append(source.indices, static_cast<std::size_t>(mesh.indexSize));
+        }
+        entry->dataSize = m_offset - entry->dataOffset;
+        return !m_failed;
+    }
+
+    bool AssetWriter::addTexture(std::string_view name, const TextureSource& source)
+    {
+        if (source.levels.empty() || source.levels.size() > kMaxTextureLevels || source.width == 0 || source.height == 0)
+        {
+            std::fprintf(stderr, "%s: texture '%.*s' has an unsupported layout\n", m_path.c_str(), static_cast<int>(name.size()), name.data());
+            return false;
+        }
+
+        AssetEntry* entry = beginEntry(name, AssetType::Texture);
+        if (!entry)
+            return false;
+
+        TextureInfo& texture = entry->texture;
+        texture.width = source.width;
+        texture.height = source.height;
+        texture.levels = static_cast<uint32_t>(source.levels.size());
+        texture.internalFormat = source.internalFormat;
+        texture.format = source.format;
+        texture.type = source.type;
+        for (std::size_t level = 0; level < source.levels.size(); ++level)
+        {
+            // Level starts stay 16-byte aligned for the driver's copy.
+            padTo(16);
+            texture.levelSize[level] = source.levels[level].size();
+            texture.levelOffset[level] = append(source.levels[level].data(), source.levels[level].size());
+        }
+        entry->dataSize = m_offset - entry->dataOffset;
+        return !m_failed;
+    }
+
+    bool AssetWriter::finish()
+    {
+        if (!m_file)
+            return false;
+
+        AssetHeader header{};
+        header.magic = kAssetMagic;
+        header.version = kAssetVersion;
+        header.entryCount = static_cast<uint32_t>(m_entries.size());
+
+        header.stringOffset = m_offset;
+        header.stringSize = m_strings.size();
+        append(m_strings.data(), m_strings.size());
+
+        std::sort(m_entries.begin(), m_entries.end(),
+                  [](const AssetEntry& a, const AssetEntry& b) { return a.nameHash < b.nameHash; });
+        padTo(alignof(AssetEntry));
+        header.entryOffset = append(m_entries.data(), m_entries.size() * sizeof(AssetEntry));
+        header.fileSize = m_offset;
+
+        if (std::fseek(m_file, 0, SEEK_SET) != 0 || std::fwrite(&header, sizeof(header), 1, m_file) != 1)
+            m_failed = true;
+        if (std::fclose(m_file) != 0)
+            m_failed = true;
+        m_file = nullptr;
+
+        if (m_failed)
+            std::fprintf(stderr, "Failed to write %s\n", m_path.c_str());
+        return !m_failed;
+    }
+}
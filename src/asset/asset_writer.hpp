@@ -0,0 +1,74 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <span>
+#include <string>
+#include <string_view>
+#include <unordered_set>
+#include <vector>
+
+#include "asset/asset_format.hpp"
+
+namespace bloom
+{
+    struct MeshSource
+    {
+        const void* vertices = nullptr;
+        uint32_t vertexCount = 0;
+        uint32_t vertexStride = 0;
+        std::span<const VertexAttribute> attributes;
+        const void* indices = nullptr;  // optional
+        uint32_t indexCount = 0;
+        uint32_t indexType = 0;         // GL_UNSIGNED_SHORT or GL_UNSIGNED_INT
+    };
+
+    struct TextureSource
+    {
+        uint32_t width = 0;
+        uint32_t height = 0;
+        uint32_t internalFormat = 0;
+        uint32_t format = 0;            // 0 for compressed data
+        uint32_t type = 0;
+        std::span<const std::span<const std::byte>> levels;
+    };
+
+    // Writes a container for AssetFile. Blobs go to disk as they are added,
+    // so cooking a multi-gigabyte scene only ever holds one asset in memory;
+    // finish() appends the name and entry tables and patches the header.
+    // Until it succeeds the file is not a valid container.
+    class AssetWriter
+    {
+    public:
+        AssetWriter() = default;
+        ~AssetWriter();
+
+        AssetWriter(const AssetWriter&) = delete;
+        AssetWriter& operator=(const AssetWriter&) = delete;
+
+        bool open(const char* path);
+        bool finish();
+
+        bool addBlob(std::string_view name, std::span<const std::byte> data);
+        // Bounds come from the float attribute at location 0, if any.
+        bool addMesh(std::string_view name, const MeshSource& mesh);
+        bool addTexture(std::string_view name, const TextureSource& texture);
+
+        std::size_t assetCount() const { return m_entries.size(); }
+        uint64_t bytesWritten() const { return m_offset; }
+
+    private:
+        AssetEntry* beginEntry(std::string_view name, AssetType type);
+        uint64_t append(const void* data, std::size_t size);
+        void padTo(uint64_t alignment);
+
+        std::FILE* m_file = nullptr;
+        std::string m_path;
+        uint64_t m_offset = 0;
+        bool m_failed = false;
+        std::vector<AssetEntry> m_entries;
+        std::string m_strings;
+        std::unordered_set<std::string> m_names;
+    };
+}
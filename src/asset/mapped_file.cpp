@@ -0,0 +1,141 @@
+#include "asset/mapped_file.hpp"
+
+#include <algorithm>
+#include <cstdio>
+
+#if defined(_WIN32)
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace bloom
+{
+    MappedFile::~MappedFile()
+    {
+        close();
+    }
+
+#if defined(_WIN32)
+
+    bool MappedFile::open(const char* path)
+    {
+        close();
+
+        m_file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (m_file == INVALID_HANDLE_VALUE)
+        {
+            m_file = nullptr;
+            std::fprintf(stderr, "Failed to open %s\n", path);
+            return false;
+        }
+
+        LARGE_INTEGER size;
+        if (!GetFileSizeEx(m_file, &size) || size.QuadPart == 0)
+        {
+            std::fprintf(stderr, "Failed to map %s: empty or unreadable\n", path);
+            close();
+            return false;
+        }
+
+        m_mapping = CreateFileMappingA(m_file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        const void* view = m_mapping ? MapViewOfFile(m_mapping, FILE_MAP_READ, 0, 0, 0) : nullptr;
+        if (!view)
+        {
+            std::fprintf(stderr, "Failed to map %s\n", path);
+            close();
+            return false;
+        }
+
+        m_data = static_cast<const std::byte*>(view);
+        m_size = static_cast<std::size_t>(size.QuadPart);
+        return true;
+    }
+
+    void MappedFile::close()
+    {
+        if (m_data)
+            UnmapViewOfFile(m_data);
+        if (m_mapping)
+            CloseHandle(m_mapping);
+        if (m_file)
+            CloseHandle(m_file);
+        m_data = nullptr;
+        m_size = 0;
+        m_mapping = nullptr;
+        m_file = nullptr;
+    }
+
+    void MappedFile::prefetch(std::size_t offset, std::size_t size) const
+    {
+        if (!m_data || offset >= m_size)
+            return;
+
+        WIN32_MEMORY_RANGE_ENTRY range{const_cast<std::byte*>(m_data) + offset, std::min(size, m_size - offset)};
+        PrefetchVirtualMemory(GetCurrentProcess(), 1, &range, 0);
+    }
+
+#else
+
+    bool MappedFile::open(const char* path)
+    {
+        close();
+
+        m_fd = ::open(path, O_RDONLY | O_CLOEXEC);
+        if (m_fd < 0)
+        {
+            std::fprintf(stderr, "Failed to open %s\n", path);
+            return false;
+        }
+
+        struct stat info;
+        if (fstat(m_fd, &info) != 0 || info.st_size == 0)
+        {
+            std::fprintf(stderr, "Failed to map %s: empty or unreadable\n", path);
+            close();
+            return false;
+        }
+
+        void* view = mmap(nullptr, static_cast<std::size_t>(info.st_size), PROT_READ, MAP_SHARED, m_fd, 0);
+        if (view == MAP_FAILED)
+        {
+            std::fprintf(stderr, "Failed to map %s\n", path);
+            close();
+            return false;
+        }
+
+        m_data = static_cast<const std::byte*>(view);
+        m_size = static_cast<std::size_t>(info.st_size);
+        return true;
+    }
+
+    void MappedFile::close()
+    {
+        if (m_data)
+            munmap(const_cast<std::byte*>(m_data), m_size);
+        if (m_fd >= 0)
+            ::close(m_fd);
+        m_data = nullptr;
+        m_size = 0;
+        m_fd = -1;
+    }
+
+    void MappedFile::prefetch(std::size_t offset, std::size_t size) const
+    {
+        if (!m_data || offset >= m_size)
+            return;
+
+        // madvise wants a page-aligned start.
+        const std::size_t page = static_cast<std::size_t>(sysconf(_SC_PAGESIZE));
+        const std::size_t begin = offset & ~(page - 1);
+        const std::size_t end = offset + std::min(size, m_size - offset);
+        madvise(const_cast<std::byte*>(m_data) + begin, end - begin, MADV_WILLNEED);
+    }
+
+#endif
+}
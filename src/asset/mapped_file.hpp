@@ -0,0 +1,40 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace bloom
+{
+    // Read-only memory mapping of a whole file. Pages come in from the OS
+    // page cache on first touch; nothing is read up front.
+    class MappedFile
+    {
+    public:
+        MappedFile() = default;
+        ~MappedFile();
+
+        MappedFile(const MappedFile&) = delete;
+        MappedFile& operator=(const MappedFile&) = delete;
+
+        bool open(const char* path);
+        void close();
+        bool isOpen() const { return m_data != nullptr; }
+
+        const std::byte* data() const { return m_data; }
+        std::size_t size() const { return m_size; }
+
+        // Hints that [offset, offset + size) will be read soon, so the OS
+        // starts reading it in the background. Advisory only.
+        void prefetch(std::size_t offset, std::size_t size) const;
+
+    private:
+        const std::byte* m_data = nullptr;
+        std::size_t m_size = 0;
+#if defined(_WIN32)
+        void* m_file = nullptr;
+        void* m_mapping = nullptr;
+#else
+        int m_fd = -1;
+#endif
+    };
+}
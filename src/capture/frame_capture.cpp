@@ -0,0 +1,194 @@
+#include "capture/frame_capture.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <filesystem>
+
+#include "capture/image_encoders.hpp"
+#include "memory/memory.hpp"
+
+namespace bloom
+{
+    FrameCapture::FrameCapture(JobSystem& jobs, GLStateCache* renderState, std::string directory, CaptureFormat format, int slots)
+        : m_jobs(jobs)
+        , m_state(renderState ? *renderState : m_ownState)
+        , m_directory(std::move(directory))
+        , m_format(format)
+        , m_slotCount(std::clamp(slots, 2, kMaxSlots))
+    {
+        MemoryTagScope tag(MemoryTag::Capture);
+        std::error_code error;
+        std::filesystem::create_directories(m_directory, error);
+    }
+
+    FrameCapture::~FrameCapture()
+    {
+        // release() needs the context; by now it must already have run.
+        m_jobs.wait(m_encoding);
+    }
+
+    bool FrameCapture::allocate(int width, int height)
+    {
+        release();
+
+        const GLsizeiptr size = static_cast<GLsizeiptr>(width) * height * 4;
+        const GLbitfield flags = GL_MAP_READ_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+
+        for (int i = 0; i < m_slotCount; ++i)
+        {
+            Slot& slot = m_slots[i];
+            glCreateBuffers(1, &slot.buffer);
+            glNamedBufferStorage(slot.buffer, size, nullptr, flags);
+            slot.mapped = glMapNamedBufferRange(slot.buffer, 0, size, flags);
+            if (!slot.mapped)
+            {
+                std::fprintf(stderr, "Failed to map a %lld byte capture buffer\n", static_cast<long long>(size));
+                release();
+                return false;
+            }
+        }
+
+        m_width = width;
+        m_height = height;
+        m_next = 0;
+        return true;
+    }
+
+    void FrameCapture::release()
+    {
+        flush();
+        for (int i = 0; i < m_slotCount; ++i)
+        {
+            Slot& slot = m_slots[i];
+            if (slot.buffer)
+            {
+                glUnmapNamedBuffer(slot.buffer);
+                m_state.forgetBuffer(slot.buffer);
+                glDeleteBuffers(1, &slot.buffer);
+            }
+            slot.buffer = 0;
+            slot.mapped = nullptr;
+        }
+        m_width = 0;
+        m_height = 0;
+    }
+
+    void FrameCapture::capture(uint64_t frameIndex, int width, int height)
+    {
+        if (width <= 0 || height <= 0)
+            return;
+        if ((width != m_width || height != m_height) && !allocate(width, height))
+            return;
+
+        poll();
+
+        Slot& slot = m_slots[m_next];
+        if (slot.state.load(std::memory_order_acquire) != Free)
+        {
+            ++m_stalls;
+            if (slot.state.load(std::memory_order_acquire) == Reading)
+                finishRead(slot, true);
+            while (slot.state.load(std::memory_order_acquire) != Free)
+            {
+                if (!m_jobs.helpOnce())
+                    std::this_thread::yield();
+            }
+        }
+
+        // Nothing else writes to our own cache, so its shadow is only
+        // good for this call.
+        const bool ownState = &m_state == &m_ownState;
+        if (ownState)
+            m_state.invalidate();
+
+        slot.frame = frameIndex;
+        m_state.bindFramebuffer(0);
+        m_state.bindBuffer(GL_PIXEL_PACK_BUFFER, slot.buffer);
+        m_state.pixelStore(GL_PACK_ALIGNMENT, 4);
+        glReadPixels(0, 0, width, height, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+        if (ownState)
+            m_state.bindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+        slot.fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+        slot.state.store(Reading, std::memory_order_release);
+
+        m_next = (m_next + 1) % m_slotCount;
+        ++m_captured;
+    }
+
+    void FrameCapture::poll()
+    {
+        // Slots are filled in ring order, so the oldest read is the first
+        // one after m_next.
+        for (int i = 0; i < m_slotCount; ++i)
+        {
+            Slot& slot = m_slots[(m_next + i) % m_slotCount];
+            if (slot.state.load(std::memory_order_acquire) == Reading)
+                finishRead(slot, false);
+        }
+    }
+
+    void FrameCapture::finishRead(Slot& slot, bool wait)
+    {
+        GLenum result = glClientWaitSync(slot.fence, GL_SYNC_FLUSH_COMMANDS_BIT, 0);
+        while (wait && result == GL_TIMEOUT_EXPIRED)
+            result = glClientWaitSync(slot.fence, 0, 1000000);
+        if (result == GL_TIMEOUT_EXPIRED)
+            return;
+
+        glDeleteSync(slot.fence);
+        slot.fence = nullptr;
+        slot.state.store(Encoding, std::memory_order_release);
+
+        Slot* target = &slot;
+        m_jobs.run([this, target]() { encode(*target); }, &m_encoding);
+    }
+
+    void FrameCapture::encode(Slot& slot)
+    {
+        static constexpr const char* kExtensions[] = {"png", "qoi", "rgba"};
+        MemoryTagScope tag(MemoryTag::Capture);
+
+        char name[64];
+        std::snprintf(name, sizeof(name), "frame_%06llu.%s", static_cast<unsigned long long>(slot.frame),
+                      kExtensions[static_cast<int>(m_format)]);
+        const std::string path = (std::filesystem::path(m_directory) / name).string();
+
+        bool written = false;
+        switch (m_format)
+        {
+        case CaptureFormat::Png:
+            written = writePng(path.c_str(), slot.mapped, m_width, m_height);
+            break;
+        case CaptureFormat::Qoi:
+            written = writeQoi(path.c_str(), slot.mapped, m_width, m_height);
+            break;
+        case CaptureFormat::Raw:
+            written = writeRaw(path.c_str(), slot.mapped, m_width, m_height);
+            break;
+        }
+
+        (written ? m_encoded : m_failed).fetch_add(1, std::memory_order_relaxed);
+        slot.state.store(Free, std::memory_order_release);
+    }
+
+    void FrameCapture::flush()
+    {
+        for (int i = 0; i < m_slotCount; ++i)
+        {
+            Slot& slot = m_slots[(m_next + i) % m_slotCount];
+            if (slot.state.load(std::memory_order_acquire) == Reading)
+                finishRead(slot, true);
+        }
+        m_jobs.wait(m_encoding);
+    }
+
+    FrameCapture::Stats FrameCapture::stats() const
+    {
+        Stats stats;
+        stats.captured = m_captured;
+        stats.encoded = m_encoded.load(std::memory_order_relaxed);
+        stats.failed = m_failed.load(std::memory_order_relaxed);
+        stats.stalls = m_stalls;
+        return stats;
+    }
+}
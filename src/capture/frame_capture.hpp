@@ -0,0 +1,108 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <string>
+
+#include "glad/glad.h"
+
+#include "jobs/job_system.hpp"
+#include "render/gl_state_cache.hpp"
+
+namespace bloom
+{
+    enum class CaptureFormat
+    {
+        Png,
+        Qoi,
+        Raw,
+    };
+
+    // Asynchronous readback of rendered frames to image files.
+    //
+    // capture() queues a glReadPixels into one of a ring of persistently
+    // mapped pixel-pack buffers and fences it; it does not wait. Later calls
+    // notice finished fences and hand the mapped memory to an encoding job,
+    // so the GPU copy of frame N overlaps the rendering of frames N+1 and
+    // N+2 and encoding runs on the job system's workers. When every slot is
+    // still busy capture() waits (helping with jobs) rather than dropping.
+    //
+    // All methods except stats() must run on the GL context thread. The
+    // framebuffer, pack buffer and pack alignment are set through the render
+    // context's GLStateCache. Without one the capture uses a cache of its
+    // own and leaves the pack buffer unbound, as it found it.
+    class FrameCapture
+    {
+    public:
+        static constexpr int kMaxSlots = 8;
+
+        struct Stats
+        {
+            uint64_t captured = 0;
+            uint64_t encoded = 0;
+            uint64_t failed = 0;
+            uint64_t stalls = 0;    // capture() calls that had to wait for a slot
+        };
+
+        FrameCapture(JobSystem& jobs, GLStateCache* renderState, std::string directory, CaptureFormat format, int slots = 4);
+        ~FrameCapture();
+
+        FrameCapture(const FrameCapture&) = delete;
+        FrameCapture& operator=(const FrameCapture&) = delete;
+
+        // Reads the default framebuffer's color buffer; call it before the
+        // buffers are swapped. Leaves the framebuffer binding at 0.
+        void capture(uint64_t frameIndex, int width, int height);
+
+        // Hands every finished readback to the encoders without blocking.
+        void poll();
+
+        // Waits until every queued frame has been written.
+        void flush();
+
+        // Flushes and frees the GL objects. Must run before the context dies.
+        void release();
+
+        Stats stats() const;
+
+    private:
+        enum SlotState : int
+        {
+            Free,
+            Reading,
+            Encoding,
+        };
+
+        struct Slot
+        {
+            GLuint buffer = 0;
+            const void* mapped = nullptr;
+            GLsync fence = nullptr;
+            std::atomic<int> state{Free};
+            uint64_t frame = 0;
+        };
+
+        bool allocate(int width, int height);
+        void finishRead(Slot& slot, bool wait);
+        void encode(Slot& slot);
+
+        JobSystem& m_jobs;
+        GLStateCache m_ownState;
+        GLStateCache& m_state;
+        std::string m_directory;
+        CaptureFormat m_format;
+        int m_slotCount;
+        int m_width = 0;
+        int m_height = 0;
+        int m_next = 0;
+
+        std::array<Slot, kMaxSlots> m_slots;
+        JobCounter m_encoding;
+
+        std::atomic<uint64_t> m_encoded{0};
+        std::atomic<uint64_t> m_failed{0};
+        uint64_t m_captured = 0;
+        uint64_t m_stalls = 0;
+    };
+}
@@ -0,0 +1,70 @@
+#include "capture/frame_sink.hpp"
+
+#include <cstring>
+
+#if defined(_WIN32)
+#include <fcntl.h>
+#include <io.h>
+#endif
+
+namespace bloom
+{
+    FrameSink::~FrameSink()
+    {
+        close();
+    }
+
+    bool FrameSink::open(const char* path)
+    {
+        close();
+
+        if (std::strcmp(path, "-") == 0)
+        {
+#if defined(_WIN32)
+            _setmode(_fileno(stdout), _O_BINARY);
+#endif
+            m_file = stdout;
+            m_ownsFile = false;
+        }
+        else
+        {
+            m_file = std::fopen(path, "wb");
+            m_ownsFile = true;
+            if (!m_file)
+            {
+                std::fprintf(stderr, "Failed to open frame output %s\n", path);
+                return false;
+            }
+        }
+
+        std::setvbuf(m_file, nullptr, _IONBF, 0);
+        return true;
+    }
+
+    void FrameSink::close()
+    {
+        if (m_file && m_ownsFile)
+            std::fclose(m_file);
+        else if (m_file)
+            std::fflush(m_file);
+        m_file = nullptr;
+        m_ownsFile = false;
+    }
+
+    bool FrameSink::write(const void* pixels, std::size_t size)
+    {
+        if (!m_file)
+            return false;
+
+        if (std::fwrite(pixels, 1, size, m_file) != size)
+        {
+            std::fprintf(stderr, "Frame output write failed\n");
+            close();
+            return false;
+        }
+
+        ++m_frames;
+        m_bytes += size;
+        return true;
+    }
+}
@@ -0,0 +1,42 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+
+namespace bloom
+{
+    // Raw frame stream to a file or, for the path "-", to stdout. Frames are
+    // written back to back with no header, which is what encoders expect for
+    // rawvideo input, e.g.
+    //
+    //   bloom_engine --headless --output - | ffmpeg -f rawvideo -pix_fmt rgba
+    //       -s 1280x720 -r 60 -i - -vf vflip out.mp4
+    //
+    // The stream is unbuffered: each frame goes straight from the caller's
+    // memory to the file descriptor.
+    class FrameSink
+    {
+    public:
+        FrameSink() = default;
+        ~FrameSink();
+
+        FrameSink(const FrameSink&) = delete;
+        FrameSink& operator=(const FrameSink&) = delete;
+
+        bool open(const char* path);
+        void close();
+        bool isOpen() const { return m_file != nullptr; }
+
+        bool write(const void* pixels, std::size_t size);
+
+        uint64_t framesWritten() const { return m_frames; }
+        uint64_t bytesWritten() const { return m_bytes; }
+
+    private:
+        std::FILE* m_file = nullptr;
+        bool m_ownsFile = false;
+        uint64_t m_frames = 0;
+        uint64_t m_bytes = 0;
+    };
+}
@@ -0,0 +1,165 @@
+#include "capture/image_encoders.hpp"
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <memory>
+
+#define STB_IMAGE_WRITE_STATIC
+#define STB_IMAGE_WRITE_IMPLEMENTATION
+#include "stb_image_write.h"
+
+namespace bloom
+{
+    namespace
+    {
+        struct FileCloser
+        {
+            void operator()(std::FILE* file) const { std::fclose(file); }
+        };
+
+        using File = std::unique_ptr<std::FILE, FileCloser>;
+
+        void putBigEndian(std::FILE* file, uint32_t value)
+        {
+            const unsigned char bytes[4] = {
+                static_cast<unsigned char>(value >> 24), static_cast<unsigned char>(value >> 16),
+                static_cast<unsigned char>(value >> 8), static_cast<unsigned char>(value)};
+            std::fwrite(bytes, 1, sizeof(bytes), file);
+        }
+
+        // Captures favour speed over size. Set once at startup because the
+        // level is a global shared by every encoding thread.
+        [[maybe_unused]] const bool s_pngLevelSet = (stbi_write_png_compression_level = 1, true);
+    }
+
+    bool writePng(const char* path, const void* pixels, int width, int height)
+    {
+        // Start at the last row and walk backwards to flip without a copy.
+        const int stride = width * 4;
+        const auto* last = static_cast<const unsigned char*>(pixels) + static_cast<std::ptrdiff_t>(height - 1) * stride;
+        return stbi_write_png(path, width, height, 4, last, -stride) != 0;
+    }
+
+    // "Quite OK Image" format, see https://qoiformat.org/qoi-specification.pdf.
+    bool writeQoi(const char* path, const void* pixels, int width, int height)
+    {
+        File file(std::fopen(path, "wb"));
+        if (!file)
+            return false;
+
+        std::fwrite("qoif", 1, 4, file.get());
+        putBigEndian(file.get(), static_cast<uint32_t>(width));
+        putBigEndian(file.get(), static_cast<uint32_t>(height));
+        std::fputc(4, file.get());   // channels
+        std::fputc(0, file.get());   // sRGB with linear alpha
+
+        struct Pixel
+        {
+            uint8_t r, g, b, a;
+            bool operator==(const Pixel&) const = default;
+        };
+
+        Pixel index[64] = {};
+        Pixel previous{0, 0, 0, 255};
+        int run = 0;
+
+        // Worst case is 5 bytes per pixel; encode a row at a time into a
+        // local buffer to keep the stdio calls out of the inner loop.
+        std::unique_ptr<uint8_t[]> buffer(new uint8_t[static_cast<std::size_t>(width) * 5 + 1]);
+        const auto* rows = static_cast<const uint8_t*>(pixels);
+
+        for (int y = height - 1; y >= 0; --y)
+        {
+            uint8_t* out = buffer.get();
+            const uint8_t* row = rows + static_cast<std::size_t>(y) * width * 4;
+
+            for (int x = 0; x < width; ++x)
+            {
+                const Pixel pixel{row[x * 4], row[x * 4 + 1], row[x * 4 + 2], row[x * 4 + 3]};
+                const bool lastPixel = y == 0 && x == width - 1;
+
+                if (pixel == previous)
+                {
+                    if (++run == 62 || lastPixel)
+                    {
+                        *out++ = static_cast<uint8_t>(0xc0 | (run - 1));
+                        run = 0;
+                    }
+                    continue;
+                }
+
+                if (run > 0)
+                {
+                    *out++ = static_cast<uint8_t>(0xc0 | (run - 1));
+                    run = 0;
+                }
+
+                const int hash = (pixel.r * 3 + pixel.g * 5 + pixel.b * 7 + pixel.a * 11) % 64;
+                if (index[hash] == pixel)
+                {
+                    *out++ = static_cast<uint8_t>(hash);
+                }
+                else
+                {
+                    index[hash] = pixel;
+                    if (pixel.a == previous.a)
+                    {
+                        const int dr = static_cast<int8_t>(pixel.r - previous.r);
+                        const int dg = static_cast<int8_t>(pixel.g - previous.g);
+                        const int db = static_cast<int8_t>(pixel.b - previous.b);
+                        const int drg = dr - dg;
+                        const int dbg = db - dg;
+
+                        if (dr > -3 && dr < 2 && dg > -3 && dg < 2 && db > -3 && db < 2)
+                        {
+                            *out++ = static_cast<uint8_t>(0x40 | (dr + 2) << 4 | (dg + 2) << 2 | (db + 2));
+                        }
+                        else if (drg > -9 && drg < 8 && dg > -33 && dg < 32 && dbg > -9 && dbg < 8)
+                        {
+                            *out++ = static_cast<uint8_t>(0x80 | (dg + 32));
+                            *out++ = static_cast<uint8_t>((drg + 8) << 4 | (dbg + 8));
+                        }
+                        else
+                        {
+                            *out++ = 0xfe;
+                            *out++ = pixel.r;
+                            *out++ = pixel.g;
+                            *out++ = pixel.b;
+                        }
+                    }
+                    else
+                    {
+                        *out++ = 0xff;
+                        *out++ = pixel.r;
+                        *out++ = pixel.g;
+                        *out++ = pixel.b;
+                        *out++ = pixel.a;
+                    }
+                }
+                previous = pixel;
+            }
+
+            std::fwrite(buffer.get(), 1, static_cast<std::size_t>(out - buffer.get()), file.get());
+        }
+
+        static const uint8_t padding[8] = {0, 0, 0, 0, 0, 0, 0, 1};
+        return std::fwrite(padding, 1, sizeof(padding), file.get()) == sizeof(padding);
+    }
+
+    bool writeRaw(const char* path, const void* pixels, int width, int height)
+    {
+        File file(std::fopen(path, "wb"));
+        if (!file)
+            return false;
+
+        const std::size_t stride = static_cast<std::size_t>(width) * 4;
+        const auto* rows = static_cast<const uint8_t*>(pixels);
+        for (int y = height - 1; y >= 0; --y)
+        {
+            if (std::fwrite(rows + y * stride, 1, stride, file.get()) != stride)
+                return false;
+        }
+        return true;
+    }
+}
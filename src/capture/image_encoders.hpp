@@ -0,0 +1,11 @@
+#pragma once
+
+namespace bloom
+{
+    // Writers for tightly packed RGBA8 images stored bottom-up, the way GL
+    // reads them back. All of them flip to top-down on output and are safe
+    // to call from several worker threads at once.
+    bool writePng(const char* path, const void* pixels, int width, int height);
+    bool writeQoi(const char* path, const void* pixels, int width, int height);
+    bool writeRaw(const char* path, const void* pixels, int width, int height);
+}
@@ -0,0 +1,26 @@
+#include "capture/osmesa_readback.hpp"
+
+#include "GLFW/glfw3.h"
+
+// osmesa.h would drag in the system GL header, which clashes with glad; the
+// handle type is all glfw3native.h needs from it.
+typedef struct osmesa_context* OSMesaContext;
+#define GLFW_EXPOSE_NATIVE_OSMESA
+#define GLFW_NATIVE_INCLUDE_NONE
+#include "GLFW/glfw3native.h"
+
+namespace bloom
+{
+    bool osmesaColorBuffer(GLFWwindow* window, FrameView& frame)
+    {
+        int format = 0;
+        void* buffer = nullptr;
+        if (!glfwGetOSMesaColorBuffer(window, &frame.width, &frame.height, &format, &buffer))
+            return false;
+
+        // GLFW always creates OSMesa contexts with OSMESA_RGBA.
+        frame.pixels = buffer;
+        frame.bytesPerPixel = 4;
+        return buffer != nullptr;
+    }
+}
@@ -0,0 +1,24 @@
+#pragma once
+
+#include <cstddef>
+
+struct GLFWwindow;
+
+namespace bloom
+{
+    struct FrameView
+    {
+        const void* pixels = nullptr;
+        int width = 0;
+        int height = 0;
+        int bytesPerPixel = 0;
+
+        std::size_t size() const { return static_cast<std::size_t>(width) * height * bytesPerPixel; }
+    };
+
+    // Exposes the OSMesa color buffer behind a window created with
+    // GLFW_OSMESA_CONTEXT_API. OSMesa renders straight into client memory,
+    // so once the GPU work is finished (glFinish) the frame can be consumed
+    // in place without a glReadPixels copy. Rows are bottom-up, RGBA8.
+    bool osmesaColorBuffer(GLFWwindow* window, FrameView& frame);
+}
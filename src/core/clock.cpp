@@ -0,0 +1,56 @@
+#include "core/clock.hpp"
+
+#include <chrono>
+#include <thread>
+
+#include "GLFW/glfw3.h"
+
+namespace bloom
+{
+    void Clock::init()
+    {
+        s_frequency = glfwGetTimerFrequency();
+        if (s_frequency == 0)
+            s_frequency = 1;
+    }
+
+    uint64_t Clock::now()
+    {
+        return glfwGetTimerValue();
+    }
+
+    double Clock::toSeconds(uint64_t ticks)
+    {
+        return static_cast<double>(ticks) / static_cast<double>(s_frequency);
+    }
+
+    double Clock::toMilliseconds(uint64_t ticks)
+    {
+        return toSeconds(ticks) * 1000.0;
+    }
+
+    uint64_t Clock::fromSeconds(double seconds)
+    {
+        return static_cast<uint64_t>(seconds * static_cast<double>(s_frequency));
+    }
+
+    void Clock::sleepUntil(uint64_t deadline)
+    {
+        // OS sleeps routinely overshoot by a millisecond or more, so only hand
+        // the bulk of the wait to the scheduler and yield through the rest.
+        const uint64_t slack = fromSeconds(0.002);
+
+        for (;;)
+        {
+            const uint64_t current = now();
+            if (current >= deadline)
+                return;
+
+            const uint64_t remaining = deadline - current;
+            if (remaining > slack)
+                std::this_thread::sleep_for(std::chrono::duration<double>(toSeconds(remaining - slack)));
+            else
+                std::this_thread::yield();
+        }
+    }
+}
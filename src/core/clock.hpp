@@ -0,0 +1,30 @@
+#pragma once
+
+#include <cstdint>
+
+namespace bloom
+{
+    // Thin wrapper over the GLFW high-resolution timer. Raw values are in
+    // platform ticks (nanoseconds on the POSIX timer); all conversions go
+    // through the frequency reported by glfwGetTimerFrequency.
+    // glfwInit must have been called before any of these are used.
+    class Clock
+    {
+    public:
+        static void init();
+
+        static uint64_t now();
+        static uint64_t frequency() { return s_frequency; }
+
+        static double toSeconds(uint64_t ticks);
+        static double toMilliseconds(uint64_t ticks);
+        static uint64_t fromSeconds(double seconds);
+
+        // Sleeps coarsely and spins for the last stretch, so the caller wakes
+        // close to the deadline without burning a whole core.
+        static void sleepUntil(uint64_t deadline);
+
+    private:
+        static inline uint64_t s_frequency = 1;
+    };
+}
@@ -0,0 +1,535 @@
+#include "core/engine.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <ctime>
+#include <string>
+
+#include "glad/glad.h"
+#include "GLFW/glfw3.h"
+
+#include "capture/frame_sink.hpp"
+#include "capture/osmesa_readback.hpp"
+#include "core/clock.hpp"
+#include "core/profiler.hpp"
+#include "memory/frame_arena.hpp"
+#include "memory/memory.hpp"
+#include "render/frame_pacer.hpp"
+
+namespace bloom
+{
+    namespace
+    {
+        void errorCallback(int error, const char* description)
+        {
+            std::fprintf(stderr, "GLFW error %d: %s\n", error, description);
+        }
+    }
+
+    Engine::Engine(const EngineConfig& config)
+        : m_config(config)
+        , m_uploadThread(config.stagingSize)
+    {
+        unsigned workers = m_config.workerThreads;
+        if (workers == 0)
+        {
+            const unsigned hardware = std::thread::hardware_concurrency();
+            workers = hardware > 4 ? hardware - 3 : 1;
+        }
+
+        m_jobs = std::make_unique<JobSystem>(workers);
+        m_jobs->registerThread();
+        m_io = std::make_unique<AsyncReader>(m_config.ioBackend);
+    }
+
+    Engine::~Engine()
+    {
+        requestExit();
+        if (m_simulationThread.joinable())
+            m_simulationThread.join();
+        if (m_renderThread.joinable())
+            m_renderThread.join();
+        m_io.reset();
+        m_uploadThread.stop();
+        m_shaderCache.stop();
+        if (m_window)
+            glfwDestroyWindow(m_window);
+        glfwTerminate();
+    }
+
+    bool Engine::initWindow()
+    {
+        glfwSetErrorCallback(errorCallback);
+        glfwInitAllocator(&Memory::glfwAllocator());
+        if (m_config.headless)
+            glfwInitHint(GLFW_PLATFORM, GLFW_PLATFORM_NULL);
+        if (!glfwInit())
+            return false;
+
+        Clock::init();
+        m_tickInterval = Clock::fromSeconds(1.0 / m_config.tickRate);
+
+        glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, m_config.glMajor);
+        glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, m_config.glMinor);
+        glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_COMPAT_PROFILE);
+        if (m_config.headless)
+        {
+            glfwWindowHint(GLFW_CONTEXT_CREATION_API, GLFW_OSMESA_CONTEXT_API);
+            glfwWindowHint(GLFW_VISIBLE, GLFW_FALSE);
+        }
+
+        m_window = glfwCreateWindow(m_config.width, m_config.height, m_config.title, nullptr, nullptr);
+        if (!m_window)
+            return false;
+
+        m_input.attach(m_window);
+        return true;
+    }
+
+    int Engine::run(Application& app)
+    {
+        if (!initWindow())
+        {
+            std::fprintf(stderr, "Failed to create the main window\n");
+            return EXIT_FAILURE;
+        }
+
+        // Before any thread makes the main context current.
+        if (m_config.sharedUploadContext)
+            m_uploadThread.createContext(m_window);
+        if (m_config.shaderCache)
+            m_shaderCache.createContext(m_window);
+
+        if (!app.onInit(*this))
+            return EXIT_FAILURE;
+
+        startProfiling();
+
+        if (m_config.headless)
+            return runHeadless(app);
+
+        m_running.store(true, std::memory_order_release);
+        m_renderThread = std::thread(&Engine::renderMain, this, std::ref(app));
+
+        // The simulation only starts once the render thread has a context, so
+        // the first ticks are not spent racing an uninitialised renderer.
+        while (!m_renderReady.load(std::memory_order_acquire) && !m_renderFailed.load(std::memory_order_acquire))
+            glfwWaitEventsTimeout(0.01);
+
+        if (!m_renderFailed.load(std::memory_order_acquire))
+        {
+            m_uploadThread.start();
+            m_simulationThread = std::thread(&Engine::simulationMain, this, std::ref(app));
+        }
+
+        while (running() && !glfwWindowShouldClose(m_window))
+        {
+            FrameArena::thread().reset();
+            if (m_config.profile)
+            {
+                glfwWaitEventsTimeout(0.5);
+                updateTitle();
+            }
+            else
+            {
+                glfwWaitEvents();
+            }
+        }
+
+        requestExit();
+        if (m_simulationThread.joinable())
+            m_simulationThread.join();
+        m_renderThread.join();
+        shutdown(app);
+
+        const FrameTimingSummary timing = m_frameStats.summarize();
+        std::printf("%llu frames, mean %.3f ms, jitter %.3f ms, p99 %.3f ms, gpu wait %.3f ms\n",
+                    static_cast<unsigned long long>(timing.frames), timing.meanMs, timing.jitterMs,
+                    timing.p99Ms, timing.meanGpuWaitMs);
+
+        const InputLatencySummary input = m_input.latency();
+        if (input.events > 0)
+        {
+            std::printf("%llu input events, latency mean %.3f ms, p99 %.3f ms, max %.3f ms, %llu dropped\n",
+                        static_cast<unsigned long long>(input.events), input.meanMs, input.p99Ms, input.maxMs,
+                        static_cast<unsigned long long>(input.dropped));
+        }
+
+        return m_renderFailed.load(std::memory_order_acquire) ? EXIT_FAILURE : EXIT_SUCCESS;
+    }
+
+    void Engine::requestExit()
+    {
+        if (m_running.exchange(false, std::memory_order_acq_rel))
+            glfwPostEmptyEvent();
+    }
+
+    bool Engine::loadGL()
+    {
+        const auto loader = reinterpret_cast<GLADloadproc>(glfwGetProcAddress);
+        const int loaded = m_config.glLoader == GLLoader::Lazy
+                               ? gladLoadGLLoaderLazyVersion(loader, m_config.glMajor, m_config.glMinor)
+                               : gladLoadGLLoaderVersion(loader, m_config.glMajor, m_config.glMinor);
+        if (loaded == 0)
+            return false;
+
+        // Before onRenderInit, so the programs it builds are cached too.
+        if (m_config.shaderCache)
+        {
+            const std::string directory = m_config.shaderCachePath ? m_config.shaderCachePath : ShaderCache::defaultDirectory();
+            if (directory.empty())
+                std::fprintf(stderr, "No user cache directory; shaders will not be cached\n");
+            else if (m_shaderCache.open(directory.c_str()))
+                ShaderCache::install(&m_shaderCache);
+        }
+        return true;
+    }
+
+    void Engine::setRenderState(GLStateCache* state)
+    {
+        m_renderState = state;
+        m_uploadThread.setRenderState(state);
+    }
+
+    void Engine::startCapture()
+    {
+        if (m_config.capturePath)
+            m_capture = std::make_unique<FrameCapture>(*m_jobs, m_renderState, m_config.capturePath, m_config.captureFormat);
+    }
+
+    void Engine::stopCapture()
+    {
+        if (!m_capture)
+            return;
+
+        m_capture->release();
+        const FrameCapture::Stats stats = m_capture->stats();
+        std::fprintf(stderr, "Captured %llu frames, %llu written, %llu failed, %llu stalls\n",
+                     static_cast<unsigned long long>(stats.captured), static_cast<unsigned long long>(stats.encoded),
+                     static_cast<unsigned long long>(stats.failed), static_cast<unsigned long long>(stats.stalls));
+        m_capture.reset();
+    }
+
+    void Engine::startProfiling()
+    {
+        if (!m_config.profile && !m_config.tracePath)
+            return;
+
+        Profiler::setThreadName("Main");
+        Profiler::setEnabled(true);
+        if (m_config.tracePath)
+            Profiler::beginTrace();
+    }
+
+    void Engine::stopProfiling()
+    {
+        if (!Profiler::enabled())
+            return;
+
+        Profiler::setEnabled(false);
+        if (m_config.tracePath && Profiler::writeTrace(m_config.tracePath))
+            std::fprintf(stderr, "Wrote trace to %s\n", m_config.tracePath);
+
+        if (!m_config.profile)
+            return;
+
+        std::fprintf(stderr, "%-12s %-24s %10s %10s %8s\n", "track", "zone", "mean ms", "max ms", "calls");
+        for (const ZoneSummary& zone : Profiler::summary())
+            std::fprintf(stderr, "%-12s %-24s %10.3f %10.3f %8.1f\n", zone.track, zone.name, zone.meanMs, zone.maxMs, zone.callsPerFrame);
+        if (const uint64_t dropped = Profiler::droppedEvents())
+            std::fprintf(stderr, "%llu profiler events dropped\n", static_cast<unsigned long long>(dropped));
+    }
+
+    void Engine::countAllocations(uint64_t frameIndex)
+    {
+        // The first frames warm caches, pools and arenas up; from then on
+        // the engine's frame loop should not touch the heap at all.
+        if (frameIndex == kWarmupFrames)
+        {
+            m_allocationBaseline = Memory::allocationCount();
+        }
+        else if (frameIndex > kWarmupFrames)
+        {
+            m_steadyFrames = frameIndex - kWarmupFrames;
+            m_steadyAllocations = Memory::allocationCount() - m_allocationBaseline;
+        }
+    }
+
+    void Engine::reportMemory()
+    {
+        // Counted up to the last frame, so shutdown's own frees and
+        // allocations do not show up as a regression.
+        if (m_steadyFrames > 0 && m_steadyAllocations > 0)
+        {
+            std::fprintf(stderr, "Warning: %llu heap allocations in %llu steady-state frames (%.2f per frame); expected none\n",
+                         static_cast<unsigned long long>(m_steadyAllocations), static_cast<unsigned long long>(m_steadyFrames),
+                         static_cast<double>(m_steadyAllocations) / m_steadyFrames);
+        }
+        else if (m_steadyFrames > 0)
+        {
+            std::fprintf(stderr, "No heap allocations in %llu steady-state frames\n", static_cast<unsigned long long>(m_steadyFrames));
+        }
+        if (m_config.profile)
+            std::fprintf(stderr, "%s", Memory::formatStats().c_str());
+    }
+
+    void Engine::runUploads()
+    {
+        BLOOM_PROFILE_ZONE("Uploads");
+        // One byte budget per frame: uploads that run inline for lack of an
+        // upload thread spend it first, queued GL work gets what is left.
+        uint64_t spent = 0;
+        m_uploadThread.collect(m_config.uploadBudget, &spent);
+        if (spent < m_config.uploadBudget)
+            m_uploads.process(m_config.uploadBudget - spent);
+        m_shaderCache.collect();
+    }
+
+    void Engine::drainUploads()
+    {
+        // Loads still queued will not be needed; cancelling them runs their
+        // callbacks, and whatever those queued uploads now, while the app
+        // can still release the GL objects they create.
+        m_io->cancelAll();
+        m_io->waitIdle();
+        m_uploadThread.drain();
+        m_uploads.flush();
+
+        m_shaderCache.drain();
+        ShaderCache::install(nullptr);
+        const ShaderCache::Stats shaders = m_shaderCache.stats();
+        if (shaders.hits + shaders.misses > 0)
+        {
+            std::fprintf(stderr, "Shader cache: %llu hits in %.1f ms, %llu misses in %.1f ms, %llu rejected, %llu failed\n",
+                         static_cast<unsigned long long>(shaders.hits), shaders.loadMs,
+                         static_cast<unsigned long long>(shaders.misses), shaders.compileMs,
+                         static_cast<unsigned long long>(shaders.rejected), static_cast<unsigned long long>(shaders.failed));
+        }
+    }
+
+    void Engine::updateTitle()
+    {
+        const uint64_t now = Clock::now();
+        if (now - m_titleUpdate < Clock::fromSeconds(0.5))
+            return;
+        m_titleUpdate = now;
+
+        const std::string title = std::string(m_config.title) + " | " + Profiler::formatSummary(4);
+        glfwSetWindowTitle(m_window, title.c_str());
+    }
+
+    // Every exit from run() after a successful onInit() ends here, once
+    // the render side is down.
+    void Engine::shutdown(Application& app)
+    {
+        m_uploadThread.stop();
+        m_shaderCache.stop();
+        app.onShutdown();
+        stopProfiling();
+        reportMemory();
+    }
+
+    int Engine::runHeadless(Application& app)
+    {
+        glfwMakeContextCurrent(m_window);
+        if (!loadGL() || !app.onRenderInit())
+        {
+            std::fprintf(stderr, "Failed to initialise the headless renderer\n");
+            glfwMakeContextCurrent(nullptr);
+            shutdown(app);
+            return EXIT_FAILURE;
+        }
+
+        FrameSink sink;
+        if (m_config.outputPath && !sink.open(m_config.outputPath))
+        {
+            app.onRenderShutdown();
+            glfwMakeContextCurrent(nullptr);
+            shutdown(app);
+            return EXIT_FAILURE;
+        }
+
+        m_running.store(true, std::memory_order_release);
+        m_uploadThread.start();
+        startCapture();
+        if (Profiler::enabled() && !m_gpuProfiler.init())
+            std::fprintf(stderr, "GPU timer queries need GL 3.3; GPU zones are disabled\n");
+
+        TickContext tick;
+        tick.deltaTime = Clock::toSeconds(m_tickInterval);
+        FrameContext frame;
+        frame.tickInterval = m_tickInterval;
+
+        const uint64_t start = Clock::now();
+        const std::clock_t cpuStart = std::clock();
+        uint64_t lastFrame = start;
+
+        // Simulation and rendering share this thread and a virtual clock:
+        // every frame shows exactly the tick just simulated.
+        while (running() && (m_config.frameLimit == 0 || frame.index < m_config.frameLimit))
+        {
+            FrameArena::thread().reset();
+            tick.timestamp = tick.index * m_tickInterval;
+            tick.input = &m_input.update(UINT64_MAX);
+            {
+                BLOOM_PROFILE_ZONE("Tick");
+                app.onTick(tick);
+            }
+            ++tick.index;
+
+            glfwGetFramebufferSize(m_window, &frame.width, &frame.height);
+            frame.timestamp = tick.timestamp + m_tickInterval;
+            m_gpuProfiler.beginFrame();
+            runUploads();
+            {
+                BLOOM_PROFILE_ZONE("Render");
+                BLOOM_PROFILE_GPU_ZONE(m_gpuProfiler, "Frame");
+                app.onRender(frame);
+            }
+            if (m_capture)
+                m_capture->capture(frame.index, frame.width, frame.height);
+            m_gpuProfiler.endFrame();
+            {
+                BLOOM_PROFILE_ZONE("Finish");
+                glFinish();
+            }
+
+            FrameView view;
+            if (sink.isOpen() && osmesaColorBuffer(m_window, view) && !sink.write(view.pixels, view.size()))
+                requestExit();
+
+            const uint64_t now = Clock::now();
+            m_frameStats.record(now - lastFrame, 0);
+            lastFrame = now;
+            ++frame.index;
+            Profiler::endFrame();
+            countAllocations(frame.index);
+        }
+
+        stopCapture();
+        m_gpuProfiler.release();
+        drainUploads();
+        app.onRenderShutdown();
+        glfwMakeContextCurrent(nullptr);
+        sink.close();
+        shutdown(app);
+
+        const double seconds = Clock::toSeconds(Clock::now() - start);
+        const double cpuSeconds = static_cast<double>(std::clock() - cpuStart) / CLOCKS_PER_SEC;
+        std::fprintf(stderr, "%llu frames in %.3f s: %.1f frames/s, %.1f frames per CPU second\n",
+                     static_cast<unsigned long long>(frame.index), seconds,
+                     seconds > 0.0 ? frame.index / seconds : 0.0,
+                     cpuSeconds > 0.0 ? frame.index / cpuSeconds : 0.0);
+        return EXIT_SUCCESS;
+    }
+
+    void Engine::simulationMain(Application& app)
+    {
+        m_jobs->registerThread();
+        Profiler::setThreadName("Simulation");
+
+        TickContext tick;
+        tick.deltaTime = Clock::toSeconds(m_tickInterval);
+
+        uint64_t next = Clock::now();
+
+        while (running())
+        {
+            int steps = 0;
+            while (Clock::now() >= next && steps < m_config.maxCatchUpTicks)
+            {
+                FrameArena::thread().reset();
+                tick.timestamp = next;
+                tick.input = &m_input.update(next);
+                {
+                    BLOOM_PROFILE_ZONE("Tick");
+                    app.onTick(tick);
+                }
+                next += m_tickInterval;
+                ++tick.index;
+                ++steps;
+            }
+
+            // Still behind after the catch-up budget: drop the backlog rather
+            // than let every later tick arrive late too.
+            const uint64_t now = Clock::now();
+            if (now >= next)
+                next = now + m_tickInterval;
+
+            Clock::sleepUntil(next);
+        }
+    }
+
+    void Engine::renderMain(Application& app)
+    {
+        m_jobs->registerThread();
+        Profiler::setThreadName("Render");
+        MemoryTagScope tag(MemoryTag::Render);
+        glfwMakeContextCurrent(m_window);
+
+        if (!loadGL() || !app.onRenderInit())
+        {
+            std::fprintf(stderr, "Failed to initialise the renderer\n");
+            m_renderFailed.store(true, std::memory_order_release);
+            requestExit();
+            glfwMakeContextCurrent(nullptr);
+            return;
+        }
+
+        glfwSwapInterval(m_config.vsync ? 1 : 0);
+        m_renderReady.store(true, std::memory_order_release);
+        glfwPostEmptyEvent();
+
+        startCapture();
+        if (Profiler::enabled() && !m_gpuProfiler.init())
+            std::fprintf(stderr, "GPU timer queries need GL 3.3; GPU zones are disabled\n");
+        FramePacer pacer(m_config.maxFramesInFlight);
+        FrameContext frame;
+        frame.tickInterval = m_tickInterval;
+        uint64_t lastPresent = Clock::now();
+
+        while (running())
+        {
+            FrameArena::thread().reset();
+            uint64_t gpuWait = 0;
+            {
+                BLOOM_PROFILE_ZONE("Pacer wait");
+                gpuWait = pacer.wait();
+            }
+
+            glfwGetFramebufferSize(m_window, &frame.width, &frame.height);
+            frame.timestamp = Clock::now();
+            m_gpuProfiler.beginFrame();
+            runUploads();
+            {
+                BLOOM_PROFILE_ZONE("Render");
+                BLOOM_PROFILE_GPU_ZONE(m_gpuProfiler, "Frame");
+                app.onRender(frame);
+            }
+            if (m_capture)
+                m_capture->capture(frame.index, frame.width, frame.height);
+            m_gpuProfiler.endFrame();
+
+            {
+                BLOOM_PROFILE_ZONE("Swap");
+                glfwSwapBuffers(m_window);
+            }
+            pacer.signal();
+
+            const uint64_t present = Clock::now();
+            m_frameStats.record(present - lastPresent, gpuWait);
+            lastPresent = present;
+            ++frame.index;
+            Profiler::endFrame();
+            countAllocations(frame.index);
+        }
+
+        pacer.release();
+        stopCapture();
+        m_gpuProfiler.release();
+        drainUploads();
+        app.onRenderShutdown();
+        glfwMakeContextCurrent(nullptr);
+    }
+}
@@ -0,0 +1,207 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <thread>
+
+#include "capture/frame_capture.hpp"
+#include "core/frame_stats.hpp"
+#include "input/input_system.hpp"
+#include "io/async_reader.hpp"
+#include "jobs/job_system.hpp"
+#include "render/gpu_profiler.hpp"
+#include "render/shader_cache.hpp"
+#include "render/upload_queue.hpp"
+#include "render/upload_thread.hpp"
+
+struct GLFWwindow;
+
+namespace bloom
+{
+    class Engine;
+
+    enum class GLLoader
+    {
+        Eager,  // resolve every entry point up front
+        Lazy,   // resolve each entry point on its first call
+    };
+
+    struct EngineConfig
+    {
+        const char* title = "bloom";
+        int width = 1280;
+        int height = 720;
+        bool vsync = true;
+
+        // GL version the engine requests and loads entry points for.
+        int glMajor = 4;
+        int glMinor = 6;
+        GLLoader glLoader = GLLoader::Eager;
+
+        double tickRate = 60.0;
+        // Ticks the simulation may run back-to-back to catch up before it
+        // drops time instead of spiralling.
+        int maxCatchUpTicks = 5;
+        // How many frames the CPU may record ahead of the GPU.
+        int maxFramesInFlight = 2;
+        // Background job workers; 0 sizes the pool to the machine, leaving
+        // room for the main, simulation and render threads.
+        unsigned workerThreads = 0;
+
+        // Asset reads run on their own I/O thread; see AsyncReader.
+        IoBackendKind ioBackend = IoBackendKind::Auto;
+        // Bytes of GPU uploads the render thread runs per frame, shared by
+        // the UploadQueue and, without an upload thread, inline uploads.
+        uint64_t uploadBudget = 32ull << 20;
+        // Buffer, mesh and texture uploads run on a thread with a hidden
+        // shared context; without one they fall back to the render thread.
+        bool sharedUploadContext = true;
+        uint64_t stagingSize = UploadThread::kDefaultStagingSize;
+        // Linked program binaries are kept between runs in
+        // `shaderCachePath`, or ShaderCache::defaultDirectory() when it is
+        // null, and program requests compile on a thread with a hidden
+        // shared context. Off, every program compiles from source on the
+        // render thread.
+        bool shaderCache = true;
+        const char* shaderCachePath = nullptr;
+
+        // Offline rendering on GLFW's null platform with an OSMesa context.
+        // Headless runs advance one tick per frame in virtual time, as fast
+        // as the CPU allows, and stream frames straight from the OSMesa
+        // color buffer to `outputPath` ("-" for stdout) when it is set.
+        bool headless = false;
+        uint64_t frameLimit = 0;    // 0 runs until requestExit()
+        const char* outputPath = nullptr;
+
+        // When set, every frame is read back asynchronously and encoded
+        // into this directory on the job system.
+        const char* capturePath = nullptr;
+        CaptureFormat captureFormat = CaptureFormat::Png;
+
+        // Turns on the CPU and GPU zone profiler. `profile` keeps a rolling
+        // summary in the window title and prints it on exit; `tracePath`
+        // records a Chrome trace of the whole run and writes it on exit.
+        bool profile = false;
+        const char* tracePath = nullptr;
+    };
+
+    struct TickContext
+    {
+        uint64_t index = 0;
+        double deltaTime = 0.0;     // seconds, constant
+        uint64_t timestamp = 0;     // Clock value the tick was scheduled for
+        // Input up to `timestamp`; headless runs see whatever was queued.
+        const InputState* input = nullptr;
+    };
+
+    struct FrameContext
+    {
+        uint64_t index = 0;
+        uint64_t timestamp = 0;     // Clock value the frame is being drawn for
+        uint64_t tickInterval = 0;  // Clock ticks per simulation step
+        int width = 0;
+        int height = 0;
+    };
+
+    // Hooks the engine calls from its threads. onTick runs on the simulation
+    // thread, the render hooks run on the render thread with the GL context
+    // current, and everything else runs on the main thread.
+    class Application
+    {
+    public:
+        virtual ~Application() = default;
+
+        virtual bool onInit(Engine&) { return true; }
+        virtual void onTick(const TickContext& tick) = 0;
+        virtual bool onRenderInit() { return true; }
+        virtual void onRender(const FrameContext& frame) = 0;
+        virtual void onRenderShutdown() {}
+        virtual void onShutdown() {}
+    };
+
+    // Owns the window and the three engine threads: the main thread pumps
+    // GLFW events, the simulation thread advances the app in fixed steps,
+    // and the render thread draws as fast as the frame pacer lets it.
+    class Engine
+    {
+    public:
+        // Frames before the steady-state heap allocation count starts.
+        static constexpr uint64_t kWarmupFrames = 120;
+
+        explicit Engine(const EngineConfig& config);
+        ~Engine();
+
+        Engine(const Engine&) = delete;
+        Engine& operator=(const Engine&) = delete;
+
+        int run(Application& app);
+        void requestExit();
+        bool running() const { return m_running.load(std::memory_order_acquire); }
+
+        GLFWwindow* window() const { return m_window; }
+        const EngineConfig& config() const { return m_config; }
+        uint64_t tickInterval() const { return m_tickInterval; }
+        JobSystem& jobs() { return *m_jobs; }
+        AsyncReader& io() { return *m_io; }
+        // Pushed from anywhere, run on the render thread before onRender.
+        UploadQueue& uploads() { return m_uploads; }
+        // Uploads from anywhere; callbacks run on the render thread before
+        // onRender.
+        UploadThread& uploadThread() { return m_uploadThread; }
+        // Render thread, in onRenderInit. The application's state cache for
+        // the render context, which the engine's own GL work there (inline
+        // uploads, frame capture) binds through.
+        void setRenderState(GLStateCache* state);
+        // Installed for compileProgram() on the render thread; request()
+        // callbacks run on the render thread before onRender.
+        ShaderCache& shaders() { return m_shaderCache; }
+        // Bind actions in Application::onInit; the simulation owns it after.
+        InputSystem& input() { return m_input; }
+        FrameTimingSummary frameTiming() const { return m_frameStats.summarize(); }
+        // Render thread only; zones are no-ops unless profiling is enabled.
+        GpuProfiler& gpuProfiler() { return m_gpuProfiler; }
+
+    private:
+        bool initWindow();
+        bool loadGL();
+        void startCapture();
+        void stopCapture();
+        void startProfiling();
+        void stopProfiling();
+        void updateTitle();
+        void countAllocations(uint64_t frameIndex);
+        void reportMemory();
+        void runUploads();
+        void drainUploads();
+        int runHeadless(Application& app);
+        void shutdown(Application& app);
+        void simulationMain(Application& app);
+        void renderMain(Application& app);
+
+        EngineConfig m_config;
+        GLFWwindow* m_window = nullptr;
+        uint64_t m_tickInterval = 0;
+        std::unique_ptr<JobSystem> m_jobs;
+        UploadQueue m_uploads;
+        UploadThread m_uploadThread;
+        ShaderCache m_shaderCache;
+        std::unique_ptr<AsyncReader> m_io;
+        std::unique_ptr<FrameCapture> m_capture;
+        GLStateCache* m_renderState = nullptr;
+        InputSystem m_input;
+
+        std::atomic<bool> m_running{false};
+        std::atomic<bool> m_renderReady{false};
+        std::atomic<bool> m_renderFailed{false};
+        std::thread m_simulationThread;
+        std::thread m_renderThread;
+
+        FrameStats m_frameStats;
+        GpuProfiler m_gpuProfiler;
+        uint64_t m_titleUpdate = 0;
+        uint64_t m_allocationBaseline = 0;
+        uint64_t m_steadyFrames = 0;
+        uint64_t m_steadyAllocations = 0;
+    };
+}
@@ -0,0 +1,57 @@
+#include "core/frame_stats.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+#include "core/clock.hpp"
+
+namespace bloom
+{
+    void FrameStats::record(uint64_t intervalTicks, uint64_t gpuWaitTicks)
+    {
+        std::lock_guard lock(m_mutex);
+        const std::size_t slot = m_total % kWindow;
+        m_intervals[slot] = intervalTicks;
+        m_gpuWaits[slot] = gpuWaitTicks;
+        m_count = std::min(m_count + 1, kWindow);
+        ++m_total;
+    }
+
+    FrameTimingSummary FrameStats::summarize() const
+    {
+        std::array<double, kWindow> samples{};
+        double gpuWait = 0.0;
+        FrameTimingSummary summary;
+
+        {
+            std::lock_guard lock(m_mutex);
+            summary.frames = m_total;
+            for (std::size_t i = 0; i < m_count; ++i)
+            {
+                samples[i] = Clock::toMilliseconds(m_intervals[i]);
+                gpuWait += Clock::toMilliseconds(m_gpuWaits[i]);
+            }
+        }
+
+        const std::size_t count = std::min<std::size_t>(summary.frames, kWindow);
+        if (count == 0)
+            return summary;
+
+        double sum = 0.0;
+        for (std::size_t i = 0; i < count; ++i)
+            sum += samples[i];
+        summary.meanMs = sum / static_cast<double>(count);
+        summary.meanGpuWaitMs = gpuWait / static_cast<double>(count);
+
+        double variance = 0.0;
+        for (std::size_t i = 0; i < count; ++i)
+            variance += (samples[i] - summary.meanMs) * (samples[i] - summary.meanMs);
+        summary.jitterMs = std::sqrt(variance / static_cast<double>(count));
+
+        std::sort(samples.begin(), samples.begin() + count);
+        summary.minMs = samples[0];
+        summary.maxMs = samples[count - 1];
+        summary.p99Ms = samples[std::min(count - 1, (count * 99) / 100)];
+        return summary;
+    }
+}
@@ -0,0 +1,38 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+
+namespace bloom
+{
+    struct FrameTimingSummary
+    {
+        uint64_t frames = 0;
+        double meanMs = 0.0;
+        double minMs = 0.0;
+        double maxMs = 0.0;
+        double jitterMs = 0.0;   // standard deviation of the frame interval
+        double p99Ms = 0.0;
+        double meanGpuWaitMs = 0.0;
+    };
+
+    // Rolling window of present-to-present intervals. Written by the render
+    // thread, read by whoever wants to report it.
+    class FrameStats
+    {
+    public:
+        static constexpr std::size_t kWindow = 240;
+
+        void record(uint64_t intervalTicks, uint64_t gpuWaitTicks);
+        FrameTimingSummary summarize() const;
+
+    private:
+        mutable std::mutex m_mutex;
+        std::array<uint64_t, kWindow> m_intervals{};
+        std::array<uint64_t, kWindow> m_gpuWaits{};
+        std::size_t m_count = 0;
+        uint64_t m_total = 0;
+    };
+}
@@ -0,0 +1,307 @@
+#include "core/profiler.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <memory>
+#include <mutex>
+#include <string_view>
+#include <unordered_map>
+
+#include "memory/memory.hpp"
+
+namespace bloom
+{
+    namespace
+    {
+        struct ZoneKey
+        {
+            std::string_view name;
+            uint32_t track;
+
+            bool operator==(const ZoneKey&) const = default;
+        };
+
+        struct ZoneKeyHash
+        {
+            std::size_t operator()(const ZoneKey& key) const
+            {
+                return std::hash<std::string_view>{}(key.name) ^ (static_cast<std::size_t>(key.track) * 0x9e3779b97f4a7c15ull);
+            }
+        };
+
+        struct ZoneHistory
+        {
+            const char* name = nullptr;
+            const ProfileTrack* track = nullptr;
+            std::array<uint64_t, Profiler::kSummaryFrames> ticks{};
+            std::array<uint32_t, Profiler::kSummaryFrames> calls{};
+            uint64_t frameTicks = 0;
+            uint32_t frameCalls = 0;
+        };
+
+        struct TraceEvent
+        {
+            const char* name;
+            uint32_t track;
+            uint64_t begin;
+            uint64_t end;
+        };
+
+        struct ProfilerState
+        {
+            std::mutex registryMutex;
+            std::array<std::unique_ptr<ProfileTrack>, Profiler::kMaxTracks> tracks;
+            std::atomic<int> trackCount{0};
+            std::atomic<uint64_t> untracked{0};
+
+            std::mutex collectMutex;
+            std::unordered_map<ZoneKey, std::size_t, ZoneKeyHash> lookup;
+            std::vector<ZoneHistory> zones;
+            uint64_t frames = 0;
+
+            bool tracing = false;
+            uint64_t traceOrigin = 0;
+            uint64_t traceDropped = 0;
+            std::vector<TraceEvent> trace;
+        };
+
+        ProfilerState& state()
+        {
+            static ProfilerState s_state;
+            return s_state;
+        }
+
+        thread_local char t_threadName[32] = {};
+        thread_local bool t_untracked = false;
+
+        ProfileTrack* addTrack(ProfilerState& s, std::string name)
+        {
+            MemoryTagScope tag(MemoryTag::Profiler);
+            std::lock_guard lock(s.registryMutex);
+            const int index = s.trackCount.load(std::memory_order_relaxed);
+            if (index >= Profiler::kMaxTracks)
+                return nullptr;
+
+            s.tracks[index] = std::make_unique<ProfileTrack>(static_cast<uint32_t>(index), std::move(name));
+            s.trackCount.store(index + 1, std::memory_order_release);
+            return s.tracks[index].get();
+        }
+
+        void writeEscaped(std::FILE* file, const char* text)
+        {
+            for (; *text; ++text)
+            {
+                const unsigned char c = static_cast<unsigned char>(*text);
+                if (c == '"' || c == '\\')
+                    std::fprintf(file, "\\%c", c);
+                else if (c < 0x20)
+                    std::fprintf(file, "\\u%04x", c);
+                else
+                    std::fputc(c, file);
+            }
+        }
+    }
+
+    void Profiler::setThreadName(const char* name)
+    {
+        std::snprintf(t_threadName, sizeof(t_threadName), "%s", name);
+    }
+
+    ProfileTrack* Profiler::registerThread()
+    {
+        // Threads beyond kMaxTracks go unprofiled; remember that so their
+        // zones do not take the registry lock every time.
+        ProfilerState& s = state();
+        if (t_untracked)
+        {
+            s.untracked.fetch_add(1, std::memory_order_relaxed);
+            return nullptr;
+        }
+
+        std::string name = t_threadName[0] ? t_threadName : "Thread " + std::to_string(s.trackCount.load());
+        t_track = addTrack(s, std::move(name));
+        t_untracked = t_track == nullptr;
+        return t_track;
+    }
+
+    ProfileTrack* Profiler::createTrack(const char* name)
+    {
+        return addTrack(state(), name);
+    }
+
+    void Profiler::endFrame()
+    {
+        MemoryTagScope tag(MemoryTag::Profiler);
+        ProfilerState& s = state();
+        std::lock_guard lock(s.collectMutex);
+
+        const int trackCount = s.trackCount.load(std::memory_order_acquire);
+        for (int t = 0; t < trackCount; ++t)
+        {
+            ProfileTrack& track = *s.tracks[t];
+            const uint64_t head = track.m_head.load(std::memory_order_acquire);
+            uint64_t tail = track.m_tail.load(std::memory_order_relaxed);
+
+            for (; tail != head; ++tail)
+            {
+                const ProfileEvent& event = track.m_events[tail & (ProfileTrack::kCapacity - 1)];
+
+                const ZoneKey key{event.name, track.id()};
+                auto [it, inserted] = s.lookup.try_emplace(key, s.zones.size());
+                if (inserted)
+                {
+                    s.zones.emplace_back();
+                    s.zones.back().name = event.name;
+                    s.zones.back().track = &track;
+                }
+
+                ZoneHistory& zone = s.zones[it->second];
+                zone.frameTicks += event.end - event.begin;
+                ++zone.frameCalls;
+
+                if (s.tracing)
+                {
+                    if (s.trace.size() < kMaxTraceEvents)
+                        s.trace.push_back({event.name, track.id(), event.begin, event.end});
+                    else
+                        ++s.traceDropped;
+                }
+            }
+
+            track.m_tail.store(tail, std::memory_order_release);
+        }
+
+        const std::size_t slot = s.frames % kSummaryFrames;
+        for (ZoneHistory& zone : s.zones)
+        {
+            zone.ticks[slot] = zone.frameTicks;
+            zone.calls[slot] = zone.frameCalls;
+            zone.frameTicks = 0;
+            zone.frameCalls = 0;
+        }
+        ++s.frames;
+    }
+
+    void Profiler::beginTrace()
+    {
+        ProfilerState& s = state();
+        std::lock_guard lock(s.collectMutex);
+        s.trace.clear();
+        s.traceDropped = 0;
+        s.traceOrigin = Clock::now();
+        s.tracing = true;
+    }
+
+    bool Profiler::writeTrace(const char* path)
+    {
+        ProfilerState& s = state();
+        std::lock_guard lock(s.collectMutex);
+        s.tracing = false;
+
+        std::FILE* file = std::fopen(path, "wb");
+        if (!file)
+        {
+            std::fprintf(stderr, "Failed to open %s for writing\n", path);
+            return false;
+        }
+
+        std::fprintf(file, "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n");
+        std::fprintf(file, "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":1,\"args\":{\"name\":\"bloom\"}}");
+
+        const int trackCount = s.trackCount.load(std::memory_order_acquire);
+        for (int t = 0; t < trackCount; ++t)
+        {
+            std::fprintf(file, ",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%d,\"args\":{\"name\":\"", t);
+            writeEscaped(file, s.tracks[t]->name().c_str());
+            std::fprintf(file, "\"}}");
+        }
+
+        // Chrome wants microseconds; GPU events may start slightly before
+        // the origin after clock calibration, hence the signed offset.
+        const double usPerTick = 1e6 / static_cast<double>(Clock::frequency());
+        for (const TraceEvent& event : s.trace)
+        {
+            const double ts = static_cast<double>(static_cast<int64_t>(event.begin - s.traceOrigin)) * usPerTick;
+            const double dur = static_cast<double>(event.end - event.begin) * usPerTick;
+            std::fprintf(file, ",\n{\"name\":\"");
+            writeEscaped(file, event.name);
+            std::fprintf(file, "\",\"ph\":\"X\",\"pid\":1,\"tid\":%u,\"ts\":%.3f,\"dur\":%.3f}", event.track, ts, dur);
+        }
+
+        std::fprintf(file, "\n]}\n");
+        const bool ok = std::ferror(file) == 0;
+        std::fclose(file);
+
+        if (s.traceDropped)
+            std::fprintf(stderr, "Trace was truncated: %llu events dropped\n", static_cast<unsigned long long>(s.traceDropped));
+        s.trace.clear();
+        s.trace.shrink_to_fit();
+        return ok;
+    }
+
+    std::vector<ZoneSummary> Profiler::summary()
+    {
+        ProfilerState& s = state();
+        std::lock_guard lock(s.collectMutex);
+
+        std::vector<ZoneSummary> result;
+        const std::size_t window = static_cast<std::size_t>(std::min<uint64_t>(s.frames, kSummaryFrames));
+        if (window == 0)
+            return result;
+
+        result.reserve(s.zones.size());
+        for (const ZoneHistory& zone : s.zones)
+        {
+            uint64_t total = 0;
+            uint64_t peak = 0;
+            uint64_t calls = 0;
+            for (std::size_t i = 0; i < window; ++i)
+            {
+                total += zone.ticks[i];
+                peak = std::max(peak, zone.ticks[i]);
+                calls += zone.calls[i];
+            }
+            if (calls == 0)
+                continue;
+
+            ZoneSummary entry;
+            entry.name = zone.name;
+            entry.track = zone.track->name().c_str();
+            entry.meanMs = Clock::toMilliseconds(total) / static_cast<double>(window);
+            entry.maxMs = Clock::toMilliseconds(peak);
+            entry.callsPerFrame = static_cast<double>(calls) / static_cast<double>(window);
+            result.push_back(entry);
+        }
+
+        std::sort(result.begin(), result.end(), [](const ZoneSummary& a, const ZoneSummary& b)
+        {
+            return a.meanMs > b.meanMs;
+        });
+        return result;
+    }
+
+    std::string Profiler::formatSummary(std::size_t maxZones)
+    {
+        const std::vector<ZoneSummary> zones = summary();
+
+        std::string text;
+        char buffer[128];
+        for (std::size_t i = 0; i < zones.size() && i < maxZones; ++i)
+        {
+            std::snprintf(buffer, sizeof(buffer), "%s%s/%s %.2f ms", i ? ", " : "", zones[i].track, zones[i].name, zones[i].meanMs);
+            text += buffer;
+        }
+        return text;
+    }
+
+    uint64_t Profiler::droppedEvents()
+    {
+        ProfilerState& s = state();
+        uint64_t dropped = s.untracked.load(std::memory_order_relaxed);
+
+        const int trackCount = s.trackCount.load(std::memory_order_acquire);
+        for (int t = 0; t < trackCount; ++t)
+            dropped += s.tracks[t]->m_dropped.load(std::memory_order_relaxed);
+        return dropped;
+    }
+}
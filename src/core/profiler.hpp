@@ -0,0 +1,155 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "core/clock.hpp"
+
+namespace bloom
+{
+    struct ProfileEvent
+    {
+        const char* name;   // must outlive the profiler; string literals in practice
+        uint64_t begin;     // Clock ticks
+        uint64_t end;
+    };
+
+    struct ZoneSummary
+    {
+        const char* name = nullptr;
+        const char* track = nullptr;
+        double meanMs = 0.0;        // time per frame, averaged over the window
+        double maxMs = 0.0;
+        double callsPerFrame = 0.0;
+    };
+
+    // Timeline of events written by one thread (or one GPU queue) and
+    // drained by the collector. A single-producer ring: the writer only
+    // touches m_head and the reader only m_tail, so recording never locks.
+    class ProfileTrack
+    {
+    public:
+        static constexpr std::size_t kCapacity = 8192;
+
+        ProfileTrack(uint32_t id, std::string name)
+            : m_id(id), m_name(std::move(name))
+        {
+        }
+
+        void record(const char* name, uint64_t begin, uint64_t end)
+        {
+            const uint64_t head = m_head.load(std::memory_order_relaxed);
+            if (head - m_cachedTail >= kCapacity)
+            {
+                m_cachedTail = m_tail.load(std::memory_order_acquire);
+                if (head - m_cachedTail >= kCapacity)
+                {
+                    m_dropped.fetch_add(1, std::memory_order_relaxed);
+                    return;
+                }
+            }
+
+            m_events[head & (kCapacity - 1)] = {name, begin, end};
+            m_head.store(head + 1, std::memory_order_release);
+        }
+
+        uint32_t id() const { return m_id; }
+        const std::string& name() const { return m_name; }
+
+    private:
+        friend class Profiler;
+
+        std::array<ProfileEvent, kCapacity> m_events;
+        uint32_t m_id;
+        std::string m_name;
+
+        alignas(64) std::atomic<uint64_t> m_head{0};
+        uint64_t m_cachedTail = 0;
+        alignas(64) std::atomic<uint64_t> m_tail{0};
+        std::atomic<uint64_t> m_dropped{0};
+    };
+
+    // Process-wide frame profiler. CPU zones go to a lazily created track
+    // per thread; GpuProfiler feeds GPU timings through a track of its own.
+    // endFrame() drains every track on the calling thread, keeps a rolling
+    // per-zone summary, and appends to the trace while one is recording.
+    // Zones cost two timer reads and a ring write while enabled and a single
+    // relaxed load while disabled, so they can stay in release builds.
+    class Profiler
+    {
+    public:
+        static constexpr int kMaxTracks = 64;
+        static constexpr std::size_t kSummaryFrames = 120;
+        static constexpr std::size_t kMaxTraceEvents = 4u << 20;
+
+        static void setEnabled(bool enabled) { s_enabled.store(enabled, std::memory_order_relaxed); }
+        static bool enabled() { return s_enabled.load(std::memory_order_relaxed); }
+
+        // Names the calling thread's track; takes effect if it has none yet.
+        static void setThreadName(const char* name);
+        // Null once kMaxTracks tracks exist.
+        static ProfileTrack* threadTrack()
+        {
+            return t_track ? t_track : registerThread();
+        }
+        // Adds a track that is not tied to a thread, e.g. a GPU timeline.
+        // Null once kMaxTracks tracks exist.
+        static ProfileTrack* createTrack(const char* name);
+
+        static void endFrame();
+
+        // Chrome trace / Perfetto JSON of everything collected between the
+        // two calls. writeTrace() stops the recording.
+        static void beginTrace();
+        static bool writeTrace(const char* path);
+
+        static std::vector<ZoneSummary> summary();
+        // The most expensive zones on one line, for the title bar or a log.
+        static std::string formatSummary(std::size_t maxZones);
+        static uint64_t droppedEvents();
+
+    private:
+        static ProfileTrack* registerThread();
+
+        static inline std::atomic<bool> s_enabled{false};
+        static inline thread_local ProfileTrack* t_track = nullptr;
+    };
+
+    // Times its own scope on the calling thread's track.
+    class ProfileZone
+    {
+    public:
+        explicit ProfileZone(const char* name)
+        {
+            if (!Profiler::enabled())
+                return;
+            m_track = Profiler::threadTrack();
+            if (!m_track)
+                return;
+            m_name = name;
+            m_begin = Clock::now();
+        }
+
+        ~ProfileZone()
+        {
+            if (m_track)
+                m_track->record(m_name, m_begin, Clock::now());
+        }
+
+        ProfileZone(const ProfileZone&) = delete;
+        ProfileZone& operator=(const ProfileZone&) = delete;
+
+    private:
+        ProfileTrack* m_track = nullptr;
+        const char* m_name = nullptr;
+        uint64_t m_begin = 0;
+    };
+}
+
+#define BLOOM_PROFILE_CONCAT_(a, b) a##b
+#define BLOOM_PROFILE_CONCAT(a, b) BLOOM_PROFILE_CONCAT_(a, b)
+#define BLOOM_PROFILE_ZONE(name) ::bloom::ProfileZone BLOOM_PROFILE_CONCAT(bloomZone_, __LINE__)(name)
@@ -0,0 +1,81 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <type_traits>
+
+namespace bloom
+{
+    // Bounded single-producer / single-consumer queue. One thread may push
+    // and one other thread may peek and pop; neither ever blocks or locks.
+    // Each side caches the other's index so the shared cache line is only
+    // touched when the ring looks full (or empty).
+    template <typename T, std::size_t Capacity>
+    class SpscRing
+    {
+        static_assert(Capacity > 0 && (Capacity & (Capacity - 1)) == 0, "capacity must be a power of two");
+        static_assert(std::is_trivially_copyable_v<T>, "ring items are copied with plain stores");
+
+    public:
+        static constexpr std::size_t kCapacity = Capacity;
+
+        // Producer side. Returns false when the ring is full.
+        bool push(const T& item)
+        {
+            const std::size_t head = m_head.load(std::memory_order_relaxed);
+            if (head - m_cachedTail == Capacity)
+            {
+                m_cachedTail = m_tail.load(std::memory_order_acquire);
+                if (head - m_cachedTail == Capacity)
+                    return false;
+            }
+
+            m_items[head & (Capacity - 1)] = item;
+            m_head.store(head + 1, std::memory_order_release);
+            return true;
+        }
+
+        // Consumer side. The pointer stays valid until the next pop().
+        const T* peek()
+        {
+            const std::size_t tail = m_tail.load(std::memory_order_relaxed);
+            if (tail == m_cachedHead)
+            {
+                m_cachedHead = m_head.load(std::memory_order_acquire);
+                if (tail == m_cachedHead)
+                    return nullptr;
+            }
+            return &m_items[tail & (Capacity - 1)];
+        }
+
+        // Consumer side; only after peek() returned an item.
+        void pop()
+        {
+            m_tail.store(m_tail.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+        }
+
+        bool pop(T& item)
+        {
+            const T* front = peek();
+            if (!front)
+                return false;
+            item = *front;
+            pop();
+            return true;
+        }
+
+        // Approximate when called while the other side is active.
+        std::size_t size() const
+        {
+            return m_head.load(std::memory_order_acquire) - m_tail.load(std::memory_order_acquire);
+        }
+
+    private:
+        alignas(64) std::atomic<std::size_t> m_head{0};
+        std::size_t m_cachedTail = 0;
+        alignas(64) std::atomic<std::size_t> m_tail{0};
+        std::size_t m_cachedHead = 0;
+        alignas(64) std::array<T, Capacity> m_items;
+    };
+}
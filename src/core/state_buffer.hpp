@@ -0,0 +1,86 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+
+namespace bloom
+{
+    // Lock-free triple buffer carrying simulation snapshots from the sim
+    // thread to the render thread. Every published slot carries the snapshot
+    // of the tick before it as well, so the reader always interpolates
+    // between two consecutive ticks even when it misses some.
+    //
+    // Exactly one thread may publish and exactly one thread may acquire.
+    template <typename T>
+    class StateBuffer
+    {
+    public:
+        StateBuffer() = default;
+        StateBuffer(const StateBuffer&) = delete;
+        StateBuffer& operator=(const StateBuffer&) = delete;
+
+        // Writer side. `timestamp` is the Clock value the state is valid at.
+        void publish(const T& state, uint64_t timestamp)
+        {
+            Slot& slot = m_slots[m_write];
+            slot.previous = m_hasLast ? m_last : state;
+            slot.current = state;
+            slot.timestamp = timestamp;
+            m_last = state;
+            m_hasLast = true;
+
+            m_write = m_ready.exchange(static_cast<uint8_t>(m_write | kFresh), std::memory_order_acq_rel) & kIndexMask;
+        }
+
+        // Reader side. Swaps in the newest published slot, if any. Returns
+        // true when the reader now sees a state it had not seen before.
+        bool acquire()
+        {
+            if ((m_ready.load(std::memory_order_relaxed) & kFresh) == 0)
+                return false;
+
+            m_read = m_ready.exchange(m_read, std::memory_order_acq_rel) & kIndexMask;
+            m_hasRead = true;
+            return true;
+        }
+
+        bool valid() const { return m_hasRead; }
+
+        const T& previous() const { return m_slots[m_read].previous; }
+        const T& current() const { return m_slots[m_read].current; }
+        uint64_t timestamp() const { return m_slots[m_read].timestamp; }
+
+        // Blend factor between previous() and current() for a frame drawn at
+        // `now`. Rendering runs one tick behind the simulation so the factor
+        // stays inside [0, 1] while the sim keeps up.
+        float alpha(uint64_t now, uint64_t interval) const
+        {
+            if (!m_hasRead || interval == 0 || now <= timestamp())
+                return 0.f;
+
+            const double t = static_cast<double>(now - timestamp()) / static_cast<double>(interval);
+            return static_cast<float>(std::min(t, 1.0));
+        }
+
+    private:
+        static constexpr uint8_t kIndexMask = 0x3;
+        static constexpr uint8_t kFresh = 0x4;
+
+        struct Slot
+        {
+            T previous{};
+            T current{};
+            uint64_t timestamp = 0;
+        };
+
+        Slot m_slots[3];
+        std::atomic<uint8_t> m_ready{1};
+        uint8_t m_write = 0;
+        uint8_t m_read = 2;
+
+        T m_last{};
+        bool m_hasLast = false;
+        bool m_hasRead = false;
+    };
+}
@@ -0,0 +1,127 @@
+#include "ecs/archetype.hpp"
+
+#include <cstring>
+#include <new>
+
+#include "memory/memory.hpp"
+
+namespace bloom
+{
+    namespace
+    {
+        uint32_t alignUp(uint32_t value, uint32_t alignment)
+        {
+            return (value + alignment - 1) & ~(alignment - 1);
+        }
+
+        // Lays out `capacity` rows and returns the bytes they need, filling in
+        // column offsets on the way.
+        uint32_t layout(ComponentMask mask, uint32_t capacity, std::array<uint32_t, kMaxComponentTypes>& offsets)
+        {
+            uint32_t offset = capacity * static_cast<uint32_t>(sizeof(Entity));
+            for (ComponentMask bits = mask; bits; bits &= bits - 1)
+            {
+                const auto id = static_cast<ComponentId>(std::countr_zero(bits));
+                const ComponentInfo& info = ComponentRegistry::info(id);
+                offset = alignUp(offset, info.alignment);
+                offsets[id] = offset;
+                offset += capacity * info.size;
+            }
+            return offset;
+        }
+    }
+
+    const Entity* ChunkView::entities() const
+    {
+        return reinterpret_cast<const Entity*>(m_data + m_archetype->entityOffset());
+    }
+
+    void* ChunkView::column(ComponentId id) const
+    {
+        return m_archetype->has(id) ? m_data + m_archetype->columnOffset(id) : nullptr;
+    }
+
+    Archetype::Archetype(ComponentMask mask)
+        : m_mask(mask)
+    {
+        uint32_t rowSize = sizeof(Entity);
+        for (ComponentMask bits = mask; bits; bits &= bits - 1)
+            rowSize += ComponentRegistry::info(static_cast<ComponentId>(std::countr_zero(bits))).size;
+
+        // Start from the unpadded estimate and back off until the padding
+        // between columns fits as well.
+        m_capacity = static_cast<uint32_t>(kChunkSize / rowSize);
+        while (m_capacity > 1 && layout(mask, m_capacity, m_columnOffsets) > kChunkSize)
+            --m_capacity;
+        layout(mask, m_capacity, m_columnOffsets);
+    }
+
+    Archetype::~Archetype()
+    {
+        for (Chunk& chunk : m_chunks)
+            ::operator delete(chunk.data, std::align_val_t{64});
+    }
+
+    Archetype::Location Archetype::allocate(Entity entity)
+    {
+        if (m_chunks.empty() || m_chunks.back().count == m_capacity)
+        {
+            MemoryTagScope tag(MemoryTag::Ecs);
+            Chunk chunk;
+            chunk.data = static_cast<std::byte*>(::operator new(kChunkSize, std::align_val_t{64}));
+            m_chunks.push_back(chunk);
+        }
+
+        Chunk& chunk = m_chunks.back();
+        const Location location{static_cast<uint32_t>(m_chunks.size() - 1), chunk.count++};
+        reinterpret_cast<Entity*>(chunk.data)[location.row] = entity;
+        ++m_entityCount;
+        return location;
+    }
+
+    Entity Archetype::remove(Location location)
+    {
+        Chunk& last = m_chunks.back();
+        const Location tail{static_cast<uint32_t>(m_chunks.size() - 1), last.count - 1};
+
+        Entity moved;
+        if (tail.chunk != location.chunk || tail.row != location.row)
+        {
+            Chunk& target = m_chunks[location.chunk];
+            moved = reinterpret_cast<Entity*>(last.data)[tail.row];
+            reinterpret_cast<Entity*>(target.data)[location.row] = moved;
+
+            for (ComponentMask bits = m_mask; bits; bits &= bits - 1)
+            {
+                const auto id = static_cast<ComponentId>(std::countr_zero(bits));
+                const uint32_t size = ComponentRegistry::info(id).size;
+                std::memcpy(target.data + m_columnOffsets[id] + location.row * size,
+                            last.data + m_columnOffsets[id] + tail.row * size, size);
+            }
+        }
+
+        --m_entityCount;
+        if (--last.count == 0)
+        {
+            ::operator delete(last.data, std::align_val_t{64});
+            m_chunks.pop_back();
+        }
+        return moved;
+    }
+
+    void* Archetype::component(ComponentId id, Location location) const
+    {
+        if (!has(id))
+            return nullptr;
+        return m_chunks[location.chunk].data + m_columnOffsets[id] + location.row * ComponentRegistry::info(id).size;
+    }
+
+    void Archetype::copyShared(const Archetype& from, Location source, const Archetype& to, Location target)
+    {
+        for (ComponentMask bits = from.m_mask & to.m_mask; bits; bits &= bits - 1)
+        {
+            const auto id = static_cast<ComponentId>(std::countr_zero(bits));
+            std::memcpy(to.component(id, target), from.component(id, source), ComponentRegistry::info(id).size);
+        }
+    }
+}
@@ -0,0 +1,104 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "ecs/component.hpp"
+#include "ecs/entity.hpp"
+
+namespace bloom
+{
+    class Archetype;
+
+    // One 16 KiB block of an archetype. Columns are laid out back to back
+    // (structure of arrays): first the owning entities, then one tightly
+    // packed array per component type.
+    class ChunkView
+    {
+    public:
+        ChunkView(const Archetype* archetype, std::byte* data, uint32_t count)
+            : m_archetype(archetype), m_data(data), m_count(count)
+        {
+        }
+
+        uint32_t size() const { return m_count; }
+        const Entity* entities() const;
+
+        template <typename T>
+        T* column() const
+        {
+            return static_cast<T*>(column(ComponentRegistry::id<T>()));
+        }
+
+        void* column(ComponentId id) const;
+
+    private:
+        const Archetype* m_archetype;
+        std::byte* m_data;
+        uint32_t m_count;
+    };
+
+    // All entities sharing exactly one set of component types. Chunks are
+    // kept dense: every chunk but the last is full, and removals swap the
+    // very last row into the hole.
+    class Archetype
+    {
+    public:
+        static constexpr std::size_t kChunkSize = 16 * 1024;
+
+        struct Location
+        {
+            uint32_t chunk = 0;
+            uint32_t row = 0;
+        };
+
+        explicit Archetype(ComponentMask mask);
+        ~Archetype();
+
+        Archetype(const Archetype&) = delete;
+        Archetype& operator=(const Archetype&) = delete;
+
+        ComponentMask mask() const { return m_mask; }
+        uint32_t chunkCapacity() const { return m_capacity; }
+        std::size_t chunkCount() const { return m_chunks.size(); }
+        std::size_t entityCount() const { return m_entityCount; }
+
+        ChunkView chunk(std::size_t index) const
+        {
+            return ChunkView(this, m_chunks[index].data, m_chunks[index].count);
+        }
+
+        bool has(ComponentId id) const { return (m_mask >> id) & 1u; }
+        uint32_t columnOffset(ComponentId id) const { return m_columnOffsets[id]; }
+        uint32_t entityOffset() const { return 0; }
+
+        // Appends an uninitialised row owned by `entity`.
+        Location allocate(Entity entity);
+
+        // Removes a row by moving the archetype's last row into it. Returns
+        // the entity that was moved, or an invalid entity if the removed row
+        // was the last one.
+        Entity remove(Location location);
+
+        void* component(ComponentId id, Location location) const;
+
+        // Copies every column both archetypes share from one row to another.
+        static void copyShared(const Archetype& from, Location source, const Archetype& to, Location target);
+
+    private:
+        struct Chunk
+        {
+            std::byte* data = nullptr;
+            uint32_t count = 0;
+        };
+
+        ComponentMask m_mask;
+        uint32_t m_capacity = 0;
+        std::array<uint32_t, kMaxComponentTypes> m_columnOffsets{};
+        std::vector<Chunk> m_chunks;
+        std::size_t m_entityCount = 0;
+    };
+}
@@ -0,0 +1,20 @@
+#include "ecs/component.hpp"
+
+#include <cstdio>
+#include <cstdlib>
+
+namespace bloom
+{
+    ComponentId ComponentRegistry::registerType(const ComponentInfo& info)
+    {
+        const uint32_t id = s_count.fetch_add(1, std::memory_order_relaxed);
+        if (id >= kMaxComponentTypes)
+        {
+            std::fprintf(stderr, "Too many component types (limit is %zu)\n", kMaxComponentTypes);
+            std::abort();
+        }
+
+        s_infos[id] = info;
+        return static_cast<ComponentId>(id);
+    }
+}
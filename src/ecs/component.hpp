@@ -0,0 +1,56 @@
+#pragma once
+
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+namespace bloom
+{
+    using ComponentId = uint8_t;
+    using ComponentMask = uint64_t;
+
+    constexpr std::size_t kMaxComponentTypes = 64;
+
+    struct ComponentInfo
+    {
+        uint32_t size = 0;
+        uint32_t alignment = 0;
+    };
+
+    // Process-wide registry handing out dense ids to component types the
+    // first time they are used. Components live in raw chunk memory and are
+    // moved with memcpy, so they must be trivially copyable.
+    class ComponentRegistry
+    {
+    public:
+        template <typename T>
+        static ComponentId id()
+        {
+            static_assert(std::is_trivially_copyable_v<T>, "components are relocated with memcpy");
+            static_assert(alignof(T) <= 64, "components may be at most cache-line aligned");
+            static const ComponentId value = registerType(ComponentInfo{sizeof(T), alignof(T)});
+            return value;
+        }
+
+        static const ComponentInfo& info(ComponentId id) { return s_infos[id]; }
+
+    private:
+        static ComponentId registerType(const ComponentInfo& info);
+
+        static inline ComponentInfo s_infos[kMaxComponentTypes];
+        static inline std::atomic<uint32_t> s_count{0};
+    };
+
+    template <typename... Ts>
+    ComponentMask componentMask()
+    {
+        return (ComponentMask{0} | ... | (ComponentMask{1} << ComponentRegistry::id<Ts>()));
+    }
+
+    inline int componentCount(ComponentMask mask)
+    {
+        return std::popcount(mask);
+    }
+}
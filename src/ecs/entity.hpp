@@ -0,0 +1,17 @@
+#pragma once
+
+#include <cstdint>
+
+namespace bloom
+{
+    // Generational handle: `index` names a slot in the world's entity table
+    // and `generation` tells a live entity apart from a recycled slot.
+    struct Entity
+    {
+        uint32_t index = ~0u;
+        uint32_t generation = 0;
+
+        bool valid() const { return index != ~0u; }
+        friend bool operator==(Entity, Entity) = default;
+    };
+}
@@ -0,0 +1,116 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "ecs/archetype.hpp"
+#include "ecs/component.hpp"
+#include "jobs/job_system.hpp"
+
+namespace bloom
+{
+    class World;
+
+    // Cached view over every archetype containing all of Ts. Matching is
+    // incremental: each iteration only inspects archetypes created since the
+    // previous one. Iteration walks chunk columns directly, so callbacks see
+    // contiguous arrays of each component. Include ecs/world.hpp to use it.
+    template <typename... Ts>
+    class Query
+    {
+    public:
+        explicit Query(World& world)
+            : m_world(&world)
+            , m_required(componentMask<Ts...>())
+        {
+        }
+
+        // Excludes archetypes that contain any of Us.
+        template <typename... Us>
+        Query& without()
+        {
+            m_excluded |= componentMask<Us...>();
+            m_matched.clear();
+            m_scanned = 0;
+            return *this;
+        }
+
+        // fn(std::size_t count, const Entity* entities, Ts* columns...)
+        template <typename F>
+        void eachChunk(F&& fn)
+        {
+            refresh();
+            for (Archetype* archetype : m_matched)
+            {
+                for (std::size_t i = 0; i < archetype->chunkCount(); ++i)
+                {
+                    const ChunkView chunk = archetype->chunk(i);
+                    fn(static_cast<std::size_t>(chunk.size()), chunk.entities(), chunk.template column<Ts>()...);
+                }
+            }
+        }
+
+        // fn(Ts&... components)
+        template <typename F>
+        void each(F&& fn)
+        {
+            eachChunk([&fn](std::size_t count, const Entity*, Ts*... columns)
+            {
+                for (std::size_t i = 0; i < count; ++i)
+                    fn(columns[i]...);
+            });
+        }
+
+        // Same as eachChunk, but with one job per chunk. Blocks (helping)
+        // until every chunk has been processed.
+        template <typename F>
+        void parallelEachChunk(JobSystem& jobs, F&& fn)
+        {
+            refresh();
+            m_chunks.clear();
+            for (Archetype* archetype : m_matched)
+                for (std::size_t i = 0; i < archetype->chunkCount(); ++i)
+                    m_chunks.push_back(archetype->chunk(i));
+
+            const std::vector<ChunkView>& chunks = m_chunks;
+            jobs.parallelFor(static_cast<uint32_t>(chunks.size()), 1, [&chunks, &fn](uint32_t begin, uint32_t end)
+            {
+                for (uint32_t c = begin; c < end; ++c)
+                {
+                    const ChunkView& chunk = chunks[c];
+                    fn(static_cast<std::size_t>(chunk.size()), chunk.entities(), chunk.template column<Ts>()...);
+                }
+            });
+        }
+
+        template <typename F>
+        void parallelEach(JobSystem& jobs, F&& fn)
+        {
+            parallelEachChunk(jobs, [&fn](std::size_t count, const Entity*, Ts*... columns)
+            {
+                for (std::size_t i = 0; i < count; ++i)
+                    fn(columns[i]...);
+            });
+        }
+
+        std::size_t count()
+        {
+            refresh();
+            std::size_t total = 0;
+            for (const Archetype* archetype : m_matched)
+                total += archetype->entityCount();
+            return total;
+        }
+
+    private:
+        void refresh();
+
+        World* m_world;
+        ComponentMask m_required;
+        ComponentMask m_excluded = 0;
+        std::vector<Archetype*> m_matched;
+        std::vector<ChunkView> m_chunks;
+        std::size_t m_scanned = 0;
+    };
+}
@@ -0,0 +1,79 @@
+#include "ecs/world.hpp"
+
+#include "memory/memory.hpp"
+
+namespace bloom
+{
+    Entity World::allocateEntity()
+    {
+        if (!m_freeList.empty())
+        {
+            const uint32_t index = m_freeList.back();
+            m_freeList.pop_back();
+            return Entity{index, m_records[index].generation};
+        }
+
+        MemoryTagScope tag(MemoryTag::Ecs);
+        m_records.emplace_back();
+        return Entity{static_cast<uint32_t>(m_records.size() - 1), 0};
+    }
+
+    Archetype& World::archetypeFor(ComponentMask mask)
+    {
+        std::unique_ptr<Archetype>& slot = m_archetypes[mask];
+        if (!slot)
+        {
+            MemoryTagScope tag(MemoryTag::Ecs);
+            slot = std::make_unique<Archetype>(mask);
+            m_archetypeList.push_back(slot.get());
+        }
+        return *slot;
+    }
+
+    bool World::alive(Entity entity) const
+    {
+        return entity.index < m_records.size() &&
+               m_records[entity.index].archetype != nullptr &&
+               m_records[entity.index].generation == entity.generation;
+    }
+
+    void World::destroy(Entity entity)
+    {
+        if (!alive(entity))
+            return;
+
+        Record& record = m_records[entity.index];
+        release(*record.archetype, record.location);
+        record.archetype = nullptr;
+        ++record.generation;
+        m_freeList.push_back(entity.index);
+    }
+
+    void World::release(Archetype& archetype, Archetype::Location location)
+    {
+        const Entity moved = archetype.remove(location);
+        if (moved.valid())
+            m_records[moved.index].location = location;
+    }
+
+    void World::move(Entity entity, ComponentMask mask)
+    {
+        Record& record = m_records[entity.index];
+        Archetype& from = *record.archetype;
+        Archetype& to = archetypeFor(mask);
+
+        const Archetype::Location source = record.location;
+        const Archetype::Location target = to.allocate(entity);
+        Archetype::copyShared(from, source, to, target);
+        release(from, source);
+
+        record.archetype = &to;
+        record.location = target;
+    }
+
+    void World::reserve(std::size_t entities)
+    {
+        MemoryTagScope tag(MemoryTag::Ecs);
+        m_records.reserve(entities);
+    }
+}
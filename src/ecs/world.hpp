@@ -0,0 +1,122 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+#include "ecs/archetype.hpp"
+#include "ecs/component.hpp"
+#include "ecs/entity.hpp"
+#include "ecs/query.hpp"
+
+namespace bloom
+{
+    // Owns every entity and archetype. Structural changes (create, destroy,
+    // add, remove) are single-threaded and must not overlap with queries
+    // iterating the same world; component writes through a query may run in
+    // parallel over disjoint chunks.
+    class World
+    {
+    public:
+        World() = default;
+        World(const World&) = delete;
+        World& operator=(const World&) = delete;
+
+        template <typename... Ts>
+        Entity create(const Ts&... components)
+        {
+            Archetype& archetype = archetypeFor(componentMask<Ts...>());
+            const Entity entity = allocateEntity();
+            const Archetype::Location location = archetype.allocate(entity);
+            m_records[entity.index] = Record{&archetype, location, entity.generation};
+            (write(archetype, location, components), ...);
+            return entity;
+        }
+
+        void destroy(Entity entity);
+        bool alive(Entity entity) const;
+
+        template <typename T>
+        T* get(Entity entity)
+        {
+            if (!alive(entity))
+                return nullptr;
+            const Record& record = m_records[entity.index];
+            return static_cast<T*>(record.archetype->component(ComponentRegistry::id<T>(), record.location));
+        }
+
+        template <typename T>
+        bool has(Entity entity) const
+        {
+            return alive(entity) && m_records[entity.index].archetype->has(ComponentRegistry::id<T>());
+        }
+
+        // Adds the component, or overwrites it if the entity already has one.
+        template <typename T>
+        void add(Entity entity, const T& component)
+        {
+            if (!alive(entity))
+                return;
+            const ComponentId id = ComponentRegistry::id<T>();
+            if (!m_records[entity.index].archetype->has(id))
+                move(entity, m_records[entity.index].archetype->mask() | (ComponentMask{1} << id));
+            *get<T>(entity) = component;
+        }
+
+        template <typename T>
+        void remove(Entity entity)
+        {
+            if (!has<T>(entity))
+                return;
+            move(entity, m_records[entity.index].archetype->mask() & ~(ComponentMask{1} << ComponentRegistry::id<T>()));
+        }
+
+        void reserve(std::size_t entities);
+
+        std::size_t entityCount() const { return m_records.size() - m_freeList.size(); }
+
+        // Append-only; queries remember how far they have scanned.
+        const std::vector<Archetype*>& archetypes() const { return m_archetypeList; }
+
+        template <typename... Ts>
+        Query<Ts...> query() { return Query<Ts...>(*this); }
+
+    private:
+        struct Record
+        {
+            Archetype* archetype = nullptr;
+            Archetype::Location location;
+            uint32_t generation = 0;
+        };
+
+        template <typename T>
+        static void write(Archetype& archetype, Archetype::Location location, const T& component)
+        {
+            *static_cast<T*>(archetype.component(ComponentRegistry::id<T>(), location)) = component;
+        }
+
+        Entity allocateEntity();
+        Archetype& archetypeFor(ComponentMask mask);
+        void move(Entity entity, ComponentMask mask);
+        void release(Archetype& archetype, Archetype::Location location);
+
+        std::vector<Record> m_records;
+        std::vector<uint32_t> m_freeList;
+        std::unordered_map<ComponentMask, std::unique_ptr<Archetype>> m_archetypes;
+        std::vector<Archetype*> m_archetypeList;
+    };
+
+    template <typename... Ts>
+    void Query<Ts...>::refresh()
+    {
+        const std::vector<Archetype*>& archetypes = m_world->archetypes();
+        for (; m_scanned < archetypes.size(); ++m_scanned)
+        {
+            const ComponentMask mask = archetypes[m_scanned]->mask();
+            if ((mask & m_required) == m_required && (mask & m_excluded) == 0)
+                m_matched.push_back(archetypes[m_scanned]);
+        }
+    }
+}
@@ -10,6 +10,8 @@
         
     Loader: True
     Local files: False
+    Local additions: gladLoadGLLoaderVersion, gladLoadGLLoaderLazy and
+    gladLoadGLLoaderLazyVersion (see tools/gen_glad_lazy.py)
     Omit khrplatform: False
     Reproducible: False
 
@@ -2500,12 +2502,33 @@ static void find_coreGL(void) {
 	}
 }
 
-int gladLoadGLLoader(GLADloadproc load) {
+static void limit_coreGL(int major, int minor) {
+	/* Versions above the requested one are reported as unavailable, so code
+	 * testing GLAD_GL_VERSION_X_Y never calls a pointer that was not loaded. */
+#define GLAD_LIMIT(maj, min) if (maj > major || (maj == major && min > minor)) GLAD_GL_VERSION_##maj##_##min = 0
+	GLAD_LIMIT(1, 0); GLAD_LIMIT(1, 1); GLAD_LIMIT(1, 2); GLAD_LIMIT(1, 3); GLAD_LIMIT(1, 4); GLAD_LIMIT(1, 5);
+	GLAD_LIMIT(2, 0); GLAD_LIMIT(2, 1);
+	GLAD_LIMIT(3, 0); GLAD_LIMIT(3, 1); GLAD_LIMIT(3, 2); GLAD_LIMIT(3, 3);
+	GLAD_LIMIT(4, 0); GLAD_LIMIT(4, 1); GLAD_LIMIT(4, 2); GLAD_LIMIT(4, 3); GLAD_LIMIT(4, 4); GLAD_LIMIT(4, 5); GLAD_LIMIT(4, 6);
+#undef GLAD_LIMIT
+	if (max_loaded_major > major || (max_loaded_major == major && max_loaded_minor > minor)) {
+		max_loaded_major = major;
+		max_loaded_minor = minor;
+	}
+}
+
+static int begin_loadGL(GLADloadproc load, int major, int minor) {
 	GLVersion.major = 0; GLVersion.minor = 0;
 	glGetString = (PFNGLGETSTRINGPROC)load("glGetString");
 	if(glGetString == NULL) return 0;
 	if(glGetString(GL_VERSION) == NULL) return 0;
 	find_coreGL();
+	limit_coreGL(major, minor);
+	return 1;
+}
+
+int gladLoadGLLoaderVersion(GLADloadproc load, int major, int minor) {
+	if (!begin_loadGL(load, major, minor)) return 0;
 	load_GL_VERSION_1_0(load);
 	load_GL_VERSION_1_1(load);
 	load_GL_VERSION_1_2(load);
@@ -2530,3 +2553,20 @@ int gladLoadGLLoader(GLADloadproc load) {
 	return GLVersion.major != 0 || GLVersion.minor != 0;
 }
 
+int gladLoadGLLoader(GLADloadproc load) {
+	return gladLoadGLLoaderVersion(load, 4, 6);
+}
+
+/* Defined in glad_lazy.c, generated by tools/gen_glad_lazy.py. */
+void glad_install_lazy_GL(GLADloadproc load);
+
+int gladLoadGLLoaderLazyVersion(GLADloadproc load, int major, int minor) {
+	if (!begin_loadGL(load, major, minor)) return 0;
+	glad_install_lazy_GL(load);
+	return GLVersion.major != 0 || GLVersion.minor != 0;
+}
+
+int gladLoadGLLoaderLazy(GLADloadproc load) {
+	return gladLoadGLLoaderLazyVersion(load, 4, 6);
+}
+
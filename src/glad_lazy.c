@@ -0,0 +1,2173 @@
+/*
+    Lazy entry point trampolines for the glad loader in src/glad.c.
+    Generated by tools/gen_glad_lazy.py -- do not edit.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <glad/glad.h>
+
+static GLADloadproc glad_lazy_load;
+
+static void* glad_lazy_resolve(const char *name) {
+    void* result = glad_lazy_load(name);
+    if(result == NULL) {
+        fprintf(stderr, "glad: %s is not exported by the current context\n", name);
+        abort();
+    }
+    return result;
+}
+
+#define GLAD_LAZY_VOID(name, pfn, params, args) \
+    static void APIENTRY glad_lazy_##name params { \
+        glad_##name = (pfn)glad_lazy_resolve(#name); \
+        glad_##name args; \
+    }
+
+#define GLAD_LAZY_RET(type, name, pfn, params, args) \
+    static type APIENTRY glad_lazy_##name params { \
+        glad_##name = (pfn)glad_lazy_resolve(#name); \
+        return glad_##name args; \
+    }
+
+GLAD_LAZY_VOID(glAccum, PFNGLACCUMPROC, (GLenum op, GLfloat value), (op, value))
+GLAD_LAZY_VOID(glActiveShaderProgram, PFNGLACTIVESHADERPROGRAMPROC, (GLuint pipeline, GLuint program), (pipeline, program))
+GLAD_LAZY_VOID(glActiveTexture, PFNGLACTIVETEXTUREPROC, (GLenum texture), (texture))
+GLAD_LAZY_VOID(glAlphaFunc, PFNGLALPHAFUNCPROC, (GLenum func, GLfloat ref), (func, ref))
+GLAD_LAZY_RET(GLboolean, glAreTexturesResident, PFNGLARETEXTURESRESIDENTPROC, (GLsizei n, const GLuint *textures, GLboolean *residences), (n, textures, residences))
+GLAD_LAZY_VOID(glArrayElement, PFNGLARRAYELEMENTPROC, (GLint i), (i))
+GLAD_LAZY_VOID(glAttachShader, PFNGLATTACHSHADERPROC, (GLuint program, GLuint shader), (program, shader))
+GLAD_LAZY_VOID(glBegin, PFNGLBEGINPROC, (GLenum mode), (mode))
+GLAD_LAZY_VOID(glBeginConditionalRender, PFNGLBEGINCONDITIONALRENDERPROC, (GLuint id, GLenum mode), (id, mode))
+GLAD_LAZY_VOID(glBeginQuery, PFNGLBEGINQUERYPROC, (GLenum target, GLuint id), (target, id))
+GLAD_LAZY_VOID(glBeginQueryIndexed, PFNGLBEGINQUERYINDEXEDPROC, (GLenum target, GLuint index, GLuint id), (target, index, id))
+GLAD_LAZY_VOID(glBeginTransformFeedback, PFNGLBEGINTRANSFORMFEEDBACKPROC, (GLenum primitiveMode), (primitiveMode))
+GLAD_LAZY_VOID(glBindAttribLocation, PFNGLBINDATTRIBLOCATIONPROC, (GLuint program, GLuint index, const GLchar *name), (program, index, name))
+GLAD_LAZY_VOID(glBindBuffer, PFNGLBINDBUFFERPROC, (GLenum target, GLuint buffer), (target, buffer))
+GLAD_LAZY_VOID(glBindBufferBase, PFNGLBINDBUFFERBASEPROC, (GLenum target, GLuint index, GLuint buffer), (target, index, buffer))
+GLAD_LAZY_VOID(glBindBufferRange, PFNGLBINDBUFFERRANGEPROC, (GLenum target, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size), (target, index, buffer, offset, size))
+GLAD_LAZY_VOID(glBindBuffersBase, PFNGLBINDBUFFERSBASEPROC, (GLenum target, GLuint first, GLsizei count, const GLuint *buffers), (target, first, count, buffers))
+GLAD_LAZY_VOID(glBindBuffersRange, PFNGLBINDBUFFERSRANGEPROC, (GLenum target, GLuint first, GLsizei count, const GLuint *buffers, const GLintptr *offsets, const GLsizeiptr *sizes), (target, first, count, buffers, offsets, sizes))
+GLAD_LAZY_VOID(glBindFragDataLocation, PFNGLBINDFRAGDATALOCATIONPROC, (GLuint program, GLuint color, const GLchar *name), (program, color, name))
+GLAD_LAZY_VOID(glBindFragDataLocationIndexed, PFNGLBINDFRAGDATALOCATIONINDEXEDPROC, (GLuint program, GLuint colorNumber, GLuint index, const GLchar *name), (program, colorNumber, index, name))
+GLAD_LAZY_VOID(glBindFramebuffer, PFNGLBINDFRAMEBUFFERPROC, (GLenum target, GLuint framebuffer), (target, framebuffer))
+GLAD_LAZY_VOID(glBindImageTexture, PFNGLBINDIMAGETEXTUREPROC, (GLuint unit, GLuint texture, GLint level, GLboolean layered, GLint layer, GLenum access, GLenum format), (unit, texture, level, layered, layer, access, format))
+GLAD_LAZY_VOID(glBindImageTextures, PFNGLBINDIMAGETEXTURESPROC, (GLuint first, GLsizei count, const GLuint *textures), (first, count, textures))
+GLAD_LAZY_VOID(glBindProgramPipeline, PFNGLBINDPROGRAMPIPELINEPROC, (GLuint pipeline), (pipeline))
+GLAD_LAZY_VOID(glBindRenderbuffer, PFNGLBINDRENDERBUFFERPROC, (GLenum target, GLuint renderbuffer), (target, renderbuffer))
+GLAD_LAZY_VOID(glBindSampler, PFNGLBINDSAMPLERPROC, (GLuint unit, GLuint sampler), (unit, sampler))
+GLAD_LAZY_VOID(glBindSamplers, PFNGLBINDSAMPLERSPROC, (GLuint first, GLsizei count, const GLuint *samplers), (first, count, samplers))
+GLAD_LAZY_VOID(glBindTexture, PFNGLBINDTEXTUREPROC, (GLenum target, GLuint texture), (target, texture))
+GLAD_LAZY_VOID(glBindTextureUnit, PFNGLBINDTEXTUREUNITPROC, (GLuint unit, GLuint texture), (unit, texture))
+GLAD_LAZY_VOID(glBindTextures, PFNGLBINDTEXTURESPROC, (GLuint first, GLsizei count, const GLuint *textures), (first, count, textures))
+GLAD_LAZY_VOID(glBindTransformFeedback, PFNGLBINDTRANSFORMFEEDBACKPROC, (GLenum target, GLuint id), (target, id))
+GLAD_LAZY_VOID(glBindVertexArray, PFNGLBINDVERTEXARRAYPROC, (GLuint array), (array))
+GLAD_LAZY_VOID(glBindVertexBuffer, PFNGLBINDVERTEXBUFFERPROC, (GLuint bindingindex, GLuint buffer, GLintptr offset, GLsizei stride), (bindingindex, buffer, offset, stride))
+GLAD_LAZY_VOID(glBindVertexBuffers, PFNGLBINDVERTEXBUFFERSPROC, (GLuint first, GLsizei count, const GLuint *buffers, const GLintptr *offsets, const GLsizei *strides), (first, count, buffers, offsets, strides))
+GLAD_LAZY_VOID(glBitmap, PFNGLBITMAPPROC, (GLsizei width, GLsizei height, GLfloat xorig, GLfloat yorig, GLfloat xmove, GLfloat ymove, const GLubyte *bitmap), (width, height, xorig, yorig, xmove, ymove, bitmap))
+GLAD_LAZY_VOID(glBlendColor, PFNGLBLENDCOLORPROC, (GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha), (red, green, blue, alpha))
+GLAD_LAZY_VOID(glBlendEquation, PFNGLBLENDEQUATIONPROC, (GLenum mode), (mode))
+GLAD_LAZY_VOID(glBlendEquationSeparate, PFNGLBLENDEQUATIONSEPARATEPROC, (GLenum modeRGB, GLenum modeAlpha), (modeRGB, modeAlpha))
+GLAD_LAZY_VOID(glBlendEquationSeparatei, PFNGLBLENDEQUATIONSEPARATEIPROC, (GLuint buf, GLenum modeRGB, GLenum modeAlpha), (buf, modeRGB, modeAlpha))
+GLAD_LAZY_VOID(glBlendEquationi, PFNGLBLENDEQUATIONIPROC, (GLuint buf, GLenum mode), (buf, mode))
+GLAD_LAZY_VOID(glBlendFunc, PFNGLBLENDFUNCPROC, (GLenum sfactor, GLenum dfactor), (sfactor, dfactor))
+GLAD_LAZY_VOID(glBlendFuncSeparate, PFNGLBLENDFUNCSEPARATEPROC, (GLenum sfactorRGB, GLenum dfactorRGB, GLenum sfactorAlpha, GLenum dfactorAlpha), (sfactorRGB, dfactorRGB, sfactorAlpha, dfactorAlpha))
+GLAD_LAZY_VOID(glBlendFuncSeparatei, PFNGLBLENDFUNCSEPARATEIPROC, (GLuint buf, GLenum srcRGB, GLenum dstRGB, GLenum srcAlpha, GLenum dstAlpha), (buf, srcRGB, dstRGB, srcAlpha, dstAlpha))
+GLAD_LAZY_VOID(glBlendFunci, PFNGLBLENDFUNCIPROC, (GLuint buf, GLenum src, GLenum dst), (buf, src, dst))
+GLAD_LAZY_VOID(glBlitFramebuffer, PFNGLBLITFRAMEBUFFERPROC, (GLint srcX0, GLint srcY0, GLint srcX1, GLint srcY1, GLint dstX0, GLint dstY0, GLint dstX1, GLint dstY1, GLbitfield mask, GLenum filter), (srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1, mask, filter))
+GLAD_LAZY_VOID(glBlitNamedFramebuffer, PFNGLBLITNAMEDFRAMEBUFFERPROC, (GLuint readFramebuffer, GLuint drawFramebuffer, GLint srcX0, GLint srcY0, GLint srcX1, GLint srcY1, GLint dstX0, GLint dstY0, GLint dstX1, GLint dstY1, GLbitfield mask, GLenum filter), (readFramebuffer, drawFramebuffer, srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1, mask, filter))
+GLAD_LAZY_VOID(glBufferData, PFNGLBUFFERDATAPROC, (GLenum target, GLsizeiptr size, const void *data, GLenum usage), (target, size, data, usage))
+GLAD_LAZY_VOID(glBufferStorage, PFNGLBUFFERSTORAGEPROC, (GLenum target, GLsizeiptr size, const void *data, GLbitfield flags), (target, size, data, flags))
+GLAD_LAZY_VOID(glBufferSubData, PFNGLBUFFERSUBDATAPROC, (GLenum target, GLintptr offset, GLsizeiptr size, const void *data), (target, offset, size, data))
+GLAD_LAZY_VOID(glCallList, PFNGLCALLLISTPROC, (GLuint list), (list))
+GLAD_LAZY_VOID(glCallLists, PFNGLCALLLISTSPROC, (GLsizei n, GLenum type, const void *lists), (n, type, lists))
+GLAD_LAZY_RET(GLenum, glCheckFramebufferStatus, PFNGLCHECKFRAMEBUFFERSTATUSPROC, (GLenum target), (target))
+GLAD_LAZY_RET(GLenum, glCheckNamedFramebufferStatus, PFNGLCHECKNAMEDFRAMEBUFFERSTATUSPROC, (GLuint framebuffer, GLenum target), (framebuffer, target))
+GLAD_LAZY_VOID(glClampColor, PFNGLCLAMPCOLORPROC, (GLenum target, GLenum clamp), (target, clamp))
+GLAD_LAZY_VOID(glClear, PFNGLCLEARPROC, (GLbitfield mask), (mask))
+GLAD_LAZY_VOID(glClearAccum, PFNGLCLEARACCUMPROC, (GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha), (red, green, blue, alpha))
+GLAD_LAZY_VOID(glClearBufferData, PFNGLCLEARBUFFERDATAPROC, (GLenum target, GLenum internalformat, GLenum format, GLenum type, const void *data), (target, internalformat, format, type, data))
+GLAD_LAZY_VOID(glClearBufferSubData, PFNGLCLEARBUFFERSUBDATAPROC, (GLenum target, GLenum internalformat, GLintptr offset, GLsizeiptr size, GLenum format, GLenum type, const void *data), (target, internalformat, offset, size, format, type, data))
+GLAD_LAZY_VOID(glClearBufferfi, PFNGLCLEARBUFFERFIPROC, (GLenum buffer, GLint drawbuffer, GLfloat depth, GLint stencil), (buffer, drawbuffer, depth, stencil))
+GLAD_LAZY_VOID(glClearBufferfv, PFNGLCLEARBUFFERFVPROC, (GLenum buffer, GLint drawbuffer, const GLfloat *value), (buffer, drawbuffer, value))
+GLAD_LAZY_VOID(glClearBufferiv, PFNGLCLEARBUFFERIVPROC, (GLenum buffer, GLint drawbuffer, const GLint *value), (buffer, drawbuffer, value))
+GLAD_LAZY_VOID(glClearBufferuiv, PFNGLCLEARBUFFERUIVPROC, (GLenum buffer, GLint drawbuffer, const GLuint *value), (buffer, drawbuffer, value))
+GLAD_LAZY_VOID(glClearColor, PFNGLCLEARCOLORPROC, (GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha), (red, green, blue, alpha))
+GLAD_LAZY_VOID(glClearDepth, PFNGLCLEARDEPTHPROC, (GLdouble depth), (depth))
+GLAD_LAZY_VOID(glClearDepthf, PFNGLCLEARDEPTHFPROC, (GLfloat d), (d))
+GLAD_LAZY_VOID(glClearIndex, PFNGLCLEARINDEXPROC, (GLfloat c), (c))
+GLAD_LAZY_VOID(glClearNamedBufferData, PFNGLCLEARNAMEDBUFFERDATAPROC, (GLuint buffer, GLenum internalformat, GLenum format, GLenum type, const void *data), (buffer, internalformat, format, type, data))
+GLAD_LAZY_VOID(glClearNamedBufferSubData, PFNGLCLEARNAMEDBUFFERSUBDATAPROC, (GLuint buffer, GLenum internalformat, GLintptr offset, GLsizeiptr size, GLenum format, GLenum type, const void *data), (buffer, internalformat, offset, size, format, type, data))
+GLAD_LAZY_VOID(glClearNamedFramebufferfi, PFNGLCLEARNAMEDFRAMEBUFFERFIPROC, (GLuint framebuffer, GLenum buffer, GLint drawbuffer, GLfloat depth, GLint stencil), (framebuffer, buffer, drawbuffer, depth, stencil))
+GLAD_LAZY_VOID(glClearNamedFramebufferfv, PFNGLCLEARNAMEDFRAMEBUFFERFVPROC, (GLuint framebuffer, GLenum buffer, GLint drawbuffer, const GLfloat *value), (framebuffer, buffer, drawbuffer, value))
+GLAD_LAZY_VOID(glClearNamedFramebufferiv, PFNGLCLEARNAMEDFRAMEBUFFERIVPROC, (GLuint framebuffer, GLenum buffer, GLint drawbuffer, const GLint *value), (framebuffer, buffer, drawbuffer, value))
+GLAD_LAZY_VOID(glClearNamedFramebufferuiv, PFNGLCLEARNAMEDFRAMEBUFFERUIVPROC, (GLuint framebuffer, GLenum buffer, GLint drawbuffer, const GLuint *value), (framebuffer, buffer, drawbuffer, value))
+GLAD_LAZY_VOID(glClearStencil, PFNGLCLEARSTENCILPROC, (GLint s), (s))
+GLAD_LAZY_VOID(glClearTexImage, PFNGLCLEARTEXIMAGEPROC, (GLuint texture, GLint level, GLenum format, GLenum type, const void *data), (texture, level, format, type, data))
+GLAD_LAZY_VOID(glClearTexSubImage, PFNGLCLEARTEXSUBIMAGEPROC, (GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void *data), (texture, level, xoffset, yoffset, zoffset, width, height, depth, format, type, data))
+GLAD_LAZY_VOID(glClientActiveTexture, PFNGLCLIENTACTIVETEXTUREPROC, (GLenum texture), (texture))
+GLAD_LAZY_RET(GLenum, glClientWaitSync, PFNGLCLIENTWAITSYNCPROC, (GLsync sync, GLbitfield flags, GLuint64 timeout), (sync, flags, timeout))
+GLAD_LAZY_VOID(glClipControl, PFNGLCLIPCONTROLPROC, (GLenum origin, GLenum depth), (origin, depth))
+GLAD_LAZY_VOID(glClipPlane, PFNGLCLIPPLANEPROC, (GLenum plane, const GLdouble *equation), (plane, equation))
+GLAD_LAZY_VOID(glColor3b, PFNGLCOLOR3BPROC, (GLbyte red, GLbyte green, GLbyte blue), (red, green, blue))
+GLAD_LAZY_VOID(glColor3bv, PFNGLCOLOR3BVPROC, (const GLbyte *v), (v))
+GLAD_LAZY_VOID(glColor3d, PFNGLCOLOR3DPROC, (GLdouble red, GLdouble green, GLdouble blue), (red, green, blue))
+GLAD_LAZY_VOID(glColor3dv, PFNGLCOLOR3DVPROC, (const GLdouble *v), (v))
+GLAD_LAZY_VOID(glColor3f, PFNGLCOLOR3FPROC, (GLfloat red, GLfloat green, GLfloat blue), (red, green, blue))
+GLAD_LAZY_VOID(glColor3fv, PFNGLCOLOR3FVPROC, (const GLfloat *v), (v))
+GLAD_LAZY_VOID(glColor3i, PFNGLCOLOR3IPROC, (GLint red, GLint green, GLint blue), (red, green, blue))
+GLAD_LAZY_VOID(glColor3iv, PFNGLCOLOR3IVPROC, (const GLint *v), (v))
+GLAD_LAZY_VOID(glColor3s, PFNGLCOLOR3SPROC, (GLshort red, GLshort green, GLshort blue), (red, green, blue))
+GLAD_LAZY_VOID(glColor3sv, PFNGLCOLOR3SVPROC, (const GLshort *v), (v))
+GLAD_LAZY_VOID(glColor3ub, PFNGLCOLOR3UBPROC, (GLubyte red, GLubyte green, GLubyte blue), (red, green, blue))
+GLAD_LAZY_VOID(glColor3ubv, PFNGLCOLOR3UBVPROC, (const GLubyte *v), (v))
+GLAD_LAZY_VOID(glColor3ui, PFNGLCOLOR3UIPROC, (GLuint red, GLuint green, GLuint blue), (red, green, blue))
+GLAD_LAZY_VOID(glColor3uiv, PFNGLCOLOR3UIVPROC, (const GLuint *v), (v))
+GLAD_LAZY_VOID(glColor3us, PFNGLCOLOR3USPROC, (GLushort red, GLushort green, GLushort blue), (red, green, blue))
+GLAD_LAZY_VOID(glColor3usv, PFNGLCOLOR3USVPROC, (const GLushort *v), (v))
+GLAD_LAZY_VOID(glColor4b, PFNGLCOLOR4BPROC, (GLbyte red, GLbyte green, GLbyte blue, GLbyte alpha), (red, green, blue, alpha))
+GLAD_LAZY_VOID(glColor4bv, PFNGLCOLOR4BVPROC, (const GLbyte *v), (v))
+GLAD_LAZY_VOID(glColor4d, PFNGLCOLOR4DPROC, (GLdouble red, GLdouble green, GLdouble blue, GLdouble alpha), (red, green, blue, alpha))
+GLAD_LAZY_VOID(glColor4dv, PFNGLCOLOR4DVPROC, (const GLdouble *v), (v))
+GLAD_LAZY_VOID(glColor4f, PFNGLCOLOR4FPROC, (GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha), (red, green, blue, alpha))
+GLAD_LAZY_VOID(glColor4fv, PFNGLCOLOR4FVPROC, (const GLfloat *v), (v))
+GLAD_LAZY_VOID(glColor4i, PFNGLCOLOR4IPROC, (GLint red, GLint green, GLint blue, GLint alpha), (red, green, blue, alpha))
+GLAD_LAZY_VOID(glColor4iv, PFNGLCOLOR4IVPROC, (const GLint *v), (v))
+GLAD_LAZY_VOID(glColor4s, PFNGLCOLOR4SPROC, (GLshort red, GLshort green, GLshort blue, GLshort alpha), (red, green, blue, alpha))
+GLAD_LAZY_VOID(glColor4sv, PFNGLCOLOR4SVPROC, (const GLshort *v), (v))
+GLAD_LAZY_VOID(glColor4ub, PFNGLCOLOR4UBPROC, (GLubyte red, GLubyte green, GLubyte blue, GLubyte alpha), (red, green, blue, alpha))
+GLAD_LAZY_VOID(glColor4ubv, PFNGLCOLOR4UBVPROC, (const GLubyte *v), (v))
+GLAD_LAZY_VOID(glColor4ui, PFNGLCOLOR4UIPROC, (GLuint red, GLuint green, GLuint blue, GLuint alpha), (red, green, blue, alpha))
+GLAD_LAZY_VOID(glColor4uiv, PFNGLCOLOR4UIVPROC, (const GLuint *v), (v))
+GLAD_LAZY_VOID(glColor4us, PFNGLCOLOR4USPROC, (GLushort red, GLushort green, GLushort blue, GLushort alpha), (red, green, blue, alpha))
+GLAD_LAZY_VOID(glColor4usv, PFNGLCOLOR4USVPROC, (const GLushort *v), (v))
+GLAD_LAZY_VOID(glColorMask, PFNGLCOLORMASKPROC, (GLboolean red, GLboolean green, GLboolean blue, GLboolean alpha), (red, green, blue, alpha))
+GLAD_LAZY_VOID(glColorMaski, PFNGLCOLORMASKIPROC, (GLuint index, GLboolean r, GLboolean g, GLboolean b, GLboolean a), (index, r, g, b, a))
+GLAD_LAZY_VOID(glColorMaterial, PFNGLCOLORMATERIALPROC, (GLenum face, GLenum mode), (face, mode))
+GLAD_LAZY_VOID(glColorP3ui, PFNGLCOLORP3UIPROC, (GLenum type, GLuint color), (type, color))
+GLAD_LAZY_VOID(glColorP3uiv, PFNGLCOLORP3UIVPROC, (GLenum type, const GLuint *color), (type, color))
+GLAD_LAZY_VOID(glColorP4ui, PFNGLCOLORP4UIPROC, (GLenum type, GLuint color), (type, color))
+GLAD_LAZY_VOID(glColorP4uiv, PFNGLCOLORP4UIVPROC, (GLenum type, const GLuint *color), (type, color))
+GLAD_LAZY_VOID(glColorPointer, PFNGLCOLORPOINTERPROC, (GLint size, GLenum type, GLsizei stride, const void *pointer), (size, type, stride, pointer))
+GLAD_LAZY_VOID(glCompileShader, PFNGLCOMPILESHADERPROC, (GLuint shader), (shader))
+GLAD_LAZY_VOID(glCompressedTexImage1D, PFNGLCOMPRESSEDTEXIMAGE1DPROC, (GLenum target, GLint level, GLenum internalformat, GLsizei width, GLint border, GLsizei imageSize, const void *data), (target, level, internalformat, width, border, imageSize, data))
+GLAD_LAZY_VOID(glCompressedTexImage2D, PFNGLCOMPRESSEDTEXIMAGE2DPROC, (GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLint border, GLsizei imageSize, const void *data), (target, level, internalformat, width, height, border, imageSize, data))
+GLAD_LAZY_VOID(glCompressedTexImage3D, PFNGLCOMPRESSEDTEXIMAGE3DPROC, (GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLsizei imageSize, const void *data), (target, level, internalformat, width, height, depth, border, imageSize, data))
+GLAD_LAZY_VOID(glCompressedTexSubImage1D, PFNGLCOMPRESSEDTEXSUBIMAGE1DPROC, (GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLsizei imageSize, const void *data), (target, level, xoffset, width, format, imageSize, data))
+GLAD_LAZY_VOID(glCompressedTexSubImage2D, PFNGLCOMPRESSEDTEXSUBIMAGE2DPROC, (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLsizei imageSize, const void *data), (target, level, xoffset, yoffset, width, height, format, imageSize, data))
+GLAD_LAZY_VOID(glCompressedTexSubImage3D, PFNGLCOMPRESSEDTEXSUBIMAGE3DPROC, (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLsizei imageSize, const void *data), (target, level, xoffset, yoffset, zoffset, width, height, depth, format, imageSize, data))
+GLAD_LAZY_VOID(glCompressedTextureSubImage1D, PFNGLCOMPRESSEDTEXTURESUBIMAGE1DPROC, (GLuint texture, GLint level, GLint xoffset, GLsizei width, GLenum format, GLsizei imageSize, const void *data), (texture, level, xoffset, width, format, imageSize, data))
+GLAD_LAZY_VOID(glCompressedTextureSubImage2D, PFNGLCOMPRESSEDTEXTURESUBIMAGE2DPROC, (GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLsizei imageSize, const void *data), (texture, level, xoffset, yoffset, width, height, format, imageSize, data))
+GLAD_LAZY_VOID(glCompressedTextureSubImage3D, PFNGLCOMPRESSEDTEXTURESUBIMAGE3DPROC, (GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLsizei imageSize, const void *data), (texture, level, xoffset, yoffset, zoffset, width, height, depth, format, imageSize, data))
+GLAD_LAZY_VOID(glCopyBufferSubData, PFNGLCOPYBUFFERSUBDATAPROC, (GLenum readTarget, GLenum writeTarget, GLintptr readOffset, GLintptr writeOffset, GLsizeiptr size), (readTarget, writeTarget, readOffset, writeOffset, size))
+GLAD_LAZY_VOID(glCopyImageSubData, PFNGLCOPYIMAGESUBDATAPROC, (GLuint srcName, GLenum srcTarget, GLint srcLevel, GLint srcX, GLint srcY, GLint srcZ, GLuint dstName, GLenum dstTarget, GLint dstLevel, GLint dstX, GLint dstY, GLint dstZ, GLsizei srcWidth, GLsizei srcHeight, GLsizei srcDepth), (srcName, srcTarget, srcLevel, srcX, srcY, srcZ, dstName, dstTarget, dstLevel, dstX, dstY, dstZ, srcWidth, srcHeight, srcDepth))
+GLAD_LAZY_VOID(glCopyNamedBufferSubData, PFNGLCOPYNAMEDBUFFERSUBDATAPROC, (GLuint readBuffer, GLuint writeBuffer, GLintptr readOffset, GLintptr writeOffset, GLsizeiptr size), (readBuffer, writeBuffer, readOffset, writeOffset, size))
+GLAD_LAZY_VOID(glCopyPixels, PFNGLCOPYPIXELSPROC, (GLint x, GLint y, GLsizei width, GLsizei height, GLenum type), (x, y, width, height, type))
+GLAD_LAZY_VOID(glCopyTexImage1D, PFNGLCOPYTEXIMAGE1DPROC, (GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLint border), (target, level, internalformat, x, y, width, border))
+GLAD_LAZY_VOID(glCopyTexImage2D, PFNGLCOPYTEXIMAGE2DPROC, (GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLsizei height, GLint border), (target, level, internalformat, x, y, width, height, border))
+GLAD_LAZY_VOID(glCopyTexSubImage1D, PFNGLCOPYTEXSUBIMAGE1DPROC, (GLenum target, GLint level, GLint xoffset, GLint x, GLint y, GLsizei width), (target, level, xoffset, x, y, width))
+GLAD_LAZY_VOID(glCopyTexSubImage2D, PFNGLCOPYTEXSUBIMAGE2DPROC, (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint x, GLint y, GLsizei width, GLsizei height), (target, level, xoffset, yoffset, x, y, width, height))
+GLAD_LAZY_VOID(glCopyTexSubImage3D, PFNGLCOPYTEXSUBIMAGE3DPROC, (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLint x, GLint y, GLsizei width, GLsizei height), (target, level, xoffset, yoffset, zoffset, x, y, width, height))
+GLAD_LAZY_VOID(glCopyTextureSubImage1D, PFNGLCOPYTEXTURESUBIMAGE1DPROC, (GLuint texture, GLint level, GLint xoffset, GLint x, GLint y, GLsizei width), (texture, level, xoffset, x, y, width))
+GLAD_LAZY_VOID(glCopyTextureSubImage2D, PFNGLCOPYTEXTURESUBIMAGE2DPROC, (GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint x, GLint y, GLsizei width, GLsizei height), (texture, level, xoffset, yoffset, x, y, width, height))
+GLAD_LAZY_VOID(glCopyTextureSubImage3D, PFNGLCOPYTEXTURESUBIMAGE3DPROC, (GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLint x, GLint y, GLsizei width, GLsizei height), (texture, level, xoffset, yoffset, zoffset, x, y, width, height))
+GLAD_LAZY_VOID(glCreateBuffers, PFNGLCREATEBUFFERSPROC, (GLsizei n, GLuint *buffers), (n, buffers))
+GLAD_LAZY_VOID(glCreateFramebuffers, PFNGLCREATEFRAMEBUFFERSPROC, (GLsizei n, GLuint *framebuffers), (n, framebuffers))
+GLAD_LAZY_RET(GLuint, glCreateProgram, PFNGLCREATEPROGRAMPROC, (void), ())
+GLAD_LAZY_VOID(glCreateProgramPipelines, PFNGLCREATEPROGRAMPIPELINESPROC, (GLsizei n, GLuint *pipelines), (n, pipelines))
+GLAD_LAZY_VOID(glCreateQueries, PFNGLCREATEQUERIESPROC, (GLenum target, GLsizei n, GLuint *ids), (target, n, ids))
+GLAD_LAZY_VOID(glCreateRenderbuffers, PFNGLCREATERENDERBUFFERSPROC, (GLsizei n, GLuint *renderbuffers), (n, renderbuffers))
+GLAD_LAZY_VOID(glCreateSamplers, PFNGLCREATESAMPLERSPROC, (GLsizei n, GLuint *samplers), (n, samplers))
+GLAD_LAZY_RET(GLuint, glCreateShader, PFNGLCREATESHADERPROC, (GLenum type), (type))
+GLAD_LAZY_RET(GLuint, glCreateShaderProgramv, PFNGLCREATESHADERPROGRAMVPROC, (GLenum type, GLsizei count, const GLchar *const*strings), (type, count, strings))
+GLAD_LAZY_VOID(glCreateTextures, PFNGLCREATETEXTURESPROC, (GLenum target, GLsizei n, GLuint *textures), (target, n, textures))
+GLAD_LAZY_VOID(glCreateTransformFeedbacks, PFNGLCREATETRANSFORMFEEDBACKSPROC, (GLsizei n, GLuint *ids), (n, ids))
+GLAD_LAZY_VOID(glCreateVertexArrays, PFNGLCREATEVERTEXARRAYSPROC, (GLsizei n, GLuint *arrays), (n, arrays))
+GLAD_LAZY_VOID(glCullFace, PFNGLCULLFACEPROC, (GLenum mode), (mode))
+GLAD_LAZY_VOID(glDebugMessageCallback, PFNGLDEBUGMESSAGECALLBACKPROC, (GLDEBUGPROC callback, const void *userParam), (callback, userParam))
+GLAD_LAZY_VOID(glDebugMessageControl, PFNGLDEBUGMESSAGECONTROLPROC, (GLenum source, GLenum type, GLenum severity, GLsizei count, const GLuint *ids, GLboolean enabled), (source, type, severity, count, ids, enabled))
+GLAD_LAZY_VOID(glDebugMessageInsert, PFNGLDEBUGMESSAGEINSERTPROC, (GLenum source, GLenum type, GLuint id, GLenum severity, GLsizei length, const GLchar *buf), (source, type, id, severity, length, buf))
+GLAD_LAZY_VOID(glDeleteBuffers, PFNGLDELETEBUFFERSPROC, (GLsizei n, const GLuint *buffers), (n, buffers))
+GLAD_LAZY_VOID(glDeleteFramebuffers, PFNGLDELETEFRAMEBUFFERSPROC, (GLsizei n, const GLuint *framebuffers), (n, framebuffers))
+GLAD_LAZY_VOID(glDeleteLists, PFNGLDELETELISTSPROC, (GLuint list, GLsizei range), (list, range))
+GLAD_LAZY_VOID(glDeleteProgram, PFNGLDELETEPROGRAMPROC, (GLuint program), (program))
+GLAD_LAZY_VOID(glDeleteProgramPipelines, PFNGLDELETEPROGRAMPIPELINESPROC, (GLsizei n, const GLuint *pipelines), (n, pipelines))
+GLAD_LAZY_VOID(glDeleteQueries, PFNGLDELETEQUERIESPROC, (GLsizei n, const GLuint *ids), (n, ids))
+GLAD_LAZY_VOID(glDeleteRenderbuffers, PFNGLDELETERENDERBUFFERSPROC, (GLsizei n, const GLuint *renderbuffers), (n, renderbuffers))
+GLAD_LAZY_VOID(glDeleteSamplers, PFNGLDELETESAMPLERSPROC, (GLsizei count, const GLuint *samplers), (count, samplers))
+GLAD_LAZY_VOID(glDeleteShader, PFNGLDELETESHADERPROC, (GLuint shader), (shader))
+GLAD_LAZY_VOID(glDeleteSync, PFNGLDELETESYNCPROC, (GLsync sync), (sync))
+GLAD_LAZY_VOID(glDeleteTextures, PFNGLDELETETEXTURESPROC, (GLsizei n, const GLuint *textures), (n, textures))
+GLAD_LAZY_VOID(glDeleteTransformFeedbacks, PFNGLDELETETRANSFORMFEEDBACKSPROC, (GLsizei n, const GLuint *ids), (n, ids))
+GLAD_LAZY_VOID(glDeleteVertexArrays, PFNGLDELETEVERTEXARRAYSPROC, (GLsizei n, const GLuint *arrays), (n, arrays))
+GLAD_LAZY_VOID(glDepthFunc, PFNGLDEPTHFUNCPROC, (GLenum func), (func))
+GLAD_LAZY_VOID(glDepthMask, PFNGLDEPTHMASKPROC, (GLboolean flag), (flag))
+GLAD_LAZY_VOID(glDepthRange, PFNGLDEPTHRANGEPROC, (GLdouble n, GLdouble f), (n, f))
+GLAD_LAZY_VOID(glDepthRangeArrayv, PFNGLDEPTHRANGEARRAYVPROC, (GLuint first, GLsizei count, const GLdouble *v), (first, count, v))
+GLAD_LAZY_VOID(glDepthRangeIndexed, PFNGLDEPTHRANGEINDEXEDPROC, (GLuint index, GLdouble n, GLdouble f), (index, n, f))
+GLAD_LAZY_VOID(glDepthRangef, PFNGLDEPTHRANGEFPROC, (GLfloat n, GLfloat f), (n, f))
+GLAD_LAZY_VOID(glDetachShader, PFNGLDETACHSHADERPROC, (GLuint program, GLuint shader), (program, shader))
+GLAD_LAZY_VOID(glDisable, PFNGLDISABLEPROC, (GLenum cap), (cap))
+GLAD_LAZY_VOID(glDisableClientState, PFNGLDISABLECLIENTSTATEPROC, (GLenum array), (array))
+GLAD_LAZY_VOID(glDisableVertexArrayAttrib, PFNGLDISABLEVERTEXARRAYATTRIBPROC, (GLuint vaobj, GLuint index), (vaobj, index))
+GLAD_LAZY_VOID(glDisableVertexAttribArray, PFNGLDISABLEVERTEXATTRIBARRAYPROC, (GLuint index), (index))
+GLAD_LAZY_VOID(glDisablei, PFNGLDISABLEIPROC, (GLenum target, GLuint index), (target, index))
+GLAD_LAZY_VOID(glDispatchCompute, PFNGLDISPATCHCOMPUTEPROC, (GLuint num_groups_x, GLuint num_groups_y, GLuint num_groups_z), (num_groups_x, num_groups_y, num_groups_z))
+GLAD_LAZY_VOID(glDispatchComputeIndirect, PFNGLDISPATCHCOMPUTEINDIRECTPROC, (GLintptr indirect), (indirect))
+GLAD_LAZY_VOID(glDrawArrays, PFNGLDRAWARRAYSPROC, (GLenum mode, GLint first, GLsizei count), (mode, first, count))
+GLAD_LAZY_VOID(glDrawArraysIndirect, PFNGLDRAWARRAYSINDIRECTPROC, (GLenum mode, const void *indirect), (mode, indirect))
+GLAD_LAZY_VOID(glDrawArraysInstanced, PFNGLDRAWARRAYSINSTANCEDPROC, (GLenum mode, GLint first, GLsizei count, GLsizei instancecount), (mode, first, count, instancecount))
+GLAD_LAZY_VOID(glDrawArraysInstancedBaseInstance, PFNGLDRAWARRAYSINSTANCEDBASEINSTANCEPROC, (GLenum mode, GLint first, GLsizei count, GLsizei instancecount, GLuint baseinstance), (mode, first, count, instancecount, baseinstance))
+GLAD_LAZY_VOID(glDrawBuffer, PFNGLDRAWBUFFERPROC, (GLenum buf), (buf))
+GLAD_LAZY_VOID(glDrawBuffers, PFNGLDRAWBUFFERSPROC, (GLsizei n, const GLenum *bufs), (n, bufs))
+GLAD_LAZY_VOID(glDrawElements, PFNGLDRAWELEMENTSPROC, (GLenum mode, GLsizei count, GLenum type, const void *indices), (mode, count, type, indices))
+GLAD_LAZY_VOID(glDrawElementsBaseVertex, PFNGLDRAWELEMENTSBASEVERTEXPROC, (GLenum mode, GLsizei count, GLenum type, const void *indices, GLint basevertex), (mode, count, type, indices, basevertex))
+GLAD_LAZY_VOID(glDrawElementsIndirect, PFNGLDRAWELEMENTSINDIRECTPROC, (GLenum mode, GLenum type, const void *indirect), (mode, type, indirect))
+GLAD_LAZY_VOID(glDrawElementsInstanced, PFNGLDRAWELEMENTSINSTANCEDPROC, (GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount), (mode, count, type, indices, instancecount))
+GLAD_LAZY_VOID(glDrawElementsInstancedBaseInstance, PFNGLDRAWELEMENTSINSTANCEDBASEINSTANCEPROC, (GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount, GLuint baseinstance), (mode, count, type, indices, instancecount, baseinstance))
+GLAD_LAZY_VOID(glDrawElementsInstancedBaseVertex, PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXPROC, (GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount, GLint basevertex), (mode, count, type, indices, instancecount, basevertex))
+GLAD_LAZY_VOID(glDrawElementsInstancedBaseVertexBaseInstance, PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXBASEINSTANCEPROC, (GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount, GLint basevertex, GLuint baseinstance), (mode, count, type, indices, instancecount, basevertex, baseinstance))
+GLAD_LAZY_VOID(glDrawPixels, PFNGLDRAWPIXELSPROC, (GLsizei width, GLsizei height, GLenum format, GLenum type, const void *pixels), (width, height, format, type, pixels))
+GLAD_LAZY_VOID(glDrawRangeElements, PFNGLDRAWRANGEELEMENTSPROC, (GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const void *indices), (mode, start, end, count, type, indices))
+GLAD_LAZY_VOID(glDrawRangeElementsBaseVertex, PFNGLDRAWRANGEELEMENTSBASEVERTEXPROC, (GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const void *indices, GLint basevertex), (mode, start, end, count, type, indices, basevertex))
+GLAD_LAZY_VOID(glDrawTransformFeedback, PFNGLDRAWTRANSFORMFEEDBACKPROC, (GLenum mode, GLuint id), (mode, id))
+GLAD_LAZY_VOID(glDrawTransformFeedbackInstanced, PFNGLDRAWTRANSFORMFEEDBACKINSTANCEDPROC, (GLenum mode, GLuint id, GLsizei instancecount), (mode, id, instancecount))
+GLAD_LAZY_VOID(glDrawTransformFeedbackStream, PFNGLDRAWTRANSFORMFEEDBACKSTREAMPROC, (GLenum mode, GLuint id, GLuint stream), (mode, id, stream))
+GLAD_LAZY_VOID(glDrawTransformFeedbackStreamInstanced, PFNGLDRAWTRANSFORMFEEDBACKSTREAMINSTANCEDPROC, (GLenum mode, GLuint id, GLuint stream, GLsizei instancecount), (mode, id, stream, instancecount))
+GLAD_LAZY_VOID(glEdgeFlag, PFNGLEDGEFLAGPROC, (GLboolean flag), (flag))
+GLAD_LAZY_VOID(glEdgeFlagPointer, PFNGLEDGEFLAGPOINTERPROC, (GLsizei stride, const void *pointer), (stride, pointer))
+GLAD_LAZY_VOID(glEdgeFlagv, PFNGLEDGEFLAGVPROC, (const GLboolean *flag), (flag))
+GLAD_LAZY_VOID(glEnable, PFNGLENABLEPROC, (GLenum cap), (cap))
+GLAD_LAZY_VOID(glEnableClientState, PFNGLENABLECLIENTSTATEPROC, (GLenum array), (array))
+GLAD_LAZY_VOID(glEnableVertexArrayAttrib, PFNGLENABLEVERTEXARRAYATTRIBPROC, (GLuint vaobj, GLuint index), (vaobj, index))
+GLAD_LAZY_VOID(glEnableVertexAttribArray, PFNGLENABLEVERTEXATTRIBARRAYPROC, (GLuint index), (index))
+GLAD_LAZY_VOID(glEnablei, PFNGLENABLEIPROC, (GLenum target, GLuint index), (target, index))
+GLAD_LAZY_VOID(glEnd, PFNGLENDPROC, (void), ())
+GLAD_LAZY_VOID(glEndConditionalRender, PFNGLENDCONDITIONALRENDERPROC, (void), ())
+GLAD_LAZY_VOID(glEndList, PFNGLENDLISTPROC, (void), ())
+GLAD_LAZY_VOID(glEndQuery, PFNGLENDQUERYPROC, (GLenum target), (target))
+GLAD_LAZY_VOID(glEndQueryIndexed, PFNGLENDQUERYINDEXEDPROC, (GLenum target, GLuint index), (target, index))
+GLAD_LAZY_VOID(glEndTransformFeedback, PFNGLENDTRANSFORMFEEDBACKPROC, (void), ())
+GLAD_LAZY_VOID(glEvalCoord1d, PFNGLEVALCOORD1DPROC, (GLdouble u), (u))
+GLAD_LAZY_VOID(glEvalCoord1dv, PFNGLEVALCOORD1DVPROC, (const GLdouble *u), (u))
+GLAD_LAZY_VOID(glEvalCoord1f, PFNGLEVALCOORD1FPROC, (GLfloat u), (u))
+GLAD_LAZY_VOID(glEvalCoord1fv, PFNGLEVALCOORD1FVPROC, (const GLfloat *u), (u))
+GLAD_LAZY_VOID(glEvalCoord2d, PFNGLEVALCOORD2DPROC, (GLdouble u, GLdouble v), (u, v))
+GLAD_LAZY_VOID(glEvalCoord2dv, PFNGLEVALCOORD2DVPROC, (const GLdouble *u), (u))
+GLAD_LAZY_VOID(glEvalCoord2f, PFNGLEVALCOORD2FPROC, (GLfloat u, GLfloat v), (u, v))
+GLAD_LAZY_VOID(glEvalCoord2fv, PFNGLEVALCOORD2FVPROC, (const GLfloat *u), (u))
+GLAD_LAZY_VOID(glEvalMesh1, PFNGLEVALMESH1PROC, (GLenum mode, GLint i1, GLint i2), (mode, i1, i2))
+GLAD_LAZY_VOID(glEvalMesh2, PFNGLEVALMESH2PROC, (GLenum mode, GLint i1, GLint i2, GLint j1, GLint j2), (mode, i1, i2, j1, j2))
+GLAD_LAZY_VOID(glEvalPoint1, PFNGLEVALPOINT1PROC, (GLint i), (i))
+GLAD_LAZY_VOID(glEvalPoint2, PFNGLEVALPOINT2PROC, (GLint i, GLint j), (i, j))
+GLAD_LAZY_VOID(glFeedbackBuffer, PFNGLFEEDBACKBUFFERPROC, (GLsizei size, GLenum type, GLfloat *buffer), (size, type, buffer))
+GLAD_LAZY_RET(GLsync, glFenceSync, PFNGLFENCESYNCPROC, (GLenum condition, GLbitfield flags), (condition, flags))
+GLAD_LAZY_VOID(glFinish, PFNGLFINISHPROC, (void), ())
+GLAD_LAZY_VOID(glFlush, PFNGLFLUSHPROC, (void), ())
+GLAD_LAZY_VOID(glFlushMappedBufferRange, PFNGLFLUSHMAPPEDBUFFERRANGEPROC, (GLenum target, GLintptr offset, GLsizeiptr length), (target, offset, length))
+GLAD_LAZY_VOID(glFlushMappedNamedBufferRange, PFNGLFLUSHMAPPEDNAMEDBUFFERRANGEPROC, (GLuint buffer, GLintptr offset, GLsizeiptr length), (buffer, offset, length))
+GLAD_LAZY_VOID(glFogCoordPointer, PFNGLFOGCOORDPOINTERPROC, (GLenum type, GLsizei stride, const void *pointer), (type, stride, pointer))
+GLAD_LAZY_VOID(glFogCoordd, PFNGLFOGCOORDDPROC, (GLdouble coord), (coord))
+GLAD_LAZY_VOID(glFogCoorddv, PFNGLFOGCOORDDVPROC, (const GLdouble *coord), (coord))
+GLAD_LAZY_VOID(glFogCoordf, PFNGLFOGCOORDFPROC, (GLfloat coord), (coord))
+GLAD_LAZY_VOID(glFogCoordfv, PFNGLFOGCOORDFVPROC, (const GLfloat *coord), (coord))
+GLAD_LAZY_VOID(glFogf, PFNGLFOGFPROC, (GLenum pname, GLfloat param), (pname, param))
+GLAD_LAZY_VOID(glFogfv, PFNGLFOGFVPROC, (GLenum pname, const GLfloat *params), (pname, params))
+GLAD_LAZY_VOID(glFogi, PFNGLFOGIPROC, (GLenum pname, GLint param), (pname, param))
+GLAD_LAZY_VOID(glFogiv, PFNGLFOGIVPROC, (GLenum pname, const GLint *params), (pname, params))
+GLAD_LAZY_VOID(glFramebufferParameteri, PFNGLFRAMEBUFFERPARAMETERIPROC, (GLenum target, GLenum pname, GLint param), (target, pname, param))
+GLAD_LAZY_VOID(glFramebufferRenderbuffer, PFNGLFRAMEBUFFERRENDERBUFFERPROC, (GLenum target, GLenum attachment, GLenum renderbuffertarget, GLuint renderbuffer), (target, attachment, renderbuffertarget, renderbuffer))
+GLAD_LAZY_VOID(glFramebufferTexture, PFNGLFRAMEBUFFERTEXTUREPROC, (GLenum target, GLenum attachment, GLuint texture, GLint level), (target, attachment, texture, level))
+GLAD_LAZY_VOID(glFramebufferTexture1D, PFNGLFRAMEBUFFERTEXTURE1DPROC, (GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level), (target, attachment, textarget, texture, level))
+GLAD_LAZY_VOID(glFramebufferTexture2D, PFNGLFRAMEBUFFERTEXTURE2DPROC, (GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level), (target, attachment, textarget, texture, level))
+GLAD_LAZY_VOID(glFramebufferTexture3D, PFNGLFRAMEBUFFERTEXTURE3DPROC, (GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level, GLint zoffset), (target, attachment, textarget, texture, level, zoffset))
+GLAD_LAZY_VOID(glFramebufferTextureLayer, PFNGLFRAMEBUFFERTEXTURELAYERPROC, (GLenum target, GLenum attachment, GLuint texture, GLint level, GLint layer), (target, attachment, texture, level, layer))
+GLAD_LAZY_VOID(glFrontFace, PFNGLFRONTFACEPROC, (GLenum mode), (mode))
+GLAD_LAZY_VOID(glFrustum, PFNGLFRUSTUMPROC, (GLdouble left, GLdouble right, GLdouble bottom, GLdouble top, GLdouble zNear, GLdouble zFar), (left, right, bottom, top, zNear, zFar))
+GLAD_LAZY_VOID(glGenBuffers, PFNGLGENBUFFERSPROC, (GLsizei n, GLuint *buffers), (n, buffers))
+GLAD_LAZY_VOID(glGenFramebuffers, PFNGLGENFRAMEBUFFERSPROC, (GLsizei n, GLuint *framebuffers), (n, framebuffers))
+GLAD_LAZY_RET(GLuint, glGenLists, PFNGLGENLISTSPROC, (GLsizei range), (range))
+GLAD_LAZY_VOID(glGenProgramPipelines, PFNGLGENPROGRAMPIPELINESPROC, (GLsizei n, GLuint *pipelines), (n, pipelines))
+GLAD_LAZY_VOID(glGenQueries, PFNGLGENQUERIESPROC, (GLsizei n, GLuint *ids), (n, ids))
+GLAD_LAZY_VOID(glGenRenderbuffers, PFNGLGENRENDERBUFFERSPROC, (GLsizei n, GLuint *renderbuffers), (n, renderbuffers))
+GLAD_LAZY_VOID(glGenSamplers, PFNGLGENSAMPLERSPROC, (GLsizei count, GLuint *samplers), (count, samplers))
+GLAD_LAZY_VOID(glGenTextures, PFNGLGENTEXTURESPROC, (GLsizei n, GLuint *textures), (n, textures))
+GLAD_LAZY_VOID(glGenTransformFeedbacks, PFNGLGENTRANSFORMFEEDBACKSPROC, (GLsizei n, GLuint *ids), (n, ids))
+GLAD_LAZY_VOID(glGenVertexArrays, PFNGLGENVERTEXARRAYSPROC, (GLsizei n, GLuint *arrays), (n, arrays))
+GLAD_LAZY_VOID(glGenerateMipmap, PFNGLGENERATEMIPMAPPROC, (GLenum target), (target))
+GLAD_LAZY_VOID(glGenerateTextureMipmap, PFNGLGENERATETEXTUREMIPMAPPROC, (GLuint texture), (texture))
+GLAD_LAZY_VOID(glGetActiveAtomicCounterBufferiv, PFNGLGETACTIVEATOMICCOUNTERBUFFERIVPROC, (GLuint program, GLuint bufferIndex, GLenum pname, GLint *params), (program, bufferIndex, pname, params))
+GLAD_LAZY_VOID(glGetActiveAttrib, PFNGLGETACTIVEATTRIBPROC, (GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLint *size, GLenum *type, GLchar *name), (program, index, bufSize, length, size, type, name))
+GLAD_LAZY_VOID(glGetActiveSubroutineName, PFNGLGETACTIVESUBROUTINENAMEPROC, (GLuint program, GLenum shadertype, GLuint index, GLsizei bufSize, GLsizei *length, GLchar *name), (program, shadertype, index, bufSize, length, name))
+GLAD_LAZY_VOID(glGetActiveSubroutineUniformName, PFNGLGETACTIVESUBROUTINEUNIFORMNAMEPROC, (GLuint program, GLenum shadertype, GLuint index, GLsizei bufSize, GLsizei *length, GLchar *name), (program, shadertype, index, bufSize, length, name))
+GLAD_LAZY_VOID(glGetActiveSubroutineUniformiv, PFNGLGETACTIVESUBROUTINEUNIFORMIVPROC, (GLuint program, GLenum shadertype, GLuint index, GLenum pname, GLint *values), (program, shadertype, index, pname, values))
+GLAD_LAZY_VOID(glGetActiveUniform, PFNGLGETACTIVEUNIFORMPROC, (GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLint *size, GLenum *type, GLchar *name), (program, index, bufSize, length, size, type, name))
+GLAD_LAZY_VOID(glGetActiveUniformBlockName, PFNGLGETACTIVEUNIFORMBLOCKNAMEPROC, (GLuint program, GLuint uniformBlockIndex, GLsizei bufSize, GLsizei *length, GLchar *uniformBlockName), (program, uniformBlockIndex, bufSize, length, uniformBlockName))
+GLAD_LAZY_VOID(glGetActiveUniformBlockiv, PFNGLGETACTIVEUNIFORMBLOCKIVPROC, (GLuint program, GLuint uniformBlockIndex, GLenum pname, GLint *params), (program, uniformBlockIndex, pname, params))
+GLAD_LAZY_VOID(glGetActiveUniformName, PFNGLGETACTIVEUNIFORMNAMEPROC, (GLuint program, GLuint uniformIndex, GLsizei bufSize, GLsizei *length, GLchar *uniformName), (program, uniformIndex, bufSize, length, uniformName))
+GLAD_LAZY_VOID(glGetActiveUniformsiv, PFNGLGETACTIVEUNIFORMSIVPROC, (GLuint program, GLsizei uniformCount, const GLuint *uniformIndices, GLenum pname, GLint *params), (program, uniformCount, uniformIndices, pname, params))
+GLAD_LAZY_VOID(glGetAttachedShaders, PFNGLGETATTACHEDSHADERSPROC, (GLuint program, GLsizei maxCount, GLsizei *count, GLuint *shaders), (program, maxCount, count, shaders))
+GLAD_LAZY_RET(GLint, glGetAttribLocation, PFNGLGETATTRIBLOCATIONPROC, (GLuint program, const GLchar *name), (program, name))
+GLAD_LAZY_VOID(glGetBooleani_v, PFNGLGETBOOLEANI_VPROC, (GLenum target, GLuint index, GLboolean *data), (target, index, data))
+GLAD_LAZY_VOID(glGetBooleanv, PFNGLGETBOOLEANVPROC, (GLenum pname, GLboolean *data), (pname, data))
+GLAD_LAZY_VOID(glGetBufferParameteri64v, PFNGLGETBUFFERPARAMETERI64VPROC, (GLenum target, GLenum pname, GLint64 *params), (target, pname, params))
+GLAD_LAZY_VOID(glGetBufferParameteriv, PFNGLGETBUFFERPARAMETERIVPROC, (GLenum target, GLenum pname, GLint *params), (target, pname, params))
+GLAD_LAZY_VOID(glGetBufferPointerv, PFNGLGETBUFFERPOINTERVPROC, (GLenum target, GLenum pname, void **params), (target, pname, params))
+GLAD_LAZY_VOID(glGetBufferSubData, PFNGLGETBUFFERSUBDATAPROC, (GLenum target, GLintptr offset, GLsizeiptr size, void *data), (target, offset, size, data))
+GLAD_LAZY_VOID(glGetClipPlane, PFNGLGETCLIPPLANEPROC, (GLenum plane, GLdouble *equation), (plane, equation))
+GLAD_LAZY_VOID(glGetCompressedTexImage, PFNGLGETCOMPRESSEDTEXIMAGEPROC, (GLenum target, GLint level, void *img), (target, level, img))
+GLAD_LAZY_VOID(glGetCompressedTextureImage, PFNGLGETCOMPRESSEDTEXTUREIMAGEPROC, (GLuint texture, GLint level, GLsizei bufSize, void *pixels), (texture, level, bufSize, pixels))
+GLAD_LAZY_VOID(glGetCompressedTextureSubImage, PFNGLGETCOMPRESSEDTEXTURESUBIMAGEPROC, (GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLsizei bufSize, void *pixels), (texture, level, xoffset, yoffset, zoffset, width, height, depth, bufSize, pixels))
+GLAD_LAZY_RET(GLuint, glGetDebugMessageLog, PFNGLGETDEBUGMESSAGELOGPROC, (GLuint count, GLsizei bufSize, GLenum *sources, GLenum *types, GLuint *ids, GLenum *severities, GLsizei *lengths, GLchar *messageLog), (count, bufSize, sources, types, ids, severities, lengths, messageLog))
+GLAD_LAZY_VOID(glGetDoublei_v, PFNGLGETDOUBLEI_VPROC, (GLenum target, GLuint index, GLdouble *data), (target, index, data))
+GLAD_LAZY_VOID(glGetDoublev, PFNGLGETDOUBLEVPROC, (GLenum pname, GLdouble *data), (pname, data))
+GLAD_LAZY_RET(GLenum, glGetError, PFNGLGETERRORPROC, (void), ())
+GLAD_LAZY_VOID(glGetFloati_v, PFNGLGETFLOATI_VPROC, (GLenum target, GLuint index, GLfloat *data), (target, index, data))
+GLAD_LAZY_VOID(glGetFloatv, PFNGLGETFLOATVPROC, (GLenum pname, GLfloat *data), (pname, data))
+GLAD_LAZY_RET(GLint, glGetFragDataIndex, PFNGLGETFRAGDATAINDEXPROC, (GLuint program, const GLchar *name), (program, name))
+GLAD_LAZY_RET(GLint, glGetFragDataLocation, PFNGLGETFRAGDATALOCATIONPROC, (GLuint program, const GLchar *name), (program, name))
+GLAD_LAZY_VOID(glGetFramebufferAttachmentParameteriv, PFNGLGETFRAMEBUFFERATTACHMENTPARAMETERIVPROC, (GLenum target, GLenum attachment, GLenum pname, GLint *params), (target, attachment, pname, params))
+GLAD_LAZY_VOID(glGetFramebufferParameteriv, PFNGLGETFRAMEBUFFERPARAMETERIVPROC, (GLenum target, GLenum pname, GLint *params), (target, pname, params))
+GLAD_LAZY_RET(GLenum, glGetGraphicsResetStatus, PFNGLGETGRAPHICSRESETSTATUSPROC, (void), ())
+GLAD_LAZY_VOID(glGetInteger64i_v, PFNGLGETINTEGER64I_VPROC, (GLenum target, GLuint index, GLint64 *data), (target, index, data))
+GLAD_LAZY_VOID(glGetInteger64v, PFNGLGETINTEGER64VPROC, (GLenum pname, GLint64 *data), (pname, data))
+GLAD_LAZY_VOID(glGetIntegeri_v, PFNGLGETINTEGERI_VPROC, (GLenum target, GLuint index, GLint *data), (target, index, data))
+GLAD_LAZY_VOID(glGetIntegerv, PFNGLGETINTEGERVPROC, (GLenum pname, GLint *data), (pname, data))
+GLAD_LAZY_VOID(glGetInternalformati64v, PFNGLGETINTERNALFORMATI64VPROC, (GLenum target, GLenum internalformat, GLenum pname, GLsizei count, GLint64 *params), (target, internalformat, pname, count, params))
+GLAD_LAZY_VOID(glGetInternalformativ, PFNGLGETINTERNALFORMATIVPROC, (GLenum target, GLenum internalformat, GLenum pname, GLsizei count, GLint *params), (target, internalformat, pname, count, params))
+GLAD_LAZY_VOID(glGetLightfv, PFNGLGETLIGHTFVPROC, (GLenum light, GLenum pname, GLfloat *params), (light, pname, params))
+GLAD_LAZY_VOID(glGetLightiv, PFNGLGETLIGHTIVPROC, (GLenum light, GLenum pname, GLint *params), (light, pname, params))
+GLAD_LAZY_VOID(glGetMapdv, PFNGLGETMAPDVPROC, (GLenum target, GLenum query, GLdouble *v), (target, query, v))
+GLAD_LAZY_VOID(glGetMapfv, PFNGLGETMAPFVPROC, (GLenum target, GLenum query, GLfloat *v), (target, query, v))
+GLAD_LAZY_VOID(glGetMapiv, PFNGLGETMAPIVPROC, (GLenum target, GLenum query, GLint *v), (target, query, v))
+GLAD_LAZY_VOID(glGetMaterialfv, PFNGLGETMATERIALFVPROC, (GLenum face, GLenum pname, GLfloat *params), (face, pname, params))
+GLAD_LAZY_VOID(glGetMaterialiv, PFNGLGETMATERIALIVPROC, (GLenum face, GLenum pname, GLint *params), (face, pname, params))
+GLAD_LAZY_VOID(glGetMultisamplefv, PFNGLGETMULTISAMPLEFVPROC, (GLenum pname, GLuint index, GLfloat *val), (pname, index, val))
+GLAD_LAZY_VOID(glGetNamedBufferParameteri64v, PFNGLGETNAMEDBUFFERPARAMETERI64VPROC, (GLuint buffer, GLenum pname, GLint64 *params), (buffer, pname, params))
+GLAD_LAZY_VOID(glGetNamedBufferParameteriv, PFNGLGETNAMEDBUFFERPARAMETERIVPROC, (GLuint buffer, GLenum pname, GLint *params), (buffer, pname, params))
+GLAD_LAZY_VOID(glGetNamedBufferPointerv, PFNGLGETNAMEDBUFFERPOINTERVPROC, (GLuint buffer, GLenum pname, void **params), (buffer, pname, params))
+GLAD_LAZY_VOID(glGetNamedBufferSubData, PFNGLGETNAMEDBUFFERSUBDATAPROC, (GLuint buffer, GLintptr offset, GLsizeiptr size, void *data), (buffer, offset, size, data))
+GLAD_LAZY_VOID(glGetNamedFramebufferAttachmentParameteriv, PFNGLGETNAMEDFRAMEBUFFERATTACHMENTPARAMETERIVPROC, (GLuint framebuffer, GLenum attachment, GLenum pname, GLint *params), (framebuffer, attachment, pname, params))
+GLAD_LAZY_VOID(glGetNamedFramebufferParameteriv, PFNGLGETNAMEDFRAMEBUFFERPARAMETERIVPROC, (GLuint framebuffer, GLenum pname, GLint *param), (framebuffer, pname, param))
+GLAD_LAZY_VOID(glGetNamedRenderbufferParameteriv, PFNGLGETNAMEDRENDERBUFFERPARAMETERIVPROC, (GLuint renderbuffer, GLenum pname, GLint *params), (renderbuffer, pname, params))
+GLAD_LAZY_VOID(glGetObjectLabel, PFNGLGETOBJECTLABELPROC, (GLenum identifier, GLuint name, GLsizei bufSize, GLsizei *length, GLchar *label), (identifier, name, bufSize, length, label))
+GLAD_LAZY_VOID(glGetObjectPtrLabel, PFNGLGETOBJECTPTRLABELPROC, (const void *ptr, GLsizei bufSize, GLsizei *length, GLchar *label), (ptr, bufSize, length, label))
+GLAD_LAZY_VOID(glGetPixelMapfv, PFNGLGETPIXELMAPFVPROC, (GLenum map, GLfloat *values), (map, values))
+GLAD_LAZY_VOID(glGetPixelMapuiv, PFNGLGETPIXELMAPUIVPROC, (GLenum map, GLuint *values), (map, values))
+GLAD_LAZY_VOID(glGetPixelMapusv, PFNGLGETPIXELMAPUSVPROC, (GLenum map, GLushort *values), (map, values))
+GLAD_LAZY_VOID(glGetPointerv, PFNGLGETPOINTERVPROC, (GLenum pname, void **params), (pname, params))
+GLAD_LAZY_VOID(glGetPolygonStipple, PFNGLGETPOLYGONSTIPPLEPROC, (GLubyte *mask), (mask))
+GLAD_LAZY_VOID(glGetProgramBinary, PFNGLGETPROGRAMBINARYPROC, (GLuint program, GLsizei bufSize, GLsizei *length, GLenum *binaryFormat, void *binary), (program, bufSize, length, binaryFormat, binary))
+GLAD_LAZY_VOID(glGetProgramInfoLog, PFNGLGETPROGRAMINFOLOGPROC, (GLuint program, GLsizei bufSize, GLsizei *length, GLchar *infoLog), (program, bufSize, length, infoLog))
+GLAD_LAZY_VOID(glGetProgramInterfaceiv, PFNGLGETPROGRAMINTERFACEIVPROC, (GLuint program, GLenum programInterface, GLenum pname, GLint *params), (program, programInterface, pname, params))
+GLAD_LAZY_VOID(glGetProgramPipelineInfoLog, PFNGLGETPROGRAMPIPELINEINFOLOGPROC, (GLuint pipeline, GLsizei bufSize, GLsizei *length, GLchar *infoLog), (pipeline, bufSize, length, infoLog))
+GLAD_LAZY_VOID(glGetProgramPipelineiv, PFNGLGETPROGRAMPIPELINEIVPROC, (GLuint pipeline, GLenum pname, GLint *params), (pipeline, pname, params))
+GLAD_LAZY_RET(GLuint, glGetProgramResourceIndex, PFNGLGETPROGRAMRESOURCEINDEXPROC, (GLuint program, GLenum programInterface, const GLchar *name), (program, programInterface, name))
+GLAD_LAZY_RET(GLint, glGetProgramResourceLocation, PFNGLGETPROGRAMRESOURCELOCATIONPROC, (GLuint program, GLenum programInterface, const GLchar *name), (program, programInterface, name))
+GLAD_LAZY_RET(GLint, glGetProgramResourceLocationIndex, PFNGLGETPROGRAMRESOURCELOCATIONINDEXPROC, (GLuint program, GLenum programInterface, const GLchar *name), (program, programInterface, name))
+GLAD_LAZY_VOID(glGetProgramResourceName, PFNGLGETPROGRAMRESOURCENAMEPROC, (GLuint program, GLenum programInterface, GLuint index, GLsizei bufSize, GLsizei *length, GLchar *name), (program, programInterface, index, bufSize, length, name))
+GLAD_LAZY_VOID(glGetProgramResourceiv, PFNGLGETPROGRAMRESOURCEIVPROC, (GLuint program, GLenum programInterface, GLuint index, GLsizei propCount, const GLenum *props, GLsizei count, GLsizei *length, GLint *params), (program, programInterface, index, propCount, props, count, length, params))
+GLAD_LAZY_VOID(glGetProgramStageiv, PFNGLGETPROGRAMSTAGEIVPROC, (GLuint program, GLenum shadertype, GLenum pname, GLint *values), (program, shadertype, pname, values))
+GLAD_LAZY_VOID(glGetProgramiv, PFNGLGETPROGRAMIVPROC, (GLuint program, GLenum pname, GLint *params), (program, pname, params))
+GLAD_LAZY_VOID(glGetQueryBufferObjecti64v, PFNGLGETQUERYBUFFEROBJECTI64VPROC, (GLuint id, GLuint buffer, GLenum pname, GLintptr offset), (id, buffer, pname, offset))
+GLAD_LAZY_VOID(glGetQueryBufferObjectiv, PFNGLGETQUERYBUFFEROBJECTIVPROC, (GLuint id, GLuint buffer, GLenum pname, GLintptr offset), (id, buffer, pname, offset))
+GLAD_LAZY_VOID(glGetQueryBufferObjectui64v, PFNGLGETQUERYBUFFEROBJECTUI64VPROC, (GLuint id, GLuint buffer, GLenum pname, GLintptr offset), (id, buffer, pname, offset))
+GLAD_LAZY_VOID(glGetQueryBufferObjectuiv, PFNGLGETQUERYBUFFEROBJECTUIVPROC, (GLuint id, GLuint buffer, GLenum pname, GLintptr offset), (id, buffer, pname, offset))
+GLAD_LAZY_VOID(glGetQueryIndexediv, PFNGLGETQUERYINDEXEDIVPROC, (GLenum target, GLuint index, GLenum pname, GLint *params), (target, index, pname, params))
+GLAD_LAZY_VOID(glGetQueryObjecti64v, PFNGLGETQUERYOBJECTI64VPROC, (GLuint id, GLenum pname, GLint64 *params), (id, pname, params))
+GLAD_LAZY_VOID(glGetQueryObjectiv, PFNGLGETQUERYOBJECTIVPROC, (GLuint id, GLenum pname, GLint *params), (id, pname, params))
+GLAD_LAZY_VOID(glGetQueryObjectui64v, PFNGLGETQUERYOBJECTUI64VPROC, (GLuint id, GLenum pname, GLuint64 *params), (id, pname, params))
+GLAD_LAZY_VOID(glGetQueryObjectuiv, PFNGLGETQUERYOBJECTUIVPROC, (GLuint id, GLenum pname, GLuint *params), (id, pname, params))
+GLAD_LAZY_VOID(glGetQueryiv, PFNGLGETQUERYIVPROC, (GLenum target, GLenum pname, GLint *params), (target, pname, params))
+GLAD_LAZY_VOID(glGetRenderbufferParameteriv, PFNGLGETRENDERBUFFERPARAMETERIVPROC, (GLenum target, GLenum pname, GLint *params), (target, pname, params))
+GLAD_LAZY_VOID(glGetSamplerParameterIiv, PFNGLGETSAMPLERPARAMETERIIVPROC, (GLuint sampler, GLenum pname, GLint *params), (sampler, pname, params))
+GLAD_LAZY_VOID(glGetSamplerParameterIuiv, PFNGLGETSAMPLERPARAMETERIUIVPROC, (GLuint sampler, GLenum pname, GLuint *params), (sampler, pname, params))
+GLAD_LAZY_VOID(glGetSamplerParameterfv, PFNGLGETSAMPLERPARAMETERFVPROC, (GLuint sampler, GLenum pname, GLfloat *params), (sampler, pname, params))
+GLAD_LAZY_VOID(glGetSamplerParameteriv, PFNGLGETSAMPLERPARAMETERIVPROC, (GLuint sampler, GLenum pname, GLint *params), (sampler, pname, params))
+GLAD_LAZY_VOID(glGetShaderInfoLog, PFNGLGETSHADERINFOLOGPROC, (GLuint shader, GLsizei bufSize, GLsizei *length, GLchar *infoLog), (shader, bufSize, length, infoLog))
+GLAD_LAZY_VOID(glGetShaderPrecisionFormat, PFNGLGETSHADERPRECISIONFORMATPROC, (GLenum shadertype, GLenum precisiontype, GLint *range, GLint *precision), (shadertype, precisiontype, range, precision))
+GLAD_LAZY_VOID(glGetShaderSource, PFNGLGETSHADERSOURCEPROC, (GLuint shader, GLsizei bufSize, GLsizei *length, GLchar *source), (shader, bufSize, length, source))
+GLAD_LAZY_VOID(glGetShaderiv, PFNGLGETSHADERIVPROC, (GLuint shader, GLenum pname, GLint *params), (shader, pname, params))
+GLAD_LAZY_RET(const GLubyte *, glGetStringi, PFNGLGETSTRINGIPROC, (GLenum name, GLuint index), (name, index))
+GLAD_LAZY_RET(GLuint, glGetSubroutineIndex, PFNGLGETSUBROUTINEINDEXPROC, (GLuint program, GLenum shadertype, const GLchar *name), (program, shadertype, name))
+GLAD_LAZY_RET(GLint, glGetSubroutineUniformLocation, PFNGLGETSUBROUTINEUNIFORMLOCATIONPROC, (GLuint program, GLenum shadertype, const GLchar *name), (program, shadertype, name))
+GLAD_LAZY_VOID(glGetSynciv, PFNGLGETSYNCIVPROC, (GLsync sync, GLenum pname, GLsizei count, GLsizei *length, GLint *values), (sync, pname, count, length, values))
+GLAD_LAZY_VOID(glGetTexEnvfv, PFNGLGETTEXENVFVPROC, (GLenum target, GLenum pname, GLfloat *params), (target, pname, params))
+GLAD_LAZY_VOID(glGetTexEnviv, PFNGLGETTEXENVIVPROC, (GLenum target, GLenum pname, GLint *params), (target, pname, params))
+GLAD_LAZY_VOID(glGetTexGendv, PFNGLGETTEXGENDVPROC, (GLenum coord, GLenum pname, GLdouble *params), (coord, pname, params))
+GLAD_LAZY_VOID(glGetTexGenfv, PFNGLGETTEXGENFVPROC, (GLenum coord, GLenum pname, GLfloat *params), (coord, pname, params))
+GLAD_LAZY_VOID(glGetTexGeniv, PFNGLGETTEXGENIVPROC, (GLenum coord, GLenum pname, GLint *params), (coord, pname, params))
+GLAD_LAZY_VOID(glGetTexImage, PFNGLGETTEXIMAGEPROC, (GLenum target, GLint level, GLenum format, GLenum type, void *pixels), (target, level, format, type, pixels))
+GLAD_LAZY_VOID(glGetTexLevelParameterfv, PFNGLGETTEXLEVELPARAMETERFVPROC, (GLenum target, GLint level, GLenum pname, GLfloat *params), (target, level, pname, params))
+GLAD_LAZY_VOID(glGetTexLevelParameteriv, PFNGLGETTEXLEVELPARAMETERIVPROC, (GLenum target, GLint level, GLenum pname, GLint *params), (target, level, pname, params))
+GLAD_LAZY_VOID(glGetTexParameterIiv, PFNGLGETTEXPARAMETERIIVPROC, (GLenum target, GLenum pname, GLint *params), (target, pname, params))
+GLAD_LAZY_VOID(glGetTexParameterIuiv, PFNGLGETTEXPARAMETERIUIVPROC, (GLenum target, GLenum pname, GLuint *params), (target, pname, params))
+GLAD_LAZY_VOID(glGetTexParameterfv, PFNGLGETTEXPARAMETERFVPROC, (GLenum target, GLenum pname, GLfloat *params), (target, pname, params))
+GLAD_LAZY_VOID(glGetTexParameteriv, PFNGLGETTEXPARAMETERIVPROC, (GLenum target, GLenum pname, GLint *params), (target, pname, params))
+GLAD_LAZY_VOID(glGetTextureImage, PFNGLGETTEXTUREIMAGEPROC, (GLuint texture, GLint level, GLenum format, GLenum type, GLsizei bufSize, void *pixels), (texture, level, format, type, bufSize, pixels))
+GLAD_LAZY_VOID(glGetTextureLevelParameterfv, PFNGLGETTEXTURELEVELPARAMETERFVPROC, (GLuint texture, GLint level, GLenum pname, GLfloat *params), (texture, level, pname, params))
+GLAD_LAZY_VOID(glGetTextureLevelParameteriv, PFNGLGETTEXTURELEVELPARAMETERIVPROC, (GLuint texture, GLint level, GLenum pname, GLint *params), (texture, level, pname, params))
+GLAD_LAZY_VOID(glGetTextureParameterIiv, PFNGLGETTEXTUREPARAMETERIIVPROC, (GLuint texture, GLenum pname, GLint *params), (texture, pname, params))
+GLAD_LAZY_VOID(glGetTextureParameterIuiv, PFNGLGETTEXTUREPARAMETERIUIVPROC, (GLuint texture, GLenum pname, GLuint *params), (texture, pname, params))
+GLAD_LAZY_VOID(glGetTextureParameterfv, PFNGLGETTEXTUREPARAMETERFVPROC, (GLuint texture, GLenum pname, GLfloat *params), (texture, pname, params))
+GLAD_LAZY_VOID(glGetTextureParameteriv, PFNGLGETTEXTUREPARAMETERIVPROC, (GLuint texture, GLenum pname, GLint *params), (texture, pname, params))
+GLAD_LAZY_VOID(glGetTextureSubImage, PFNGLGETTEXTURESUBIMAGEPROC, (GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, GLsizei bufSize, void *pixels), (texture, level, xoffset, yoffset, zoffset, width, height, depth, format, type, bufSize, pixels))
+GLAD_LAZY_VOID(glGetTransformFeedbackVarying, PFNGLGETTRANSFORMFEEDBACKVARYINGPROC, (GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLsizei *size, GLenum *type, GLchar *name), (program, index, bufSize, length, size, type, name))
+GLAD_LAZY_VOID(glGetTransformFeedbacki64_v, PFNGLGETTRANSFORMFEEDBACKI64_VPROC, (GLuint xfb, GLenum pname, GLuint index, GLint64 *param), (xfb, pname, index, param))
+GLAD_LAZY_VOID(glGetTransformFeedbacki_v, PFNGLGETTRANSFORMFEEDBACKI_VPROC, (GLuint xfb, GLenum pname, GLuint index, GLint *param), (xfb, pname, index, param))
+GLAD_LAZY_VOID(glGetTransformFeedbackiv, PFNGLGETTRANSFORMFEEDBACKIVPROC, (GLuint xfb, GLenum pname, GLint *param), (xfb, pname, param))
+GLAD_LAZY_RET(GLuint, glGetUniformBlockIndex, PFNGLGETUNIFORMBLOCKINDEXPROC, (GLuint program, const GLchar *uniformBlockName), (program, uniformBlockName))
+GLAD_LAZY_VOID(glGetUniformIndices, PFNGLGETUNIFORMINDICESPROC, (GLuint program, GLsizei uniformCount, const GLchar *const*uniformNames, GLuint *uniformIndices), (program, uniformCount, uniformNames, uniformIndices))
+GLAD_LAZY_RET(GLint, glGetUniformLocation, PFNGLGETUNIFORMLOCATIONPROC, (GLuint program, const GLchar *name), (program, name))
+GLAD_LAZY_VOID(glGetUniformSubroutineuiv, PFNGLGETUNIFORMSUBROUTINEUIVPROC, (GLenum shadertype, GLint location, GLuint *params), (shadertype, location, params))
+GLAD_LAZY_VOID(glGetUniformdv, PFNGLGETUNIFORMDVPROC, (GLuint program, GLint location, GLdouble *params), (program, location, params))
+GLAD_LAZY_VOID(glGetUniformfv, PFNGLGETUNIFORMFVPROC, (GLuint program, GLint location, GLfloat *params), (program, location, params))
+GLAD_LAZY_VOID(glGetUniformiv, PFNGLGETUNIFORMIVPROC, (GLuint program, GLint location, GLint *params), (program, location, params))
+GLAD_LAZY_VOID(glGetUniformuiv, PFNGLGETUNIFORMUIVPROC, (GLuint program, GLint location, GLuint *params), (program, location, params))
+GLAD_LAZY_VOID(glGetVertexArrayIndexed64iv, PFNGLGETVERTEXARRAYINDEXED64IVPROC, (GLuint vaobj, GLuint index, GLenum pname, GLint64 *param), (vaobj, index, pname, param))
+GLAD_LAZY_VOID(glGetVertexArrayIndexediv, PFNGLGETVERTEXARRAYINDEXEDIVPROC, (GLuint vaobj, GLuint index, GLenum pname, GLint *param), (vaobj, index, pname, param))
+GLAD_LAZY_VOID(glGetVertexArrayiv, PFNGLGETVERTEXARRAYIVPROC, (GLuint vaobj, GLenum pname, GLint *param), (vaobj, pname, param))
+GLAD_LAZY_VOID(glGetVertexAttribIiv, PFNGLGETVERTEXATTRIBIIVPROC, (GLuint index, GLenum pname, GLint *params), (index, pname, params))
+GLAD_LAZY_VOID(glGetVertexAttribIuiv, PFNGLGETVERTEXATTRIBIUIVPROC, (GLuint index, GLenum pname, GLuint *params), (index, pname, params))
+GLAD_LAZY_VOID(glGetVertexAttribLdv, PFNGLGETVERTEXATTRIBLDVPROC, (GLuint index, GLenum pname, GLdouble *params), (index, pname, params))
+GLAD_LAZY_VOID(glGetVertexAttribPointerv, PFNGLGETVERTEXATTRIBPOINTERVPROC, (GLuint index, GLenum pname, void **pointer), (index, pname, pointer))
+GLAD_LAZY_VOID(glGetVertexAttribdv, PFNGLGETVERTEXATTRIBDVPROC, (GLuint index, GLenum pname, GLdouble *params), (index, pname, params))
+GLAD_LAZY_VOID(glGetVertexAttribfv, PFNGLGETVERTEXATTRIBFVPROC, (GLuint index, GLenum pname, GLfloat *params), (index, pname, params))
+GLAD_LAZY_VOID(glGetVertexAttribiv, PFNGLGETVERTEXATTRIBIVPROC, (GLuint index, GLenum pname, GLint *params), (index, pname, params))
+GLAD_LAZY_VOID(glGetnColorTable, PFNGLGETNCOLORTABLEPROC, (GLenum target, GLenum format, GLenum type, GLsizei bufSize, void *table), (target, format, type, bufSize, table))
+GLAD_LAZY_VOID(glGetnCompressedTexImage, PFNGLGETNCOMPRESSEDTEXIMAGEPROC, (GLenum target, GLint lod, GLsizei bufSize, void *pixels), (target, lod, bufSize, pixels))
+GLAD_LAZY_VOID(glGetnConvolutionFilter, PFNGLGETNCONVOLUTIONFILTERPROC, (GLenum target, GLenum format, GLenum type, GLsizei bufSize, void *image), (target, format, type, bufSize, image))
+GLAD_LAZY_VOID(glGetnHistogram, PFNGLGETNHISTOGRAMPROC, (GLenum target, GLboolean reset, GLenum format, GLenum type, GLsizei bufSize, void *values), (target, reset, format, type, bufSize, values))
+GLAD_LAZY_VOID(glGetnMapdv, PFNGLGETNMAPDVPROC, (GLenum target, GLenum query, GLsizei bufSize, GLdouble *v), (target, query, bufSize, v))
+GLAD_LAZY_VOID(glGetnMapfv, PFNGLGETNMAPFVPROC, (GLenum target, GLenum query, GLsizei bufSize, GLfloat *v), (target, query, bufSize, v))
+GLAD_LAZY_VOID(glGetnMapiv, PFNGLGETNMAPIVPROC, (GLenum target, GLenum query, GLsizei bufSize, GLint *v), (target, query, bufSize, v))
+GLAD_LAZY_VOID(glGetnMinmax, PFNGLGETNMINMAXPROC, (GLenum target, GLboolean reset, GLenum format, GLenum type, GLsizei bufSize, void *values), (target, reset, format, type, bufSize, values))
+GLAD_LAZY_VOID(glGetnPixelMapfv, PFNGLGETNPIXELMAPFVPROC, (GLenum map, GLsizei bufSize, GLfloat *values), (map, bufSize, values))
+GLAD_LAZY_VOID(glGetnPixelMapuiv, PFNGLGETNPIXELMAPUIVPROC, (GLenum map, GLsizei bufSize, GLuint *values), (map, bufSize, values))
+GLAD_LAZY_VOID(glGetnPixelMapusv, PFNGLGETNPIXELMAPUSVPROC, (GLenum map, GLsizei bufSize, GLushort *values), (map, bufSize, values))
+GLAD_LAZY_VOID(glGetnPolygonStipple, PFNGLGETNPOLYGONSTIPPLEPROC, (GLsizei bufSize, GLubyte *pattern), (bufSize, pattern))
+GLAD_LAZY_VOID(glGetnSeparableFilter, PFNGLGETNSEPARABLEFILTERPROC, (GLenum target, GLenum format, GLenum type, GLsizei rowBufSize, void *row, GLsizei columnBufSize, void *column, void *span), (target, format, type, rowBufSize, row, columnBufSize, column, span))
+GLAD_LAZY_VOID(glGetnTexImage, PFNGLGETNTEXIMAGEPROC, (GLenum target, GLint level, GLenum format, GLenum type, GLsizei bufSize, void *pixels), (target, level, format, type, bufSize, pixels))
+GLAD_LAZY_VOID(glGetnUniformdv, PFNGLGETNUNIFORMDVPROC, (GLuint program, GLint location, GLsizei bufSize, GLdouble *params), (program, location, bufSize, params))
+GLAD_LAZY_VOID(glGetnUniformfv, PFNGLGETNUNIFORMFVPROC, (GLuint program, GLint location, GLsizei bufSize, GLfloat *params), (program, location, bufSize, params))
+GLAD_LAZY_VOID(glGetnUniformiv, PFNGLGETNUNIFORMIVPROC, (GLuint program, GLint location, GLsizei bufSize, GLint *params), (program, location, bufSize, params))
+GLAD_LAZY_VOID(glGetnUniformuiv, PFNGLGETNUNIFORMUIVPROC, (GLuint program, GLint location, GLsizei bufSize, GLuint *params), (program, location, bufSize, params))
+GLAD_LAZY_VOID(glHint, PFNGLHINTPROC, (GLenum target, GLenum mode), (target, mode))
+GLAD_LAZY_VOID(glIndexMask, PFNGLINDEXMASKPROC, (GLuint mask), (mask))
+GLAD_LAZY_VOID(glIndexPointer, PFNGLINDEXPOINTERPROC, (GLenum type, GLsizei stride, const void *pointer), (type, stride, pointer))
+GLAD_LAZY_VOID(glIndexd, PFNGLINDEXDPROC, (GLdouble c), (c))
+GLAD_LAZY_VOID(glIndexdv, PFNGLINDEXDVPROC, (const GLdouble *c), (c))
+GLAD_LAZY_VOID(glIndexf, PFNGLINDEXFPROC, (GLfloat c), (c))
+GLAD_LAZY_VOID(glIndexfv, PFNGLINDEXFVPROC, (const GLfloat *c), (c))
+GLAD_LAZY_VOID(glIndexi, PFNGLINDEXIPROC, (GLint c), (c))
+GLAD_LAZY_VOID(glIndexiv, PFNGLINDEXIVPROC, (const GLint *c), (c))
+GLAD_LAZY_VOID(glIndexs, PFNGLINDEXSPROC, (GLshort c), (c))
+GLAD_LAZY_VOID(glIndexsv, PFNGLINDEXSVPROC, (const GLshort *c), (c))
+GLAD_LAZY_VOID(glIndexub, PFNGLINDEXUBPROC, (GLubyte c), (c))
+GLAD_LAZY_VOID(glIndexubv, PFNGLINDEXUBVPROC, (const GLubyte *c), (c))
+GLAD_LAZY_VOID(glInitNames, PFNGLINITNAMESPROC, (void), ())
+GLAD_LAZY_VOID(glInterleavedArrays, PFNGLINTERLEAVEDARRAYSPROC, (GLenum format, GLsizei stride, const void *pointer), (format, stride, pointer))
+GLAD_LAZY_VOID(glInvalidateBufferData, PFNGLINVALIDATEBUFFERDATAPROC, (GLuint buffer), (buffer))
+GLAD_LAZY_VOID(glInvalidateBufferSubData, PFNGLINVALIDATEBUFFERSUBDATAPROC, (GLuint buffer, GLintptr offset, GLsizeiptr length), (buffer, offset, length))
+GLAD_LAZY_VOID(glInvalidateFramebuffer, PFNGLINVALIDATEFRAMEBUFFERPROC, (GLenum target, GLsizei numAttachments, const GLenum *attachments), (target, numAttachments, attachments))
+GLAD_LAZY_VOID(glInvalidateNamedFramebufferData, PFNGLINVALIDATENAMEDFRAMEBUFFERDATAPROC, (GLuint framebuffer, GLsizei numAttachments, const GLenum *attachments), (framebuffer, numAttachments, attachments))
+GLAD_LAZY_VOID(glInvalidateNamedFramebufferSubData, PFNGLINVALIDATENAMEDFRAMEBUFFERSUBDATAPROC, (GLuint framebuffer, GLsizei numAttachments, const GLenum *attachments, GLint x, GLint y, GLsizei width, GLsizei height), (framebuffer, numAttachments, attachments, x, y, width, height))
+GLAD_LAZY_VOID(glInvalidateSubFramebuffer, PFNGLINVALIDATESUBFRAMEBUFFERPROC, (GLenum target, GLsizei numAttachments, const GLenum *attachments, GLint x, GLint y, GLsizei width, GLsizei height), (target, numAttachments, attachments, x, y, width, height))
+GLAD_LAZY_VOID(glInvalidateTexImage, PFNGLINVALIDATETEXIMAGEPROC, (GLuint texture, GLint level), (texture, level))
+GLAD_LAZY_VOID(glInvalidateTexSubImage, PFNGLINVALIDATETEXSUBIMAGEPROC, (GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth), (texture, level, xoffset, yoffset, zoffset, width, height, depth))
+GLAD_LAZY_RET(GLboolean, glIsBuffer, PFNGLISBUFFERPROC, (GLuint buffer), (buffer))
+GLAD_LAZY_RET(GLboolean, glIsEnabled, PFNGLISENABLEDPROC, (GLenum cap), (cap))
+GLAD_LAZY_RET(GLboolean, glIsEnabledi, PFNGLISENABLEDIPROC, (GLenum target, GLuint index), (target, index))
+GLAD_LAZY_RET(GLboolean, glIsFramebuffer, PFNGLISFRAMEBUFFERPROC, (GLuint framebuffer), (framebuffer))
+GLAD_LAZY_RET(GLboolean, glIsList, PFNGLISLISTPROC, (GLuint list), (list))
+GLAD_LAZY_RET(GLboolean, glIsProgram, PFNGLISPROGRAMPROC, (GLuint program), (program))
+GLAD_LAZY_RET(GLboolean, glIsProgramPipeline, PFNGLISPROGRAMPIPELINEPROC, (GLuint pipeline), (pipeline))
+GLAD_LAZY_RET(GLboolean, glIsQuery, PFNGLISQUERYPROC, (GLuint id), (id))
+GLAD_LAZY_RET(GLboolean, glIsRenderbuffer, PFNGLISRENDERBUFFERPROC, (GLuint renderbuffer), (renderbuffer))
+GLAD_LAZY_RET(GLboolean, glIsSampler, PFNGLISSAMPLERPROC, (GLuint sampler), (sampler))
+GLAD_LAZY_RET(GLboolean, glIsShader, PFNGLISSHADERPROC, (GLuint shader), (shader))
+GLAD_LAZY_RET(GLboolean, glIsSync, PFNGLISSYNCPROC, (GLsync sync), (sync))
+GLAD_LAZY_RET(GLboolean, glIsTexture, PFNGLISTEXTUREPROC, (GLuint texture), (texture))
+GLAD_LAZY_RET(GLboolean, glIsTransformFeedback, PFNGLISTRANSFORMFEEDBACKPROC, (GLuint id), (id))
+GLAD_LAZY_RET(GLboolean, glIsVertexArray, PFNGLISVERTEXARRAYPROC, (GLuint array), (array))
+GLAD_LAZY_VOID(glLightModelf, PFNGLLIGHTMODELFPROC, (GLenum pname, GLfloat param), (pname, param))
+GLAD_LAZY_VOID(glLightModelfv, PFNGLLIGHTMODELFVPROC, (GLenum pname, const GLfloat *params), (pname, params))
+GLAD_LAZY_VOID(glLightModeli, PFNGLLIGHTMODELIPROC, (GLenum pname, GLint param), (pname, param))
+GLAD_LAZY_VOID(glLightModeliv, PFNGLLIGHTMODELIVPROC, (GLenum pname, const GLint *params), (pname, params))
+GLAD_LAZY_VOID(glLightf, PFNGLLIGHTFPROC, (GLenum light, GLenum pname, GLfloat param), (light, pname, param))
+GLAD_LAZY_VOID(glLightfv, PFNGLLIGHTFVPROC, (GLenum light, GLenum pname, const GLfloat *params), (light, pname, params))
+GLAD_LAZY_VOID(glLighti, PFNGLLIGHTIPROC, (GLenum light, GLenum pname, GLint param), (light, pname, param))
+GLAD_LAZY_VOID(glLightiv, PFNGLLIGHTIVPROC, (GLenum light, GLenum pname, const GLint *params), (light, pname, params))
+GLAD_LAZY_VOID(glLineStipple, PFNGLLINESTIPPLEPROC, (GLint factor, GLushort pattern), (factor, pattern))
+GLAD_LAZY_VOID(glLineWidth, PFNGLLINEWIDTHPROC, (GLfloat width), (width))
+GLAD_LAZY_VOID(glLinkProgram, PFNGLLINKPROGRAMPROC, (GLuint program), (program))
+GLAD_LAZY_VOID(glListBase, PFNGLLISTBASEPROC, (GLuint base), (base))
+GLAD_LAZY_VOID(glLoadIdentity, PFNGLLOADIDENTITYPROC, (void), ())
+GLAD_LAZY_VOID(glLoadMatrixd, PFNGLLOADMATRIXDPROC, (const GLdouble *m), (m))
+GLAD_LAZY_VOID(glLoadMatrixf, PFNGLLOADMATRIXFPROC, (const GLfloat *m), (m))
+GLAD_LAZY_VOID(glLoadName, PFNGLLOADNAMEPROC, (GLuint name), (name))
+GLAD_LAZY_VOID(glLoadTransposeMatrixd, PFNGLLOADTRANSPOSEMATRIXDPROC, (const GLdouble *m), (m))
+GLAD_LAZY_VOID(glLoadTransposeMatrixf, PFNGLLOADTRANSPOSEMATRIXFPROC, (const GLfloat *m), (m))
+GLAD_LAZY_VOID(glLogicOp, PFNGLLOGICOPPROC, (GLenum opcode), (opcode))
+GLAD_LAZY_VOID(glMap1d, PFNGLMAP1DPROC, (GLenum target, GLdouble u1, GLdouble u2, GLint stride, GLint order, const GLdouble *points), (target, u1, u2, stride, order, points))
+GLAD_LAZY_VOID(glMap1f, PFNGLMAP1FPROC, (GLenum target, GLfloat u1, GLfloat u2, GLint stride, GLint order, const GLfloat *points), (target, u1, u2, stride, order, points))
+GLAD_LAZY_VOID(glMap2d, PFNGLMAP2DPROC, (GLenum target, GLdouble u1, GLdouble u2, GLint ustride, GLint uorder, GLdouble v1, GLdouble v2, GLint vstride, GLint vorder, const GLdouble *points), (target, u1, u2, ustride, uorder, v1, v2, vstride, vorder, points))
+GLAD_LAZY_VOID(glMap2f, PFNGLMAP2FPROC, (GLenum target, GLfloat u1, GLfloat u2, GLint ustride, GLint uorder, GLfloat v1, GLfloat v2, GLint vstride, GLint vorder, const GLfloat *points), (target, u1, u2, ustride, uorder, v1, v2, vstride, vorder, points))
+GLAD_LAZY_RET(void *, glMapBuffer, PFNGLMAPBUFFERPROC, (GLenum target, GLenum access), (target, access))
+GLAD_LAZY_RET(void *, glMapBufferRange, PFNGLMAPBUFFERRANGEPROC, (GLenum target, GLintptr offset, GLsizeiptr length, GLbitfield access), (target, offset, length, access))
+GLAD_LAZY_VOID(glMapGrid1d, PFNGLMAPGRID1DPROC, (GLint un, GLdouble u1, GLdouble u2), (un, u1, u2))
+GLAD_LAZY_VOID(glMapGrid1f, PFNGLMAPGRID1FPROC, (GLint un, GLfloat u1, GLfloat u2), (un, u1, u2))
+GLAD_LAZY_VOID(glMapGrid2d, PFNGLMAPGRID2DPROC, (GLint un, GLdouble u1, GLdouble u2, GLint vn, GLdouble v1, GLdouble v2), (un, u1, u2, vn, v1, v2))
+GLAD_LAZY_VOID(glMapGrid2f, PFNGLMAPGRID2FPROC, (GLint un, GLfloat u1, GLfloat u2, GLint vn, GLfloat v1, GLfloat v2), (un, u1, u2, vn, v1, v2))
+GLAD_LAZY_RET(void *, glMapNamedBuffer, PFNGLMAPNAMEDBUFFERPROC, (GLuint buffer, GLenum access), (buffer, access))
+GLAD_LAZY_RET(void *, glMapNamedBufferRange, PFNGLMAPNAMEDBUFFERRANGEPROC, (GLuint buffer, GLintptr offset, GLsizeiptr length, GLbitfield access), (buffer, offset, length, access))
+GLAD_LAZY_VOID(glMaterialf, PFNGLMATERIALFPROC, (GLenum face, GLenum pname, GLfloat param), (face, pname, param))
+GLAD_LAZY_VOID(glMaterialfv, PFNGLMATERIALFVPROC, (GLenum face, GLenum pname, const GLfloat *params), (face, pname, params))
+GLAD_LAZY_VOID(glMateriali, PFNGLMATERIALIPROC, (GLenum face, GLenum pname, GLint param), (face, pname, param))
+GLAD_LAZY_VOID(glMaterialiv, PFNGLMATERIALIVPROC, (GLenum face, GLenum pname, const GLint *params), (face, pname, params))
+GLAD_LAZY_VOID(glMatrixMode, PFNGLMATRIXMODEPROC, (GLenum mode), (mode))
+GLAD_LAZY_VOID(glMemoryBarrier, PFNGLMEMORYBARRIERPROC, (GLbitfield barriers), (barriers))
+GLAD_LAZY_VOID(glMemoryBarrierByRegion, PFNGLMEMORYBARRIERBYREGIONPROC, (GLbitfield barriers), (barriers))
+GLAD_LAZY_VOID(glMinSampleShading, PFNGLMINSAMPLESHADINGPROC, (GLfloat value), (value))
+GLAD_LAZY_VOID(glMultMatrixd, PFNGLMULTMATRIXDPROC, (const GLdouble *m), (m))
+GLAD_LAZY_VOID(glMultMatrixf, PFNGLMULTMATRIXFPROC, (const GLfloat *m), (m))
+GLAD_LAZY_VOID(glMultTransposeMatrixd, PFNGLMULTTRANSPOSEMATRIXDPROC, (const GLdouble *m), (m))
+GLAD_LAZY_VOID(glMultTransposeMatrixf, PFNGLMULTTRANSPOSEMATRIXFPROC, (const GLfloat *m), (m))
+GLAD_LAZY_VOID(glMultiDrawArrays, PFNGLMULTIDRAWARRAYSPROC, (GLenum mode, const GLint *first, const GLsizei *count, GLsizei drawcount), (mode, first, count, drawcount))
+GLAD_LAZY_VOID(glMultiDrawArraysIndirect, PFNGLMULTIDRAWARRAYSINDIRECTPROC, (GLenum mode, const void *indirect, GLsizei drawcount, GLsizei stride), (mode, indirect, drawcount, stride))
+GLAD_LAZY_VOID(glMultiDrawArraysIndirectCount, PFNGLMULTIDRAWARRAYSINDIRECTCOUNTPROC, (GLenum mode, const void *indirect, GLintptr drawcount, GLsizei maxdrawcount, GLsizei stride), (mode, indirect, drawcount, maxdrawcount, stride))
+GLAD_LAZY_VOID(glMultiDrawElements, PFNGLMULTIDRAWELEMENTSPROC, (GLenum mode, const GLsizei *count, GLenum type, const void *const*indices, GLsizei drawcount), (mode, count, type, indices, drawcount))
+GLAD_LAZY_VOID(glMultiDrawElementsBaseVertex, PFNGLMULTIDRAWELEMENTSBASEVERTEXPROC, (GLenum mode, const GLsizei *count, GLenum type, const void *const*indices, GLsizei drawcount, const GLint *basevertex), (mode, count, type, indices, drawcount, basevertex))
+GLAD_LAZY_VOID(glMultiDrawElementsIndirect, PFNGLMULTIDRAWELEMENTSINDIRECTPROC, (GLenum mode, GLenum type, const void *indirect, GLsizei drawcount, GLsizei stride), (mode, type, indirect, drawcount, stride))
+GLAD_LAZY_VOID(glMultiDrawElementsIndirectCount, PFNGLMULTIDRAWELEMENTSINDIRECTCOUNTPROC, (GLenum mode, GLenum type, const void *indirect, GLintptr drawcount, GLsizei maxdrawcount, GLsizei stride), (mode, type, indirect, drawcount, maxdrawcount, stride))
+GLAD_LAZY_VOID(glMultiTexCoord1d, PFNGLMULTITEXCOORD1DPROC, (GLenum target, GLdouble s), (target, s))
+GLAD_LAZY_VOID(glMultiTexCoord1dv, PFNGLMULTITEXCOORD1DVPROC, (GLenum target, const GLdouble *v), (target, v))
+GLAD_LAZY_VOID(glMultiTexCoord1f, PFNGLMULTITEXCOORD1FPROC, (GLenum target, GLfloat s), (target, s))
+GLAD_LAZY_VOID(glMultiTexCoord1fv, PFNGLMULTITEXCOORD1FVPROC, (GLenum target, const GLfloat *v), (target, v))
+GLAD_LAZY_VOID(glMultiTexCoord1i, PFNGLMULTITEXCOORD1IPROC, (GLenum target, GLint s), (target, s))
+GLAD_LAZY_VOID(glMultiTexCoord1iv, PFNGLMULTITEXCOORD1IVPROC, (GLenum target, const GLint *v), (target, v))
+GLAD_LAZY_VOID(glMultiTexCoord1s, PFNGLMULTITEXCOORD1SPROC, (GLenum target, GLshort s), (target, s))
+GLAD_LAZY_VOID(glMultiTexCoord1sv, PFNGLMULTITEXCOORD1SVPROC, (GLenum target, const GLshort *v), (target, v))
+GLAD_LAZY_VOID(glMultiTexCoord2d, PFNGLMULTITEXCOORD2DPROC, (GLenum target, GLdouble s, GLdouble t), (target, s, t))
+GLAD_LAZY_VOID(glMultiTexCoord2dv, PFNGLMULTITEXCOORD2DVPROC, (GLenum target, const GLdouble *v), (target, v))
+GLAD_LAZY_VOID(glMultiTexCoord2f, PFNGLMULTITEXCOORD2FPROC, (GLenum target, GLfloat s, GLfloat t), (target, s, t))
+GLAD_LAZY_VOID(glMultiTexCoord2fv, PFNGLMULTITEXCOORD2FVPROC, (GLenum target, const GLfloat *v), (target, v))
+GLAD_LAZY_VOID(glMultiTexCoord2i, PFNGLMULTITEXCOORD2IPROC, (GLenum target, GLint s, GLint t), (target, s, t))
+GLAD_LAZY_VOID(glMultiTexCoord2iv, PFNGLMULTITEXCOORD2IVPROC, (GLenum target, const GLint *v), (target, v))
+GLAD_LAZY_VOID(glMultiTexCoord2s, PFNGLMULTITEXCOORD2SPROC, (GLenum target, GLshort s, GLshort t), (target, s, t))
+GLAD_LAZY_VOID(glMultiTexCoord2sv, PFNGLMULTITEXCOORD2SVPROC, (GLenum target, const GLshort *v), (target, v))
+GLAD_LAZY_VOID(glMultiTexCoord3d, PFNGLMULTITEXCOORD3DPROC, (GLenum target, GLdouble s, GLdouble t, GLdouble r), (target, s, t, r))
+GLAD_LAZY_VOID(glMultiTexCoord3dv, PFNGLMULTITEXCOORD3DVPROC, (GLenum target, const GLdouble *v), (target, v))
+GLAD_LAZY_VOID(glMultiTexCoord3f, PFNGLMULTITEXCOORD3FPROC, (GLenum target, GLfloat s, GLfloat t, GLfloat r), (target, s, t, r))
+GLAD_LAZY_VOID(glMultiTexCoord3fv, PFNGLMULTITEXCOORD3FVPROC, (GLenum target, const GLfloat *v), (target, v))
+GLAD_LAZY_VOID(glMultiTexCoord3i, PFNGLMULTITEXCOORD3IPROC, (GLenum target, GLint s, GLint t, GLint r), (target, s, t, r))
+GLAD_LAZY_VOID(glMultiTexCoord3iv, PFNGLMULTITEXCOORD3IVPROC, (GLenum target, const GLint *v), (target, v))
+GLAD_LAZY_VOID(glMultiTexCoord3s, PFNGLMULTITEXCOORD3SPROC, (GLenum target, GLshort s, GLshort t, GLshort r), (target, s, t, r))
+GLAD_LAZY_VOID(glMultiTexCoord3sv, PFNGLMULTITEXCOORD3SVPROC, (GLenum target, const GLshort *v), (target, v))
+GLAD_LAZY_VOID(glMultiTexCoord4d, PFNGLMULTITEXCOORD4DPROC, (GLenum target, GLdouble s, GLdouble t, GLdouble r, GLdouble q), (target, s, t, r, q))
+GLAD_LAZY_VOID(glMultiTexCoord4dv, PFNGLMULTITEXCOORD4DVPROC, (GLenum target, const GLdouble *v), (target, v))
+GLAD_LAZY_VOID(glMultiTexCoord4f, PFNGLMULTITEXCOORD4FPROC, (GLenum target, GLfloat s, GLfloat t, GLfloat r, GLfloat q), (target, s, t, r, q))
+GLAD_LAZY_VOID(glMultiTexCoord4fv, PFNGLMULTITEXCOORD4FVPROC, (GLenum target, const GLfloat *v), (target, v))
+GLAD_LAZY_VOID(glMultiTexCoord4i, PFNGLMULTITEXCOORD4IPROC, (GLenum target, GLint s, GLint t, GLint r, GLint q), (target, s, t, r, q))
+GLAD_LAZY_VOID(glMultiTexCoord4iv, PFNGLMULTITEXCOORD4IVPROC, (GLenum target, const GLint *v), (target, v))
+GLAD_LAZY_VOID(glMultiTexCoord4s, PFNGLMULTITEXCOORD4SPROC, (GLenum target, GLshort s, GLshort t, GLshort r, GLshort q), (target, s, t, r, q))
+GLAD_LAZY_VOID(glMultiTexCoord4sv, PFNGLMULTITEXCOORD4SVPROC, (GLenum target, const GLshort *v), (target, v))
+GLAD_LAZY_VOID(glMultiTexCoordP1ui, PFNGLMULTITEXCOORDP1UIPROC, (GLenum texture, GLenum type, GLuint coords), (texture, type, coords))
+GLAD_LAZY_VOID(glMultiTexCoordP1uiv, PFNGLMULTITEXCOORDP1UIVPROC, (GLenum texture, GLenum type, const GLuint *coords), (texture, type, coords))
+GLAD_LAZY_VOID(glMultiTexCoordP2ui, PFNGLMULTITEXCOORDP2UIPROC, (GLenum texture, GLenum type, GLuint coords), (texture, type, coords))
+GLAD_LAZY_VOID(glMultiTexCoordP2uiv, PFNGLMULTITEXCOORDP2UIVPROC, (GLenum texture, GLenum type, const GLuint *coords), (texture, type, coords))
+GLAD_LAZY_VOID(glMultiTexCoordP3ui, PFNGLMULTITEXCOORDP3UIPROC, (GLenum texture, GLenum type, GLuint coords), (texture, type, coords))
+GLAD_LAZY_VOID(glMultiTexCoordP3uiv, PFNGLMULTITEXCOORDP3UIVPROC, (GLenum texture, GLenum type, const GLuint *coords), (texture, type, coords))
+GLAD_LAZY_VOID(glMultiTexCoordP4ui, PFNGLMULTITEXCOORDP4UIPROC, (GLenum texture, GLenum type, GLuint coords), (texture, type, coords))
+GLAD_LAZY_VOID(glMultiTexCoordP4uiv, PFNGLMULTITEXCOORDP4UIVPROC, (GLenum texture, GLenum type, const GLuint *coords), (texture, type, coords))
+GLAD_LAZY_VOID(glNamedBufferData, PFNGLNAMEDBUFFERDATAPROC, (GLuint buffer, GLsizeiptr size, const void *data, GLenum usage), (buffer, size, data, usage))
+GLAD_LAZY_VOID(glNamedBufferStorage, PFNGLNAMEDBUFFERSTORAGEPROC, (GLuint buffer, GLsizeiptr size, const void *data, GLbitfield flags), (buffer, size, data, flags))
+GLAD_LAZY_VOID(glNamedBufferSubData, PFNGLNAMEDBUFFERSUBDATAPROC, (GLuint buffer, GLintptr offset, GLsizeiptr size, const void *data), (buffer, offset, size, data))
+GLAD_LAZY_VOID(glNamedFramebufferDrawBuffer, PFNGLNAMEDFRAMEBUFFERDRAWBUFFERPROC, (GLuint framebuffer, GLenum buf), (framebuffer, buf))
+GLAD_LAZY_VOID(glNamedFramebufferDrawBuffers, PFNGLNAMEDFRAMEBUFFERDRAWBUFFERSPROC, (GLuint framebuffer, GLsizei n, const GLenum *bufs), (framebuffer, n, bufs))
+GLAD_LAZY_VOID(glNamedFramebufferParameteri, PFNGLNAMEDFRAMEBUFFERPARAMETERIPROC, (GLuint framebuffer, GLenum pname, GLint param), (framebuffer, pname, param))
+GLAD_LAZY_VOID(glNamedFramebufferReadBuffer, PFNGLNAMEDFRAMEBUFFERREADBUFFERPROC, (GLuint framebuffer, GLenum src), (framebuffer, src))
+GLAD_LAZY_VOID(glNamedFramebufferRenderbuffer, PFNGLNAMEDFRAMEBUFFERRENDERBUFFERPROC, (GLuint framebuffer, GLenum attachment, GLenum renderbuffertarget, GLuint renderbuffer), (framebuffer, attachment, renderbuffertarget, renderbuffer))
+GLAD_LAZY_VOID(glNamedFramebufferTexture, PFNGLNAMEDFRAMEBUFFERTEXTUREPROC, (GLuint framebuffer, GLenum attachment, GLuint texture, GLint level), (framebuffer, attachment, texture, level))
+GLAD_LAZY_VOID(glNamedFramebufferTextureLayer, PFNGLNAMEDFRAMEBUFFERTEXTURELAYERPROC, (GLuint framebuffer, GLenum attachment, GLuint texture, GLint level, GLint layer), (framebuffer, attachment, texture, level, layer))
+GLAD_LAZY_VOID(glNamedRenderbufferStorage, PFNGLNAMEDRENDERBUFFERSTORAGEPROC, (GLuint renderbuffer, GLenum internalformat, GLsizei width, GLsizei height), (renderbuffer, internalformat, width, height))
+GLAD_LAZY_VOID(glNamedRenderbufferStorageMultisample, PFNGLNAMEDRENDERBUFFERSTORAGEMULTISAMPLEPROC, (GLuint renderbuffer, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height), (renderbuffer, samples, internalformat, width, height))
+GLAD_LAZY_VOID(glNewList, PFNGLNEWLISTPROC, (GLuint list, GLenum mode), (list, mode))
+GLAD_LAZY_VOID(glNormal3b, PFNGLNORMAL3BPROC, (GLbyte nx, GLbyte ny, GLbyte nz), (nx, ny, nz))
+GLAD_LAZY_VOID(glNormal3bv, PFNGLNORMAL3BVPROC, (const GLbyte *v), (v))
+GLAD_LAZY_VOID(glNormal3d, PFNGLNORMAL3DPROC, (GLdouble nx, GLdouble ny, GLdouble nz), (nx, ny, nz))
+GLAD_LAZY_VOID(glNormal3dv, PFNGLNORMAL3DVPROC, (const GLdouble *v), (v))
+GLAD_LAZY_VOID(glNormal3f, PFNGLNORMAL3FPROC, (GLfloat nx, GLfloat ny, GLfloat nz), (nx, ny, nz))
+GLAD_LAZY_VOID(glNormal3fv, PFNGLNORMAL3FVPROC, (const GLfloat *v), (v))
+GLAD_LAZY_VOID(glNormal3i, PFNGLNORMAL3IPROC, (GLint nx, GLint ny, GLint nz), (nx, ny, nz))
+GLAD_LAZY_VOID(glNormal3iv, PFNGLNORMAL3IVPROC, (const GLint *v), (v))
+GLAD_LAZY_VOID(glNormal3s, PFNGLNORMAL3SPROC, (GLshort nx, GLshort ny, GLshort nz), (nx, ny, nz))
+GLAD_LAZY_VOID(glNormal3sv, PFNGLNORMAL3SVPROC, (const GLshort *v), (v))
+GLAD_LAZY_VOID(glNormalP3ui, PFNGLNORMALP3UIPROC, (GLenum type, GLuint coords), (type, coords))
+GLAD_LAZY_VOID(glNormalP3uiv, PFNGLNORMALP3UIVPROC, (GLenum type, const GLuint *coords), (type, coords))
+GLAD_LAZY_VOID(glNormalPointer, PFNGLNORMALPOINTERPROC, (GLenum type, GLsizei stride, const void *pointer), (type, stride, pointer))
+GLAD_LAZY_VOID(glObjectLabel, PFNGLOBJECTLABELPROC, (GLenum identifier, GLuint name, GLsizei length, const GLchar *label), (identifier, name, length, label))
+GLAD_LAZY_VOID(glObjectPtrLabel, PFNGLOBJECTPTRLABELPROC, (const void *ptr, GLsizei length, const GLchar *label), (ptr, length, label))
+GLAD_LAZY_VOID(glOrtho, PFNGLORTHOPROC, (GLdouble left, GLdouble right, GLdouble bottom, GLdouble top, GLdouble zNear, GLdouble zFar), (left, right, bottom, top, zNear, zFar))
+GLAD_LAZY_VOID(glPassThrough, PFNGLPASSTHROUGHPROC, (GLfloat token), (token))
+GLAD_LAZY_VOID(glPatchParameterfv, PFNGLPATCHPARAMETERFVPROC, (GLenum pname, const GLfloat *values), (pname, values))
+GLAD_LAZY_VOID(glPatchParameteri, PFNGLPATCHPARAMETERIPROC, (GLenum pname, GLint value), (pname, value))
+GLAD_LAZY_VOID(glPauseTransformFeedback, PFNGLPAUSETRANSFORMFEEDBACKPROC, (void), ())
+GLAD_LAZY_VOID(glPixelMapfv, PFNGLPIXELMAPFVPROC, (GLenum map, GLsizei mapsize, const GLfloat *values), (map, mapsize, values))
+GLAD_LAZY_VOID(glPixelMapuiv, PFNGLPIXELMAPUIVPROC, (GLenum map, GLsizei mapsize, const GLuint *values), (map, mapsize, values))
+GLAD_LAZY_VOID(glPixelMapusv, PFNGLPIXELMAPUSVPROC, (GLenum map, GLsizei mapsize, const GLushort *values), (map, mapsize, values))
+GLAD_LAZY_VOID(glPixelStoref, PFNGLPIXELSTOREFPROC, (GLenum pname, GLfloat param), (pname, param))
+GLAD_LAZY_VOID(glPixelStorei, PFNGLPIXELSTOREIPROC, (GLenum pname, GLint param), (pname, param))
+GLAD_LAZY_VOID(glPixelTransferf, PFNGLPIXELTRANSFERFPROC, (GLenum pname, GLfloat param), (pname, param))
+GLAD_LAZY_VOID(glPixelTransferi, PFNGLPIXELTRANSFERIPROC, (GLenum pname, GLint param), (pname, param))
+GLAD_LAZY_VOID(glPixelZoom, PFNGLPIXELZOOMPROC, (GLfloat xfactor, GLfloat yfactor), (xfactor, yfactor))
+GLAD_LAZY_VOID(glPointParameterf, PFNGLPOINTPARAMETERFPROC, (GLenum pname, GLfloat param), (pname, param))
+GLAD_LAZY_VOID(glPointParameterfv, PFNGLPOINTPARAMETERFVPROC, (GLenum pname, const GLfloat *params), (pname, params))
+GLAD_LAZY_VOID(glPointParameteri, PFNGLPOINTPARAMETERIPROC, (GLenum pname, GLint param), (pname, param))
+GLAD_LAZY_VOID(glPointParameteriv, PFNGLPOINTPARAMETERIVPROC, (GLenum pname, const GLint *params), (pname, params))
+GLAD_LAZY_VOID(glPointSize, PFNGLPOINTSIZEPROC, (GLfloat size), (size))
+GLAD_LAZY_VOID(glPolygonMode, PFNGLPOLYGONMODEPROC, (GLenum face, GLenum mode), (face, mode))
+GLAD_LAZY_VOID(glPolygonOffset, PFNGLPOLYGONOFFSETPROC, (GLfloat factor, GLfloat units), (factor, units))
+GLAD_LAZY_VOID(glPolygonOffsetClamp, PFNGLPOLYGONOFFSETCLAMPPROC, (GLfloat factor, GLfloat units, GLfloat clamp), (factor, units, clamp))
+GLAD_LAZY_VOID(glPolygonStipple, PFNGLPOLYGONSTIPPLEPROC, (const GLubyte *mask), (mask))
+GLAD_LAZY_VOID(glPopAttrib, PFNGLPOPATTRIBPROC, (void), ())
+GLAD_LAZY_VOID(glPopClientAttrib, PFNGLPOPCLIENTATTRIBPROC, (void), ())
+GLAD_LAZY_VOID(glPopDebugGroup, PFNGLPOPDEBUGGROUPPROC, (void), ())
+GLAD_LAZY_VOID(glPopMatrix, PFNGLPOPMATRIXPROC, (void), ())
+GLAD_LAZY_VOID(glPopName, PFNGLPOPNAMEPROC, (void), ())
+GLAD_LAZY_VOID(glPrimitiveRestartIndex, PFNGLPRIMITIVERESTARTINDEXPROC, (GLuint index), (index))
+GLAD_LAZY_VOID(glPrioritizeTextures, PFNGLPRIORITIZETEXTURESPROC, (GLsizei n, const GLuint *textures, const GLfloat *priorities), (n, textures, priorities))
+GLAD_LAZY_VOID(glProgramBinary, PFNGLPROGRAMBINARYPROC, (GLuint program, GLenum binaryFormat, const void *binary, GLsizei length), (program, binaryFormat, binary, length))
+GLAD_LAZY_VOID(glProgramParameteri, PFNGLPROGRAMPARAMETERIPROC, (GLuint program, GLenum pname, GLint value), (program, pname, value))
+GLAD_LAZY_VOID(glProgramUniform1d, PFNGLPROGRAMUNIFORM1DPROC, (GLuint program, GLint location, GLdouble v0), (program, location, v0))
+GLAD_LAZY_VOID(glProgramUniform1dv, PFNGLPROGRAMUNIFORM1DVPROC, (GLuint program, GLint location, GLsizei count, const GLdouble *value), (program, location, count, value))
+GLAD_LAZY_VOID(glProgramUniform1f, PFNGLPROGRAMUNIFORM1FPROC, (GLuint program, GLint location, GLfloat v0), (program, location, v0))
+GLAD_LAZY_VOID(glProgramUniform1fv, PFNGLPROGRAMUNIFORM1FVPROC, (GLuint program, GLint location, GLsizei count, const GLfloat *value), (program, location, count, value))
+GLAD_LAZY_VOID(glProgramUniform1i, PFNGLPROGRAMUNIFORM1IPROC, (GLuint program, GLint location, GLint v0), (program, location, v0))
+GLAD_LAZY_VOID(glProgramUniform1iv, PFNGLPROGRAMUNIFORM1IVPROC, (GLuint program, GLint location, GLsizei count, const GLint *value), (program, location, count, value))
+GLAD_LAZY_VOID(glProgramUniform1ui, PFNGLPROGRAMUNIFORM1UIPROC, (GLuint program, GLint location, GLuint v0), (program, location, v0))
+GLAD_LAZY_VOID(glProgramUniform1uiv, PFNGLPROGRAMUNIFORM1UIVPROC, (GLuint program, GLint location, GLsizei count, const GLuint *value), (program, location, count, value))
+GLAD_LAZY_VOID(glProgramUniform2d, PFNGLPROGRAMUNIFORM2DPROC, (GLuint program, GLint location, GLdouble v0, GLdouble v1), (program, location, v0, v1))
+GLAD_LAZY_VOID(glProgramUniform2dv, PFNGLPROGRAMUNIFORM2DVPROC, (GLuint program, GLint location, GLsizei count, const GLdouble *value), (program, location, count, value))
+GLAD_LAZY_VOID(glProgramUniform2f, PFNGLPROGRAMUNIFORM2FPROC, (GLuint program, GLint location, GLfloat v0, GLfloat v1), (program, location, v0, v1))
+GLAD_LAZY_VOID(glProgramUniform2fv, PFNGLPROGRAMUNIFORM2FVPROC, (GLuint program, GLint location, GLsizei count, const GLfloat *value), (program, location, count, value))
+GLAD_LAZY_VOID(glProgramUniform2i, PFNGLPROGRAMUNIFORM2IPROC, (GLuint program, GLint location, GLint v0, GLint v1), (program, location, v0, v1))
+GLAD_LAZY_VOID(glProgramUniform2iv, PFNGLPROGRAMUNIFORM2IVPROC, (GLuint program, GLint location, GLsizei count, const GLint *value), (program, location, count, value))
+GLAD_LAZY_VOID(glProgramUniform2ui, PFNGLPROGRAMUNIFORM2UIPROC, (GLuint program, GLint location, GLuint v0, GLuint v1), (program, location, v0, v1))
+GLAD_LAZY_VOID(glProgramUniform2uiv, PFNGLPROGRAMUNIFORM2UIVPROC, (GLuint program, GLint location, GLsizei count, const GLuint *value), (program, location, count, value))
+GLAD_LAZY_VOID(glProgramUniform3d, PFNGLPROGRAMUNIFORM3DPROC, (GLuint program, GLint location, GLdouble v0, GLdouble v1, GLdouble v2), (program, location, v0, v1, v2))
+GLAD_LAZY_VOID(glProgramUniform3dv, PFNGLPROGRAMUNIFORM3DVPROC, (GLuint program, GLint location, GLsizei count, const GLdouble *value), (program, location, count, value))
+GLAD_LAZY_VOID(glProgramUniform3f, PFNGLPROGRAMUNIFORM3FPROC, (GLuint program, GLint location, GLfloat v0, GLfloat v1, GLfloat v2), (program, location, v0, v1, v2))
+GLAD_LAZY_VOID(glProgramUniform3fv, PFNGLPROGRAMUNIFORM3FVPROC, (GLuint program, GLint location, GLsizei count, const GLfloat *value), (program, location, count, value))
+GLAD_LAZY_VOID(glProgramUniform3i, PFNGLPROGRAMUNIFORM3IPROC, (GLuint program, GLint location, GLint v0, GLint v1, GLint v2), (program, location, v0, v1, v2))
+GLAD_LAZY_VOID(glProgramUniform3iv, PFNGLPROGRAMUNIFORM3IVPROC, (GLuint program, GLint location, GLsizei count, const GLint *value), (program, location, count, value))
+GLAD_LAZY_VOID(glProgramUniform3ui, PFNGLPROGRAMUNIFORM3UIPROC, (GLuint program, GLint location, GLuint v0, GLuint v1, GLuint v2), (program, location, v0, v1, v2))
+GLAD_LAZY_VOID(glProgramUniform3uiv, PFNGLPROGRAMUNIFORM3UIVPROC, (GLuint program, GLint location, GLsizei count, const GLuint *value), (program, location, count, value))
+GLAD_LAZY_VOID(glProgramUniform4d, PFNGLPROGRAMUNIFORM4DPROC, (GLuint program, GLint location, GLdouble v0, GLdouble v1, GLdouble v2, GLdouble v3), (program, location, v0, v1, v2, v3))
+GLAD_LAZY_VOID(glProgramUniform4dv, PFNGLPROGRAMUNIFORM4DVPROC, (GLuint program, GLint location, GLsizei count, const GLdouble *value), (program, location, count, value))
+GLAD_LAZY_VOID(glProgramUniform4f, PFNGLPROGRAMUNIFORM4FPROC, (GLuint program, GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3), (program, location, v0, v1, v2, v3))
+GLAD_LAZY_VOID(glProgramUniform4fv, PFNGLPROGRAMUNIFORM4FVPROC, (GLuint program, GLint location, GLsizei count, const GLfloat *value), (program, location, count, value))
+GLAD_LAZY_VOID(glProgramUniform4i, PFNGLPROGRAMUNIFORM4IPROC, (GLuint program, GLint location, GLint v0, GLint v1, GLint v2, GLint v3), (program, location, v0, v1, v2, v3))
+GLAD_LAZY_VOID(glProgramUniform4iv, PFNGLPROGRAMUNIFORM4IVPROC, (GLuint program, GLint location, GLsizei count, const GLint *value), (program, location, count, value))
+GLAD_LAZY_VOID(glProgramUniform4ui, PFNGLPROGRAMUNIFORM4UIPROC, (GLuint program, GLint location, GLuint v0, GLuint v1, GLuint v2, GLuint v3), (program, location, v0, v1, v2, v3))
+GLAD_LAZY_VOID(glProgramUniform4uiv, PFNGLPROGRAMUNIFORM4UIVPROC, (GLuint program, GLint location, GLsizei count, const GLuint *value), (program, location, count, value))
+GLAD_LAZY_VOID(glProgramUniformMatrix2dv, PFNGLPROGRAMUNIFORMMATRIX2DVPROC, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value), (program, location, count, transpose, value))
+GLAD_LAZY_VOID(glProgramUniformMatrix2fv, PFNGLPROGRAMUNIFORMMATRIX2FVPROC, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (program, location, count, transpose, value))
+GLAD_LAZY_VOID(glProgramUniformMatrix2x3dv, PFNGLPROGRAMUNIFORMMATRIX2X3DVPROC, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value), (program, location, count, transpose, value))
+GLAD_LAZY_VOID(glProgramUniformMatrix2x3fv, PFNGLPROGRAMUNIFORMMATRIX2X3FVPROC, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (program, location, count, transpose, value))
+GLAD_LAZY_VOID(glProgramUniformMatrix2x4dv, PFNGLPROGRAMUNIFORMMATRIX2X4DVPROC, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value), (program, location, count, transpose, value))
+GLAD_LAZY_VOID(glProgramUniformMatrix2x4fv, PFNGLPROGRAMUNIFORMMATRIX2X4FVPROC, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (program, location, count, transpose, value))
+GLAD_LAZY_VOID(glProgramUniformMatrix3dv, PFNGLPROGRAMUNIFORMMATRIX3DVPROC, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value), (program, location, count, transpose, value))
+GLAD_LAZY_VOID(glProgramUniformMatrix3fv, PFNGLPROGRAMUNIFORMMATRIX3FVPROC, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (program, location, count, transpose, value))
+GLAD_LAZY_VOID(glProgramUniformMatrix3x2dv, PFNGLPROGRAMUNIFORMMATRIX3X2DVPROC, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value), (program, location, count, transpose, value))
+GLAD_LAZY_VOID(glProgramUniformMatrix3x2fv, PFNGLPROGRAMUNIFORMMATRIX3X2FVPROC, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (program, location, count, transpose, value))
+GLAD_LAZY_VOID(glProgramUniformMatrix3x4dv, PFNGLPROGRAMUNIFORMMATRIX3X4DVPROC, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value), (program, location, count, transpose, value))
+GLAD_LAZY_VOID(glProgramUniformMatrix3x4fv, PFNGLPROGRAMUNIFORMMATRIX3X4FVPROC, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (program, location, count, transpose, value))
+GLAD_LAZY_VOID(glProgramUniformMatrix4dv, PFNGLPROGRAMUNIFORMMATRIX4DVPROC, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value), (program, location, count, transpose, value))
+GLAD_LAZY_VOID(glProgramUniformMatrix4fv, PFNGLPROGRAMUNIFORMMATRIX4FVPROC, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (program, location, count, transpose, value))
+GLAD_LAZY_VOID(glProgramUniformMatrix4x2dv, PFNGLPROGRAMUNIFORMMATRIX4X2DVPROC, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value), (program, location, count, transpose, value))
+GLAD_LAZY_VOID(glProgramUniformMatrix4x2fv, PFNGLPROGRAMUNIFORMMATRIX4X2FVPROC, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (program, location, count, transpose, value))
+GLAD_LAZY_VOID(glProgramUniformMatrix4x3dv, PFNGLPROGRAMUNIFORMMATRIX4X3DVPROC, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value), (program, location, count, transpose, value))
+GLAD_LAZY_VOID(glProgramUniformMatrix4x3fv, PFNGLPROGRAMUNIFORMMATRIX4X3FVPROC, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (program, location, count, transpose, value))
+GLAD_LAZY_VOID(glProvokingVertex, PFNGLPROVOKINGVERTEXPROC, (GLenum mode), (mode))
+GLAD_LAZY_VOID(glPushAttrib, PFNGLPUSHATTRIBPROC, (GLbitfield mask), (mask))
+GLAD_LAZY_VOID(glPushClientAttrib, PFNGLPUSHCLIENTATTRIBPROC, (GLbitfield mask), (mask))
+GLAD_LAZY_VOID(glPushDebugGroup, PFNGLPUSHDEBUGGROUPPROC, (GLenum source, GLuint id, GLsizei length, const GLchar *message), (source, id, length, message))
+GLAD_LAZY_VOID(glPushMatrix, PFNGLPUSHMATRIXPROC, (void), ())
+GLAD_LAZY_VOID(glPushName, PFNGLPUSHNAMEPROC, (GLuint name), (name))
+GLAD_LAZY_VOID(glQueryCounter, PFNGLQUERYCOUNTERPROC, (GLuint id, GLenum target), (id, target))
+GLAD_LAZY_VOID(glRasterPos2d, PFNGLRASTERPOS2DPROC, (GLdouble x, GLdouble y), (x, y))
+GLAD_LAZY_VOID(glRasterPos2dv, PFNGLRASTERPOS2DVPROC, (const GLdouble *v), (v))
+GLAD_LAZY_VOID(glRasterPos2f, PFNGLRASTERPOS2FPROC, (GLfloat x, GLfloat y), (x, y))
+GLAD_LAZY_VOID(glRasterPos2fv, PFNGLRASTERPOS2FVPROC, (const GLfloat *v), (v))
+GLAD_LAZY_VOID(glRasterPos2i, PFNGLRASTERPOS2IPROC, (GLint x, GLint y), (x, y))
+GLAD_LAZY_VOID(glRasterPos2iv, PFNGLRASTERPOS2IVPROC, (const GLint *v), (v))
+GLAD_LAZY_VOID(glRasterPos2s, PFNGLRASTERPOS2SPROC, (GLshort x, GLshort y), (x, y))
+GLAD_LAZY_VOID(glRasterPos2sv, PFNGLRASTERPOS2SVPROC, (const GLshort *v), (v))
+GLAD_LAZY_VOID(glRasterPos3d, PFNGLRASTERPOS3DPROC, (GLdouble x, GLdouble y, GLdouble z), (x, y, z))
+GLAD_LAZY_VOID(glRasterPos3dv, PFNGLRASTERPOS3DVPROC, (const GLdouble *v), (v))
+GLAD_LAZY_VOID(glRasterPos3f, PFNGLRASTERPOS3FPROC, (GLfloat x, GLfloat y, GLfloat z), (x, y, z))
+GLAD_LAZY_VOID(glRasterPos3fv, PFNGLRASTERPOS3FVPROC, (const GLfloat *v), (v))
+GLAD_LAZY_VOID(glRasterPos3i, PFNGLRASTERPOS3IPROC, (GLint x, GLint y, GLint z), (x, y, z))
+GLAD_LAZY_VOID(glRasterPos3iv, PFNGLRASTERPOS3IVPROC, (const GLint *v), (v))
+GLAD_LAZY_VOID(glRasterPos3s, PFNGLRASTERPOS3SPROC, (GLshort x, GLshort y, GLshort z), (x, y, z))
+GLAD_LAZY_VOID(glRasterPos3sv, PFNGLRASTERPOS3SVPROC, (const GLshort *v), (v))
+GLAD_LAZY_VOID(glRasterPos4d, PFNGLRASTERPOS4DPROC, (GLdouble x, GLdouble y, GLdouble z, GLdouble w), (x, y, z, w))
+GLAD_LAZY_VOID(glRasterPos4dv, PFNGLRASTERPOS4DVPROC, (const GLdouble *v), (v))
+GLAD_LAZY_VOID(glRasterPos4f, PFNGLRASTERPOS4FPROC, (GLfloat x, GLfloat y, GLfloat z, GLfloat w), (x, y, z, w))
+GLAD_LAZY_VOID(glRasterPos4fv, PFNGLRASTERPOS4FVPROC, (const GLfloat *v), (v))
+GLAD_LAZY_VOID(glRasterPos4i, PFNGLRASTERPOS4IPROC, (GLint x, GLint y, GLint z, GLint w), (x, y, z, w))
+GLAD_LAZY_VOID(glRasterPos4iv, PFNGLRASTERPOS4IVPROC, (const GLint *v), (v))
+GLAD_LAZY_VOID(glRasterPos4s, PFNGLRASTERPOS4SPROC, (GLshort x, GLshort y, GLshort z, GLshort w), (x, y, z, w))
+GLAD_LAZY_VOID(glRasterPos4sv, PFNGLRASTERPOS4SVPROC, (const GLshort *v), (v))
+GLAD_LAZY_VOID(glReadBuffer, PFNGLREADBUFFERPROC, (GLenum src), (src))
+GLAD_LAZY_VOID(glReadPixels, PFNGLREADPIXELSPROC, (GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, void *pixels), (x, y, width, height, format, type, pixels))
+GLAD_LAZY_VOID(glReadnPixels, PFNGLREADNPIXELSPROC, (GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, GLsizei bufSize, void *data), (x, y, width, height, format, type, bufSize, data))
+GLAD_LAZY_VOID(glRectd, PFNGLRECTDPROC, (GLdouble x1, GLdouble y1, GLdouble x2, GLdouble y2), (x1, y1, x2, y2))
+GLAD_LAZY_VOID(glRectdv, PFNGLRECTDVPROC, (const GLdouble *v1, const GLdouble *v2), (v1, v2))
+GLAD_LAZY_VOID(glRectf, PFNGLRECTFPROC, (GLfloat x1, GLfloat y1, GLfloat x2, GLfloat y2), (x1, y1, x2, y2))
+GLAD_LAZY_VOID(glRectfv, PFNGLRECTFVPROC, (const GLfloat *v1, const GLfloat *v2), (v1, v2))
+GLAD_LAZY_VOID(glRecti, PFNGLRECTIPROC, (GLint x1, GLint y1, GLint x2, GLint y2), (x1, y1, x2, y2))
+GLAD_LAZY_VOID(glRectiv, PFNGLRECTIVPROC, (const GLint *v1, const GLint *v2), (v1, v2))
+GLAD_LAZY_VOID(glRects, PFNGLRECTSPROC, (GLshort x1, GLshort y1, GLshort x2, GLshort y2), (x1, y1, x2, y2))
+GLAD_LAZY_VOID(glRectsv, PFNGLRECTSVPROC, (const GLshort *v1, const GLshort *v2), (v1, v2))
+GLAD_LAZY_VOID(glReleaseShaderCompiler, PFNGLRELEASESHADERCOMPILERPROC, (void), ())
+GLAD_LAZY_RET(GLint, glRenderMode, PFNGLRENDERMODEPROC, (GLenum mode), (mode))
+GLAD_LAZY_VOID(glRenderbufferStorage, PFNGLRENDERBUFFERSTORAGEPROC, (GLenum target, GLenum internalformat, GLsizei width, GLsizei height), (target, internalformat, width, height))
+GLAD_LAZY_VOID(glRenderbufferStorageMultisample, PFNGLRENDERBUFFERSTORAGEMULTISAMPLEPROC, (GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height), (target, samples, internalformat, width, height))
+GLAD_LAZY_VOID(glResumeTransformFeedback, PFNGLRESUMETRANSFORMFEEDBACKPROC, (void), ())
+GLAD_LAZY_VOID(glRotated, PFNGLROTATEDPROC, (GLdouble angle, GLdouble x, GLdouble y, GLdouble z), (angle, x, y, z))
+GLAD_LAZY_VOID(glRotatef, PFNGLROTATEFPROC, (GLfloat angle, GLfloat x, GLfloat y, GLfloat z), (angle, x, y, z))
+GLAD_LAZY_VOID(glSampleCoverage, PFNGLSAMPLECOVERAGEPROC, (GLfloat value, GLboolean invert), (value, invert))
+GLAD_LAZY_VOID(glSampleMaski, PFNGLSAMPLEMASKIPROC, (GLuint maskNumber, GLbitfield mask), (maskNumber, mask))
+GLAD_LAZY_VOID(glSamplerParameterIiv, PFNGLSAMPLERPARAMETERIIVPROC, (GLuint sampler, GLenum pname, const GLint *param), (sampler, pname, param))
+GLAD_LAZY_VOID(glSamplerParameterIuiv, PFNGLSAMPLERPARAMETERIUIVPROC, (GLuint sampler, GLenum pname, const GLuint *param), (sampler, pname, param))
+GLAD_LAZY_VOID(glSamplerParameterf, PFNGLSAMPLERPARAMETERFPROC, (GLuint sampler, GLenum pname, GLfloat param), (sampler, pname, param))
+GLAD_LAZY_VOID(glSamplerParameterfv, PFNGLSAMPLERPARAMETERFVPROC, (GLuint sampler, GLenum pname, const GLfloat *param), (sampler, pname, param))
+GLAD_LAZY_VOID(glSamplerParameteri, PFNGLSAMPLERPARAMETERIPROC, (GLuint sampler, GLenum pname, GLint param), (sampler, pname, param))
+GLAD_LAZY_VOID(glSamplerParameteriv, PFNGLSAMPLERPARAMETERIVPROC, (GLuint sampler, GLenum pname, const GLint *param), (sampler, pname, param))
+GLAD_LAZY_VOID(glScaled, PFNGLSCALEDPROC, (GLdouble x, GLdouble y, GLdouble z), (x, y, z))
+GLAD_LAZY_VOID(glScalef, PFNGLSCALEFPROC, (GLfloat x, GLfloat y, GLfloat z), (x, y, z))
+GLAD_LAZY_VOID(glScissor, PFNGLSCISSORPROC, (GLint x, GLint y, GLsizei width, GLsizei height), (x, y, width, height))
+GLAD_LAZY_VOID(glScissorArrayv, PFNGLSCISSORARRAYVPROC, (GLuint first, GLsizei count, const GLint *v), (first, count, v))
+GLAD_LAZY_VOID(glScissorIndexed, PFNGLSCISSORINDEXEDPROC, (GLuint index, GLint left, GLint bottom, GLsizei width, GLsizei height), (index, left, bottom, width, height))
+GLAD_LAZY_VOID(glScissorIndexedv, PFNGLSCISSORINDEXEDVPROC, (GLuint index, const GLint *v), (index, v))
+GLAD_LAZY_VOID(glSecondaryColor3b, PFNGLSECONDARYCOLOR3BPROC, (GLbyte red, GLbyte green, GLbyte blue), (red, green, blue))
+GLAD_LAZY_VOID(glSecondaryColor3bv, PFNGLSECONDARYCOLOR3BVPROC, (const GLbyte *v), (v))
+GLAD_LAZY_VOID(glSecondaryColor3d, PFNGLSECONDARYCOLOR3DPROC, (GLdouble red, GLdouble green, GLdouble blue), (red, green, blue))
+GLAD_LAZY_VOID(glSecondaryColor3dv, PFNGLSECONDARYCOLOR3DVPROC, (const GLdouble *v), (v))
+GLAD_LAZY_VOID(glSecondaryColor3f, PFNGLSECONDARYCOLOR3FPROC, (GLfloat red, GLfloat green, GLfloat blue), (red, green, blue))
+GLAD_LAZY_VOID(glSecondaryColor3fv, PFNGLSECONDARYCOLOR3FVPROC, (const GLfloat *v), (v))
+GLAD_LAZY_VOID(glSecondaryColor3i, PFNGLSECONDARYCOLOR3IPROC, (GLint red, GLint green, GLint blue), (red, green, blue))
+GLAD_LAZY_VOID(glSecondaryColor3iv, PFNGLSECONDARYCOLOR3IVPROC, (const GLint *v), (v))
+GLAD_LAZY_VOID(glSecondaryColor3s, PFNGLSECONDARYCOLOR3SPROC, (GLshort red, GLshort green, GLshort blue), (red, green, blue))
+GLAD_LAZY_VOID(glSecondaryColor3sv, PFNGLSECONDARYCOLOR3SVPROC, (const GLshort *v), (v))
+GLAD_LAZY_VOID(glSecondaryColor3ub, PFNGLSECONDARYCOLOR3UBPROC, (GLubyte red, GLubyte green, GLubyte blue), (red, green, blue))
+GLAD_LAZY_VOID(glSecondaryColor3ubv, PFNGLSECONDARYCOLOR3UBVPROC, (const GLubyte *v), (v))
+GLAD_LAZY_VOID(glSecondaryColor3ui, PFNGLSECONDARYCOLOR3UIPROC, (GLuint red, GLuint green, GLuint blue), (red, green, blue))
+GLAD_LAZY_VOID(glSecondaryColor3uiv, PFNGLSECONDARYCOLOR3UIVPROC, (const GLuint *v), (v))
+GLAD_LAZY_VOID(glSecondaryColor3us, PFNGLSECONDARYCOLOR3USPROC, (GLushort red, GLushort green, GLushort blue), (red, green, blue))
+GLAD_LAZY_VOID(glSecondaryColor3usv, PFNGLSECONDARYCOLOR3USVPROC, (const GLushort *v), (v))
+GLAD_LAZY_VOID(glSecondaryColorP3ui, PFNGLSECONDARYCOLORP3UIPROC, (GLenum type, GLuint color), (type, color))
+GLAD_LAZY_VOID(glSecondaryColorP3uiv, PFNGLSECONDARYCOLORP3UIVPROC, (GLenum type, const GLuint *color), (type, color))
+GLAD_LAZY_VOID(glSecondaryColorPointer, PFNGLSECONDARYCOLORPOINTERPROC, (GLint size, GLenum type, GLsizei stride, const void *pointer), (size, type, stride, pointer))
+GLAD_LAZY_VOID(glSelectBuffer, PFNGLSELECTBUFFERPROC, (GLsizei size, GLuint *buffer), (size, buffer))
+GLAD_LAZY_VOID(glShadeModel, PFNGLSHADEMODELPROC, (GLenum mode), (mode))
+GLAD_LAZY_VOID(glShaderBinary, PFNGLSHADERBINARYPROC, (GLsizei count, const GLuint *shaders, GLenum binaryFormat, const void *binary, GLsizei length), (count, shaders, binaryFormat, binary, length))
+GLAD_LAZY_VOID(glShaderSource, PFNGLSHADERSOURCEPROC, (GLuint shader, GLsizei count, const GLchar *const*string, const GLint *length), (shader, count, string, length))
+GLAD_LAZY_VOID(glShaderStorageBlockBinding, PFNGLSHADERSTORAGEBLOCKBINDINGPROC, (GLuint program, GLuint storageBlockIndex, GLuint storageBlockBinding), (program, storageBlockIndex, storageBlockBinding))
+GLAD_LAZY_VOID(glSpecializeShader, PFNGLSPECIALIZESHADERPROC, (GLuint shader, const GLchar *pEntryPoint, GLuint numSpecializationConstants, const GLuint *pConstantIndex, const GLuint *pConstantValue), (shader, pEntryPoint, numSpecializationConstants, pConstantIndex, pConstantValue))
+GLAD_LAZY_VOID(glStencilFunc, PFNGLSTENCILFUNCPROC, (GLenum func, GLint ref, GLuint mask), (func, ref, mask))
+GLAD_LAZY_VOID(glStencilFuncSeparate, PFNGLSTENCILFUNCSEPARATEPROC, (GLenum face, GLenum func, GLint ref, GLuint mask), (face, func, ref, mask))
+GLAD_LAZY_VOID(glStencilMask, PFNGLSTENCILMASKPROC, (GLuint mask), (mask))
+GLAD_LAZY_VOID(glStencilMaskSeparate, PFNGLSTENCILMASKSEPARATEPROC, (GLenum face, GLuint mask), (face, mask))
+GLAD_LAZY_VOID(glStencilOp, PFNGLSTENCILOPPROC, (GLenum fail, GLenum zfail, GLenum zpass), (fail, zfail, zpass))
+GLAD_LAZY_VOID(glStencilOpSeparate, PFNGLSTENCILOPSEPARATEPROC, (GLenum face, GLenum sfail, GLenum dpfail, GLenum dppass), (face, sfail, dpfail, dppass))
+GLAD_LAZY_VOID(glTexBuffer, PFNGLTEXBUFFERPROC, (GLenum target, GLenum internalformat, GLuint buffer), (target, internalformat, buffer))
+GLAD_LAZY_VOID(glTexBufferRange, PFNGLTEXBUFFERRANGEPROC, (GLenum target, GLenum internalformat, GLuint buffer, GLintptr offset, GLsizeiptr size), (target, internalformat, buffer, offset, size))
+GLAD_LAZY_VOID(glTexCoord1d, PFNGLTEXCOORD1DPROC, (GLdouble s), (s))
+GLAD_LAZY_VOID(glTexCoord1dv, PFNGLTEXCOORD1DVPROC, (const GLdouble *v), (v))
+GLAD_LAZY_VOID(glTexCoord1f, PFNGLTEXCOORD1FPROC, (GLfloat s), (s))
+GLAD_LAZY_VOID(glTexCoord1fv, PFNGLTEXCOORD1FVPROC, (const GLfloat *v), (v))
+GLAD_LAZY_VOID(glTexCoord1i, PFNGLTEXCOORD1IPROC, (GLint s), (s))
+GLAD_LAZY_VOID(glTexCoord1iv, PFNGLTEXCOORD1IVPROC, (const GLint *v), (v))
+GLAD_LAZY_VOID(glTexCoord1s, PFNGLTEXCOORD1SPROC, (GLshort s), (s))
+GLAD_LAZY_VOID(glTexCoord1sv, PFNGLTEXCOORD1SVPROC, (const GLshort *v), (v))
+GLAD_LAZY_VOID(glTexCoord2d, PFNGLTEXCOORD2DPROC, (GLdouble s, GLdouble t), (s, t))
+GLAD_LAZY_VOID(glTexCoord2dv, PFNGLTEXCOORD2DVPROC, (const GLdouble *v), (v))
+GLAD_LAZY_VOID(glTexCoord2f, PFNGLTEXCOORD2FPROC, (GLfloat s, GLfloat t), (s, t))
+GLAD_LAZY_VOID(glTexCoord2fv, PFNGLTEXCOORD2FVPROC, (const GLfloat *v), (v))
+GLAD_LAZY_VOID(glTexCoord2i, PFNGLTEXCOORD2IPROC, (GLint s, GLint t), (s, t))
+GLAD_LAZY_VOID(glTexCoord2iv, PFNGLTEXCOORD2IVPROC, (const GLint *v), (v))
+GLAD_LAZY_VOID(glTexCoord2s, PFNGLTEXCOORD2SPROC, (GLshort s, GLshort t), (s, t))
+GLAD_LAZY_VOID(glTexCoord2sv, PFNGLTEXCOORD2SVPROC, (const GLshort *v), (v))
+GLAD_LAZY_VOID(glTexCoord3d, PFNGLTEXCOORD3DPROC, (GLdouble s, GLdouble t, GLdouble r), (s, t, r))
+GLAD_LAZY_VOID(glTexCoord3dv, PFNGLTEXCOORD3DVPROC, (const GLdouble *v), (v))
+GLAD_LAZY_VOID(glTexCoord3f, PFNGLTEXCOORD3FPROC, (GLfloat s, GLfloat t, GLfloat r), (s, t, r))
+GLAD_LAZY_VOID(glTexCoord3fv, PFNGLTEXCOORD3FVPROC, (const GLfloat *v), (v))
+GLAD_LAZY_VOID(glTexCoord3i, PFNGLTEXCOORD3IPROC, (GLint s, GLint t, GLint r), (s, t, r))
+GLAD_LAZY_VOID(glTexCoord3iv, PFNGLTEXCOORD3IVPROC, (const GLint *v), (v))
+GLAD_LAZY_VOID(glTexCoord3s, PFNGLTEXCOORD3SPROC, (GLshort s, GLshort t, GLshort r), (s, t, r))
+GLAD_LAZY_VOID(glTexCoord3sv, PFNGLTEXCOORD3SVPROC, (const GLshort *v), (v))
+GLAD_LAZY_VOID(glTexCoord4d, PFNGLTEXCOORD4DPROC, (GLdouble s, GLdouble t, GLdouble r, GLdouble q), (s, t, r, q))
+GLAD_LAZY_VOID(glTexCoord4dv, PFNGLTEXCOORD4DVPROC, (const GLdouble *v), (v))
+GLAD_LAZY_VOID(glTexCoord4f, PFNGLTEXCOORD4FPROC, (GLfloat s, GLfloat t, GLfloat r, GLfloat q), (s, t, r, q))
+GLAD_LAZY_VOID(glTexCoord4fv, PFNGLTEXCOORD4FVPROC, (const GLfloat *v), (v))
+GLAD_LAZY_VOID(glTexCoord4i, PFNGLTEXCOORD4IPROC, (GLint s, GLint t, GLint r, GLint q), (s, t, r, q))
+GLAD_LAZY_VOID(glTexCoord4iv, PFNGLTEXCOORD4IVPROC, (const GLint *v), (v))
+GLAD_LAZY_VOID(glTexCoord4s, PFNGLTEXCOORD4SPROC, (GLshort s, GLshort t, GLshort r, GLshort q), (s, t, r, q))
+GLAD_LAZY_VOID(glTexCoord4sv, PFNGLTEXCOORD4SVPROC, (const GLshort *v), (v))
+GLAD_LAZY_VOID(glTexCoordP1ui, PFNGLTEXCOORDP1UIPROC, (GLenum type, GLuint coords), (type, coords))
+GLAD_LAZY_VOID(glTexCoordP1uiv, PFNGLTEXCOORDP1UIVPROC, (GLenum type, const GLuint *coords), (type, coords))
+GLAD_LAZY_VOID(glTexCoordP2ui, PFNGLTEXCOORDP2UIPROC, (GLenum type, GLuint coords), (type, coords))
+GLAD_LAZY_VOID(glTexCoordP2uiv, PFNGLTEXCOORDP2UIVPROC, (GLenum type, const GLuint *coords), (type, coords))
+GLAD_LAZY_VOID(glTexCoordP3ui, PFNGLTEXCOORDP3UIPROC, (GLenum type, GLuint coords), (type, coords))
+GLAD_LAZY_VOID(glTexCoordP3uiv, PFNGLTEXCOORDP3UIVPROC, (GLenum type, const GLuint *coords), (type, coords))
+GLAD_LAZY_VOID(glTexCoordP4ui, PFNGLTEXCOORDP4UIPROC, (GLenum type, GLuint coords), (type, coords))
+GLAD_LAZY_VOID(glTexCoordP4uiv, PFNGLTEXCOORDP4UIVPROC, (GLenum type, const GLuint *coords), (type, coords))
+GLAD_LAZY_VOID(glTexCoordPointer, PFNGLTEXCOORDPOINTERPROC, (GLint size, GLenum type, GLsizei stride, const void *pointer), (size, type, stride, pointer))
+GLAD_LAZY_VOID(glTexEnvf, PFNGLTEXENVFPROC, (GLenum target, GLenum pname, GLfloat param), (target, pname, param))
+GLAD_LAZY_VOID(glTexEnvfv, PFNGLTEXENVFVPROC, (GLenum target, GLenum pname, const GLfloat *params), (target, pname, params))
+GLAD_LAZY_VOID(glTexEnvi, PFNGLTEXENVIPROC, (GLenum target, GLenum pname, GLint param), (target, pname, param))
+GLAD_LAZY_VOID(glTexEnviv, PFNGLTEXENVIVPROC, (GLenum target, GLenum pname, const GLint *params), (target, pname, params))
+GLAD_LAZY_VOID(glTexGend, PFNGLTEXGENDPROC, (GLenum coord, GLenum pname, GLdouble param), (coord, pname, param))
+GLAD_LAZY_VOID(glTexGendv, PFNGLTEXGENDVPROC, (GLenum coord, GLenum pname, const GLdouble *params), (coord, pname, params))
+GLAD_LAZY_VOID(glTexGenf, PFNGLTEXGENFPROC, (GLenum coord, GLenum pname, GLfloat param), (coord, pname, param))
+GLAD_LAZY_VOID(glTexGenfv, PFNGLTEXGENFVPROC, (GLenum coord, GLenum pname, const GLfloat *params), (coord, pname, params))
+GLAD_LAZY_VOID(glTexGeni, PFNGLTEXGENIPROC, (GLenum coord, GLenum pname, GLint param), (coord, pname, param))
+GLAD_LAZY_VOID(glTexGeniv, PFNGLTEXGENIVPROC, (GLenum coord, GLenum pname, const GLint *params), (coord, pname, params))
+GLAD_LAZY_VOID(glTexImage1D, PFNGLTEXIMAGE1DPROC, (GLenum target, GLint level, GLint internalformat, GLsizei width, GLint border, GLenum format, GLenum type, const void *pixels), (target, level, internalformat, width, border, format, type, pixels))
+GLAD_LAZY_VOID(glTexImage2D, PFNGLTEXIMAGE2DPROC, (GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLint border, GLenum format, GLenum type, const void *pixels), (target, level, internalformat, width, height, border, format, type, pixels))
+GLAD_LAZY_VOID(glTexImage2DMultisample, PFNGLTEXIMAGE2DMULTISAMPLEPROC, (GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLboolean fixedsamplelocations), (target, samples, internalformat, width, height, fixedsamplelocations))
+GLAD_LAZY_VOID(glTexImage3D, PFNGLTEXIMAGE3DPROC, (GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLenum format, GLenum type, const void *pixels), (target, level, internalformat, width, height, depth, border, format, type, pixels))
+GLAD_LAZY_VOID(glTexImage3DMultisample, PFNGLTEXIMAGE3DMULTISAMPLEPROC, (GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedsamplelocations), (target, samples, internalformat, width, height, depth, fixedsamplelocations))
+GLAD_LAZY_VOID(glTexParameterIiv, PFNGLTEXPARAMETERIIVPROC, (GLenum target, GLenum pname, const GLint *params), (target, pname, params))
+GLAD_LAZY_VOID(glTexParameterIuiv, PFNGLTEXPARAMETERIUIVPROC, (GLenum target, GLenum pname, const GLuint *params), (target, pname, params))
+GLAD_LAZY_VOID(glTexParameterf, PFNGLTEXPARAMETERFPROC, (GLenum target, GLenum pname, GLfloat param), (target, pname, param))
+GLAD_LAZY_VOID(glTexParameterfv, PFNGLTEXPARAMETERFVPROC, (GLenum target, GLenum pname, const GLfloat *params), (target, pname, params))
+GLAD_LAZY_VOID(glTexParameteri, PFNGLTEXPARAMETERIPROC, (GLenum target, GLenum pname, GLint param), (target, pname, param))
+GLAD_LAZY_VOID(glTexParameteriv, PFNGLTEXPARAMETERIVPROC, (GLenum target, GLenum pname, const GLint *params), (target, pname, params))
+GLAD_LAZY_VOID(glTexStorage1D, PFNGLTEXSTORAGE1DPROC, (GLenum target, GLsizei levels, GLenum internalformat, GLsizei width), (target, levels, internalformat, width))
+GLAD_LAZY_VOID(glTexStorage2D, PFNGLTEXSTORAGE2DPROC, (GLenum target, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height), (target, levels, internalformat, width, height))
+GLAD_LAZY_VOID(glTexStorage2DMultisample, PFNGLTEXSTORAGE2DMULTISAMPLEPROC, (GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLboolean fixedsamplelocations), (target, samples, internalformat, width, height, fixedsamplelocations))
+GLAD_LAZY_VOID(glTexStorage3D, PFNGLTEXSTORAGE3DPROC, (GLenum target, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth), (target, levels, internalformat, width, height, depth))
+GLAD_LAZY_VOID(glTexStorage3DMultisample, PFNGLTEXSTORAGE3DMULTISAMPLEPROC, (GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedsamplelocations), (target, samples, internalformat, width, height, depth, fixedsamplelocations))
+GLAD_LAZY_VOID(glTexSubImage1D, PFNGLTEXSUBIMAGE1DPROC, (GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLenum type, const void *pixels), (target, level, xoffset, width, format, type, pixels))
+GLAD_LAZY_VOID(glTexSubImage2D, PFNGLTEXSUBIMAGE2DPROC, (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type, const void *pixels), (target, level, xoffset, yoffset, width, height, format, type, pixels))
+GLAD_LAZY_VOID(glTexSubImage3D, PFNGLTEXSUBIMAGE3DPROC, (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void *pixels), (target, level, xoffset, yoffset, zoffset, width, height, depth, format, type, pixels))
+GLAD_LAZY_VOID(glTextureBarrier, PFNGLTEXTUREBARRIERPROC, (void), ())
+GLAD_LAZY_VOID(glTextureBuffer, PFNGLTEXTUREBUFFERPROC, (GLuint texture, GLenum internalformat, GLuint buffer), (texture, internalformat, buffer))
+GLAD_LAZY_VOID(glTextureBufferRange, PFNGLTEXTUREBUFFERRANGEPROC, (GLuint texture, GLenum internalformat, GLuint buffer, GLintptr offset, GLsizeiptr size), (texture, internalformat, buffer, offset, size))
+GLAD_LAZY_VOID(glTextureParameterIiv, PFNGLTEXTUREPARAMETERIIVPROC, (GLuint texture, GLenum pname, const GLint *params), (texture, pname, params))
+GLAD_LAZY_VOID(glTextureParameterIuiv, PFNGLTEXTUREPARAMETERIUIVPROC, (GLuint texture, GLenum pname, const GLuint *params), (texture, pname, params))
+GLAD_LAZY_VOID(glTextureParameterf, PFNGLTEXTUREPARAMETERFPROC, (GLuint texture, GLenum pname, GLfloat param), (texture, pname, param))
+GLAD_LAZY_VOID(glTextureParameterfv, PFNGLTEXTUREPARAMETERFVPROC, (GLuint texture, GLenum pname, const GLfloat *param), (texture, pname, param))
+GLAD_LAZY_VOID(glTextureParameteri, PFNGLTEXTUREPARAMETERIPROC, (GLuint texture, GLenum pname, GLint param), (texture, pname, param))
+GLAD_LAZY_VOID(glTextureParameteriv, PFNGLTEXTUREPARAMETERIVPROC, (GLuint texture, GLenum pname, const GLint *param), (texture, pname, param))
+GLAD_LAZY_VOID(glTextureStorage1D, PFNGLTEXTURESTORAGE1DPROC, (GLuint texture, GLsizei levels, GLenum internalformat, GLsizei width), (texture, levels, internalformat, width))
+GLAD_LAZY_VOID(glTextureStorage2D, PFNGLTEXTURESTORAGE2DPROC, (GLuint texture, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height), (texture, levels, internalformat, width, height))
+GLAD_LAZY_VOID(glTextureStorage2DMultisample, PFNGLTEXTURESTORAGE2DMULTISAMPLEPROC, (GLuint texture, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLboolean fixedsamplelocations), (texture, samples, internalformat, width, height, fixedsamplelocations))
+GLAD_LAZY_VOID(glTextureStorage3D, PFNGLTEXTURESTORAGE3DPROC, (GLuint texture, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth), (texture, levels, internalformat, width, height, depth))
+GLAD_LAZY_VOID(glTextureStorage3DMultisample, PFNGLTEXTURESTORAGE3DMULTISAMPLEPROC, (GLuint texture, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedsamplelocations), (texture, samples, internalformat, width, height, depth, fixedsamplelocations))
+GLAD_LAZY_VOID(glTextureSubImage1D, PFNGLTEXTURESUBIMAGE1DPROC, (GLuint texture, GLint level, GLint xoffset, GLsizei width, GLenum format, GLenum type, const void *pixels), (texture, level, xoffset, width, format, type, pixels))
+GLAD_LAZY_VOID(glTextureSubImage2D, PFNGLTEXTURESUBIMAGE2DPROC, (GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type, const void *pixels), (texture, level, xoffset, yoffset, width, height, format, type, pixels))
+GLAD_LAZY_VOID(glTextureSubImage3D, PFNGLTEXTURESUBIMAGE3DPROC, (GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void *pixels), (texture, level, xoffset, yoffset, zoffset, width, height, depth, format, type, pixels))
+GLAD_LAZY_VOID(glTextureView, PFNGLTEXTUREVIEWPROC, (GLuint texture, GLenum target, GLuint origtexture, GLenum internalformat, GLuint minlevel, GLuint numlevels, GLuint minlayer, GLuint numlayers), (texture, target, origtexture, internalformat, minlevel, numlevels, minlayer, numlayers))
+GLAD_LAZY_VOID(glTransformFeedbackBufferBase, PFNGLTRANSFORMFEEDBACKBUFFERBASEPROC, (GLuint xfb, GLuint index, GLuint buffer), (xfb, index, buffer))
+GLAD_LAZY_VOID(glTransformFeedbackBufferRange, PFNGLTRANSFORMFEEDBACKBUFFERRANGEPROC, (GLuint xfb, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size), (xfb, index, buffer, offset, size))
+GLAD_LAZY_VOID(glTransformFeedbackVaryings, PFNGLTRANSFORMFEEDBACKVARYINGSPROC, (GLuint program, GLsizei count, const GLchar *const*varyings, GLenum bufferMode), (program, count, varyings, bufferMode))
+GLAD_LAZY_VOID(glTranslated, PFNGLTRANSLATEDPROC, (GLdouble x, GLdouble y, GLdouble z), (x, y, z))
+GLAD_LAZY_VOID(glTranslatef, PFNGLTRANSLATEFPROC, (GLfloat x, GLfloat y, GLfloat z), (x, y, z))
+GLAD_LAZY_VOID(glUniform1d, PFNGLUNIFORM1DPROC, (GLint location, GLdouble x), (location, x))
+GLAD_LAZY_VOID(glUniform1dv, PFNGLUNIFORM1DVPROC, (GLint location, GLsizei count, const GLdouble *value), (location, count, value))
+GLAD_LAZY_VOID(glUniform1f, PFNGLUNIFORM1FPROC, (GLint location, GLfloat v0), (location, v0))
+GLAD_LAZY_VOID(glUniform1fv, PFNGLUNIFORM1FVPROC, (GLint location, GLsizei count, const GLfloat *value), (location, count, value))
+GLAD_LAZY_VOID(glUniform1i, PFNGLUNIFORM1IPROC, (GLint location, GLint v0), (location, v0))
+GLAD_LAZY_VOID(glUniform1iv, PFNGLUNIFORM1IVPROC, (GLint location, GLsizei count, const GLint *value), (location, count, value))
+GLAD_LAZY_VOID(glUniform1ui, PFNGLUNIFORM1UIPROC, (GLint location, GLuint v0), (location, v0))
+GLAD_LAZY_VOID(glUniform1uiv, PFNGLUNIFORM1UIVPROC, (GLint location, GLsizei count, const GLuint *value), (location, count, value))
+GLAD_LAZY_VOID(glUniform2d, PFNGLUNIFORM2DPROC, (GLint location, GLdouble x, GLdouble y), (location, x, y))
+GLAD_LAZY_VOID(glUniform2dv, PFNGLUNIFORM2DVPROC, (GLint location, GLsizei count, const GLdouble *value), (location, count, value))
+GLAD_LAZY_VOID(glUniform2f, PFNGLUNIFORM2FPROC, (GLint location, GLfloat v0, GLfloat v1), (location, v0, v1))
+GLAD_LAZY_VOID(glUniform2fv, PFNGLUNIFORM2FVPROC, (GLint location, GLsizei count, const GLfloat *value), (location, count, value))
+GLAD_LAZY_VOID(glUniform2i, PFNGLUNIFORM2IPROC, (GLint location, GLint v0, GLint v1), (location, v0, v1))
+GLAD_LAZY_VOID(glUniform2iv, PFNGLUNIFORM2IVPROC, (GLint location, GLsizei count, const GLint *value), (location, count, value))
+GLAD_LAZY_VOID(glUniform2ui, PFNGLUNIFORM2UIPROC, (GLint location, GLuint v0, GLuint v1), (location, v0, v1))
+GLAD_LAZY_VOID(glUniform2uiv, PFNGLUNIFORM2UIVPROC, (GLint location, GLsizei count, const GLuint *value), (location, count, value))
+GLAD_LAZY_VOID(glUniform3d, PFNGLUNIFORM3DPROC, (GLint location, GLdouble x, GLdouble y, GLdouble z), (location, x, y, z))
+GLAD_LAZY_VOID(glUniform3dv, PFNGLUNIFORM3DVPROC, (GLint location, GLsizei count, const GLdouble *value), (location, count, value))
+GLAD_LAZY_VOID(glUniform3f, PFNGLUNIFORM3FPROC, (GLint location, GLfloat v0, GLfloat v1, GLfloat v2), (location, v0, v1, v2))
+GLAD_LAZY_VOID(glUniform3fv, PFNGLUNIFORM3FVPROC, (GLint location, GLsizei count, const GLfloat *value), (location, count, value))
+GLAD_LAZY_VOID(glUniform3i, PFNGLUNIFORM3IPROC, (GLint location, GLint v0, GLint v1, GLint v2), (location, v0, v1, v2))
+GLAD_LAZY_VOID(glUniform3iv, PFNGLUNIFORM3IVPROC, (GLint location, GLsizei count, const GLint *value), (location, count, value))
+GLAD_LAZY_VOID(glUniform3ui, PFNGLUNIFORM3UIPROC, (GLint location, GLuint v0, GLuint v1, GLuint v2), (location, v0, v1, v2))
+GLAD_LAZY_VOID(glUniform3uiv, PFNGLUNIFORM3UIVPROC, (GLint location, GLsizei count, const GLuint *value), (location, count, value))
+GLAD_LAZY_VOID(glUniform4d, PFNGLUNIFORM4DPROC, (GLint location, GLdouble x, GLdouble y, GLdouble z, GLdouble w), (location, x, y, z, w))
+GLAD_LAZY_VOID(glUniform4dv, PFNGLUNIFORM4DVPROC, (GLint location, GLsizei count, const GLdouble *value), (location, count, value))
+GLAD_LAZY_VOID(glUniform4f, PFNGLUNIFORM4FPROC, (GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3), (location, v0, v1, v2, v3))
+GLAD_LAZY_VOID(glUniform4fv, PFNGLUNIFORM4FVPROC, (GLint location, GLsizei count, const GLfloat *value), (location, count, value))
+GLAD_LAZY_VOID(glUniform4i, PFNGLUNIFORM4IPROC, (GLint location, GLint v0, GLint v1, GLint v2, GLint v3), (location, v0, v1, v2, v3))
+GLAD_LAZY_VOID(glUniform4iv, PFNGLUNIFORM4IVPROC, (GLint location, GLsizei count, const GLint *value), (location, count, value))
+GLAD_LAZY_VOID(glUniform4ui, PFNGLUNIFORM4UIPROC, (GLint location, GLuint v0, GLuint v1, GLuint v2, GLuint v3), (location, v0, v1, v2, v3))
+GLAD_LAZY_VOID(glUniform4uiv, PFNGLUNIFORM4UIVPROC, (GLint location, GLsizei count, const GLuint *value), (location, count, value))
+GLAD_LAZY_VOID(glUniformBlockBinding, PFNGLUNIFORMBLOCKBINDINGPROC, (GLuint program, GLuint uniformBlockIndex, GLuint uniformBlockBinding), (program, uniformBlockIndex, uniformBlockBinding))
+GLAD_LAZY_VOID(glUniformMatrix2dv, PFNGLUNIFORMMATRIX2DVPROC, (GLint location, GLsizei count, GLboolean transpose, const GLdouble *value), (location, count, transpose, value))
+GLAD_LAZY_VOID(glUniformMatrix2fv, PFNGLUNIFORMMATRIX2FVPROC, (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (location, count, transpose, value))
+GLAD_LAZY_VOID(glUniformMatrix2x3dv, PFNGLUNIFORMMATRIX2X3DVPROC, (GLint location, GLsizei count, GLboolean transpose, const GLdouble *value), (location, count, transpose, value))
+GLAD_LAZY_VOID(glUniformMatrix2x3fv, PFNGLUNIFORMMATRIX2X3FVPROC, (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (location, count, transpose, value))
+GLAD_LAZY_VOID(glUniformMatrix2x4dv, PFNGLUNIFORMMATRIX2X4DVPROC, (GLint location, GLsizei count, GLboolean transpose, const GLdouble *value), (location, count, transpose, value))
+GLAD_LAZY_VOID(glUniformMatrix2x4fv, PFNGLUNIFORMMATRIX2X4FVPROC, (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (location, count, transpose, value))
+GLAD_LAZY_VOID(glUniformMatrix3dv, PFNGLUNIFORMMATRIX3DVPROC, (GLint location, GLsizei count, GLboolean transpose, const GLdouble *value), (location, count, transpose, value))
+GLAD_LAZY_VOID(glUniformMatrix3fv, PFNGLUNIFORMMATRIX3FVPROC, (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (location, count, transpose, value))
+GLAD_LAZY_VOID(glUniformMatrix3x2dv, PFNGLUNIFORMMATRIX3X2DVPROC, (GLint location, GLsizei count, GLboolean transpose, const GLdouble *value), (location, count, transpose, value))
+GLAD_LAZY_VOID(glUniformMatrix3x2fv, PFNGLUNIFORMMATRIX3X2FVPROC, (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (location, count, transpose, value))
+GLAD_LAZY_VOID(glUniformMatrix3x4dv, PFNGLUNIFORMMATRIX3X4DVPROC, (GLint location, GLsizei count, GLboolean transpose, const GLdouble *value), (location, count, transpose, value))
+GLAD_LAZY_VOID(glUniformMatrix3x4fv, PFNGLUNIFORMMATRIX3X4FVPROC, (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (location, count, transpose, value))
+GLAD_LAZY_VOID(glUniformMatrix4dv, PFNGLUNIFORMMATRIX4DVPROC, (GLint location, GLsizei count, GLboolean transpose, const GLdouble *value), (location, count, transpose, value))
+GLAD_LAZY_VOID(glUniformMatrix4fv, PFNGLUNIFORMMATRIX4FVPROC, (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (location, count, transpose, value))
+GLAD_LAZY_VOID(glUniformMatrix4x2dv, PFNGLUNIFORMMATRIX4X2DVPROC, (GLint location, GLsizei count, GLboolean transpose, const GLdouble *value), (location, count, transpose, value))
+GLAD_LAZY_VOID(glUniformMatrix4x2fv, PFNGLUNIFORMMATRIX4X2FVPROC, (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (location, count, transpose, value))
+GLAD_LAZY_VOID(glUniformMatrix4x3dv, PFNGLUNIFORMMATRIX4X3DVPROC, (GLint location, GLsizei count, GLboolean transpose, const GLdouble *value), (location, count, transpose, value))
+GLAD_LAZY_VOID(glUniformMatrix4x3fv, PFNGLUNIFORMMATRIX4X3FVPROC, (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (location, count, transpose, value))
+GLAD_LAZY_VOID(glUniformSubroutinesuiv, PFNGLUNIFORMSUBROUTINESUIVPROC, (GLenum shadertype, GLsizei count, const GLuint *indices), (shadertype, count, indices))
+GLAD_LAZY_RET(GLboolean, glUnmapBuffer, PFNGLUNMAPBUFFERPROC, (GLenum target), (target))
+GLAD_LAZY_RET(GLboolean, glUnmapNamedBuffer, PFNGLUNMAPNAMEDBUFFERPROC, (GLuint buffer), (buffer))
+GLAD_LAZY_VOID(glUseProgram, PFNGLUSEPROGRAMPROC, (GLuint program), (program))
+GLAD_LAZY_VOID(glUseProgramStages, PFNGLUSEPROGRAMSTAGESPROC, (GLuint pipeline, GLbitfield stages, GLuint program), (pipeline, stages, program))
+GLAD_LAZY_VOID(glValidateProgram, PFNGLVALIDATEPROGRAMPROC, (GLuint program), (program))
+GLAD_LAZY_VOID(glValidateProgramPipeline, PFNGLVALIDATEPROGRAMPIPELINEPROC, (GLuint pipeline), (pipeline))
+GLAD_LAZY_VOID(glVertex2d, PFNGLVERTEX2DPROC, (GLdouble x, GLdouble y), (x, y))
+GLAD_LAZY_VOID(glVertex2dv, PFNGLVERTEX2DVPROC, (const GLdouble *v), (v))
+GLAD_LAZY_VOID(glVertex2f, PFNGLVERTEX2FPROC, (GLfloat x, GLfloat y), (x, y))
+GLAD_LAZY_VOID(glVertex2fv, PFNGLVERTEX2FVPROC, (const GLfloat *v), (v))
+GLAD_LAZY_VOID(glVertex2i, PFNGLVERTEX2IPROC, (GLint x, GLint y), (x, y))
+GLAD_LAZY_VOID(glVertex2iv, PFNGLVERTEX2IVPROC, (const GLint *v), (v))
+GLAD_LAZY_VOID(glVertex2s, PFNGLVERTEX2SPROC, (GLshort x, GLshort y), (x, y))
+GLAD_LAZY_VOID(glVertex2sv, PFNGLVERTEX2SVPROC, (const GLshort *v), (v))
+GLAD_LAZY_VOID(glVertex3d, PFNGLVERTEX3DPROC, (GLdouble x, GLdouble y, GLdouble z), (x, y, z))
+GLAD_LAZY_VOID(glVertex3dv, PFNGLVERTEX3DVPROC, (const GLdouble *v), (v))
+GLAD_LAZY_VOID(glVertex3f, PFNGLVERTEX3FPROC, (GLfloat x, GLfloat y, GLfloat z), (x, y, z))
+GLAD_LAZY_VOID(glVertex3fv, PFNGLVERTEX3FVPROC, (const GLfloat *v), (v))
+GLAD_LAZY_VOID(glVertex3i, PFNGLVERTEX3IPROC, (GLint x, GLint y, GLint z), (x, y, z))
+GLAD_LAZY_VOID(glVertex3iv, PFNGLVERTEX3IVPROC, (const GLint *v), (v))
+GLAD_LAZY_VOID(glVertex3s, PFNGLVERTEX3SPROC, (GLshort x, GLshort y, GLshort z), (x, y, z))
+GLAD_LAZY_VOID(glVertex3sv, PFNGLVERTEX3SVPROC, (const GLshort *v), (v))
+GLAD_LAZY_VOID(glVertex4d, PFNGLVERTEX4DPROC, (GLdouble x, GLdouble y, GLdouble z, GLdouble w), (x, y, z, w))
+GLAD_LAZY_VOID(glVertex4dv, PFNGLVERTEX4DVPROC, (const GLdouble *v), (v))
+GLAD_LAZY_VOID(glVertex4f, PFNGLVERTEX4FPROC, (GLfloat x, GLfloat y, GLfloat z, GLfloat w), (x, y, z, w))
+GLAD_LAZY_VOID(glVertex4fv, PFNGLVERTEX4FVPROC, (const GLfloat *v), (v))
+GLAD_LAZY_VOID(glVertex4i, PFNGLVERTEX4IPROC, (GLint x, GLint y, GLint z, GLint w), (x, y, z, w))
+GLAD_LAZY_VOID(glVertex4iv, PFNGLVERTEX4IVPROC, (const GLint *v), (v))
+GLAD_LAZY_VOID(glVertex4s, PFNGLVERTEX4SPROC, (GLshort x, GLshort y, GLshort z, GLshort w), (x, y, z, w))
+GLAD_LAZY_VOID(glVertex4sv, PFNGLVERTEX4SVPROC, (const GLshort *v), (v))
+GLAD_LAZY_VOID(glVertexArrayAttribBinding, PFNGLVERTEXARRAYATTRIBBINDINGPROC, (GLuint vaobj, GLuint attribindex, GLuint bindingindex), (vaobj, attribindex, bindingindex))
+GLAD_LAZY_VOID(glVertexArrayAttribFormat, PFNGLVERTEXARRAYATTRIBFORMATPROC, (GLuint vaobj, GLuint attribindex, GLint size, GLenum type, GLboolean normalized, GLuint relativeoffset), (vaobj, attribindex, size, type, normalized, relativeoffset))
+GLAD_LAZY_VOID(glVertexArrayAttribIFormat, PFNGLVERTEXARRAYATTRIBIFORMATPROC, (GLuint vaobj, GLuint attribindex, GLint size, GLenum type, GLuint relativeoffset), (vaobj, attribindex, size, type, relativeoffset))
+GLAD_LAZY_VOID(glVertexArrayAttribLFormat, PFNGLVERTEXARRAYATTRIBLFORMATPROC, (GLuint vaobj, GLuint attribindex, GLint size, GLenum type, GLuint relativeoffset), (vaobj, attribindex, size, type, relativeoffset))
+GLAD_LAZY_VOID(glVertexArrayBindingDivisor, PFNGLVERTEXARRAYBINDINGDIVISORPROC, (GLuint vaobj, GLuint bindingindex, GLuint divisor), (vaobj, bindingindex, divisor))
+GLAD_LAZY_VOID(glVertexArrayElementBuffer, PFNGLVERTEXARRAYELEMENTBUFFERPROC, (GLuint vaobj, GLuint buffer), (vaobj, buffer))
+GLAD_LAZY_VOID(glVertexArrayVertexBuffer, PFNGLVERTEXARRAYVERTEXBUFFERPROC, (GLuint vaobj, GLuint bindingindex, GLuint buffer, GLintptr offset, GLsizei stride), (vaobj, bindingindex, buffer, offset, stride))
+GLAD_LAZY_VOID(glVertexArrayVertexBuffers, PFNGLVERTEXARRAYVERTEXBUFFERSPROC, (GLuint vaobj, GLuint first, GLsizei count, const GLuint *buffers, const GLintptr *offsets, const GLsizei *strides), (vaobj, first, count, buffers, offsets, strides))
+GLAD_LAZY_VOID(glVertexAttrib1d, PFNGLVERTEXATTRIB1DPROC, (GLuint index, GLdouble x), (index, x))
+GLAD_LAZY_VOID(glVertexAttrib1dv, PFNGLVERTEXATTRIB1DVPROC, (GLuint index, const GLdouble *v), (index, v))
+GLAD_LAZY_VOID(glVertexAttrib1f, PFNGLVERTEXATTRIB1FPROC, (GLuint index, GLfloat x), (index, x))
+GLAD_LAZY_VOID(glVertexAttrib1fv, PFNGLVERTEXATTRIB1FVPROC, (GLuint index, const GLfloat *v), (index, v))
+GLAD_LAZY_VOID(glVertexAttrib1s, PFNGLVERTEXATTRIB1SPROC, (GLuint index, GLshort x), (index, x))
+GLAD_LAZY_VOID(glVertexAttrib1sv, PFNGLVERTEXATTRIB1SVPROC, (GLuint index, const GLshort *v), (index, v))
+GLAD_LAZY_VOID(glVertexAttrib2d, PFNGLVERTEXATTRIB2DPROC, (GLuint index, GLdouble x, GLdouble y), (index, x, y))
+GLAD_LAZY_VOID(glVertexAttrib2dv, PFNGLVERTEXATTRIB2DVPROC, (GLuint index, const GLdouble *v), (index, v))
+GLAD_LAZY_VOID(glVertexAttrib2f, PFNGLVERTEXATTRIB2FPROC, (GLuint index, GLfloat x, GLfloat y), (index, x, y))
+GLAD_LAZY_VOID(glVertexAttrib2fv, PFNGLVERTEXATTRIB2FVPROC, (GLuint index, const GLfloat *v), (index, v))
+GLAD_LAZY_VOID(glVertexAttrib2s, PFNGLVERTEXATTRIB2SPROC, (GLuint index, GLshort x, GLshort y), (index, x, y))
+GLAD_LAZY_VOID(glVertexAttrib2sv, PFNGLVERTEXATTRIB2SVPROC, (GLuint index, const GLshort *v), (index, v))
+GLAD_LAZY_VOID(glVertexAttrib3d, PFNGLVERTEXATTRIB3DPROC, (GLuint index, GLdouble x, GLdouble y, GLdouble z), (index, x, y, z))
+GLAD_LAZY_VOID(glVertexAttrib3dv, PFNGLVERTEXATTRIB3DVPROC, (GLuint index, const GLdouble *v), (index, v))
+GLAD_LAZY_VOID(glVertexAttrib3f, PFNGLVERTEXATTRIB3FPROC, (GLuint index, GLfloat x, GLfloat y, GLfloat z), (index, x, y, z))
+GLAD_LAZY_VOID(glVertexAttrib3fv, PFNGLVERTEXATTRIB3FVPROC, (GLuint index, const GLfloat *v), (index, v))
+GLAD_LAZY_VOID(glVertexAttrib3s, PFNGLVERTEXATTRIB3SPROC, (GLuint index, GLshort x, GLshort y, GLshort z), (index, x, y, z))
+GLAD_LAZY_VOID(glVertexAttrib3sv, PFNGLVERTEXATTRIB3SVPROC, (GLuint index, const GLshort *v), (index, v))
+GLAD_LAZY_VOID(glVertexAttrib4Nbv, PFNGLVERTEXATTRIB4NBVPROC, (GLuint index, const GLbyte *v), (index, v))
+GLAD_LAZY_VOID(glVertexAttrib4Niv, PFNGLVERTEXATTRIB4NIVPROC, (GLuint index, const GLint *v), (index, v))
+GLAD_LAZY_VOID(glVertexAttrib4Nsv, PFNGLVERTEXATTRIB4NSVPROC, (GLuint index, const GLshort *v), (index, v))
+GLAD_LAZY_VOID(glVertexAttrib4Nub, PFNGLVERTEXATTRIB4NUBPROC, (GLuint index, GLubyte x, GLubyte y, GLubyte z, GLubyte w), (index, x, y, z, w))
+GLAD_LAZY_VOID(glVertexAttrib4Nubv, PFNGLVERTEXATTRIB4NUBVPROC, (GLuint index, const GLubyte *v), (index, v))
+GLAD_LAZY_VOID(glVertexAttrib4Nuiv, PFNGLVERTEXATTRIB4NUIVPROC, (GLuint index, const GLuint *v), (index, v))
+GLAD_LAZY_VOID(glVertexAttrib4Nusv, PFNGLVERTEXATTRIB4NUSVPROC, (GLuint index, const GLushort *v), (index, v))
+GLAD_LAZY_VOID(glVertexAttrib4bv, PFNGLVERTEXATTRIB4BVPROC, (GLuint index, const GLbyte *v), (index, v))
+GLAD_LAZY_VOID(glVertexAttrib4d, PFNGLVERTEXATTRIB4DPROC, (GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w), (index, x, y, z, w))
+GLAD_LAZY_VOID(glVertexAttrib4dv, PFNGLVERTEXATTRIB4DVPROC, (GLuint index, const GLdouble *v), (index, v))
+GLAD_LAZY_VOID(glVertexAttrib4f, PFNGLVERTEXATTRIB4FPROC, (GLuint index, GLfloat x, GLfloat y, GLfloat z, GLfloat w), (index, x, y, z, w))
+GLAD_LAZY_VOID(glVertexAttrib4fv, PFNGLVERTEXATTRIB4FVPROC, (GLuint index, const GLfloat *v), (index, v))
+GLAD_LAZY_VOID(glVertexAttrib4iv, PFNGLVERTEXATTRIB4IVPROC, (GLuint index, const GLint *v), (index, v))
+GLAD_LAZY_VOID(glVertexAttrib4s, PFNGLVERTEXATTRIB4SPROC, (GLuint index, GLshort x, GLshort y, GLshort z, GLshort w), (index, x, y, z, w))
+GLAD_LAZY_VOID(glVertexAttrib4sv, PFNGLVERTEXATTRIB4SVPROC, (GLuint index, const GLshort *v), (index, v))
+GLAD_LAZY_VOID(glVertexAttrib4ubv, PFNGLVERTEXATTRIB4UBVPROC, (GLuint index, const GLubyte *v), (index, v))
+GLAD_LAZY_VOID(glVertexAttrib4uiv, PFNGLVERTEXATTRIB4UIVPROC, (GLuint index, const GLuint *v), (index, v))
+GLAD_LAZY_VOID(glVertexAttrib4usv, PFNGLVERTEXATTRIB4USVPROC, (GLuint index, const GLushort *v), (index, v))
+GLAD_LAZY_VOID(glVertexAttribBinding, PFNGLVERTEXATTRIBBINDINGPROC, (GLuint attribindex, GLuint bindingindex), (attribindex, bindingindex))
+GLAD_LAZY_VOID(glVertexAttribDivisor, PFNGLVERTEXATTRIBDIVISORPROC, (GLuint index, GLuint divisor), (index, divisor))
+GLAD_LAZY_VOID(glVertexAttribFormat, PFNGLVERTEXATTRIBFORMATPROC, (GLuint attribindex, GLint size, GLenum type, GLboolean normalized, GLuint relativeoffset), (attribindex, size, type, normalized, relativeoffset))
+GLAD_LAZY_VOID(glVertexAttribI1i, PFNGLVERTEXATTRIBI1IPROC, (GLuint index, GLint x), (index, x))
+GLAD_LAZY_VOID(glVertexAttribI1iv, PFNGLVERTEXATTRIBI1IVPROC, (GLuint index, const GLint *v), (index, v))
+GLAD_LAZY_VOID(glVertexAttribI1ui, PFNGLVERTEXATTRIBI1UIPROC, (GLuint index, GLuint x), (index, x))
+GLAD_LAZY_VOID(glVertexAttribI1uiv, PFNGLVERTEXATTRIBI1UIVPROC, (GLuint index, const GLuint *v), (index, v))
+GLAD_LAZY_VOID(glVertexAttribI2i, PFNGLVERTEXATTRIBI2IPROC, (GLuint index, GLint x, GLint y), (index, x, y))
+GLAD_LAZY_VOID(glVertexAttribI2iv, PFNGLVERTEXATTRIBI2IVPROC, (GLuint index, const GLint *v), (index, v))
+GLAD_LAZY_VOID(glVertexAttribI2ui, PFNGLVERTEXATTRIBI2UIPROC, (GLuint index, GLuint x, GLuint y), (index, x, y))
+GLAD_LAZY_VOID(glVertexAttribI2uiv, PFNGLVERTEXATTRIBI2UIVPROC, (GLuint index, const GLuint *v), (index, v))
+GLAD_LAZY_VOID(glVertexAttribI3i, PFNGLVERTEXATTRIBI3IPROC, (GLuint index, GLint x, GLint y, GLint z), (index, x, y, z))
+GLAD_LAZY_VOID(glVertexAttribI3iv, PFNGLVERTEXATTRIBI3IVPROC, (GLuint index, const GLint *v), (index, v))
+GLAD_LAZY_VOID(glVertexAttribI3ui, PFNGLVERTEXATTRIBI3UIPROC, (GLuint index, GLuint x, GLuint y, GLuint z), (index, x, y, z))
+GLAD_LAZY_VOID(glVertexAttribI3uiv, PFNGLVERTEXATTRIBI3UIVPROC, (GLuint index, const GLuint *v), (index, v))
+GLAD_LAZY_VOID(glVertexAttribI4bv, PFNGLVERTEXATTRIBI4BVPROC, (GLuint index, const GLbyte *v), (index, v))
+GLAD_LAZY_VOID(glVertexAttribI4i, PFNGLVERTEXATTRIBI4IPROC, (GLuint index, GLint x, GLint y, GLint z, GLint w), (index, x, y, z, w))
+GLAD_LAZY_VOID(glVertexAttribI4iv, PFNGLVERTEXATTRIBI4IVPROC, (GLuint index, const GLint *v), (index, v))
+GLAD_LAZY_VOID(glVertexAttribI4sv, PFNGLVERTEXATTRIBI4SVPROC, (GLuint index, const GLshort *v), (index, v))
+GLAD_LAZY_VOID(glVertexAttribI4ubv, PFNGLVERTEXATTRIBI4UBVPROC, (GLuint index, const GLubyte *v), (index, v))
+GLAD_LAZY_VOID(glVertexAttribI4ui, PFNGLVERTEXATTRIBI4UIPROC, (GLuint index, GLuint x, GLuint y, GLuint z, GLuint w), (index, x, y, z, w))
+GLAD_LAZY_VOID(glVertexAttribI4uiv, PFNGLVERTEXATTRIBI4UIVPROC, (GLuint index, const GLuint *v), (index, v))
+GLAD_LAZY_VOID(glVertexAttribI4usv, PFNGLVERTEXATTRIBI4USVPROC, (GLuint index, const GLushort *v), (index, v))
+GLAD_LAZY_VOID(glVertexAttribIFormat, PFNGLVERTEXATTRIBIFORMATPROC, (GLuint attribindex, GLint size, GLenum type, GLuint relativeoffset), (attribindex, size, type, relativeoffset))
+GLAD_LAZY_VOID(glVertexAttribIPointer, PFNGLVERTEXATTRIBIPOINTERPROC, (GLuint index, GLint size, GLenum type, GLsizei stride, const void *pointer), (index, size, type, stride, pointer))
+GLAD_LAZY_VOID(glVertexAttribL1d, PFNGLVERTEXATTRIBL1DPROC, (GLuint index, GLdouble x), (index, x))
+GLAD_LAZY_VOID(glVertexAttribL1dv, PFNGLVERTEXATTRIBL1DVPROC, (GLuint index, const GLdouble *v), (index, v))
+GLAD_LAZY_VOID(glVertexAttribL2d, PFNGLVERTEXATTRIBL2DPROC, (GLuint index, GLdouble x, GLdouble y), (index, x, y))
+GLAD_LAZY_VOID(glVertexAttribL2dv, PFNGLVERTEXATTRIBL2DVPROC, (GLuint index, const GLdouble *v), (index, v))
+GLAD_LAZY_VOID(glVertexAttribL3d, PFNGLVERTEXATTRIBL3DPROC, (GLuint index, GLdouble x, GLdouble y, GLdouble z), (index, x, y, z))
+GLAD_LAZY_VOID(glVertexAttribL3dv, PFNGLVERTEXATTRIBL3DVPROC, (GLuint index, const GLdouble *v), (index, v))
+GLAD_LAZY_VOID(glVertexAttribL4d, PFNGLVERTEXATTRIBL4DPROC, (GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w), (index, x, y, z, w))
+GLAD_LAZY_VOID(glVertexAttribL4dv, PFNGLVERTEXATTRIBL4DVPROC, (GLuint index, const GLdouble *v), (index, v))
+GLAD_LAZY_VOID(glVertexAttribLFormat, PFNGLVERTEXATTRIBLFORMATPROC, (GLuint attribindex, GLint size, GLenum type, GLuint relativeoffset), (attribindex, size, type, relativeoffset))
+GLAD_LAZY_VOID(glVertexAttribLPointer, PFNGLVERTEXATTRIBLPOINTERPROC, (GLuint index, GLint size, GLenum type, GLsizei stride, const void *pointer), (index, size, type, stride, pointer))
+GLAD_LAZY_VOID(glVertexAttribP1ui, PFNGLVERTEXATTRIBP1UIPROC, (GLuint index, GLenum type, GLboolean normalized, GLuint value), (index, type, normalized, value))
+GLAD_LAZY_VOID(glVertexAttribP1uiv, PFNGLVERTEXATTRIBP1UIVPROC, (GLuint index, GLenum type, GLboolean normalized, const GLuint *value), (index, type, normalized, value))
+GLAD_LAZY_VOID(glVertexAttribP2ui, PFNGLVERTEXATTRIBP2UIPROC, (GLuint index, GLenum type, GLboolean normalized, GLuint value), (index, type, normalized, value))
+GLAD_LAZY_VOID(glVertexAttribP2uiv, PFNGLVERTEXATTRIBP2UIVPROC, (GLuint index, GLenum type, GLboolean normalized, const GLuint *value), (index, type, normalized, value))
+GLAD_LAZY_VOID(glVertexAttribP3ui, PFNGLVERTEXATTRIBP3UIPROC, (GLuint index, GLenum type, GLboolean normalized, GLuint value), (index, type, normalized, value))
+GLAD_LAZY_VOID(glVertexAttribP3uiv, PFNGLVERTEXATTRIBP3UIVPROC, (GLuint index, GLenum type, GLboolean normalized, const GLuint *value), (index, type, normalized, value))
+GLAD_LAZY_VOID(glVertexAttribP4ui, PFNGLVERTEXATTRIBP4UIPROC, (GLuint index, GLenum type, GLboolean normalized, GLuint value), (index, type, normalized, value))
+GLAD_LAZY_VOID(glVertexAttribP4uiv, PFNGLVERTEXATTRIBP4UIVPROC, (GLuint index, GLenum type, GLboolean normalized, const GLuint *value), (index, type, normalized, value))
+GLAD_LAZY_VOID(glVertexAttribPointer, PFNGLVERTEXATTRIBPOINTERPROC, (GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei stride, const void *pointer), (index, size, type, normalized, stride, pointer))
+GLAD_LAZY_VOID(glVertexBindingDivisor, PFNGLVERTEXBINDINGDIVISORPROC, (GLuint bindingindex, GLuint divisor), (bindingindex, divisor))
+GLAD_LAZY_VOID(glVertexP2ui, PFNGLVERTEXP2UIPROC, (GLenum type, GLuint value), (type, value))
+GLAD_LAZY_VOID(glVertexP2uiv, PFNGLVERTEXP2UIVPROC, (GLenum type, const GLuint *value), (type, value))
+GLAD_LAZY_VOID(glVertexP3ui, PFNGLVERTEXP3UIPROC, (GLenum type, GLuint value), (type, value))
+GLAD_LAZY_VOID(glVertexP3uiv, PFNGLVERTEXP3UIVPROC, (GLenum type, const GLuint *value), (type, value))
+GLAD_LAZY_VOID(glVertexP4ui, PFNGLVERTEXP4UIPROC, (GLenum type, GLuint value), (type, value))
+GLAD_LAZY_VOID(glVertexP4uiv, PFNGLVERTEXP4UIVPROC, (GLenum type, const GLuint *value), (type, value))
+GLAD_LAZY_VOID(glVertexPointer, PFNGLVERTEXPOINTERPROC, (GLint size, GLenum type, GLsizei stride, const void *pointer), (size, type, stride, pointer))
+GLAD_LAZY_VOID(glViewport, PFNGLVIEWPORTPROC, (GLint x, GLint y, GLsizei width, GLsizei height), (x, y, width, height))
+GLAD_LAZY_VOID(glViewportArrayv, PFNGLVIEWPORTARRAYVPROC, (GLuint first, GLsizei count, const GLfloat *v), (first, count, v))
+GLAD_LAZY_VOID(glViewportIndexedf, PFNGLVIEWPORTINDEXEDFPROC, (GLuint index, GLfloat x, GLfloat y, GLfloat w, GLfloat h), (index, x, y, w, h))
+GLAD_LAZY_VOID(glViewportIndexedfv, PFNGLVIEWPORTINDEXEDFVPROC, (GLuint index, const GLfloat *v), (index, v))
+GLAD_LAZY_VOID(glWaitSync, PFNGLWAITSYNCPROC, (GLsync sync, GLbitfield flags, GLuint64 timeout), (sync, flags, timeout))
+GLAD_LAZY_VOID(glWindowPos2d, PFNGLWINDOWPOS2DPROC, (GLdouble x, GLdouble y), (x, y))
+GLAD_LAZY_VOID(glWindowPos2dv, PFNGLWINDOWPOS2DVPROC, (const GLdouble *v), (v))
+GLAD_LAZY_VOID(glWindowPos2f, PFNGLWINDOWPOS2FPROC, (GLfloat x, GLfloat y), (x, y))
+GLAD_LAZY_VOID(glWindowPos2fv, PFNGLWINDOWPOS2FVPROC, (const GLfloat *v), (v))
+GLAD_LAZY_VOID(glWindowPos2i, PFNGLWINDOWPOS2IPROC, (GLint x, GLint y), (x, y))
+GLAD_LAZY_VOID(glWindowPos2iv, PFNGLWINDOWPOS2IVPROC, (const GLint *v), (v))
+GLAD_LAZY_VOID(glWindowPos2s, PFNGLWINDOWPOS2SPROC, (GLshort x, GLshort y), (x, y))
+GLAD_LAZY_VOID(glWindowPos2sv, PFNGLWINDOWPOS2SVPROC, (const GLshort *v), (v))
+GLAD_LAZY_VOID(glWindowPos3d, PFNGLWINDOWPOS3DPROC, (GLdouble x, GLdouble y, GLdouble z), (x, y, z))
+GLAD_LAZY_VOID(glWindowPos3dv, PFNGLWINDOWPOS3DVPROC, (const GLdouble *v), (v))
+GLAD_LAZY_VOID(glWindowPos3f, PFNGLWINDOWPOS3FPROC, (GLfloat x, GLfloat y, GLfloat z), (x, y, z))
+GLAD_LAZY_VOID(glWindowPos3fv, PFNGLWINDOWPOS3FVPROC, (const GLfloat *v), (v))
+GLAD_LAZY_VOID(glWindowPos3i, PFNGLWINDOWPOS3IPROC, (GLint x, GLint y, GLint z), (x, y, z))
+GLAD_LAZY_VOID(glWindowPos3iv, PFNGLWINDOWPOS3IVPROC, (const GLint *v), (v))
+GLAD_LAZY_VOID(glWindowPos3s, PFNGLWINDOWPOS3SPROC, (GLshort x, GLshort y, GLshort z), (x, y, z))
+GLAD_LAZY_VOID(glWindowPos3sv, PFNGLWINDOWPOS3SVPROC, (const GLshort *v), (v))
+
+void glad_install_lazy_GL(GLADloadproc load) {
+    glad_lazy_load = load;
+    if(GLAD_GL_VERSION_1_0) {
+        glad_glCullFace = glad_lazy_glCullFace;
+        glad_glFrontFace = glad_lazy_glFrontFace;
+        glad_glHint = glad_lazy_glHint;
+        glad_glLineWidth = glad_lazy_glLineWidth;
+        glad_glPointSize = glad_lazy_glPointSize;
+        glad_glPolygonMode = glad_lazy_glPolygonMode;
+        glad_glScissor = glad_lazy_glScissor;
+        glad_glTexParameterf = glad_lazy_glTexParameterf;
+        glad_glTexParameterfv = glad_lazy_glTexParameterfv;
+        glad_glTexParameteri = glad_lazy_glTexParameteri;
+        glad_glTexParameteriv = glad_lazy_glTexParameteriv;
+        glad_glTexImage1D = glad_lazy_glTexImage1D;
+        glad_glTexImage2D = glad_lazy_glTexImage2D;
+        glad_glDrawBuffer = glad_lazy_glDrawBuffer;
+        glad_glClear = glad_lazy_glClear;
+        glad_glClearColor = glad_lazy_glClearColor;
+        glad_glClearStencil = glad_lazy_glClearStencil;
+        glad_glClearDepth = glad_lazy_glClearDepth;
+        glad_glStencilMask = glad_lazy_glStencilMask;
+        glad_glColorMask = glad_lazy_glColorMask;
+        glad_glDepthMask = glad_lazy_glDepthMask;
+        glad_glDisable = glad_lazy_glDisable;
+        glad_glEnable = glad_lazy_glEnable;
+        glad_glFinish = glad_lazy_glFinish;
+        glad_glFlush = glad_lazy_glFlush;
+        glad_glBlendFunc = glad_lazy_glBlendFunc;
+        glad_glLogicOp = glad_lazy_glLogicOp;
+        glad_glStencilFunc = glad_lazy_glStencilFunc;
+        glad_glStencilOp = glad_lazy_glStencilOp;
+        glad_glDepthFunc = glad_lazy_glDepthFunc;
+        glad_glPixelStoref = glad_lazy_glPixelStoref;
+        glad_glPixelStorei = glad_lazy_glPixelStorei;
+        glad_glReadBuffer = glad_lazy_glReadBuffer;
+        glad_glReadPixels = glad_lazy_glReadPixels;
+        glad_glGetBooleanv = glad_lazy_glGetBooleanv;
+        glad_glGetDoublev = glad_lazy_glGetDoublev;
+        glad_glGetError = glad_lazy_glGetError;
+        glad_glGetFloatv = glad_lazy_glGetFloatv;
+        glad_glGetIntegerv = glad_lazy_glGetIntegerv;
+        glad_glGetTexImage = glad_lazy_glGetTexImage;
+        glad_glGetTexParameterfv = glad_lazy_glGetTexParameterfv;
+        glad_glGetTexParameteriv = glad_lazy_glGetTexParameteriv;
+        glad_glGetTexLevelParameterfv = glad_lazy_glGetTexLevelParameterfv;
+        glad_glGetTexLevelParameteriv = glad_lazy_glGetTexLevelParameteriv;
+        glad_glIsEnabled = glad_lazy_glIsEnabled;
+        glad_glDepthRange = glad_lazy_glDepthRange;
+        glad_glViewport = glad_lazy_glViewport;
+        glad_glNewList = glad_lazy_glNewList;
+        glad_glEndList = glad_lazy_glEndList;
+        glad_glCallList = glad_lazy_glCallList;
+        glad_glCallLists = glad_lazy_glCallLists;
+        glad_glDeleteLists = glad_lazy_glDeleteLists;
+        glad_glGenLists = glad_lazy_glGenLists;
+        glad_glListBase = glad_lazy_glListBase;
+        glad_glBegin = glad_lazy_glBegin;
+        glad_glBitmap = glad_lazy_glBitmap;
+        glad_glColor3b = glad_lazy_glColor3b;
+        glad_glColor3bv = glad_lazy_glColor3bv;
+        glad_glColor3d = glad_lazy_glColor3d;
+        glad_glColor3dv = glad_lazy_glColor3dv;
+        glad_glColor3f = glad_lazy_glColor3f;
+        glad_glColor3fv = glad_lazy_glColor3fv;
+        glad_glColor3i = glad_lazy_glColor3i;
+        glad_glColor3iv = glad_lazy_glColor3iv;
+        glad_glColor3s = glad_lazy_glColor3s;
+        glad_glColor3sv = glad_lazy_glColor3sv;
+        glad_glColor3ub = glad_lazy_glColor3ub;
+        glad_glColor3ubv = glad_lazy_glColor3ubv;
+        glad_glColor3ui = glad_lazy_glColor3ui;
+        glad_glColor3uiv = glad_lazy_glColor3uiv;
+        glad_glColor3us = glad_lazy_glColor3us;
+        glad_glColor3usv = glad_lazy_glColor3usv;
+        glad_glColor4b = glad_lazy_glColor4b;
+        glad_glColor4bv = glad_lazy_glColor4bv;
+        glad_glColor4d = glad_lazy_glColor4d;
+        glad_glColor4dv = glad_lazy_glColor4dv;
+        glad_glColor4f = glad_lazy_glColor4f;
+        glad_glColor4fv = glad_lazy_glColor4fv;
+        glad_glColor4i = glad_lazy_glColor4i;
+        glad_glColor4iv = glad_lazy_glColor4iv;
+        glad_glColor4s = glad_lazy_glColor4s;
+        glad_glColor4sv = glad_lazy_glColor4sv;
+        glad_glColor4ub = glad_lazy_glColor4ub;
+        glad_glColor4ubv = glad_lazy_glColor4ubv;
+        glad_glColor4ui = glad_lazy_glColor4ui;
+        glad_glColor4uiv = glad_lazy_glColor4uiv;
+        glad_glColor4us = glad_lazy_glColor4us;
+        glad_glColor4usv = glad_lazy_glColor4usv;
+        glad_glEdgeFlag = glad_lazy_glEdgeFlag;
+        glad_glEdgeFlagv = glad_lazy_glEdgeFlagv;
+        glad_glEnd = glad_lazy_glEnd;
+        glad_glIndexd = glad_lazy_glIndexd;
+        glad_glIndexdv = glad_lazy_glIndexdv;
+        glad_glIndexf = glad_lazy_glIndexf;
+        glad_glIndexfv = glad_lazy_glIndexfv;
+        glad_glIndexi = glad_lazy_glIndexi;
+        glad_glIndexiv = glad_lazy_glIndexiv;
+        glad_glIndexs = glad_lazy_glIndexs;
+        glad_glIndexsv = glad_lazy_glIndexsv;
+        glad_glNormal3b = glad_lazy_glNormal3b;
+        glad_glNormal3bv = glad_lazy_glNormal3bv;
+        glad_glNormal3d = glad_lazy_glNormal3d;
+        glad_glNormal3dv = glad_lazy_glNormal3dv;
+        glad_glNormal3f = glad_lazy_glNormal3f;
+        glad_glNormal3fv = glad_lazy_glNormal3fv;
+        glad_glNormal3i = glad_lazy_glNormal3i;
+        glad_glNormal3iv = glad_lazy_glNormal3iv;
+        glad_glNormal3s = glad_lazy_glNormal3s;
+        glad_glNormal3sv = glad_lazy_glNormal3sv;
+        glad_glRasterPos2d = glad_lazy_glRasterPos2d;
+        glad_glRasterPos2dv = glad_lazy_glRasterPos2dv;
+        glad_glRasterPos2f = glad_lazy_glRasterPos2f;
+        glad_glRasterPos2fv = glad_lazy_glRasterPos2fv;
+        glad_glRasterPos2i = glad_lazy_glRasterPos2i;
+        glad_glRasterPos2iv = glad_lazy_glRasterPos2iv;
+        glad_glRasterPos2s = glad_lazy_glRasterPos2s;
+        glad_glRasterPos2sv = glad_lazy_glRasterPos2sv;
+        glad_glRasterPos3d = glad_lazy_glRasterPos3d;
+        glad_glRasterPos3dv = glad_lazy_glRasterPos3dv;
+        glad_glRasterPos3f = glad_lazy_glRasterPos3f;
+        glad_glRasterPos3fv = glad_lazy_glRasterPos3fv;
+        glad_glRasterPos3i = glad_lazy_glRasterPos3i;
+        glad_glRasterPos3iv = glad_lazy_glRasterPos3iv;
+        glad_glRasterPos3s = glad_lazy_glRasterPos3s;
+        glad_glRasterPos3sv = glad_lazy_glRasterPos3sv;
+        glad_glRasterPos4d = glad_lazy_glRasterPos4d;
+        glad_glRasterPos4dv = glad_lazy_glRasterPos4dv;
+        glad_glRasterPos4f = glad_lazy_glRasterPos4f;
+        glad_glRasterPos4fv = glad_lazy_glRasterPos4fv;
+        glad_glRasterPos4i = glad_lazy_glRasterPos4i;
+        glad_glRasterPos4iv = glad_lazy_glRasterPos4iv;
+        glad_glRasterPos4s = glad_lazy_glRasterPos4s;
+        glad_glRasterPos4sv = glad_lazy_glRasterPos4sv;
+        glad_glRectd = glad_lazy_glRectd;
+        glad_glRectdv = glad_lazy_glRectdv;
+        glad_glRectf = glad_lazy_glRectf;
+        glad_glRectfv = glad_lazy_glRectfv;
+        glad_glRecti = glad_lazy_glRecti;
+        glad_glRectiv = glad_lazy_glRectiv;
+        glad_glRects = glad_lazy_glRects;
+        glad_glRectsv = glad_lazy_glRectsv;
+        glad_glTexCoord1d = glad_lazy_glTexCoord1d;
+        glad_glTexCoord1dv = glad_lazy_glTexCoord1dv;
+        glad_glTexCoord1f = glad_lazy_glTexCoord1f;
+        glad_glTexCoord1fv = glad_lazy_glTexCoord1fv;
+        glad_glTexCoord1i = glad_lazy_glTexCoord1i;
+        glad_glTexCoord1iv = glad_lazy_glTexCoord1iv;
+        glad_glTexCoord1s = glad_lazy_glTexCoord1s;
+        glad_glTexCoord1sv = glad_lazy_glTexCoord1sv;
+        glad_glTexCoord2d = glad_lazy_glTexCoord2d;
+        glad_glTexCoord2dv = glad_lazy_glTexCoord2dv;
+        glad_glTexCoord2f = glad_lazy_glTexCoord2f;
+        glad_glTexCoord2fv = glad_lazy_glTexCoord2fv;
+        glad_glTexCoord2i = glad_lazy_glTexCoord2i;
+        glad_glTexCoord2iv = glad_lazy_glTexCoord2iv;
+        glad_glTexCoord2s = glad_lazy_glTexCoord2s;
+        glad_glTexCoord2sv = glad_lazy_glTexCoord2sv;
+        glad_glTexCoord3d = glad_lazy_glTexCoord3d;
+        glad_glTexCoord3dv = glad_lazy_glTexCoord3dv;
+        glad_glTexCoord3f = glad_lazy_glTexCoord3f;
+        glad_glTexCoord3fv = glad_lazy_glTexCoord3fv;
+        glad_glTexCoord3i = glad_lazy_glTexCoord3i;
+        glad_glTexCoord3iv = glad_lazy_glTexCoord3iv;
+        glad_glTexCoord3s = glad_lazy_glTexCoord3s;
+        glad_glTexCoord3sv = glad_lazy_glTexCoord3sv;
+        glad_glTexCoord4d = glad_lazy_glTexCoord4d;
+        glad_glTexCoord4dv = glad_lazy_glTexCoord4dv;
+        glad_glTexCoord4f = glad_lazy_glTexCoord4f;
+        glad_glTexCoord4fv = glad_lazy_glTexCoord4fv;
+        glad_glTexCoord4i = glad_lazy_glTexCoord4i;
+        glad_glTexCoord4iv = glad_lazy_glTexCoord4iv;
+        glad_glTexCoord4s = glad_lazy_glTexCoord4s;
+        glad_glTexCoord4sv = glad_lazy_glTexCoord4sv;
+        glad_glVertex2d = glad_lazy_glVertex2d;
+        glad_glVertex2dv = glad_lazy_glVertex2dv;
+        glad_glVertex2f = glad_lazy_glVertex2f;
+        glad_glVertex2fv = glad_lazy_glVertex2fv;
+        glad_glVertex2i = glad_lazy_glVertex2i;
+        glad_glVertex2iv = glad_lazy_glVertex2iv;
+        glad_glVertex2s = glad_lazy_glVertex2s;
+        glad_glVertex2sv = glad_lazy_glVertex2sv;
+        glad_glVertex3d = glad_lazy_glVertex3d;
+        glad_glVertex3dv = glad_lazy_glVertex3dv;
+        glad_glVertex3f = glad_lazy_glVertex3f;
+        glad_glVertex3fv = glad_lazy_glVertex3fv;
+        glad_glVertex3i = glad_lazy_glVertex3i;
+        glad_glVertex3iv = glad_lazy_glVertex3iv;
+        glad_glVertex3s = glad_lazy_glVertex3s;
+        glad_glVertex3sv = glad_lazy_glVertex3sv;
+        glad_glVertex4d = glad_lazy_glVertex4d;
+        glad_glVertex4dv = glad_lazy_glVertex4dv;
+        glad_glVertex4f = glad_lazy_glVertex4f;
+        glad_glVertex4fv = glad_lazy_glVertex4fv;
+        glad_glVertex4i = glad_lazy_glVertex4i;
+        glad_glVertex4iv = glad_lazy_glVertex4iv;
+        glad_glVertex4s = glad_lazy_glVertex4s;
+        glad_glVertex4sv = glad_lazy_glVertex4sv;
+        glad_glClipPlane = glad_lazy_glClipPlane;
+        glad_glColorMaterial = glad_lazy_glColorMaterial;
+        glad_glFogf = glad_lazy_glFogf;
+        glad_glFogfv = glad_lazy_glFogfv;
+        glad_glFogi = glad_lazy_glFogi;
+        glad_glFogiv = glad_lazy_glFogiv;
+        glad_glLightf = glad_lazy_glLightf;
+        glad_glLightfv = glad_lazy_glLightfv;
+        glad_glLighti = glad_lazy_glLighti;
+        glad_glLightiv = glad_lazy_glLightiv;
+        glad_glLightModelf = glad_lazy_glLightModelf;
+        glad_glLightModelfv = glad_lazy_glLightModelfv;
+        glad_glLightModeli = glad_lazy_glLightModeli;
+        glad_glLightModeliv = glad_lazy_glLightModeliv;
+        glad_glLineStipple = glad_lazy_glLineStipple;
+        glad_glMaterialf = glad_lazy_glMaterialf;
+        glad_glMaterialfv = glad_lazy_glMaterialfv;
+        glad_glMateriali = glad_lazy_glMateriali;
+        glad_glMaterialiv = glad_lazy_glMaterialiv;
+        glad_glPolygonStipple = glad_lazy_glPolygonStipple;
+        glad_glShadeModel = glad_lazy_glShadeModel;
+        glad_glTexEnvf = glad_lazy_glTexEnvf;
+        glad_glTexEnvfv = glad_lazy_glTexEnvfv;
+        glad_glTexEnvi = glad_lazy_glTexEnvi;
+        glad_glTexEnviv = glad_lazy_glTexEnviv;
+        glad_glTexGend = glad_lazy_glTexGend;
+        glad_glTexGendv = glad_lazy_glTexGendv;
+        glad_glTexGenf = glad_lazy_glTexGenf;
+        glad_glTexGenfv = glad_lazy_glTexGenfv;
+        glad_glTexGeni = glad_lazy_glTexGeni;
+        glad_glTexGeniv = glad_lazy_glTexGeniv;
+        glad_glFeedbackBuffer = glad_lazy_glFeedbackBuffer;
+        glad_glSelectBuffer = glad_lazy_glSelectBuffer;
+        glad_glRenderMode = glad_lazy_glRenderMode;
+        glad_glInitNames = glad_lazy_glInitNames;
+        glad_glLoadName = glad_lazy_glLoadName;
+        glad_glPassThrough = glad_lazy_glPassThrough;
+        glad_glPopName = glad_lazy_glPopName;
+        glad_glPushName = glad_lazy_glPushName;
+        glad_glClearAccum = glad_lazy_glClearAccum;
+        glad_glClearIndex = glad_lazy_glClearIndex;
+        glad_glIndexMask = glad_lazy_glIndexMask;
+        glad_glAccum = glad_lazy_glAccum;
+        glad_glPopAttrib = glad_lazy_glPopAttrib;
+        glad_glPushAttrib = glad_lazy_glPushAttrib;
+        glad_glMap1d = glad_lazy_glMap1d;
+        glad_glMap1f = glad_lazy_glMap1f;
+        glad_glMap2d = glad_lazy_glMap2d;
+        glad_glMap2f = glad_lazy_glMap2f;
+        glad_glMapGrid1d = glad_lazy_glMapGrid1d;
+        glad_glMapGrid1f = glad_lazy_glMapGrid1f;
+        glad_glMapGrid2d = glad_lazy_glMapGrid2d;
+        glad_glMapGrid2f = glad_lazy_glMapGrid2f;
+        glad_glEvalCoord1d = glad_lazy_glEvalCoord1d;
+        glad_glEvalCoord1dv = glad_lazy_glEvalCoord1dv;
+        glad_glEvalCoord1f = glad_lazy_glEvalCoord1f;
+        glad_glEvalCoord1fv = glad_lazy_glEvalCoord1fv;
+        glad_glEvalCoord2d = glad_lazy_glEvalCoord2d;
+        glad_glEvalCoord2dv = glad_lazy_glEvalCoord2dv;
+        glad_glEvalCoord2f = glad_lazy_glEvalCoord2f;
+        glad_glEvalCoord2fv = glad_lazy_glEvalCoord2fv;
+        glad_glEvalMesh1 = glad_lazy_glEvalMesh1;
+        glad_glEvalPoint1 = glad_lazy_glEvalPoint1;
+        glad_glEvalMesh2 = glad_lazy_glEvalMesh2;
+        glad_glEvalPoint2 = glad_lazy_glEvalPoint2;
+        glad_glAlphaFunc = glad_lazy_glAlphaFunc;
+        glad_glPixelZoom = glad_lazy_glPixelZoom;
+        glad_glPixelTransferf = glad_lazy_glPixelTransferf;
+        glad_glPixelTransferi = glad_lazy_glPixelTransferi;
+        glad_glPixelMapfv = glad_lazy_glPixelMapfv;
+        glad_glPixelMapuiv = glad_lazy_glPixelMapuiv;
+        glad_glPixelMapusv = glad_lazy_glPixelMapusv;
+        glad_glCopyPixels = glad_lazy_glCopyPixels;
+        glad_glDrawPixels = glad_lazy_glDrawPixels;
+        glad_glGetClipPlane = glad_lazy_glGetClipPlane;
+        glad_glGetLightfv = glad_lazy_glGetLightfv;
+        glad_glGetLightiv = glad_lazy_glGetLightiv;
+        glad_glGetMapdv = glad_lazy_glGetMapdv;
+        glad_glGetMapfv = glad_lazy_glGetMapfv;
+        glad_glGetMapiv = glad_lazy_glGetMapiv;
+        glad_glGetMaterialfv = glad_lazy_glGetMaterialfv;
+        glad_glGetMaterialiv = glad_lazy_glGetMaterialiv;
+        glad_glGetPixelMapfv = glad_lazy_glGetPixelMapfv;
+        glad_glGetPixelMapuiv = glad_lazy_glGetPixelMapuiv;
+        glad_glGetPixelMapusv = glad_lazy_glGetPixelMapusv;
+        glad_glGetPolygonStipple = glad_lazy_glGetPolygonStipple;
+        glad_glGetTexEnvfv = glad_lazy_glGetTexEnvfv;
+        glad_glGetTexEnviv = glad_lazy_glGetTexEnviv;
+        glad_glGetTexGendv = glad_lazy_glGetTexGendv;
+        glad_glGetTexGenfv = glad_lazy_glGetTexGenfv;
+        glad_glGetTexGeniv = glad_lazy_glGetTexGeniv;
+        glad_glIsList = glad_lazy_glIsList;
+        glad_glFrustum = glad_lazy_glFrustum;
+        glad_glLoadIdentity = glad_lazy_glLoadIdentity;
+        glad_glLoadMatrixf = glad_lazy_glLoadMatrixf;
+        glad_glLoadMatrixd = glad_lazy_glLoadMatrixd;
+        glad_glMatrixMode = glad_lazy_glMatrixMode;
+        glad_glMultMatrixf = glad_lazy_glMultMatrixf;
+        glad_glMultMatrixd = glad_lazy_glMultMatrixd;
+        glad_glOrtho = glad_lazy_glOrtho;
+        glad_glPopMatrix = glad_lazy_glPopMatrix;
+        glad_glPushMatrix = glad_lazy_glPushMatrix;
+        glad_glRotated = glad_lazy_glRotated;
+        glad_glRotatef = glad_lazy_glRotatef;
+        glad_glScaled = glad_lazy_glScaled;
+        glad_glScalef = glad_lazy_glScalef;
+        glad_glTranslated = glad_lazy_glTranslated;
+        glad_glTranslatef = glad_lazy_glTranslatef;
+    }
+    if(GLAD_GL_VERSION_1_1) {
+        glad_glDrawArrays = glad_lazy_glDrawArrays;
+        glad_glDrawElements = glad_lazy_glDrawElements;
+        glad_glGetPointerv = glad_lazy_glGetPointerv;
+        glad_glPolygonOffset = glad_lazy_glPolygonOffset;
+        glad_glCopyTexImage1D = glad_lazy_glCopyTexImage1D;
+        glad_glCopyTexImage2D = glad_lazy_glCopyTexImage2D;
+        glad_glCopyTexSubImage1D = glad_lazy_glCopyTexSubImage1D;
+        glad_glCopyTexSubImage2D = glad_lazy_glCopyTexSubImage2D;
+        glad_glTexSubImage1D = glad_lazy_glTexSubImage1D;
+        glad_glTexSubImage2D = glad_lazy_glTexSubImage2D;
+        glad_glBindTexture = glad_lazy_glBindTexture;
+        glad_glDeleteTextures = glad_lazy_glDeleteTextures;
+        glad_glGenTextures = glad_lazy_glGenTextures;
+        glad_glIsTexture = glad_lazy_glIsTexture;
+        glad_glArrayElement = glad_lazy_glArrayElement;
+        glad_glColorPointer = glad_lazy_glColorPointer;
+        glad_glDisableClientState = glad_lazy_glDisableClientState;
+        glad_glEdgeFlagPointer = glad_lazy_glEdgeFlagPointer;
+        glad_glEnableClientState = glad_lazy_glEnableClientState;
+        glad_glIndexPointer = glad_lazy_glIndexPointer;
+        glad_glInterleavedArrays = glad_lazy_glInterleavedArrays;
+        glad_glNormalPointer = glad_lazy_glNormalPointer;
+        glad_glTexCoordPointer = glad_lazy_glTexCoordPointer;
+        glad_glVertexPointer = glad_lazy_glVertexPointer;
+        glad_glAreTexturesResident = glad_lazy_glAreTexturesResident;
+        glad_glPrioritizeTextures = glad_lazy_glPrioritizeTextures;
+        glad_glIndexub = glad_lazy_glIndexub;
+        glad_glIndexubv = glad_lazy_glIndexubv;
+        glad_glPopClientAttrib = glad_lazy_glPopClientAttrib;
+        glad_glPushClientAttrib = glad_lazy_glPushClientAttrib;
+    }
+    if(GLAD_GL_VERSION_1_2) {
+        glad_glDrawRangeElements = glad_lazy_glDrawRangeElements;
+        glad_glTexImage3D = glad_lazy_glTexImage3D;
+        glad_glTexSubImage3D = glad_lazy_glTexSubImage3D;
+        glad_glCopyTexSubImage3D = glad_lazy_glCopyTexSubImage3D;
+    }
+    if(GLAD_GL_VERSION_1_3) {
+        glad_glActiveTexture = glad_lazy_glActiveTexture;
+        glad_glSampleCoverage = glad_lazy_glSampleCoverage;
+        glad_glCompressedTexImage3D = glad_lazy_glCompressedTexImage3D;
+        glad_glCompressedTexImage2D = glad_lazy_glCompressedTexImage2D;
+        glad_glCompressedTexImage1D = glad_lazy_glCompressedTexImage1D;
+        glad_glCompressedTexSubImage3D = glad_lazy_glCompressedTexSubImage3D;
+        glad_glCompressedTexSubImage2D = glad_lazy_glCompressedTexSubImage2D;
+        glad_glCompressedTexSubImage1D = glad_lazy_glCompressedTexSubImage1D;
+        glad_glGetCompressedTexImage = glad_lazy_glGetCompressedTexImage;
+        glad_glClientActiveTexture = glad_lazy_glClientActiveTexture;
+        glad_glMultiTexCoord1d = glad_lazy_glMultiTexCoord1d;
+        glad_glMultiTexCoord1dv = glad_lazy_glMultiTexCoord1dv;
+        glad_glMultiTexCoord1f = glad_lazy_glMultiTexCoord1f;
+        glad_glMultiTexCoord1fv = glad_lazy_glMultiTexCoord1fv;
+        glad_glMultiTexCoord1i = glad_lazy_glMultiTexCoord1i;
+        glad_glMultiTexCoord1iv = glad_lazy_glMultiTexCoord1iv;
+        glad_glMultiTexCoord1s = glad_lazy_glMultiTexCoord1s;
+        glad_glMultiTexCoord1sv = glad_lazy_glMultiTexCoord1sv;
+        glad_glMultiTexCoord2d = glad_lazy_glMultiTexCoord2d;
+        glad_glMultiTexCoord2dv = glad_lazy_glMultiTexCoord2dv;
+        glad_glMultiTexCoord2f = glad_lazy_glMultiTexCoord2f;
+        glad_glMultiTexCoord2fv = glad_lazy_glMultiTexCoord2fv;
+        glad_glMultiTexCoord2i = glad_lazy_glMultiTexCoord2i;
+        glad_glMultiTexCoord2iv = glad_lazy_glMultiTexCoord2iv;
+        glad_glMultiTexCoord2s = glad_lazy_glMultiTexCoord2s;
+        glad_glMultiTexCoord2sv = glad_lazy_glMultiTexCoord2sv;
+        glad_glMultiTexCoord3d = glad_lazy_glMultiTexCoord3d;
+        glad_glMultiTexCoord3dv = glad_lazy_glMultiTexCoord3dv;
+        glad_glMultiTexCoord3f = glad_lazy_glMultiTexCoord3f;
+        glad_glMultiTexCoord3fv = glad_lazy_glMultiTexCoord3fv;
+        glad_glMultiTexCoord3i = glad_lazy_glMultiTexCoord3i;
+        glad_glMultiTexCoord3iv = glad_lazy_glMultiTexCoord3iv;
+        glad_glMultiTexCoord3s = glad_lazy_glMultiTexCoord3s;
+        glad_glMultiTexCoord3sv = glad_lazy_glMultiTexCoord3sv;
+        glad_glMultiTexCoord4d = glad_lazy_glMultiTexCoord4d;
+        glad_glMultiTexCoord4dv = glad_lazy_glMultiTexCoord4dv;
+        glad_glMultiTexCoord4f = glad_lazy_glMultiTexCoord4f;
+        glad_glMultiTexCoord4fv = glad_lazy_glMultiTexCoord4fv;
+        glad_glMultiTexCoord4i = glad_lazy_glMultiTexCoord4i;
+        glad_glMultiTexCoord4iv = glad_lazy_glMultiTexCoord4iv;
+        glad_glMultiTexCoord4s = glad_lazy_glMultiTexCoord4s;
+        glad_glMultiTexCoord4sv = glad_lazy_glMultiTexCoord4sv;
+        glad_glLoadTransposeMatrixf = glad_lazy_glLoadTransposeMatrixf;
+        glad_glLoadTransposeMatrixd = glad_lazy_glLoadTransposeMatrixd;
+        glad_glMultTransposeMatrixf = glad_lazy_glMultTransposeMatrixf;
+        glad_glMultTransposeMatrixd = glad_lazy_glMultTransposeMatrixd;
+    }
+    if(GLAD_GL_VERSION_1_4) {
+        glad_glBlendFuncSeparate = glad_lazy_glBlendFuncSeparate;
+        glad_glMultiDrawArrays = glad_lazy_glMultiDrawArrays;
+        glad_glMultiDrawElements = glad_lazy_glMultiDrawElements;
+        glad_glPointParameterf = glad_lazy_glPointParameterf;
+        glad_glPointParameterfv = glad_lazy_glPointParameterfv;
+        glad_glPointParameteri = glad_lazy_glPointParameteri;
+        glad_glPointParameteriv = glad_lazy_glPointParameteriv;
+        glad_glFogCoordf = glad_lazy_glFogCoordf;
+        glad_glFogCoordfv = glad_lazy_glFogCoordfv;
+        glad_glFogCoordd = glad_lazy_glFogCoordd;
+        glad_glFogCoorddv = glad_lazy_glFogCoorddv;
+        glad_glFogCoordPointer = glad_lazy_glFogCoordPointer;
+        glad_glSecondaryColor3b = glad_lazy_glSecondaryColor3b;
+        glad_glSecondaryColor3bv = glad_lazy_glSecondaryColor3bv;
+        glad_glSecondaryColor3d = glad_lazy_glSecondaryColor3d;
+        glad_glSecondaryColor3dv = glad_lazy_glSecondaryColor3dv;
+        glad_glSecondaryColor3f = glad_lazy_glSecondaryColor3f;
+        glad_glSecondaryColor3fv = glad_lazy_glSecondaryColor3fv;
+        glad_glSecondaryColor3i = glad_lazy_glSecondaryColor3i;
+        glad_glSecondaryColor3iv = glad_lazy_glSecondaryColor3iv;
+        glad_glSecondaryColor3s = glad_lazy_glSecondaryColor3s;
+        glad_glSecondaryColor3sv = glad_lazy_glSecondaryColor3sv;
+        glad_glSecondaryColor3ub = glad_lazy_glSecondaryColor3ub;
+        glad_glSecondaryColor3ubv = glad_lazy_glSecondaryColor3ubv;
+        glad_glSecondaryColor3ui = glad_lazy_glSecondaryColor3ui;
+        glad_glSecondaryColor3uiv = glad_lazy_glSecondaryColor3uiv;
+        glad_glSecondaryColor3us = glad_lazy_glSecondaryColor3us;
+        glad_glSecondaryColor3usv = glad_lazy_glSecondaryColor3usv;
+        glad_glSecondaryColorPointer = glad_lazy_glSecondaryColorPointer;
+        glad_glWindowPos2d = glad_lazy_glWindowPos2d;
+        glad_glWindowPos2dv = glad_lazy_glWindowPos2dv;
+        glad_glWindowPos2f = glad_lazy_glWindowPos2f;
+        glad_glWindowPos2fv = glad_lazy_glWindowPos2fv;
+        glad_glWindowPos2i = glad_lazy_glWindowPos2i;
+        glad_glWindowPos2iv = glad_lazy_glWindowPos2iv;
+        glad_glWindowPos2s = glad_lazy_glWindowPos2s;
+        glad_glWindowPos2sv = glad_lazy_glWindowPos2sv;
+        glad_glWindowPos3d = glad_lazy_glWindowPos3d;
+        glad_glWindowPos3dv = glad_lazy_glWindowPos3dv;
+        glad_glWindowPos3f = glad_lazy_glWindowPos3f;
+        glad_glWindowPos3fv = glad_lazy_glWindowPos3fv;
+        glad_glWindowPos3i = glad_lazy_glWindowPos3i;
+        glad_glWindowPos3iv = glad_lazy_glWindowPos3iv;
+        glad_glWindowPos3s = glad_lazy_glWindowPos3s;
+        glad_glWindowPos3sv = glad_lazy_glWindowPos3sv;
+        glad_glBlendColor = glad_lazy_glBlendColor;
+        glad_glBlendEquation = glad_lazy_glBlendEquation;
+    }
+    if(GLAD_GL_VERSION_1_5) {
+        glad_glGenQueries = glad_lazy_glGenQueries;
+        glad_glDeleteQueries = glad_lazy_glDeleteQueries;
+        glad_glIsQuery = glad_lazy_glIsQuery;
+        glad_glBeginQuery = glad_lazy_glBeginQuery;
+        glad_glEndQuery = glad_lazy_glEndQuery;
+        glad_glGetQueryiv = glad_lazy_glGetQueryiv;
+        glad_glGetQueryObjectiv = glad_lazy_glGetQueryObjectiv;
+        glad_glGetQueryObjectuiv = glad_lazy_glGetQueryObjectuiv;
+        glad_glBindBuffer = glad_lazy_glBindBuffer;
+        glad_glDeleteBuffers = glad_lazy_glDeleteBuffers;
+        glad_glGenBuffers = glad_lazy_glGenBuffers;
+        glad_glIsBuffer = glad_lazy_glIsBuffer;
+        glad_glBufferData = glad_lazy_glBufferData;
+        glad_glBufferSubData = glad_lazy_glBufferSubData;
+        glad_glGetBufferSubData = glad_lazy_glGetBufferSubData;
+        glad_glMapBuffer = glad_lazy_glMapBuffer;
+        glad_glUnmapBuffer = glad_lazy_glUnmapBuffer;
+        glad_glGetBufferParameteriv = glad_lazy_glGetBufferParameteriv;
+        glad_glGetBufferPointerv = glad_lazy_glGetBufferPointerv;
+    }
+    if(GLAD_GL_VERSION_2_0) {
+        glad_glBlendEquationSeparate = glad_lazy_glBlendEquationSeparate;
+        glad_glDrawBuffers = glad_lazy_glDrawBuffers;
+        glad_glStencilOpSeparate = glad_lazy_glStencilOpSeparate;
+        glad_glStencilFuncSeparate = glad_lazy_glStencilFuncSeparate;
+        glad_glStencilMaskSeparate = glad_lazy_glStencilMaskSeparate;
+        glad_glAttachShader = glad_lazy_glAttachShader;
+        glad_glBindAttribLocation = glad_lazy_glBindAttribLocation;
+        glad_glCompileShader = glad_lazy_glCompileShader;
+        glad_glCreateProgram = glad_lazy_glCreateProgram;
+        glad_glCreateShader = glad_lazy_glCreateShader;
+        glad_glDeleteProgram = glad_lazy_glDeleteProgram;
+        glad_glDeleteShader = glad_lazy_glDeleteShader;
+        glad_glDetachShader = glad_lazy_glDetachShader;
+        glad_glDisableVertexAttribArray = glad_lazy_glDisableVertexAttribArray;
+        glad_glEnableVertexAttribArray = glad_lazy_glEnableVertexAttribArray;
+        glad_glGetActiveAttrib = glad_lazy_glGetActiveAttrib;
+        glad_glGetActiveUniform = glad_lazy_glGetActiveUniform;
+        glad_glGetAttachedShaders = glad_lazy_glGetAttachedShaders;
+        glad_glGetAttribLocation = glad_lazy_glGetAttribLocation;
+        glad_glGetProgramiv = glad_lazy_glGetProgramiv;
+        glad_glGetProgramInfoLog = glad_lazy_glGetProgramInfoLog;
+        glad_glGetShaderiv = glad_lazy_glGetShaderiv;
+        glad_glGetShaderInfoLog = glad_lazy_glGetShaderInfoLog;
+        glad_glGetShaderSource = glad_lazy_glGetShaderSource;
+        glad_glGetUniformLocation = glad_lazy_glGetUniformLocation;
+        glad_glGetUniformfv = glad_lazy_glGetUniformfv;
+        glad_glGetUniformiv = glad_lazy_glGetUniformiv;
+        glad_glGetVertexAttribdv = glad_lazy_glGetVertexAttribdv;
+        glad_glGetVertexAttribfv = glad_lazy_glGetVertexAttribfv;
+        glad_glGetVertexAttribiv = glad_lazy_glGetVertexAttribiv;
+        glad_glGetVertexAttribPointerv = glad_lazy_glGetVertexAttribPointerv;
+        glad_glIsProgram = glad_lazy_glIsProgram;
+        glad_glIsShader = glad_lazy_glIsShader;
+        glad_glLinkProgram = glad_lazy_glLinkProgram;
+        glad_glShaderSource = glad_lazy_glShaderSource;
+        glad_glUseProgram = glad_lazy_glUseProgram;
+        glad_glUniform1f = glad_lazy_glUniform1f;
+        glad_glUniform2f = glad_lazy_glUniform2f;
+        glad_glUniform3f = glad_lazy_glUniform3f;
+        glad_glUniform4f = glad_lazy_glUniform4f;
+        glad_glUniform1i = glad_lazy_glUniform1i;
+        glad_glUniform2i = glad_lazy_glUniform2i;
+        glad_glUniform3i = glad_lazy_glUniform3i;
+        glad_glUniform4i = glad_lazy_glUniform4i;
+        glad_glUniform1fv = glad_lazy_glUniform1fv;
+        glad_glUniform2fv = glad_lazy_glUniform2fv;
+        glad_glUniform3fv = glad_lazy_glUniform3fv;
+        glad_glUniform4fv = glad_lazy_glUniform4fv;
+        glad_glUniform1iv = glad_lazy_glUniform1iv;
+        glad_glUniform2iv = glad_lazy_glUniform2iv;
+        glad_glUniform3iv = glad_lazy_glUniform3iv;
+        glad_glUniform4iv = glad_lazy_glUniform4iv;
+        glad_glUniformMatrix2fv = glad_lazy_glUniformMatrix2fv;
+        glad_glUniformMatrix3fv = glad_lazy_glUniformMatrix3fv;
+        glad_glUniformMatrix4fv = glad_lazy_glUniformMatrix4fv;
+        glad_glValidateProgram = glad_lazy_glValidateProgram;
+        glad_glVertexAttrib1d = glad_lazy_glVertexAttrib1d;
+        glad_glVertexAttrib1dv = glad_lazy_glVertexAttrib1dv;
+        glad_glVertexAttrib1f = glad_lazy_glVertexAttrib1f;
+        glad_glVertexAttrib1fv = glad_lazy_glVertexAttrib1fv;
+        glad_glVertexAttrib1s = glad_lazy_glVertexAttrib1s;
+        glad_glVertexAttrib1sv = glad_lazy_glVertexAttrib1sv;
+        glad_glVertexAttrib2d = glad_lazy_glVertexAttrib2d;
+        glad_glVertexAttrib2dv = glad_lazy_glVertexAttrib2dv;
+        glad_glVertexAttrib2f = glad_lazy_glVertexAttrib2f;
+        glad_glVertexAttrib2fv = glad_lazy_glVertexAttrib2fv;
+        glad_glVertexAttrib2s = glad_lazy_glVertexAttrib2s;
+        glad_glVertexAttrib2sv = glad_lazy_glVertexAttrib2sv;
+        glad_glVertexAttrib3d = glad_lazy_glVertexAttrib3d;
+        glad_glVertexAttrib3dv = glad_lazy_glVertexAttrib3dv;
+        glad_glVertexAttrib3f = glad_lazy_glVertexAttrib3f;
+        glad_glVertexAttrib3fv = glad_lazy_glVertexAttrib3fv;
+        glad_glVertexAttrib3s = glad_lazy_glVertexAttrib3s;
+        glad_glVertexAttrib3sv = glad_lazy_glVertexAttrib3sv;
+        glad_glVertexAttrib4Nbv = glad_lazy_glVertexAttrib4Nbv;
+        glad_glVertexAttrib4Niv = glad_lazy_glVertexAttrib4Niv;
+        glad_glVertexAttrib4Nsv = glad_lazy_glVertexAttrib4Nsv;
+        glad_glVertexAttrib4Nub = glad_lazy_glVertexAttrib4Nub;
+        glad_glVertexAttrib4Nubv = glad_lazy_glVertexAttrib4Nubv;
+        glad_glVertexAttrib4Nuiv = glad_lazy_glVertexAttrib4Nuiv;
+        glad_glVertexAttrib4Nusv = glad_lazy_glVertexAttrib4Nusv;
+        glad_glVertexAttrib4bv = glad_lazy_glVertexAttrib4bv;
+        glad_glVertexAttrib4d = glad_lazy_glVertexAttrib4d;
+        glad_glVertexAttrib4dv = glad_lazy_glVertexAttrib4dv;
+        glad_glVertexAttrib4f = glad_lazy_glVertexAttrib4f;
+        glad_glVertexAttrib4fv = glad_lazy_glVertexAttrib4fv;
+        glad_glVertexAttrib4iv = glad_lazy_glVertexAttrib4iv;
+        glad_glVertexAttrib4s = glad_lazy_glVertexAttrib4s;
+        glad_glVertexAttrib4sv = glad_lazy_glVertexAttrib4sv;
+        glad_glVertexAttrib4ubv = glad_lazy_glVertexAttrib4ubv;
+        glad_glVertexAttrib4uiv = glad_lazy_glVertexAttrib4uiv;
+        glad_glVertexAttrib4usv = glad_lazy_glVertexAttrib4usv;
+        glad_glVertexAttribPointer = glad_lazy_glVertexAttribPointer;
+    }
+    if(GLAD_GL_VERSION_2_1) {
+        glad_glUniformMatrix2x3fv = glad_lazy_glUniformMatrix2x3fv;
+        glad_glUniformMatrix3x2fv = glad_lazy_glUniformMatrix3x2fv;
+        glad_glUniformMatrix2x4fv = glad_lazy_glUniformMatrix2x4fv;
+        glad_glUniformMatrix4x2fv = glad_lazy_glUniformMatrix4x2fv;
+        glad_glUniformMatrix3x4fv = glad_lazy_glUniformMatrix3x4fv;
+        glad_glUniformMatrix4x3fv = glad_lazy_glUniformMatrix4x3fv;
+    }
+    if(GLAD_GL_VERSION_3_0) {
+        glad_glColorMaski = glad_lazy_glColorMaski;
+        glad_glGetBooleani_v = glad_lazy_glGetBooleani_v;
+        glad_glGetIntegeri_v = glad_lazy_glGetIntegeri_v;
+        glad_glEnablei = glad_lazy_glEnablei;
+        glad_glDisablei = glad_lazy_glDisablei;
+        glad_glIsEnabledi = glad_lazy_glIsEnabledi;
+        glad_glBeginTransformFeedback = glad_lazy_glBeginTransformFeedback;
+        glad_glEndTransformFeedback = glad_lazy_glEndTransformFeedback;
+        glad_glBindBufferRange = glad_lazy_glBindBufferRange;
+        glad_glBindBufferBase = glad_lazy_glBindBufferBase;
+        glad_glTransformFeedbackVaryings = glad_lazy_glTransformFeedbackVaryings;
+        glad_glGetTransformFeedbackVarying = glad_lazy_glGetTransformFeedbackVarying;
+        glad_glClampColor = glad_lazy_glClampColor;
+        glad_glBeginConditionalRender = glad_lazy_glBeginConditionalRender;
+        glad_glEndConditionalRender = glad_lazy_glEndConditionalRender;
+        glad_glVertexAttribIPointer = glad_lazy_glVertexAttribIPointer;
+        glad_glGetVertexAttribIiv = glad_lazy_glGetVertexAttribIiv;
+        glad_glGetVertexAttribIuiv = glad_lazy_glGetVertexAttribIuiv;
+        glad_glVertexAttribI1i = glad_lazy_glVertexAttribI1i;
+        glad_glVertexAttribI2i = glad_lazy_glVertexAttribI2i;
+        glad_glVertexAttribI3i = glad_lazy_glVertexAttribI3i;
+        glad_glVertexAttribI4i = glad_lazy_glVertexAttribI4i;
+        glad_glVertexAttribI1ui = glad_lazy_glVertexAttribI1ui;
+        glad_glVertexAttribI2ui = glad_lazy_glVertexAttribI2ui;
+        glad_glVertexAttribI3ui = glad_lazy_glVertexAttribI3ui;
+        glad_glVertexAttribI4ui = glad_lazy_glVertexAttribI4ui;
+        glad_glVertexAttribI1iv = glad_lazy_glVertexAttribI1iv;
+        glad_glVertexAttribI2iv = glad_lazy_glVertexAttribI2iv;
+        glad_glVertexAttribI3iv = glad_lazy_glVertexAttribI3iv;
+        glad_glVertexAttribI4iv = glad_lazy_glVertexAttribI4iv;
+        glad_glVertexAttribI1uiv = glad_lazy_glVertexAttribI1uiv;
+        glad_glVertexAttribI2uiv = glad_lazy_glVertexAttribI2uiv;
+        glad_glVertexAttribI3uiv = glad_lazy_glVertexAttribI3uiv;
+        glad_glVertexAttribI4uiv = glad_lazy_glVertexAttribI4uiv;
+        glad_glVertexAttribI4bv = glad_lazy_glVertexAttribI4bv;
+        glad_glVertexAttribI4sv = glad_lazy_glVertexAttribI4sv;
+        glad_glVertexAttribI4ubv = glad_lazy_glVertexAttribI4ubv;
+        glad_glVertexAttribI4usv = glad_lazy_glVertexAttribI4usv;
+        glad_glGetUniformuiv = glad_lazy_glGetUniformuiv;
+        glad_glBindFragDataLocation = glad_lazy_glBindFragDataLocation;
+        glad_glGetFragDataLocation = glad_lazy_glGetFragDataLocation;
+        glad_glUniform1ui = glad_lazy_glUniform1ui;
+        glad_glUniform2ui = glad_lazy_glUniform2ui;
+        glad_glUniform3ui = glad_lazy_glUniform3ui;
+        glad_glUniform4ui = glad_lazy_glUniform4ui;
+        glad_glUniform1uiv = glad_lazy_glUniform1uiv;
+        glad_glUniform2uiv = glad_lazy_glUniform2uiv;
+        glad_glUniform3uiv = glad_lazy_glUniform3uiv;
+        glad_glUniform4uiv = glad_lazy_glUniform4uiv;
+        glad_glTexParameterIiv = glad_lazy_glTexParameterIiv;
+        glad_glTexParameterIuiv = glad_lazy_glTexParameterIuiv;
+        glad_glGetTexParameterIiv = glad_lazy_glGetTexParameterIiv;
+        glad_glGetTexParameterIuiv = glad_lazy_glGetTexParameterIuiv;
+        glad_glClearBufferiv = glad_lazy_glClearBufferiv;
+        glad_glClearBufferuiv = glad_lazy_glClearBufferuiv;
+        glad_glClearBufferfv = glad_lazy_glClearBufferfv;
+        glad_glClearBufferfi = glad_lazy_glClearBufferfi;
+        glad_glGetStringi = glad_lazy_glGetStringi;
+        glad_glIsRenderbuffer = glad_lazy_glIsRenderbuffer;
+        glad_glBindRenderbuffer = glad_lazy_glBindRenderbuffer;
+        glad_glDeleteRenderbuffers = glad_lazy_glDeleteRenderbuffers;
+        glad_glGenRenderbuffers = glad_lazy_glGenRenderbuffers;
+        glad_glRenderbufferStorage = glad_lazy_glRenderbufferStorage;
+        glad_glGetRenderbufferParameteriv = glad_lazy_glGetRenderbufferParameteriv;
+        glad_glIsFramebuffer = glad_lazy_glIsFramebuffer;
+        glad_glBindFramebuffer = glad_lazy_glBindFramebuffer;
+        glad_glDeleteFramebuffers = glad_lazy_glDeleteFramebuffers;
+        glad_glGenFramebuffers = glad_lazy_glGenFramebuffers;
+        glad_glCheckFramebufferStatus = glad_lazy_glCheckFramebufferStatus;
+        glad_glFramebufferTexture1D = glad_lazy_glFramebufferTexture1D;
+        glad_glFramebufferTexture2D = glad_lazy_glFramebufferTexture2D;
+        glad_glFramebufferTexture3D = glad_lazy_glFramebufferTexture3D;
+        glad_glFramebufferRenderbuffer = glad_lazy_glFramebufferRenderbuffer;
+        glad_glGetFramebufferAttachmentParameteriv = glad_lazy_glGetFramebufferAttachmentParameteriv;
+        glad_glGenerateMipmap = glad_lazy_glGenerateMipmap;
+        glad_glBlitFramebuffer = glad_lazy_glBlitFramebuffer;
+        glad_glRenderbufferStorageMultisample = glad_lazy_glRenderbufferStorageMultisample;
+        glad_glFramebufferTextureLayer = glad_lazy_glFramebufferTextureLayer;
+        glad_glMapBufferRange = glad_lazy_glMapBufferRange;
+        glad_glFlushMappedBufferRange = glad_lazy_glFlushMappedBufferRange;
+        glad_glBindVertexArray = glad_lazy_glBindVertexArray;
+        glad_glDeleteVertexArrays = glad_lazy_glDeleteVertexArrays;
+        glad_glGenVertexArrays = glad_lazy_glGenVertexArrays;
+        glad_glIsVertexArray = glad_lazy_glIsVertexArray;
+    }
+    if(GLAD_GL_VERSION_3_1) {
+        glad_glDrawArraysInstanced = glad_lazy_glDrawArraysInstanced;
+        glad_glDrawElementsInstanced = glad_lazy_glDrawElementsInstanced;
+        glad_glTexBuffer = glad_lazy_glTexBuffer;
+        glad_glPrimitiveRestartIndex = glad_lazy_glPrimitiveRestartIndex;
+        glad_glCopyBufferSubData = glad_lazy_glCopyBufferSubData;
+        glad_glGetUniformIndices = glad_lazy_glGetUniformIndices;
+        glad_glGetActiveUniformsiv = glad_lazy_glGetActiveUniformsiv;
+        glad_glGetActiveUniformName = glad_lazy_glGetActiveUniformName;
+        glad_glGetUniformBlockIndex = glad_lazy_glGetUniformBlockIndex;
+        glad_glGetActiveUniformBlockiv = glad_lazy_glGetActiveUniformBlockiv;
+        glad_glGetActiveUniformBlockName = glad_lazy_glGetActiveUniformBlockName;
+        glad_glUniformBlockBinding = glad_lazy_glUniformBlockBinding;
+        glad_glBindBufferRange = glad_lazy_glBindBufferRange;
+        glad_glBindBufferBase = glad_lazy_glBindBufferBase;
+        glad_glGetIntegeri_v = glad_lazy_glGetIntegeri_v;
+    }
+    if(GLAD_GL_VERSION_3_2) {
+        glad_glDrawElementsBaseVertex = glad_lazy_glDrawElementsBaseVertex;
+        glad_glDrawRangeElementsBaseVertex = glad_lazy_glDrawRangeElementsBaseVertex;
+        glad_glDrawElementsInstancedBaseVertex = glad_lazy_glDrawElementsInstancedBaseVertex;
+        glad_glMultiDrawElementsBaseVertex = glad_lazy_glMultiDrawElementsBaseVertex;
+        glad_glProvokingVertex = glad_lazy_glProvokingVertex;
+        glad_glFenceSync = glad_lazy_glFenceSync;
+        glad_glIsSync = glad_lazy_glIsSync;
+        glad_glDeleteSync = glad_lazy_glDeleteSync;
+        glad_glClientWaitSync = glad_lazy_glClientWaitSync;
+        glad_glWaitSync = glad_lazy_glWaitSync;
+        glad_glGetInteger64v = glad_lazy_glGetInteger64v;
+        glad_glGetSynciv = glad_lazy_glGetSynciv;
+        glad_glGetInteger64i_v = glad_lazy_glGetInteger64i_v;
+        glad_glGetBufferParameteri64v = glad_lazy_glGetBufferParameteri64v;
+        glad_glFramebufferTexture = glad_lazy_glFramebufferTexture;
+        glad_glTexImage2DMultisample = glad_lazy_glTexImage2DMultisample;
+        glad_glTexImage3DMultisample = glad_lazy_glTexImage3DMultisample;
+        glad_glGetMultisamplefv = glad_lazy_glGetMultisamplefv;
+        glad_glSampleMaski = glad_lazy_glSampleMaski;
+    }
+    if(GLAD_GL_VERSION_3_3) {
+        glad_glBindFragDataLocationIndexed = glad_lazy_glBindFragDataLocationIndexed;
+        glad_glGetFragDataIndex = glad_lazy_glGetFragDataIndex;
+        glad_glGenSamplers = glad_lazy_glGenSamplers;
+        glad_glDeleteSamplers = glad_lazy_glDeleteSamplers;
+        glad_glIsSampler = glad_lazy_glIsSampler;
+        glad_glBindSampler = glad_lazy_glBindSampler;
+        glad_glSamplerParameteri = glad_lazy_glSamplerParameteri;
+        glad_glSamplerParameteriv = glad_lazy_glSamplerParameteriv;
+        glad_glSamplerParameterf = glad_lazy_glSamplerParameterf;
+        glad_glSamplerParameterfv = glad_lazy_glSamplerParameterfv;
+        glad_glSamplerParameterIiv = glad_lazy_glSamplerParameterIiv;
+        glad_glSamplerParameterIuiv = glad_lazy_glSamplerParameterIuiv;
+        glad_glGetSamplerParameteriv = glad_lazy_glGetSamplerParameteriv;
+        glad_glGetSamplerParameterIiv = glad_lazy_glGetSamplerParameterIiv;
+        glad_glGetSamplerParameterfv = glad_lazy_glGetSamplerParameterfv;
+        glad_glGetSamplerParameterIuiv = glad_lazy_glGetSamplerParameterIuiv;
+        glad_glQueryCounter = glad_lazy_glQueryCounter;
+        glad_glGetQueryObjecti64v = glad_lazy_glGetQueryObjecti64v;
+        glad_glGetQueryObjectui64v = glad_lazy_glGetQueryObjectui64v;
+        glad_glVertexAttribDivisor = glad_lazy_glVertexAttribDivisor;
+        glad_glVertexAttribP1ui = glad_lazy_glVertexAttribP1ui;
+        glad_glVertexAttribP1uiv = glad_lazy_glVertexAttribP1uiv;
+        glad_glVertexAttribP2ui = glad_lazy_glVertexAttribP2ui;
+        glad_glVertexAttribP2uiv = glad_lazy_glVertexAttribP2uiv;
+        glad_glVertexAttribP3ui = glad_lazy_glVertexAttribP3ui;
+        glad_glVertexAttribP3uiv = glad_lazy_glVertexAttribP3uiv;
+        glad_glVertexAttribP4ui = glad_lazy_glVertexAttribP4ui;
+        glad_glVertexAttribP4uiv = glad_lazy_glVertexAttribP4uiv;
+        glad_glVertexP2ui = glad_lazy_glVertexP2ui;
+        glad_glVertexP2uiv = glad_lazy_glVertexP2uiv;
+        glad_glVertexP3ui = glad_lazy_glVertexP3ui;
+        glad_glVertexP3uiv = glad_lazy_glVertexP3uiv;
+        glad_glVertexP4ui = glad_lazy_glVertexP4ui;
+        glad_glVertexP4uiv = glad_lazy_glVertexP4uiv;
+        glad_glTexCoordP1ui = glad_lazy_glTexCoordP1ui;
+        glad_glTexCoordP1uiv = glad_lazy_glTexCoordP1uiv;
+        glad_glTexCoordP2ui = glad_lazy_glTexCoordP2ui;
+        glad_glTexCoordP2uiv = glad_lazy_glTexCoordP2uiv;
+        glad_glTexCoordP3ui = glad_lazy_glTexCoordP3ui;
+        glad_glTexCoordP3uiv = glad_lazy_glTexCoordP3uiv;
+        glad_glTexCoordP4ui = glad_lazy_glTexCoordP4ui;
+        glad_glTexCoordP4uiv = glad_lazy_glTexCoordP4uiv;
+        glad_glMultiTexCoordP1ui = glad_lazy_glMultiTexCoordP1ui;
+        glad_glMultiTexCoordP1uiv = glad_lazy_glMultiTexCoordP1uiv;
+        glad_glMultiTexCoordP2ui = glad_lazy_glMultiTexCoordP2ui;
+        glad_glMultiTexCoordP2uiv = glad_lazy_glMultiTexCoordP2uiv;
+        glad_glMultiTexCoordP3ui = glad_lazy_glMultiTexCoordP3ui;
+        glad_glMultiTexCoordP3uiv = glad_lazy_glMultiTexCoordP3uiv;
+        glad_glMultiTexCoordP4ui = glad_lazy_glMultiTexCoordP4ui;
+        glad_glMultiTexCoordP4uiv = glad_lazy_glMultiTexCoordP4uiv;
+        glad_glNormalP3ui = glad_lazy_glNormalP3ui;
+        glad_glNormalP3uiv = glad_lazy_glNormalP3uiv;
+        glad_glColorP3ui = glad_lazy_glColorP3ui;
+        glad_glColorP3uiv = glad_lazy_glColorP3uiv;
+        glad_glColorP4ui = glad_lazy_glColorP4ui;
+        glad_glColorP4uiv = glad_lazy_glColorP4uiv;
+        glad_glSecondaryColorP3ui = glad_lazy_glSecondaryColorP3ui;
+        glad_glSecondaryColorP3uiv = glad_lazy_glSecondaryColorP3uiv;
+    }
+    if(GLAD_GL_VERSION_4_0) {
+        glad_glMinSampleShading = glad_lazy_glMinSampleShading;
+        glad_glBlendEquationi = glad_lazy_glBlendEquationi;
+        glad_glBlendEquationSeparatei = glad_lazy_glBlendEquationSeparatei;
+        glad_glBlendFunci = glad_lazy_glBlendFunci;
+        glad_glBlendFuncSeparatei = glad_lazy_glBlendFuncSeparatei;
+        glad_glDrawArraysIndirect = glad_lazy_glDrawArraysIndirect;
+        glad_glDrawElementsIndirect = glad_lazy_glDrawElementsIndirect;
+        glad_glUniform1d = glad_lazy_glUniform1d;
+        glad_glUniform2d = glad_lazy_glUniform2d;
+        glad_glUniform3d = glad_lazy_glUniform3d;
+        glad_glUniform4d = glad_lazy_glUniform4d;
+        glad_glUniform1dv = glad_lazy_glUniform1dv;
+        glad_glUniform2dv = glad_lazy_glUniform2dv;
+        glad_glUniform3dv = glad_lazy_glUniform3dv;
+        glad_glUniform4dv = glad_lazy_glUniform4dv;
+        glad_glUniformMatrix2dv = glad_lazy_glUniformMatrix2dv;
+        glad_glUniformMatrix3dv = glad_lazy_glUniformMatrix3dv;
+        glad_glUniformMatrix4dv = glad_lazy_glUniformMatrix4dv;
+        glad_glUniformMatrix2x3dv = glad_lazy_glUniformMatrix2x3dv;
+        glad_glUniformMatrix2x4dv = glad_lazy_glUniformMatrix2x4dv;
+        glad_glUniformMatrix3x2dv = glad_lazy_glUniformMatrix3x2dv;
+        glad_glUniformMatrix3x4dv = glad_lazy_glUniformMatrix3x4dv;
+        glad_glUniformMatrix4x2dv = glad_lazy_glUniformMatrix4x2dv;
+        glad_glUniformMatrix4x3dv = glad_lazy_glUniformMatrix4x3dv;
+        glad_glGetUniformdv = glad_lazy_glGetUniformdv;
+        glad_glGetSubroutineUniformLocation = glad_lazy_glGetSubroutineUniformLocation;
+        glad_glGetSubroutineIndex = glad_lazy_glGetSubroutineIndex;
+        glad_glGetActiveSubroutineUniformiv = glad_lazy_glGetActiveSubroutineUniformiv;
+        glad_glGetActiveSubroutineUniformName = glad_lazy_glGetActiveSubroutineUniformName;
+        glad_glGetActiveSubroutineName = glad_lazy_glGetActiveSubroutineName;
+        glad_glUniformSubroutinesuiv = glad_lazy_glUniformSubroutinesuiv;
+        glad_glGetUniformSubroutineuiv = glad_lazy_glGetUniformSubroutineuiv;
+        glad_glGetProgramStageiv = glad_lazy_glGetProgramStageiv;
+        glad_glPatchParameteri = glad_lazy_glPatchParameteri;
+        glad_glPatchParameterfv = glad_lazy_glPatchParameterfv;
+        glad_glBindTransformFeedback = glad_lazy_glBindTransformFeedback;
+        glad_glDeleteTransformFeedbacks = glad_lazy_glDeleteTransformFeedbacks;
+        glad_glGenTransformFeedbacks = glad_lazy_glGenTransformFeedbacks;
+        glad_glIsTransformFeedback = glad_lazy_glIsTransformFeedback;
+        glad_glPauseTransformFeedback = glad_lazy_glPauseTransformFeedback;
+        glad_glResumeTransformFeedback = glad_lazy_glResumeTransformFeedback;
+        glad_glDrawTransformFeedback = glad_lazy_glDrawTransformFeedback;
+        glad_glDrawTransformFeedbackStream = glad_lazy_glDrawTransformFeedbackStream;
+        glad_glBeginQueryIndexed = glad_lazy_glBeginQueryIndexed;
+        glad_glEndQueryIndexed = glad_lazy_glEndQueryIndexed;
+        glad_glGetQueryIndexediv = glad_lazy_glGetQueryIndexediv;
+    }
+    if(GLAD_GL_VERSION_4_1) {
+        glad_glReleaseShaderCompiler = glad_lazy_glReleaseShaderCompiler;
+        glad_glShaderBinary = glad_lazy_glShaderBinary;
+        glad_glGetShaderPrecisionFormat = glad_lazy_glGetShaderPrecisionFormat;
+        glad_glDepthRangef = glad_lazy_glDepthRangef;
+        glad_glClearDepthf = glad_lazy_glClearDepthf;
+        glad_glGetProgramBinary = glad_lazy_glGetProgramBinary;
+        glad_glProgramBinary = glad_lazy_glProgramBinary;
+        glad_glProgramParameteri = glad_lazy_glProgramParameteri;
+        glad_glUseProgramStages = glad_lazy_glUseProgramStages;
+        glad_glActiveShaderProgram = glad_lazy_glActiveShaderProgram;
+        glad_glCreateShaderProgramv = glad_lazy_glCreateShaderProgramv;
+        glad_glBindProgramPipeline = glad_lazy_glBindProgramPipeline;
+        glad_glDeleteProgramPipelines = glad_lazy_glDeleteProgramPipelines;
+        glad_glGenProgramPipelines = glad_lazy_glGenProgramPipelines;
+        glad_glIsProgramPipeline = glad_lazy_glIsProgramPipeline;
+        glad_glGetProgramPipelineiv = glad_lazy_glGetProgramPipelineiv;
+        glad_glProgramParameteri = glad_lazy_glProgramParameteri;
+        glad_glProgramUniform1i = glad_lazy_glProgramUniform1i;
+        glad_glProgramUniform1iv = glad_lazy_glProgramUniform1iv;
+        glad_glProgramUniform1f = glad_lazy_glProgramUniform1f;
+        glad_glProgramUniform1fv = glad_lazy_glProgramUniform1fv;
+        glad_glProgramUniform1d = glad_lazy_glProgramUniform1d;
+        glad_glProgramUniform1dv = glad_lazy_glProgramUniform1dv;
+        glad_glProgramUniform1ui = glad_lazy_glProgramUniform1ui;
+        glad_glProgramUniform1uiv = glad_lazy_glProgramUniform1uiv;
+        glad_glProgramUniform2i = glad_lazy_glProgramUniform2i;
+        glad_glProgramUniform2iv = glad_lazy_glProgramUniform2iv;
+        glad_glProgramUniform2f = glad_lazy_glProgramUniform2f;
+        glad_glProgramUniform2fv = glad_lazy_glProgramUniform2fv;
+        glad_glProgramUniform2d = glad_lazy_glProgramUniform2d;
+        glad_glProgramUniform2dv = glad_lazy_glProgramUniform2dv;
+        glad_glProgramUniform2ui = glad_lazy_glProgramUniform2ui;
+        glad_glProgramUniform2uiv = glad_lazy_glProgramUniform2uiv;
+        glad_glProgramUniform3i = glad_lazy_glProgramUniform3i;
+        glad_glProgramUniform3iv = glad_lazy_glProgramUniform3iv;
+        glad_glProgramUniform3f = glad_lazy_glProgramUniform3f;
+        glad_glProgramUniform3fv = glad_lazy_glProgramUniform3fv;
+        glad_glProgramUniform3d = glad_lazy_glProgramUniform3d;
+        glad_glProgramUniform3dv = glad_lazy_glProgramUniform3dv;
+        glad_glProgramUniform3ui = glad_lazy_glProgramUniform3ui;
+        glad_glProgramUniform3uiv = glad_lazy_glProgramUniform3uiv;
+        glad_glProgramUniform4i = glad_lazy_glProgramUniform4i;
+        glad_glProgramUniform4iv = glad_lazy_glProgramUniform4iv;
+        glad_glProgramUniform4f = glad_lazy_glProgramUniform4f;
+        glad_glProgramUniform4fv = glad_lazy_glProgramUniform4fv;
+        glad_glProgramUniform4d = glad_lazy_glProgramUniform4d;
+        glad_glProgramUniform4dv = glad_lazy_glProgramUniform4dv;
+        glad_glProgramUniform4ui = glad_lazy_glProgramUniform4ui;
+        glad_glProgramUniform4uiv = glad_lazy_glProgramUniform4uiv;
+        glad_glProgramUniformMatrix2fv = glad_lazy_glProgramUniformMatrix2fv;
+        glad_glProgramUniformMatrix3fv = glad_lazy_glProgramUniformMatrix3fv;
+        glad_glProgramUniformMatrix4fv = glad_lazy_glProgramUniformMatrix4fv;
+        glad_glProgramUniformMatrix2dv = glad_lazy_glProgramUniformMatrix2dv;
+        glad_glProgramUniformMatrix3dv = glad_lazy_glProgramUniformMatrix3dv;
+        glad_glProgramUniformMatrix4dv = glad_lazy_glProgramUniformMatrix4dv;
+        glad_glProgramUniformMatrix2x3fv = glad_lazy_glProgramUniformMatrix2x3fv;
+        glad_glProgramUniformMatrix3x2fv = glad_lazy_glProgramUniformMatrix3x2fv;
+        glad_glProgramUniformMatrix2x4fv = glad_lazy_glProgramUniformMatrix2x4fv;
+        glad_glProgramUniformMatrix4x2fv = glad_lazy_glProgramUniformMatrix4x2fv;
+        glad_glProgramUniformMatrix3x4fv = glad_lazy_glProgramUniformMatrix3x4fv;
+        glad_glProgramUniformMatrix4x3fv = glad_lazy_glProgramUniformMatrix4x3fv;
+        glad_glProgramUniformMatrix2x3dv = glad_lazy_glProgramUniformMatrix2x3dv;
+        glad_glProgramUniformMatrix3x2dv = glad_lazy_glProgramUniformMatrix3x2dv;
+        glad_glProgramUniformMatrix2x4dv = glad_lazy_glProgramUniformMatrix2x4dv;
+        glad_glProgramUniformMatrix4x2dv = glad_lazy_glProgramUniformMatrix4x2dv;
+        glad_glProgramUniformMatrix3x4dv = glad_lazy_glProgramUniformMatrix3x4dv;
+        glad_glProgramUniformMatrix4x3dv = glad_lazy_glProgramUniformMatrix4x3dv;
+        glad_glValidateProgramPipeline = glad_lazy_glValidateProgramPipeline;
+        glad_glGetProgramPipelineInfoLog = glad_lazy_glGetProgramPipelineInfoLog;
+        glad_glVertexAttribL1d = glad_lazy_glVertexAttribL1d;
+        glad_glVertexAttribL2d = glad_lazy_glVertexAttribL2d;
+        glad_glVertexAttribL3d = glad_lazy_glVertexAttribL3d;
+        glad_glVertexAttribL4d = glad_lazy_glVertexAttribL4d;
+        glad_glVertexAttribL1dv = glad_lazy_glVertexAttribL1dv;
+        glad_glVertexAttribL2dv = glad_lazy_glVertexAttribL2dv;
+        glad_glVertexAttribL3dv = glad_lazy_glVertexAttribL3dv;
+        glad_glVertexAttribL4dv = glad_lazy_glVertexAttribL4dv;
+        glad_glVertexAttribLPointer = glad_lazy_glVertexAttribLPointer;
+        glad_glGetVertexAttribLdv = glad_lazy_glGetVertexAttribLdv;
+        glad_glViewportArrayv = glad_lazy_glViewportArrayv;
+        glad_glViewportIndexedf = glad_lazy_glViewportIndexedf;
+        glad_glViewportIndexedfv = glad_lazy_glViewportIndexedfv;
+        glad_glScissorArrayv = glad_lazy_glScissorArrayv;
+        glad_glScissorIndexed = glad_lazy_glScissorIndexed;
+        glad_glScissorIndexedv = glad_lazy_glScissorIndexedv;
+        glad_glDepthRangeArrayv = glad_lazy_glDepthRangeArrayv;
+        glad_glDepthRangeIndexed = glad_lazy_glDepthRangeIndexed;
+        glad_glGetFloati_v = glad_lazy_glGetFloati_v;
+        glad_glGetDoublei_v = glad_lazy_glGetDoublei_v;
+    }
+    if(GLAD_GL_VERSION_4_2) {
+        glad_glDrawArraysInstancedBaseInstance = glad_lazy_glDrawArraysInstancedBaseInstance;
+        glad_glDrawElementsInstancedBaseInstance = glad_lazy_glDrawElementsInstancedBaseInstance;
+        glad_glDrawElementsInstancedBaseVertexBaseInstance = glad_lazy_glDrawElementsInstancedBaseVertexBaseInstance;
+        glad_glGetInternalformativ = glad_lazy_glGetInternalformativ;
+        glad_glGetActiveAtomicCounterBufferiv = glad_lazy_glGetActiveAtomicCounterBufferiv;
+        glad_glBindImageTexture = glad_lazy_glBindImageTexture;
+        glad_glMemoryBarrier = glad_lazy_glMemoryBarrier;
+        glad_glTexStorage1D = glad_lazy_glTexStorage1D;
+        glad_glTexStorage2D = glad_lazy_glTexStorage2D;
+        glad_glTexStorage3D = glad_lazy_glTexStorage3D;
+        glad_glDrawTransformFeedbackInstanced = glad_lazy_glDrawTransformFeedbackInstanced;
+        glad_glDrawTransformFeedbackStreamInstanced = glad_lazy_glDrawTransformFeedbackStreamInstanced;
+    }
+    if(GLAD_GL_VERSION_4_3) {
+        glad_glClearBufferData = glad_lazy_glClearBufferData;
+        glad_glClearBufferSubData = glad_lazy_glClearBufferSubData;
+        glad_glDispatchCompute = glad_lazy_glDispatchCompute;
+        glad_glDispatchComputeIndirect = glad_lazy_glDispatchComputeIndirect;
+        glad_glCopyImageSubData = glad_lazy_glCopyImageSubData;
+        glad_glFramebufferParameteri = glad_lazy_glFramebufferParameteri;
+        glad_glGetFramebufferParameteriv = glad_lazy_glGetFramebufferParameteriv;
+        glad_glGetInternalformati64v = glad_lazy_glGetInternalformati64v;
+        glad_glInvalidateTexSubImage = glad_lazy_glInvalidateTexSubImage;
+        glad_glInvalidateTexImage = glad_lazy_glInvalidateTexImage;
+        glad_glInvalidateBufferSubData = glad_lazy_glInvalidateBufferSubData;
+        glad_glInvalidateBufferData = glad_lazy_glInvalidateBufferData;
+        glad_glInvalidateFramebuffer = glad_lazy_glInvalidateFramebuffer;
+        glad_glInvalidateSubFramebuffer = glad_lazy_glInvalidateSubFramebuffer;
+        glad_glMultiDrawArraysIndirect = glad_lazy_glMultiDrawArraysIndirect;
+        glad_glMultiDrawElementsIndirect = glad_lazy_glMultiDrawElementsIndirect;
+        glad_glGetProgramInterfaceiv = glad_lazy_glGetProgramInterfaceiv;
+        glad_glGetProgramResourceIndex = glad_lazy_glGetProgramResourceIndex;
+        glad_glGetProgramResourceName = glad_lazy_glGetProgramResourceName;
+        glad_glGetProgramResourceiv = glad_lazy_glGetProgramResourceiv;
+        glad_glGetProgramResourceLocation = glad_lazy_glGetProgramResourceLocation;
+        glad_glGetProgramResourceLocationIndex = glad_lazy_glGetProgramResourceLocationIndex;
+        glad_glShaderStorageBlockBinding = glad_lazy_glShaderStorageBlockBinding;
+        glad_glTexBufferRange = glad_lazy_glTexBufferRange;
+        glad_glTexStorage2DMultisample = glad_lazy_glTexStorage2DMultisample;
+        glad_glTexStorage3DMultisample = glad_lazy_glTexStorage3DMultisample;
+        glad_glTextureView = glad_lazy_glTextureView;
+        glad_glBindVertexBuffer = glad_lazy_glBindVertexBuffer;
+        glad_glVertexAttribFormat = glad_lazy_glVertexAttribFormat;
+        glad_glVertexAttribIFormat = glad_lazy_glVertexAttribIFormat;
+        glad_glVertexAttribLFormat = glad_lazy_glVertexAttribLFormat;
+        glad_glVertexAttribBinding = glad_lazy_glVertexAttribBinding;
+        glad_glVertexBindingDivisor = glad_lazy_glVertexBindingDivisor;
+        glad_glDebugMessageControl = glad_lazy_glDebugMessageControl;
+        glad_glDebugMessageInsert = glad_lazy_glDebugMessageInsert;
+        glad_glDebugMessageCallback = glad_lazy_glDebugMessageCallback;
+        glad_glGetDebugMessageLog = glad_lazy_glGetDebugMessageLog;
+        glad_glPushDebugGroup = glad_lazy_glPushDebugGroup;
+        glad_glPopDebugGroup = glad_lazy_glPopDebugGroup;
+        glad_glObjectLabel = glad_lazy_glObjectLabel;
+        glad_glGetObjectLabel = glad_lazy_glGetObjectLabel;
+        glad_glObjectPtrLabel = glad_lazy_glObjectPtrLabel;
+        glad_glGetObjectPtrLabel = glad_lazy_glGetObjectPtrLabel;
+        glad_glGetPointerv = glad_lazy_glGetPointerv;
+    }
+    if(GLAD_GL_VERSION_4_4) {
+        glad_glBufferStorage = glad_lazy_glBufferStorage;
+        glad_glClearTexImage = glad_lazy_glClearTexImage;
+        glad_glClearTexSubImage = glad_lazy_glClearTexSubImage;
+        glad_glBindBuffersBase = glad_lazy_glBindBuffersBase;
+        glad_glBindBuffersRange = glad_lazy_glBindBuffersRange;
+        glad_glBindTextures = glad_lazy_glBindTextures;
+        glad_glBindSamplers = glad_lazy_glBindSamplers;
+        glad_glBindImageTextures = glad_lazy_glBindImageTextures;
+        glad_glBindVertexBuffers = glad_lazy_glBindVertexBuffers;
+    }
+    if(GLAD_GL_VERSION_4_5) {
+        glad_glClipControl = glad_lazy_glClipControl;
+        glad_glCreateTransformFeedbacks = glad_lazy_glCreateTransformFeedbacks;
+        glad_glTransformFeedbackBufferBase = glad_lazy_glTransformFeedbackBufferBase;
+        glad_glTransformFeedbackBufferRange = glad_lazy_glTransformFeedbackBufferRange;
+        glad_glGetTransformFeedbackiv = glad_lazy_glGetTransformFeedbackiv;
+        glad_glGetTransformFeedbacki_v = glad_lazy_glGetTransformFeedbacki_v;
+        glad_glGetTransformFeedbacki64_v = glad_lazy_glGetTransformFeedbacki64_v;
+        glad_glCreateBuffers = glad_lazy_glCreateBuffers;
+        glad_glNamedBufferStorage = glad_lazy_glNamedBufferStorage;
+        glad_glNamedBufferData = glad_lazy_glNamedBufferData;
+        glad_glNamedBufferSubData = glad_lazy_glNamedBufferSubData;
+        glad_glCopyNamedBufferSubData = glad_lazy_glCopyNamedBufferSubData;
+        glad_glClearNamedBufferData = glad_lazy_glClearNamedBufferData;
+        glad_glClearNamedBufferSubData = glad_lazy_glClearNamedBufferSubData;
+        glad_glMapNamedBuffer = glad_lazy_glMapNamedBuffer;
+        glad_glMapNamedBufferRange = glad_lazy_glMapNamedBufferRange;
+        glad_glUnmapNamedBuffer = glad_lazy_glUnmapNamedBuffer;
+        glad_glFlushMappedNamedBufferRange = glad_lazy_glFlushMappedNamedBufferRange;
+        glad_glGetNamedBufferParameteriv = glad_lazy_glGetNamedBufferParameteriv;
+        glad_glGetNamedBufferParameteri64v = glad_lazy_glGetNamedBufferParameteri64v;
+        glad_glGetNamedBufferPointerv = glad_lazy_glGetNamedBufferPointerv;
+        glad_glGetNamedBufferSubData = glad_lazy_glGetNamedBufferSubData;
+        glad_glCreateFramebuffers = glad_lazy_glCreateFramebuffers;
+        glad_glNamedFramebufferRenderbuffer = glad_lazy_glNamedFramebufferRenderbuffer;
+        glad_glNamedFramebufferParameteri = glad_lazy_glNamedFramebufferParameteri;
+        glad_glNamedFramebufferTexture = glad_lazy_glNamedFramebufferTexture;
+        glad_glNamedFramebufferTextureLayer = glad_lazy_glNamedFramebufferTextureLayer;
+        glad_glNamedFramebufferDrawBuffer = glad_lazy_glNamedFramebufferDrawBuffer;
+        glad_glNamedFramebufferDrawBuffers = glad_lazy_glNamedFramebufferDrawBuffers;
+        glad_glNamedFramebufferReadBuffer = glad_lazy_glNamedFramebufferReadBuffer;
+        glad_glInvalidateNamedFramebufferData = glad_lazy_glInvalidateNamedFramebufferData;
+        glad_glInvalidateNamedFramebufferSubData = glad_lazy_glInvalidateNamedFramebufferSubData;
+        glad_glClearNamedFramebufferiv = glad_lazy_glClearNamedFramebufferiv;
+        glad_glClearNamedFramebufferuiv = glad_lazy_glClearNamedFramebufferuiv;
+        glad_glClearNamedFramebufferfv = glad_lazy_glClearNamedFramebufferfv;
+        glad_glClearNamedFramebufferfi = glad_lazy_glClearNamedFramebufferfi;
+        glad_glBlitNamedFramebuffer = glad_lazy_glBlitNamedFramebuffer;
+        glad_glCheckNamedFramebufferStatus = glad_lazy_glCheckNamedFramebufferStatus;
+        glad_glGetNamedFramebufferParameteriv = glad_lazy_glGetNamedFramebufferParameteriv;
+        glad_glGetNamedFramebufferAttachmentParameteriv = glad_lazy_glGetNamedFramebufferAttachmentParameteriv;
+        glad_glCreateRenderbuffers = glad_lazy_glCreateRenderbuffers;
+        glad_glNamedRenderbufferStorage = glad_lazy_glNamedRenderbufferStorage;
+        glad_glNamedRenderbufferStorageMultisample = glad_lazy_glNamedRenderbufferStorageMultisample;
+        glad_glGetNamedRenderbufferParameteriv = glad_lazy_glGetNamedRenderbufferParameteriv;
+        glad_glCreateTextures = glad_lazy_glCreateTextures;
+        glad_glTextureBuffer = glad_lazy_glTextureBuffer;
+        glad_glTextureBufferRange = glad_lazy_glTextureBufferRange;
+        glad_glTextureStorage1D = glad_lazy_glTextureStorage1D;
+        glad_glTextureStorage2D = glad_lazy_glTextureStorage2D;
+        glad_glTextureStorage3D = glad_lazy_glTextureStorage3D;
+        glad_glTextureStorage2DMultisample = glad_lazy_glTextureStorage2DMultisample;
+        glad_glTextureStorage3DMultisample = glad_lazy_glTextureStorage3DMultisample;
+        glad_glTextureSubImage1D = glad_lazy_glTextureSubImage1D;
+        glad_glTextureSubImage2D = glad_lazy_glTextureSubImage2D;
+        glad_glTextureSubImage3D = glad_lazy_glTextureSubImage3D;
+        glad_glCompressedTextureSubImage1D = glad_lazy_glCompressedTextureSubImage1D;
+        glad_glCompressedTextureSubImage2D = glad_lazy_glCompressedTextureSubImage2D;
+        glad_glCompressedTextureSubImage3D = glad_lazy_glCompressedTextureSubImage3D;
+        glad_glCopyTextureSubImage1D = glad_lazy_glCopyTextureSubImage1D;
+        glad_glCopyTextureSubImage2D = glad_lazy_glCopyTextureSubImage2D;
+        glad_glCopyTextureSubImage3D = glad_lazy_glCopyTextureSubImage3D;
+        glad_glTextureParameterf = glad_lazy_glTextureParameterf;
+        glad_glTextureParameterfv = glad_lazy_glTextureParameterfv;
+        glad_glTextureParameteri = glad_lazy_glTextureParameteri;
+        glad_glTextureParameterIiv = glad_lazy_glTextureParameterIiv;
+        glad_glTextureParameterIuiv = glad_lazy_glTextureParameterIuiv;
+        glad_glTextureParameteriv = glad_lazy_glTextureParameteriv;
+        glad_glGenerateTextureMipmap = glad_lazy_glGenerateTextureMipmap;
+        glad_glBindTextureUnit = glad_lazy_glBindTextureUnit;
+        glad_glGetTextureImage = glad_lazy_glGetTextureImage;
+        glad_glGetCompressedTextureImage = glad_lazy_glGetCompressedTextureImage;
+        glad_glGetTextureLevelParameterfv = glad_lazy_glGetTextureLevelParameterfv;
+        glad_glGetTextureLevelParameteriv = glad_lazy_glGetTextureLevelParameteriv;
+        glad_glGetTextureParameterfv = glad_lazy_glGetTextureParameterfv;
+        glad_glGetTextureParameterIiv = glad_lazy_glGetTextureParameterIiv;
+        glad_glGetTextureParameterIuiv = glad_lazy_glGetTextureParameterIuiv;
+        glad_glGetTextureParameteriv = glad_lazy_glGetTextureParameteriv;
+        glad_glCreateVertexArrays = glad_lazy_glCreateVertexArrays;
+        glad_glDisableVertexArrayAttrib = glad_lazy_glDisableVertexArrayAttrib;
+        glad_glEnableVertexArrayAttrib = glad_lazy_glEnableVertexArrayAttrib;
+        glad_glVertexArrayElementBuffer = glad_lazy_glVertexArrayElementBuffer;
+        glad_glVertexArrayVertexBuffer = glad_lazy_glVertexArrayVertexBuffer;
+        glad_glVertexArrayVertexBuffers = glad_lazy_glVertexArrayVertexBuffers;
+        glad_glVertexArrayAttribBinding = glad_lazy_glVertexArrayAttribBinding;
+        glad_glVertexArrayAttribFormat = glad_lazy_glVertexArrayAttribFormat;
+        glad_glVertexArrayAttribIFormat = glad_lazy_glVertexArrayAttribIFormat;
+        glad_glVertexArrayAttribLFormat = glad_lazy_glVertexArrayAttribLFormat;
+        glad_glVertexArrayBindingDivisor = glad_lazy_glVertexArrayBindingDivisor;
+        glad_glGetVertexArrayiv = glad_lazy_glGetVertexArrayiv;
+        glad_glGetVertexArrayIndexediv = glad_lazy_glGetVertexArrayIndexediv;
+        glad_glGetVertexArrayIndexed64iv = glad_lazy_glGetVertexArrayIndexed64iv;
+        glad_glCreateSamplers = glad_lazy_glCreateSamplers;
+        glad_glCreateProgramPipelines = glad_lazy_glCreateProgramPipelines;
+        glad_glCreateQueries = glad_lazy_glCreateQueries;
+        glad_glGetQueryBufferObjecti64v = glad_lazy_glGetQueryBufferObjecti64v;
+        glad_glGetQueryBufferObjectiv = glad_lazy_glGetQueryBufferObjectiv;
+        glad_glGetQueryBufferObjectui64v = glad_lazy_glGetQueryBufferObjectui64v;
+        glad_glGetQueryBufferObjectuiv = glad_lazy_glGetQueryBufferObjectuiv;
+        glad_glMemoryBarrierByRegion = glad_lazy_glMemoryBarrierByRegion;
+        glad_glGetTextureSubImage = glad_lazy_glGetTextureSubImage;
+        glad_glGetCompressedTextureSubImage = glad_lazy_glGetCompressedTextureSubImage;
+        glad_glGetGraphicsResetStatus = glad_lazy_glGetGraphicsResetStatus;
+        glad_glGetnCompressedTexImage = glad_lazy_glGetnCompressedTexImage;
+        glad_glGetnTexImage = glad_lazy_glGetnTexImage;
+        glad_glGetnUniformdv = glad_lazy_glGetnUniformdv;
+        glad_glGetnUniformfv = glad_lazy_glGetnUniformfv;
+        glad_glGetnUniformiv = glad_lazy_glGetnUniformiv;
+        glad_glGetnUniformuiv = glad_lazy_glGetnUniformuiv;
+        glad_glReadnPixels = glad_lazy_glReadnPixels;
+        glad_glGetnMapdv = glad_lazy_glGetnMapdv;
+        glad_glGetnMapfv = glad_lazy_glGetnMapfv;
+        glad_glGetnMapiv = glad_lazy_glGetnMapiv;
+        glad_glGetnPixelMapfv = glad_lazy_glGetnPixelMapfv;
+        glad_glGetnPixelMapuiv = glad_lazy_glGetnPixelMapuiv;
+        glad_glGetnPixelMapusv = glad_lazy_glGetnPixelMapusv;
+        glad_glGetnPolygonStipple = glad_lazy_glGetnPolygonStipple;
+        glad_glGetnColorTable = glad_lazy_glGetnColorTable;
+        glad_glGetnConvolutionFilter = glad_lazy_glGetnConvolutionFilter;
+        glad_glGetnSeparableFilter = glad_lazy_glGetnSeparableFilter;
+        glad_glGetnHistogram = glad_lazy_glGetnHistogram;
+        glad_glGetnMinmax = glad_lazy_glGetnMinmax;
+        glad_glTextureBarrier = glad_lazy_glTextureBarrier;
+    }
+    if(GLAD_GL_VERSION_4_6) {
+        glad_glSpecializeShader = glad_lazy_glSpecializeShader;
+        glad_glMultiDrawArraysIndirectCount = glad_lazy_glMultiDrawArraysIndirectCount;
+        glad_glMultiDrawElementsIndirectCount = glad_lazy_glMultiDrawElementsIndirectCount;
+        glad_glPolygonOffsetClamp = glad_lazy_glPolygonOffsetClamp;
+    }
+}
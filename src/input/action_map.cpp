@@ -0,0 +1,257 @@
+#include "input/action_map.hpp"
+
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+
+#include "memory/memory.hpp"
+
+namespace bloom
+{
+    namespace
+    {
+        struct NamedControl
+        {
+            const char* name;
+            int code;
+        };
+
+        // Keys whose GLFW name is not a single character or F-number.
+        constexpr NamedControl kNamedKeys[] = {
+            {"SPACE", GLFW_KEY_SPACE},
+            {"APOSTROPHE", GLFW_KEY_APOSTROPHE},
+            {"COMMA", GLFW_KEY_COMMA},
+            {"MINUS", GLFW_KEY_MINUS},
+            {"PERIOD", GLFW_KEY_PERIOD},
+            {"SLASH", GLFW_KEY_SLASH},
+            {"SEMICOLON", GLFW_KEY_SEMICOLON},
+            {"EQUAL", GLFW_KEY_EQUAL},
+            {"LEFT_BRACKET", GLFW_KEY_LEFT_BRACKET},
+            {"BACKSLASH", GLFW_KEY_BACKSLASH},
+            {"RIGHT_BRACKET", GLFW_KEY_RIGHT_BRACKET},
+            {"GRAVE_ACCENT", GLFW_KEY_GRAVE_ACCENT},
+            {"WORLD_1", GLFW_KEY_WORLD_1},
+            {"WORLD_2", GLFW_KEY_WORLD_2},
+            {"ESCAPE", GLFW_KEY_ESCAPE},
+            {"ENTER", GLFW_KEY_ENTER},
+            {"TAB", GLFW_KEY_TAB},
+            {"BACKSPACE", GLFW_KEY_BACKSPACE},
+            {"INSERT", GLFW_KEY_INSERT},
+            {"DELETE", GLFW_KEY_DELETE},
+            {"RIGHT", GLFW_KEY_RIGHT},
+            {"LEFT", GLFW_KEY_LEFT},
+            {"DOWN", GLFW_KEY_DOWN},
+            {"UP", GLFW_KEY_UP},
+            {"PAGE_UP", GLFW_KEY_PAGE_UP},
+            {"PAGE_DOWN", GLFW_KEY_PAGE_DOWN},
+            {"HOME", GLFW_KEY_HOME},
+            {"END", GLFW_KEY_END},
+            {"CAPS_LOCK", GLFW_KEY_CAPS_LOCK},
+            {"SCROLL_LOCK", GLFW_KEY_SCROLL_LOCK},
+            {"NUM_LOCK", GLFW_KEY_NUM_LOCK},
+            {"PRINT_SCREEN", GLFW_KEY_PRINT_SCREEN},
+            {"PAUSE", GLFW_KEY_PAUSE},
+            {"KP_0", GLFW_KEY_KP_0},
+            {"KP_1", GLFW_KEY_KP_1},
+            {"KP_2", GLFW_KEY_KP_2},
+            {"KP_3", GLFW_KEY_KP_3},
+            {"KP_4", GLFW_KEY_KP_4},
+            {"KP_5", GLFW_KEY_KP_5},
+            {"KP_6", GLFW_KEY_KP_6},
+            {"KP_7", GLFW_KEY_KP_7},
+            {"KP_8", GLFW_KEY_KP_8},
+            {"KP_9", GLFW_KEY_KP_9},
+            {"KP_DECIMAL", GLFW_KEY_KP_DECIMAL},
+            {"KP_DIVIDE", GLFW_KEY_KP_DIVIDE},
+            {"KP_MULTIPLY", GLFW_KEY_KP_MULTIPLY},
+            {"KP_SUBTRACT", GLFW_KEY_KP_SUBTRACT},
+            {"KP_ADD", GLFW_KEY_KP_ADD},
+            {"KP_ENTER", GLFW_KEY_KP_ENTER},
+            {"KP_EQUAL", GLFW_KEY_KP_EQUAL},
+            {"LEFT_SHIFT", GLFW_KEY_LEFT_SHIFT},
+            {"LEFT_CONTROL", GLFW_KEY_LEFT_CONTROL},
+            {"LEFT_ALT", GLFW_KEY_LEFT_ALT},
+            {"LEFT_SUPER", GLFW_KEY_LEFT_SUPER},
+            {"RIGHT_SHIFT", GLFW_KEY_RIGHT_SHIFT},
+            {"RIGHT_CONTROL", GLFW_KEY_RIGHT_CONTROL},
+            {"RIGHT_ALT", GLFW_KEY_RIGHT_ALT},
+            {"RIGHT_SUPER", GLFW_KEY_RIGHT_SUPER},
+            {"MENU", GLFW_KEY_MENU},
+        };
+
+        constexpr NamedControl kMouseButtons[] = {
+            {"LEFT", GLFW_MOUSE_BUTTON_LEFT},
+            {"RIGHT", GLFW_MOUSE_BUTTON_RIGHT},
+            {"MIDDLE", GLFW_MOUSE_BUTTON_MIDDLE},
+            {"4", GLFW_MOUSE_BUTTON_4},
+            {"5", GLFW_MOUSE_BUTTON_5},
+            {"6", GLFW_MOUSE_BUTTON_6},
+            {"7", GLFW_MOUSE_BUTTON_7},
+            {"8", GLFW_MOUSE_BUTTON_8},
+        };
+
+        int keyFromName(const std::string& name)
+        {
+            if (name.size() == 1 && ((name[0] >= 'A' && name[0] <= 'Z') || (name[0] >= '0' && name[0] <= '9')))
+                return name[0];   // GLFW_KEY_A.. and GLFW_KEY_0.. are ASCII
+
+            if (name.size() > 1 && name[0] == 'F')
+            {
+                const int number = std::atoi(name.c_str() + 1);
+                if (number >= 1 && number <= 25 && std::to_string(number) == name.substr(1))
+                    return GLFW_KEY_F1 + number - 1;
+            }
+
+            for (const NamedControl& key : kNamedKeys)
+            {
+                if (name == key.name)
+                    return key.code;
+            }
+            return -1;
+        }
+
+        int mouseButtonFromName(const std::string& name)
+        {
+            for (const NamedControl& button : kMouseButtons)
+            {
+                if (name == button.name)
+                    return button.code;
+            }
+            return -1;
+        }
+    }
+
+    int ActionMap::addAction(const std::string& name)
+    {
+        const int existing = find(name);
+        if (existing >= 0)
+            return existing;
+        if (actionCount() == kMaxActions)
+            return -1;
+
+        MemoryTagScope tag(MemoryTag::Input);
+        m_names.push_back(name);
+        return actionCount() - 1;
+    }
+
+    int ActionMap::find(const std::string& name) const
+    {
+        for (int i = 0; i < actionCount(); ++i)
+        {
+            if (m_names[i] == name)
+                return i;
+        }
+        return -1;
+    }
+
+    bool ActionMap::bind(int action, InputDevice device, int code)
+    {
+        if (action < 0 || action >= actionCount())
+            return false;
+
+        const uint64_t bit = uint64_t{1} << action;
+        switch (device)
+        {
+        case InputDevice::Key:
+            if (code < 0 || code > GLFW_KEY_LAST)
+                return false;
+            m_keys[code] |= bit;
+            return true;
+        case InputDevice::MouseButton:
+            if (code < 0 || code > GLFW_MOUSE_BUTTON_LAST)
+                return false;
+            m_mouseButtons[code] |= bit;
+            return true;
+        }
+        return false;
+    }
+
+    void ActionMap::clearBindings()
+    {
+        m_keys.fill(0);
+        m_mouseButtons.fill(0);
+    }
+
+    bool ActionMap::parse(const char* text, const char* source)
+    {
+        MemoryTagScope tag(MemoryTag::Input);
+        std::istringstream stream(text);
+        std::string line;
+        for (int number = 1; std::getline(stream, line); ++number)
+        {
+            if (const std::size_t comment = line.find('#'); comment != std::string::npos)
+                line.resize(comment);
+
+            std::istringstream fields(line);
+            std::string action;
+            std::string device;
+            std::string control;
+            std::string extra;
+            if (!(fields >> action))
+                continue;
+
+            if (!(fields >> device >> control) || (fields >> extra))
+            {
+                std::fprintf(stderr, "%s:%d: expected '<action> <key|mouse> <control>'\n", source, number);
+                return false;
+            }
+
+            int code = -1;
+            InputDevice kind = InputDevice::Key;
+            if (device == "key")
+            {
+                code = keyFromName(control);
+            }
+            else if (device == "mouse")
+            {
+                kind = InputDevice::MouseButton;
+                code = mouseButtonFromName(control);
+            }
+            else
+            {
+                std::fprintf(stderr, "%s:%d: unknown device '%s'\n", source, number, device.c_str());
+                return false;
+            }
+
+            if (code < 0)
+            {
+                std::fprintf(stderr, "%s:%d: unknown %s '%s'\n", source, number, device.c_str(), control.c_str());
+                return false;
+            }
+
+            const int id = addAction(action);
+            if (id < 0)
+            {
+                std::fprintf(stderr, "%s:%d: more than %d actions\n", source, number, kMaxActions);
+                return false;
+            }
+            bind(id, kind, code);
+        }
+        return true;
+    }
+
+    bool ActionMap::load(const char* path)
+    {
+        std::ifstream file(path);
+        if (!file)
+        {
+            std::fprintf(stderr, "Failed to open %s\n", path);
+            return false;
+        }
+
+        std::ostringstream text;
+        text << file.rdbuf();
+        return parse(text.str().c_str(), path);
+    }
+
+    uint64_t ActionMap::keyActions(int key) const
+    {
+        return key >= 0 && key <= GLFW_KEY_LAST ? m_keys[key] : 0;
+    }
+
+    uint64_t ActionMap::mouseActions(int button) const
+    {
+        return button >= 0 && button <= GLFW_MOUSE_BUTTON_LAST ? m_mouseButtons[button] : 0;
+    }
+}
@@ -0,0 +1,58 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "GLFW/glfw3.h"
+
+namespace bloom
+{
+    enum class InputDevice : uint8_t
+    {
+        Key,
+        MouseButton,
+    };
+
+    // Named actions and the keys and mouse buttons that trigger them,
+    // loaded from text so bindings can change without a rebuild:
+    //
+    //     # action   device  control
+    //     pause      key     SPACE
+    //     faster     key     UP
+    //     faster     mouse   LEFT
+    //
+    // Controls use GLFW's names without the prefix (A, 1, F5, LEFT_SHIFT,
+    // ESCAPE; LEFT, RIGHT, MIDDLE, 4-8 for mouse buttons). An action may
+    // have any number of bindings and a control may trigger several actions.
+    class ActionMap
+    {
+    public:
+        static constexpr int kMaxActions = 64;
+
+        // Returns the action's id, creating it if needed; -1 when full.
+        int addAction(const std::string& name);
+        // Returns -1 for names that are not defined.
+        int find(const std::string& name) const;
+        const std::string& name(int action) const { return m_names[action]; }
+        int actionCount() const { return static_cast<int>(m_names.size()); }
+
+        bool bind(int action, InputDevice device, int code);
+        void clearBindings();
+
+        // Adds the bindings in `text`; stops at and reports the first bad
+        // line. `source` names the text in error messages.
+        bool parse(const char* text, const char* source = "bindings");
+        bool load(const char* path);
+
+        // Bit per action bound to the control; 0 for anything unbound.
+        uint64_t keyActions(int key) const;
+        uint64_t mouseActions(int button) const;
+
+    private:
+        std::vector<std::string> m_names;
+        std::array<uint64_t, GLFW_KEY_LAST + 1> m_keys{};
+        std::array<uint64_t, GLFW_MOUSE_BUTTON_LAST + 1> m_mouseButtons{};
+    };
+}
@@ -0,0 +1,29 @@
+#pragma once
+
+#include <cstdint>
+
+namespace bloom
+{
+    enum class InputEventType : uint8_t
+    {
+        Key,
+        MouseButton,
+        CursorPos,
+        Scroll,
+    };
+
+    // One GLFW callback, stamped with Clock::now() when GLFW delivered it.
+    // Key and MouseButton use code/action/mods; CursorPos and Scroll use x/y.
+    struct InputEvent
+    {
+        uint64_t timestamp = 0;
+        InputEventType type = InputEventType::Key;
+        uint8_t action = 0;     // GLFW_PRESS, GLFW_RELEASE or GLFW_REPEAT
+        uint16_t mods = 0;
+        int32_t code = 0;       // GLFW key or mouse button
+        float x = 0.f;
+        float y = 0.f;
+    };
+
+    static_assert(sizeof(InputEvent) == 24);
+}
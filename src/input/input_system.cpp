@@ -0,0 +1,185 @@
+#include "input/input_system.hpp"
+
+#include <algorithm>
+#include <bit>
+
+#include "GLFW/glfw3.h"
+
+#include "core/clock.hpp"
+
+namespace bloom
+{
+    void InputSystem::attach(GLFWwindow* window)
+    {
+        glfwSetWindowUserPointer(window, this);
+        glfwSetKeyCallback(window, keyCallback);
+        glfwSetMouseButtonCallback(window, mouseButtonCallback);
+        glfwSetCursorPosCallback(window, cursorPosCallback);
+        glfwSetScrollCallback(window, scrollCallback);
+    }
+
+    void InputSystem::keyCallback(GLFWwindow* window, int key, int, int action, int mods)
+    {
+        InputEvent event;
+        event.type = InputEventType::Key;
+        event.code = key;
+        event.action = static_cast<uint8_t>(action);
+        event.mods = static_cast<uint16_t>(mods);
+        static_cast<InputSystem*>(glfwGetWindowUserPointer(window))->enqueue(event);
+    }
+
+    void InputSystem::mouseButtonCallback(GLFWwindow* window, int button, int action, int mods)
+    {
+        InputEvent event;
+        event.type = InputEventType::MouseButton;
+        event.code = button;
+        event.action = static_cast<uint8_t>(action);
+        event.mods = static_cast<uint16_t>(mods);
+        static_cast<InputSystem*>(glfwGetWindowUserPointer(window))->enqueue(event);
+    }
+
+    void InputSystem::cursorPosCallback(GLFWwindow* window, double x, double y)
+    {
+        InputEvent event;
+        event.type = InputEventType::CursorPos;
+        event.x = static_cast<float>(x);
+        event.y = static_cast<float>(y);
+        static_cast<InputSystem*>(glfwGetWindowUserPointer(window))->enqueue(event);
+    }
+
+    void InputSystem::scrollCallback(GLFWwindow* window, double x, double y)
+    {
+        InputEvent event;
+        event.type = InputEventType::Scroll;
+        event.x = static_cast<float>(x);
+        event.y = static_cast<float>(y);
+        static_cast<InputSystem*>(glfwGetWindowUserPointer(window))->enqueue(event);
+    }
+
+    void InputSystem::enqueue(InputEvent event)
+    {
+        event.timestamp = Clock::now();
+        if (!m_events.push(event))
+            m_dropped.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    const InputState& InputSystem::update(uint64_t until)
+    {
+        m_state.pressed = 0;
+        m_state.released = 0;
+        m_state.scrollX = 0.f;
+        m_state.scrollY = 0.f;
+
+        const uint64_t now = Clock::now();
+        while (const InputEvent* event = m_events.peek())
+        {
+            if (event->timestamp > until)
+                break;
+
+            apply(*event);
+            recordLatency(now > event->timestamp ? now - event->timestamp : 0);
+            m_events.pop();
+        }
+        return m_state;
+    }
+
+    void InputSystem::apply(const InputEvent& event)
+    {
+        switch (event.type)
+        {
+        case InputEventType::Key:
+        case InputEventType::MouseButton:
+        {
+            const uint64_t actions = event.type == InputEventType::Key ? m_actions.keyActions(event.code)
+                                                                       : m_actions.mouseActions(event.code);
+            if (event.action == GLFW_PRESS)
+                hold(actions);
+            else if (event.action == GLFW_RELEASE)
+                letGo(actions);
+            break;
+        }
+        case InputEventType::CursorPos:
+            m_state.cursorX = event.x;
+            m_state.cursorY = event.y;
+            break;
+        case InputEventType::Scroll:
+            m_state.scrollX += event.x;
+            m_state.scrollY += event.y;
+            break;
+        }
+    }
+
+    void InputSystem::hold(uint64_t actions)
+    {
+        for (; actions; actions &= actions - 1)
+        {
+            const int action = std::countr_zero(actions);
+            if (m_holds[action]++ == 0)
+            {
+                m_state.down |= uint64_t{1} << action;
+                m_state.pressed |= uint64_t{1} << action;
+            }
+        }
+    }
+
+    void InputSystem::letGo(uint64_t actions)
+    {
+        for (; actions; actions &= actions - 1)
+        {
+            // A release without a press happens when the key went down
+            // before the window had focus; there is nothing to undo.
+            const int action = std::countr_zero(actions);
+            if (m_holds[action] == 0)
+                continue;
+
+            if (--m_holds[action] == 0)
+            {
+                m_state.down &= ~(uint64_t{1} << action);
+                m_state.released |= uint64_t{1} << action;
+            }
+        }
+    }
+
+    void InputSystem::recordLatency(uint64_t ticks)
+    {
+        const double ms = Clock::toMilliseconds(ticks);
+        const uint32_t bucket = std::min(static_cast<uint32_t>(ms / kBucketMs), kLatencyBuckets - 1);
+        m_latencyBuckets[bucket].fetch_add(1, std::memory_order_relaxed);
+        m_latencyCount.fetch_add(1, std::memory_order_relaxed);
+        m_latencyTotal.fetch_add(ticks, std::memory_order_relaxed);
+        if (ticks > m_latencyMax.load(std::memory_order_relaxed))
+            m_latencyMax.store(ticks, std::memory_order_relaxed);
+    }
+
+    InputLatencySummary InputSystem::latency() const
+    {
+        InputLatencySummary summary;
+        summary.events = m_latencyCount.load(std::memory_order_relaxed);
+        summary.dropped = m_dropped.load(std::memory_order_relaxed);
+        if (summary.events == 0)
+            return summary;
+
+        summary.meanMs = Clock::toMilliseconds(m_latencyTotal.load(std::memory_order_relaxed)) / summary.events;
+        summary.maxMs = Clock::toMilliseconds(m_latencyMax.load(std::memory_order_relaxed));
+
+        // Percentiles come from the histogram, so they are upper bounds
+        // rounded to the bucket width.
+        uint64_t seen = 0;
+        const uint64_t p50 = (summary.events + 1) / 2;
+        const uint64_t p99 = summary.events - summary.events / 100;
+        for (uint32_t bucket = 0; bucket < kLatencyBuckets; ++bucket)
+        {
+            const uint64_t before = seen;
+            seen += m_latencyBuckets[bucket].load(std::memory_order_relaxed);
+            const double upper = std::min((bucket + 1) * kBucketMs, summary.maxMs);
+            if (before < p50 && seen >= p50)
+                summary.p50Ms = upper;
+            if (before < p99 && seen >= p99)
+            {
+                summary.p99Ms = upper;
+                break;
+            }
+        }
+        return summary;
+    }
+}
@@ -0,0 +1,102 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+
+#include "core/spsc_ring.hpp"
+#include "input/action_map.hpp"
+#include "input/input_event.hpp"
+
+struct GLFWwindow;
+
+namespace bloom
+{
+    // What the simulation sees for one tick. Actions are bit masks indexed
+    // by ActionMap ids; pressed/released cover only the events applied by
+    // the latest update, so a tap shorter than a tick still registers.
+    struct InputState
+    {
+        uint64_t down = 0;
+        uint64_t pressed = 0;
+        uint64_t released = 0;
+
+        float cursorX = 0.f;
+        float cursorY = 0.f;
+        float scrollX = 0.f;    // accumulated over the latest update
+        float scrollY = 0.f;
+
+        bool isDown(int action) const { return action >= 0 && (down >> action) & 1; }
+        bool wasPressed(int action) const { return action >= 0 && (pressed >> action) & 1; }
+        bool wasReleased(int action) const { return action >= 0 && (released >> action) & 1; }
+    };
+
+    struct InputLatencySummary
+    {
+        uint64_t events = 0;
+        uint64_t dropped = 0;   // events lost to a full queue
+        double meanMs = 0.0;
+        double p50Ms = 0.0;
+        double p99Ms = 0.0;
+        double maxMs = 0.0;
+    };
+
+    // Moves GLFW input from the main thread to the simulation thread.
+    //
+    // The window callbacks stamp each event with Clock::now() and push it
+    // into a lock-free SPSC ring; they never block, so a stalled simulation
+    // costs dropped events rather than a frozen event pump. update() runs on
+    // the simulation thread and applies, in order, every event stamped no
+    // later than the tick it is called for, so catch-up ticks see input in
+    // the tick it actually happened in. The delay from callback to update()
+    // is recorded as the event-to-simulation latency.
+    class InputSystem
+    {
+    public:
+        static constexpr std::size_t kQueueCapacity = 4096;
+
+        // Main thread, before the simulation starts. Installs the key,
+        // mouse button, cursor and scroll callbacks and takes the window's
+        // user pointer.
+        void attach(GLFWwindow* window);
+
+        // Edit before the simulation starts; read-only afterwards.
+        ActionMap& actions() { return m_actions; }
+        const ActionMap& actions() const { return m_actions; }
+
+        // Simulation thread.
+        const InputState& update(uint64_t until);
+        const InputState& state() const { return m_state; }
+
+        // Safe from any thread.
+        InputLatencySummary latency() const;
+
+    private:
+        static constexpr uint32_t kLatencyBuckets = 2048;
+        static constexpr double kBucketMs = 0.05;
+
+        static void keyCallback(GLFWwindow* window, int key, int scancode, int action, int mods);
+        static void mouseButtonCallback(GLFWwindow* window, int button, int action, int mods);
+        static void cursorPosCallback(GLFWwindow* window, double x, double y);
+        static void scrollCallback(GLFWwindow* window, double x, double y);
+
+        void enqueue(InputEvent event);
+        void apply(const InputEvent& event);
+        void hold(uint64_t actions);
+        void letGo(uint64_t actions);
+        void recordLatency(uint64_t ticks);
+
+        ActionMap m_actions;
+        SpscRing<InputEvent, kQueueCapacity> m_events;
+        std::atomic<uint64_t> m_dropped{0};
+
+        InputState m_state;
+        // How many bound controls currently hold each action down.
+        std::array<uint8_t, ActionMap::kMaxActions> m_holds{};
+
+        std::array<std::atomic<uint32_t>, kLatencyBuckets> m_latencyBuckets{};
+        std::atomic<uint64_t> m_latencyCount{0};
+        std::atomic<uint64_t> m_latencyTotal{0};
+        std::atomic<uint64_t> m_latencyMax{0};
+    };
+}
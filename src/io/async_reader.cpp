@@ -0,0 +1,439 @@
+#include "io/async_reader.hpp"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdio>
+
+#include "core/profiler.hpp"
+#include "memory/memory.hpp"
+
+namespace bloom
+{
+    AsyncReader::AsyncReader(IoBackendKind backend, uint32_t queueDepth, uint32_t chunkSize)
+        : m_queueDepth(std::max(queueDepth, 1u))
+        , m_chunkSize(std::max(chunkSize, 4096u))
+    {
+        MemoryTagScope tag(MemoryTag::Io);
+        if (backend != IoBackendKind::Threads)
+            m_backend = createUringBackend(m_queueDepth);
+        if (!m_backend)
+        {
+            if (backend == IoBackendKind::Uring)
+                std::fprintf(stderr, "io_uring is unavailable; reading on blocking threads instead\n");
+            m_backend = createThreadBackend(std::min(m_queueDepth, 4u));
+        }
+
+        m_chunks.resize(m_queueDepth);
+        for (uint32_t i = m_queueDepth; i-- > 0;)
+            m_freeChunks.push_back(i);
+
+        m_thread = std::thread(&AsyncReader::ioMain, this);
+    }
+
+    AsyncReader::~AsyncReader()
+    {
+        cancelAll();
+        {
+            std::lock_guard lock(m_mutex);
+            m_stopping = true;
+        }
+        signal();
+        m_thread.join();
+    }
+
+    IoHandle AsyncReader::read(const IoRead& request)
+    {
+        if (!request.path || (request.size > 0 && !request.destination) || request.priority >= IoPriority::Count)
+        {
+            std::fprintf(stderr, "AsyncReader: malformed read of %s\n", request.path ? request.path : "(null)");
+            return {};
+        }
+
+        IoHandle handle;
+        {
+            MemoryTagScope tag(MemoryTag::Io);
+            std::lock_guard lock(m_mutex);
+
+            uint32_t index;
+            if (m_free.empty())
+            {
+                index = static_cast<uint32_t>(m_requests.size());
+                m_requests.emplace_back();
+            }
+            else
+            {
+                index = m_free.back();
+                m_free.pop_back();
+            }
+
+            Request& r = m_requests[index];
+            r.path = request.path;
+            r.offset = request.offset;
+            r.size = request.size;
+            r.destination = static_cast<std::byte*>(request.destination);
+            r.callback = request.callback;
+            r.user = request.user;
+            r.priority = request.priority;
+            r.state = State::Incoming;
+            r.cancelled = false;
+            r.file = nullptr;
+            r.issued = 0;
+            r.completed = 0;
+            r.inFlight = 0;
+            r.error = 0;
+
+            m_incoming.push_back(index);
+            ++m_outstanding;
+            handle = {index, r.generation};
+        }
+
+        m_requestCount.fetch_add(1, std::memory_order_relaxed);
+        signal();
+        return handle;
+    }
+
+    bool AsyncReader::cancel(IoHandle handle)
+    {
+        bool cancelled = false;
+        {
+            std::lock_guard lock(m_mutex);
+            if (handle.index < m_requests.size() && m_requests[handle.index].generation == handle.generation)
+                cancelled = cancelLocked(handle.index);
+        }
+        if (cancelled)
+            signal();
+        return cancelled;
+    }
+
+    void AsyncReader::cancelAll()
+    {
+        {
+            std::lock_guard lock(m_mutex);
+            for (uint32_t index = 0; index < m_requests.size(); ++index)
+                cancelLocked(index);
+        }
+        signal();
+    }
+
+    bool AsyncReader::cancelLocked(uint32_t index)
+    {
+        Request& r = m_requests[index];
+        if (r.state == State::Free || r.state == State::Finishing)
+            return false;
+        if (r.cancelled)
+            return true;
+        r.cancelled = true;
+
+        // Requests nothing has been issued for leave straight away. The rest
+        // are noticed by the I/O thread: after the open, at the front of
+        // their queue, or when their last chunk lands.
+        if (r.state == State::Incoming)
+        {
+            m_incoming.erase(std::find(m_incoming.begin(), m_incoming.end(), index));
+        }
+        else if (r.state == State::Queued && r.issued == 0)
+        {
+            std::deque<uint32_t>& queue = m_queues[static_cast<std::size_t>(r.priority)];
+            queue.erase(std::find(queue.begin(), queue.end(), index));
+        }
+        else
+        {
+            return true;
+        }
+
+        r.state = State::Finishing;
+        m_cancelled.push_back(index);
+        return true;
+    }
+
+    void AsyncReader::waitIdle()
+    {
+        std::unique_lock lock(m_mutex);
+        m_idleCondition.wait(lock, [this] { return m_outstanding == 0; });
+    }
+
+    std::size_t AsyncReader::outstanding() const
+    {
+        std::lock_guard lock(m_mutex);
+        return m_outstanding;
+    }
+
+    AsyncReader::Stats AsyncReader::stats() const
+    {
+        Stats stats;
+        stats.requests = m_requestCount.load(std::memory_order_relaxed);
+        stats.completed = m_completedCount.load(std::memory_order_relaxed);
+        stats.failed = m_failedCount.load(std::memory_order_relaxed);
+        stats.cancelled = m_cancelledCount.load(std::memory_order_relaxed);
+        stats.chunks = m_chunkCount.load(std::memory_order_relaxed);
+        stats.bytes = m_byteCount.load(std::memory_order_relaxed);
+        return stats;
+    }
+
+    void AsyncReader::signal()
+    {
+        // Pairs with the m_reaping store and m_work load in ioMain(): either
+        // the I/O thread sees the new work before it blocks in reap(), or
+        // this sees it reaping and wakes it.
+        m_work.store(true);
+        m_condition.notify_one();
+        if (m_reaping.load())
+            m_backend->wake();
+    }
+
+    bool AsyncReader::hasWork() const
+    {
+        if (m_stopping || !m_incoming.empty() || !m_cancelled.empty())
+            return true;
+        return std::any_of(m_queues.begin(), m_queues.end(), [](const std::deque<uint32_t>& queue) { return !queue.empty(); });
+    }
+
+    void AsyncReader::ioMain()
+    {
+        Profiler::setThreadName("IO");
+        MemoryTagScope tag(MemoryTag::Io);
+
+        std::vector<uint32_t> incoming;
+        std::vector<uint32_t> finished;
+        std::vector<IoEvent> events(m_queueDepth);
+
+        while (true)
+        {
+            {
+                std::unique_lock lock(m_mutex);
+                if (m_inFlight == 0)
+                    m_condition.wait(lock, [this] { return hasWork(); });
+                if (m_stopping && m_outstanding == 0)
+                    break;
+
+                m_work.store(false);
+                incoming.swap(m_incoming);
+                for (uint32_t index : incoming)
+                    m_requests[index].state = State::Opening;
+                finished.insert(finished.end(), m_cancelled.begin(), m_cancelled.end());
+                m_cancelled.clear();
+                schedule(finished);
+            }
+
+            openIncoming(incoming, finished);
+            m_backend->submit();
+            for (uint32_t index : finished)
+                finish(index);
+            finished.clear();
+
+            if (m_inFlight == 0)
+                continue;
+
+            m_reaping.store(true);
+            const bool wait = !m_work.load();
+            const uint32_t count = m_backend->reap(events, wait);
+            m_reaping.store(false);
+
+            for (uint32_t i = 0; i < count; ++i)
+                complete(events[i], finished);
+            m_backend->submit();
+            for (uint32_t index : finished)
+                finish(index);
+            finished.clear();
+        }
+    }
+
+    void AsyncReader::openIncoming(std::vector<uint32_t>& incoming, std::vector<uint32_t>& finished)
+    {
+        if (incoming.empty())
+            return;
+
+        for (uint32_t index : incoming)
+        {
+            Request& r = lockedRequest(index);
+
+            // Opening can block on a cold directory, so it happens here
+            // rather than in read() and without the lock held.
+            int error = 0;
+            OpenFile* file = acquireFile(r.path, error);
+
+            std::lock_guard lock(m_mutex);
+            r.file = file;
+            r.error = error;
+            if (file)
+                r.size = r.offset >= file->size ? 0 : std::min(r.size, file->size - r.offset);
+
+            if (r.cancelled || !file || r.size == 0)
+            {
+                r.state = State::Finishing;
+                finished.push_back(index);
+            }
+            else
+            {
+                r.state = State::Queued;
+                m_queues[static_cast<std::size_t>(r.priority)].push_back(index);
+            }
+        }
+        incoming.clear();
+
+        std::lock_guard lock(m_mutex);
+        schedule(finished);
+    }
+
+    void AsyncReader::schedule(std::vector<uint32_t>& finished)
+    {
+        // Highest priority first; within a priority, first come first
+        // served. Only the front request of a queue is ever part issued.
+        for (std::deque<uint32_t>& queue : m_queues)
+        {
+            while (!queue.empty())
+            {
+                const uint32_t index = queue.front();
+                Request& r = m_requests[index];
+                if (r.cancelled)
+                {
+                    queue.pop_front();
+                    r.state = r.inFlight > 0 ? State::Active : State::Finishing;
+                    if (r.inFlight == 0)
+                        finished.push_back(index);
+                    continue;
+                }
+                if (m_inFlight == m_queueDepth)
+                    return;
+
+                const uint32_t chunk = m_freeChunks.back();
+                m_freeChunks.pop_back();
+                const uint32_t size = static_cast<uint32_t>(std::min<uint64_t>(m_chunkSize, r.size - r.issued));
+                m_chunks[chunk] = {&r, index, size, r.issued};
+                m_backend->read(r.file->handle, r.destination + r.issued, size, r.offset + r.issued, chunk);
+
+                r.issued += size;
+                ++r.inFlight;
+                ++m_inFlight;
+                m_chunkCount.fetch_add(1, std::memory_order_relaxed);
+                if (r.issued == r.size)
+                {
+                    queue.pop_front();
+                    r.state = State::Active;
+                }
+            }
+        }
+    }
+
+    void AsyncReader::complete(const IoEvent& event, std::vector<uint32_t>& finished)
+    {
+        Chunk& chunk = m_chunks[event.tag];
+        const uint32_t index = chunk.index;
+        Request& r = *chunk.request;
+
+        if (event.result > 0 && event.result < chunk.size)
+        {
+            // Short read: ask for the rest with the same chunk slot.
+            const uint32_t read = static_cast<uint32_t>(event.result);
+            r.completed += read;
+            m_byteCount.fetch_add(read, std::memory_order_relaxed);
+            chunk.offset += read;
+            chunk.size -= read;
+            m_backend->read(r.file->handle, r.destination + chunk.offset, chunk.size, r.offset + chunk.offset, event.tag);
+            return;
+        }
+
+        if (event.result > 0)
+        {
+            r.completed += static_cast<uint64_t>(event.result);
+            m_byteCount.fetch_add(static_cast<uint64_t>(event.result), std::memory_order_relaxed);
+        }
+        else if (r.error == 0)
+        {
+            // Zero means the file shrank under us.
+            r.error = event.result < 0 ? static_cast<int>(-event.result) : EIO;
+        }
+
+        m_freeChunks.push_back(static_cast<uint32_t>(event.tag));
+        --m_inFlight;
+        --r.inFlight;
+
+        std::lock_guard lock(m_mutex);
+        if (r.state == State::Queued && r.error != 0)
+        {
+            std::deque<uint32_t>& queue = m_queues[static_cast<std::size_t>(r.priority)];
+            queue.erase(std::find(queue.begin(), queue.end(), index));
+            r.state = State::Active;
+        }
+        if (r.inFlight > 0 || r.state != State::Active)
+            return;
+
+        r.state = State::Finishing;
+        finished.push_back(index);
+    }
+
+    void AsyncReader::finish(uint32_t index)
+    {
+        Request& r = lockedRequest(index);
+
+        IoCompletion completion;
+        completion.handle = {index, r.generation};
+        completion.error = r.error;
+        completion.data = r.destination;
+        completion.size = r.completed;
+        completion.user = r.user;
+        if (r.error != 0)
+        {
+            completion.status = IoStatus::Failed;
+            m_failedCount.fetch_add(1, std::memory_order_relaxed);
+        }
+        else if (r.cancelled && r.completed < r.size)
+        {
+            completion.status = IoStatus::Cancelled;
+            m_cancelledCount.fetch_add(1, std::memory_order_relaxed);
+        }
+        else
+        {
+            m_completedCount.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        if (r.callback)
+            r.callback(completion);
+        if (r.file)
+            releaseFile(r.path);
+
+        std::lock_guard lock(m_mutex);
+        r.state = State::Free;
+        r.file = nullptr;
+        ++r.generation;
+        m_free.push_back(index);
+        if (--m_outstanding == 0)
+            m_idleCondition.notify_all();
+    }
+
+    AsyncReader::Request& AsyncReader::lockedRequest(uint32_t index)
+    {
+        // read() may grow m_requests at any time. Growing a deque leaves its
+        // elements where they are but not its block map, so only the lookup
+        // needs the lock.
+        std::lock_guard lock(m_mutex);
+        return m_requests[index];
+    }
+
+    AsyncReader::OpenFile* AsyncReader::acquireFile(const std::string& path, int& error)
+    {
+        // Requests for the same file share one descriptor, so streaming many
+        // assets out of one container opens it once.
+        const auto it = m_files.find(path);
+        if (it != m_files.end())
+        {
+            ++it->second.references;
+            return &it->second;
+        }
+
+        OpenFile file;
+        if (!openNativeFile(path.c_str(), file.handle, file.size, error))
+            return nullptr;
+        file.references = 1;
+        return &m_files.emplace(path, file).first->second;
+    }
+
+    void AsyncReader::releaseFile(const std::string& path)
+    {
+        const auto it = m_files.find(path);
+        if (--it->second.references > 0)
+            return;
+        closeNativeFile(it->second.handle);
+        m_files.erase(it);
+    }
+}
@@ -0,0 +1,231 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "io/io_backend.hpp"
+
+namespace bloom
+{
+    enum class IoBackendKind : uint8_t
+    {
+        Auto,       // io_uring when the kernel allows it, else Threads
+        Uring,
+        Threads,
+    };
+
+    enum class IoPriority : uint8_t
+    {
+        High,
+        Normal,
+        Low,
+        Count
+    };
+
+    enum class IoStatus : uint8_t
+    {
+        Done,
+        Failed,
+        Cancelled,
+    };
+
+    struct IoHandle
+    {
+        uint32_t index = ~0u;
+        uint32_t generation = 0;
+
+        bool valid() const { return index != ~0u; }
+        bool operator==(const IoHandle&) const = default;
+    };
+
+    struct IoCompletion
+    {
+        IoHandle handle;
+        IoStatus status = IoStatus::Done;
+        int error = 0;                  // errno-style code when Failed
+        std::byte* data = nullptr;      // the request's destination
+        uint64_t size = 0;              // bytes read
+        void* user = nullptr;
+    };
+
+    // Runs on the reader's I/O thread; keep it short and hand real work on
+    // (an UploadQueue, the job system).
+    using IoCallback = void (*)(const IoCompletion& completion);
+
+    struct IoRead
+    {
+        const char* path = nullptr;     // copied
+        uint64_t offset = 0;
+        uint64_t size = 0;              // clamped at the end of the file
+        // At least `size` bytes. Must stay valid, and untouched, until the
+        // callback has run.
+        void* destination = nullptr;
+        IoPriority priority = IoPriority::Normal;
+        IoCallback callback = nullptr;
+        void* user = nullptr;
+    };
+
+    // Reads files in the background so no frame-critical thread ever blocks
+    // on the disk.
+    //
+    // read() only records the request and returns. A dedicated I/O thread
+    // opens the file, splits the read into chunks and keeps up to
+    // `queueDepth` of them in flight, through io_uring where the kernel
+    // allows it and otherwise through a few threads doing blocking pread.
+    // Chunks are issued strictly by priority, so a High read queued behind
+    // a gigabyte of Low ones waits for at most the chunks already in
+    // flight. Each request's callback runs exactly once, on the I/O thread,
+    // after its last chunk has landed: Done (possibly short at end of file),
+    // Failed or Cancelled.
+    //
+    // Every method is thread safe except where noted.
+    class AsyncReader
+    {
+    public:
+        static constexpr uint32_t kDefaultQueueDepth = 32;
+        static constexpr uint32_t kDefaultChunkSize = 1u << 20;
+
+        struct Stats
+        {
+            uint64_t requests = 0;
+            uint64_t completed = 0;
+            uint64_t failed = 0;
+            uint64_t cancelled = 0;
+            uint64_t chunks = 0;
+            uint64_t bytes = 0;
+        };
+
+        explicit AsyncReader(IoBackendKind backend = IoBackendKind::Auto, uint32_t queueDepth = kDefaultQueueDepth,
+                             uint32_t chunkSize = kDefaultChunkSize);
+        ~AsyncReader();
+
+        AsyncReader(const AsyncReader&) = delete;
+        AsyncReader& operator=(const AsyncReader&) = delete;
+
+        const char* backendName() const { return m_backend->name(); }
+
+        // Returns an invalid handle, and runs no callback, if the request is
+        // malformed.
+        IoHandle read(const IoRead& request);
+
+        // A cancelled request completes as Cancelled as soon as none of its
+        // chunks are in flight, unless every byte had already been read.
+        // Returns false if the handle is stale or already completing.
+        bool cancel(IoHandle handle);
+        void cancelAll();
+
+        // Blocks until every request has completed. Not from a callback.
+        void waitIdle();
+
+        std::size_t outstanding() const;
+        Stats stats() const;
+
+    private:
+        enum class State : uint8_t
+        {
+            Free,
+            Incoming,   // waiting for the I/O thread to open the file
+            Opening,
+            Queued,     // has chunks left to issue
+            Active,     // every chunk issued
+            Finishing,
+        };
+
+        struct OpenFile
+        {
+            NativeFile handle{};
+            uint64_t size = 0;
+            uint32_t references = 0;
+        };
+
+        struct Request
+        {
+            std::string path;
+            uint64_t offset = 0;
+            uint64_t size = 0;
+            std::byte* destination = nullptr;
+            IoCallback callback = nullptr;
+            void* user = nullptr;
+            IoPriority priority = IoPriority::Normal;
+            State state = State::Free;
+            bool cancelled = false;
+            uint32_t generation = 0;
+
+            // I/O thread.
+            OpenFile* file = nullptr;
+            uint64_t issued = 0;
+            uint64_t completed = 0;
+            uint32_t inFlight = 0;
+            int error = 0;
+        };
+
+        struct Chunk
+        {
+            Request* request = nullptr;
+            uint32_t index = 0;
+            uint32_t size = 0;
+            uint64_t offset = 0;    // within the request
+        };
+
+        void ioMain();
+        void openIncoming(std::vector<uint32_t>& incoming, std::vector<uint32_t>& finished);
+        void schedule(std::vector<uint32_t>& finished);
+        void complete(const IoEvent& event, std::vector<uint32_t>& finished);
+        void finish(uint32_t index);
+        // I/O thread. Takes m_mutex for the lookup; the reference stays
+        // valid while the request is in use.
+        Request& lockedRequest(uint32_t index);
+        OpenFile* acquireFile(const std::string& path, int& error);
+        void releaseFile(const std::string& path);
+        void signal();
+
+        // With m_mutex held.
+        bool cancelLocked(uint32_t index);
+        bool hasWork() const;
+
+        std::unique_ptr<IoBackend> m_backend;
+        uint32_t m_queueDepth;
+        uint32_t m_chunkSize;
+
+        mutable std::mutex m_mutex;
+        std::condition_variable m_condition;
+        std::condition_variable m_idleCondition;
+        std::deque<Request> m_requests;
+        std::vector<uint32_t> m_free;
+        std::vector<uint32_t> m_incoming;
+        std::array<std::deque<uint32_t>, static_cast<std::size_t>(IoPriority::Count)> m_queues;
+        std::vector<uint32_t> m_cancelled;
+        std::size_t m_outstanding = 0;
+        bool m_stopping = false;
+
+        // Set by submitters, cleared by the I/O thread before it schedules;
+        // with m_reaping it makes sure new work interrupts a blocking reap.
+        std::atomic<bool> m_work{false};
+        std::atomic<bool> m_reaping{false};
+
+        // I/O thread.
+        std::unordered_map<std::string, OpenFile> m_files;
+        std::vector<Chunk> m_chunks;
+        std::vector<uint32_t> m_freeChunks;
+        uint32_t m_inFlight = 0;
+
+        std::atomic<uint64_t> m_requestCount{0};
+        std::atomic<uint64_t> m_completedCount{0};
+        std::atomic<uint64_t> m_failedCount{0};
+        std::atomic<uint64_t> m_cancelledCount{0};
+        std::atomic<uint64_t> m_chunkCount{0};
+        std::atomic<uint64_t> m_byteCount{0};
+
+        std::thread m_thread;
+    };
+}
@@ -0,0 +1,51 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <span>
+
+namespace bloom
+{
+#if defined(_WIN32)
+    using NativeFile = void*;
+#else
+    using NativeFile = int;
+#endif
+
+    // Opens a file for positional reads; `size` receives its length. Returns
+    // false and sets `error` to an errno-style code on failure.
+    bool openNativeFile(const char* path, NativeFile& file, uint64_t& size, int& error);
+    void closeNativeFile(NativeFile file);
+
+    struct IoEvent
+    {
+        uint64_t tag = 0;
+        int64_t result = 0;         // bytes read, or -errno
+    };
+
+    // The part of AsyncReader that talks to the OS. Only the reader's I/O
+    // thread calls read(), submit() and reap(); wake() may be called from
+    // any thread to make a blocking reap() return early.
+    class IoBackend
+    {
+    public:
+        virtual ~IoBackend() = default;
+
+        virtual const char* name() const = 0;
+
+        // Queues a read; nothing is started before submit().
+        virtual void read(NativeFile file, void* destination, uint32_t size, uint64_t offset, uint64_t tag) = 0;
+        virtual void submit() = 0;
+
+        // Copies finished reads into `events`. With `wait` set, blocks until
+        // at least one read finishes or wake() is called.
+        virtual uint32_t reap(std::span<IoEvent> events, bool wait) = 0;
+        virtual void wake() = 0;
+    };
+
+    // Null when the kernel (or a seccomp policy) does not allow io_uring.
+    // `depth` bounds the reads in flight.
+    std::unique_ptr<IoBackend> createUringBackend(uint32_t depth);
+    // Blocking positional reads on `threads` threads of their own.
+    std::unique_ptr<IoBackend> createThreadBackend(uint32_t threads);
+}
@@ -0,0 +1,221 @@
+#include "io/io_backend.hpp"
+
+#include <algorithm>
+#include <cerrno>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#if defined(_WIN32)
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include "core/profiler.hpp"
+#include "memory/memory.hpp"
+
+namespace bloom
+{
+#if defined(_WIN32)
+
+    bool openNativeFile(const char* path, NativeFile& file, uint64_t& size, int& error)
+    {
+        file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+        LARGE_INTEGER length;
+        if (file == INVALID_HANDLE_VALUE || !GetFileSizeEx(file, &length))
+        {
+            error = file == INVALID_HANDLE_VALUE && GetLastError() == ERROR_FILE_NOT_FOUND ? ENOENT : EIO;
+            if (file != INVALID_HANDLE_VALUE)
+                CloseHandle(file);
+            file = nullptr;
+            return false;
+        }
+        size = static_cast<uint64_t>(length.QuadPart);
+        return true;
+    }
+
+    void closeNativeFile(NativeFile file)
+    {
+        CloseHandle(file);
+    }
+
+    namespace
+    {
+        int64_t readAt(NativeFile file, void* destination, uint32_t size, uint64_t offset)
+        {
+            // Synchronous handle plus an OVERLAPPED offset: a positional
+            // read that leaves the file pointer alone.
+            OVERLAPPED overlapped{};
+            overlapped.Offset = static_cast<DWORD>(offset);
+            overlapped.OffsetHigh = static_cast<DWORD>(offset >> 32);
+            DWORD read = 0;
+            if (!ReadFile(file, destination, size, &read, &overlapped) && GetLastError() != ERROR_HANDLE_EOF)
+                return -EIO;
+            return read;
+        }
+    }
+
+#else
+
+    bool openNativeFile(const char* path, NativeFile& file, uint64_t& size, int& error)
+    {
+        file = ::open(path, O_RDONLY | O_CLOEXEC);
+        struct stat info;
+        if (file < 0 || fstat(file, &info) != 0)
+        {
+            error = errno;
+            if (file >= 0)
+                ::close(file);
+            file = -1;
+            return false;
+        }
+        size = static_cast<uint64_t>(info.st_size);
+#if defined(POSIX_FADV_SEQUENTIAL)
+        posix_fadvise(file, 0, 0, POSIX_FADV_SEQUENTIAL);
+#endif
+        return true;
+    }
+
+    void closeNativeFile(NativeFile file)
+    {
+        ::close(file);
+    }
+
+    namespace
+    {
+        int64_t readAt(NativeFile file, void* destination, uint32_t size, uint64_t offset)
+        {
+            ssize_t read;
+            do
+                read = pread(file, destination, size, static_cast<off_t>(offset));
+            while (read < 0 && errno == EINTR);
+            return read < 0 ? -errno : read;
+        }
+    }
+
+#endif
+
+    namespace
+    {
+        class ThreadBackend final : public IoBackend
+        {
+        public:
+            explicit ThreadBackend(uint32_t threads)
+            {
+                for (uint32_t i = 0; i < threads; ++i)
+                    m_threads.emplace_back(&ThreadBackend::readerMain, this);
+            }
+
+            ~ThreadBackend() override
+            {
+                {
+                    std::lock_guard lock(m_mutex);
+                    m_stopping = true;
+                }
+                m_workCondition.notify_all();
+                for (std::thread& thread : m_threads)
+                    thread.join();
+            }
+
+            const char* name() const override { return "threads"; }
+
+            void read(NativeFile file, void* destination, uint32_t size, uint64_t offset, uint64_t tag) override
+            {
+                m_staged.push_back({file, destination, size, offset, tag});
+            }
+
+            void submit() override
+            {
+                if (m_staged.empty())
+                    return;
+                {
+                    std::lock_guard lock(m_mutex);
+                    m_queue.insert(m_queue.end(), m_staged.begin(), m_staged.end());
+                }
+                if (m_staged.size() == 1)
+                    m_workCondition.notify_one();
+                else
+                    m_workCondition.notify_all();
+                m_staged.clear();
+            }
+
+            uint32_t reap(std::span<IoEvent> events, bool wait) override
+            {
+                std::unique_lock lock(m_mutex);
+                if (wait)
+                    m_doneCondition.wait(lock, [this] { return !m_done.empty() || m_woken; });
+                m_woken = false;
+
+                const uint32_t count = static_cast<uint32_t>(std::min(events.size(), m_done.size()));
+                std::copy_n(m_done.begin(), count, events.begin());
+                m_done.erase(m_done.begin(), m_done.begin() + count);
+                return count;
+            }
+
+            void wake() override
+            {
+                {
+                    std::lock_guard lock(m_mutex);
+                    m_woken = true;
+                }
+                m_doneCondition.notify_one();
+            }
+
+        private:
+            struct Read
+            {
+                NativeFile file;
+                void* destination;
+                uint32_t size;
+                uint64_t offset;
+                uint64_t tag;
+            };
+
+            void readerMain()
+            {
+                Profiler::setThreadName("IO reader");
+                MemoryTagScope memoryTag(MemoryTag::Io);
+
+                std::unique_lock lock(m_mutex);
+                while (true)
+                {
+                    m_workCondition.wait(lock, [this] { return !m_queue.empty() || m_stopping; });
+                    if (m_queue.empty())
+                        return;
+
+                    const Read read = m_queue.front();
+                    m_queue.pop_front();
+                    lock.unlock();
+                    const int64_t result = readAt(read.file, read.destination, read.size, read.offset);
+                    lock.lock();
+
+                    m_done.push_back({read.tag, result});
+                    m_doneCondition.notify_one();
+                }
+            }
+
+            std::vector<std::thread> m_threads;
+            std::vector<Read> m_staged;
+
+            std::mutex m_mutex;
+            std::condition_variable m_workCondition;
+            std::condition_variable m_doneCondition;
+            std::deque<Read> m_queue;
+            std::vector<IoEvent> m_done;
+            bool m_woken = false;
+            bool m_stopping = false;
+        };
+    }
+
+    std::unique_ptr<IoBackend> createThreadBackend(uint32_t threads)
+    {
+        return std::make_unique<ThreadBackend>(std::max<uint32_t>(threads, 1));
+    }
+}
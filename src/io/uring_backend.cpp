@@ -0,0 +1,256 @@
+#include "io/io_backend.hpp"
+
+#if defined(__linux__)
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <cstring>
+
+#include <linux/io_uring.h>
+#include <sys/eventfd.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+namespace bloom
+{
+    namespace
+    {
+        // Reserved tag for the eventfd read that wake() completes.
+        constexpr uint64_t kWakeTag = UINT64_MAX;
+
+        int uringSetup(unsigned entries, io_uring_params* params)
+        {
+            return static_cast<int>(syscall(__NR_io_uring_setup, entries, params));
+        }
+
+        int uringEnter(int ring, unsigned toSubmit, unsigned minComplete, unsigned flags)
+        {
+            return static_cast<int>(syscall(__NR_io_uring_enter, ring, toSubmit, minComplete, flags, nullptr, 0));
+        }
+
+        unsigned loadAcquire(unsigned* value)
+        {
+            return std::atomic_ref<unsigned>(*value).load(std::memory_order_acquire);
+        }
+
+        void storeRelease(unsigned* value, unsigned v)
+        {
+            std::atomic_ref<unsigned>(*value).store(v, std::memory_order_release);
+        }
+
+        // io_uring through the raw system calls, so there is no liburing
+        // dependency. One submission ring, driven only by the reader's I/O
+        // thread; the kernel completes reads without a thread of ours
+        // blocking on each one. An eventfd read is kept armed in the ring so
+        // wake() can interrupt a blocking reap().
+        class UringBackend final : public IoBackend
+        {
+        public:
+            ~UringBackend() override
+            {
+                if (m_sqes)
+                    munmap(m_sqes, m_sqeSize);
+                if (m_cqMap && m_cqMap != m_sqMap)
+                    munmap(m_cqMap, m_cqMapSize);
+                if (m_sqMap)
+                    munmap(m_sqMap, m_sqMapSize);
+                if (m_ring >= 0)
+                    ::close(m_ring);
+                if (m_wakeFd >= 0)
+                    ::close(m_wakeFd);
+            }
+
+            bool init(uint32_t depth)
+            {
+                // One extra entry for the wake read.
+                io_uring_params params{};
+                m_ring = uringSetup(depth + 1, &params);
+                if (m_ring < 0)
+                    return false;
+
+                // IORING_OP_READ arrived with 5.6, as did this feature bit.
+                if (!(params.features & IORING_FEAT_RW_CUR_POS))
+                    return false;
+
+                m_sqMapSize = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+                m_cqMapSize = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+                const bool single = params.features & IORING_FEAT_SINGLE_MMAP;
+                if (single)
+                    m_sqMapSize = m_cqMapSize = std::max(m_sqMapSize, m_cqMapSize);
+
+                m_sqMap = mapRing(m_sqMapSize, IORING_OFF_SQ_RING);
+                m_cqMap = single ? m_sqMap : mapRing(m_cqMapSize, IORING_OFF_CQ_RING);
+                m_sqeSize = params.sq_entries * sizeof(io_uring_sqe);
+                m_sqes = static_cast<io_uring_sqe*>(mapRing(m_sqeSize, IORING_OFF_SQES));
+                if (!m_sqMap || !m_cqMap || !m_sqes)
+                    return false;
+
+                auto* sq = static_cast<std::byte*>(m_sqMap);
+                m_sqHead = reinterpret_cast<unsigned*>(sq + params.sq_off.head);
+                m_sqTail = reinterpret_cast<unsigned*>(sq + params.sq_off.tail);
+                m_sqMask = *reinterpret_cast<unsigned*>(sq + params.sq_off.ring_mask);
+                m_sqArray = reinterpret_cast<unsigned*>(sq + params.sq_off.array);
+                m_sqEntries = params.sq_entries;
+
+                auto* cq = static_cast<std::byte*>(m_cqMap);
+                m_cqHead = reinterpret_cast<unsigned*>(cq + params.cq_off.head);
+                m_cqTail = reinterpret_cast<unsigned*>(cq + params.cq_off.tail);
+                m_cqMask = *reinterpret_cast<unsigned*>(cq + params.cq_off.ring_mask);
+                m_cqes = reinterpret_cast<io_uring_cqe*>(cq + params.cq_off.cqes);
+
+                m_wakeFd = eventfd(0, EFD_CLOEXEC);
+                return m_wakeFd >= 0;
+            }
+
+            const char* name() const override { return "io_uring"; }
+
+            void read(NativeFile file, void* destination, uint32_t size, uint64_t offset, uint64_t tag) override
+            {
+                io_uring_sqe& sqe = nextEntry();
+                sqe.opcode = IORING_OP_READ;
+                sqe.fd = file;
+                sqe.addr = reinterpret_cast<uint64_t>(destination);
+                sqe.len = size;
+                sqe.off = offset;
+                sqe.user_data = tag;
+            }
+
+            void submit() override
+            {
+                while (m_unsubmitted > 0)
+                {
+                    const int submitted = uringEnter(m_ring, m_unsubmitted, 0, 0);
+                    if (submitted >= 0)
+                        m_unsubmitted -= static_cast<unsigned>(submitted);
+                    else if (errno != EINTR && errno != EAGAIN && errno != EBUSY)
+                        return;
+                }
+            }
+
+            uint32_t reap(std::span<IoEvent> events, bool wait) override
+            {
+                if (!m_wakeArmed)
+                {
+                    io_uring_sqe& sqe = nextEntry();
+                    sqe.opcode = IORING_OP_READ;
+                    sqe.fd = m_wakeFd;
+                    sqe.addr = reinterpret_cast<uint64_t>(&m_wakeValue);
+                    sqe.len = sizeof(m_wakeValue);
+                    sqe.user_data = kWakeTag;
+                    m_wakeArmed = true;
+                }
+
+                while (true)
+                {
+                    uint32_t count = 0;
+                    bool woken = false;
+                    unsigned head = *m_cqHead;
+                    const unsigned tail = loadAcquire(m_cqTail);
+                    for (; head != tail && count < events.size(); ++head)
+                    {
+                        const io_uring_cqe& cqe = m_cqes[head & m_cqMask];
+                        if (cqe.user_data == kWakeTag)
+                        {
+                            m_wakeArmed = false;
+                            woken = true;
+                            continue;
+                        }
+                        events[count++] = {cqe.user_data, cqe.res};
+                    }
+                    storeRelease(m_cqHead, head);
+
+                    if (count > 0 || woken || !wait)
+                    {
+                        submit();
+                        return count;
+                    }
+
+                    // Submits anything pending (the wake read included) and
+                    // sleeps until something completes.
+                    const int result = uringEnter(m_ring, m_unsubmitted, 1, IORING_ENTER_GETEVENTS);
+                    if (result >= 0)
+                        m_unsubmitted -= static_cast<unsigned>(result);
+                    else if (errno != EINTR && errno != EAGAIN && errno != EBUSY)
+                        return 0;
+                }
+            }
+
+            void wake() override
+            {
+                const uint64_t one = 1;
+                [[maybe_unused]] const ssize_t written = ::write(m_wakeFd, &one, sizeof(one));
+            }
+
+        private:
+            void* mapRing(std::size_t size, off_t offset)
+            {
+                void* map = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, m_ring, offset);
+                return map == MAP_FAILED ? nullptr : map;
+            }
+
+            io_uring_sqe& nextEntry()
+            {
+                // The reader never has more than `depth` reads out, so the
+                // ring only fills when the kernel has not consumed entries
+                // yet; pushing them through makes room.
+                unsigned tail = *m_sqTail;
+                if (tail - loadAcquire(m_sqHead) == m_sqEntries)
+                    submit();
+
+                const unsigned index = tail & m_sqMask;
+                io_uring_sqe& sqe = m_sqes[index];
+                std::memset(&sqe, 0, sizeof(sqe));
+                m_sqArray[index] = index;
+                storeRelease(m_sqTail, tail + 1);
+                ++m_unsubmitted;
+                return sqe;
+            }
+
+            int m_ring = -1;
+            int m_wakeFd = -1;
+            uint64_t m_wakeValue = 0;
+            bool m_wakeArmed = false;
+            unsigned m_unsubmitted = 0;
+
+            void* m_sqMap = nullptr;
+            void* m_cqMap = nullptr;
+            std::size_t m_sqMapSize = 0;
+            std::size_t m_cqMapSize = 0;
+            std::size_t m_sqeSize = 0;
+            io_uring_sqe* m_sqes = nullptr;
+
+            unsigned* m_sqHead = nullptr;
+            unsigned* m_sqTail = nullptr;
+            unsigned* m_sqArray = nullptr;
+            unsigned m_sqMask = 0;
+            unsigned m_sqEntries = 0;
+
+            unsigned* m_cqHead = nullptr;
+            unsigned* m_cqTail = nullptr;
+            unsigned m_cqMask = 0;
+            io_uring_cqe* m_cqes = nullptr;
+        };
+    }
+
+    std::unique_ptr<IoBackend> createUringBackend(uint32_t depth)
+    {
+        auto backend = std::make_unique<UringBackend>();
+        if (!backend->init(depth))
+            return nullptr;
+        return backend;
+    }
+}
+
+#else
+
+namespace bloom
+{
+    std::unique_ptr<IoBackend> createUringBackend(uint32_t)
+    {
+        return nullptr;
+    }
+}
+
+#endif
@@ -0,0 +1,89 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+namespace bloom
+{
+    // Fixed-capacity Chase-Lev work-stealing deque of pointers, following the
+    // C11 formulation by Le, Pop, Cohen and Zappa Nardelli (PPoPP 2013).
+    // The owning thread pushes and pops at the bottom; any thread may steal
+    // from the top. push() fails instead of growing when the deque is full.
+    template <typename T>
+    class ChaseLevDeque
+    {
+    public:
+        explicit ChaseLevDeque(std::size_t capacity)
+            : m_buffer(std::make_unique<std::atomic<T*>[]>(capacity))
+            , m_mask(static_cast<int64_t>(capacity) - 1)
+        {
+            // capacity must be a power of two
+        }
+
+        bool push(T* item)
+        {
+            const int64_t bottom = m_bottom.load(std::memory_order_relaxed);
+            const int64_t top = m_top.load(std::memory_order_acquire);
+            if (bottom - top > m_mask)
+                return false;
+
+            m_buffer[bottom & m_mask].store(item, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_release);
+            m_bottom.store(bottom + 1, std::memory_order_relaxed);
+            return true;
+        }
+
+        T* pop()
+        {
+            const int64_t bottom = m_bottom.load(std::memory_order_relaxed) - 1;
+            m_bottom.store(bottom, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            int64_t top = m_top.load(std::memory_order_relaxed);
+
+            if (top > bottom)
+            {
+                m_bottom.store(bottom + 1, std::memory_order_relaxed);
+                return nullptr;
+            }
+
+            T* item = m_buffer[bottom & m_mask].load(std::memory_order_relaxed);
+            if (top == bottom)
+            {
+                // Last item: race the stealers for it.
+                if (!m_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+                    item = nullptr;
+                m_bottom.store(bottom + 1, std::memory_order_relaxed);
+            }
+            return item;
+        }
+
+        T* steal()
+        {
+            int64_t top = m_top.load(std::memory_order_acquire);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            const int64_t bottom = m_bottom.load(std::memory_order_acquire);
+            if (top >= bottom)
+                return nullptr;
+
+            T* item = m_buffer[top & m_mask].load(std::memory_order_relaxed);
+            if (!m_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+                return nullptr;
+            return item;
+        }
+
+        std::size_t size() const
+        {
+            const int64_t bottom = m_bottom.load(std::memory_order_relaxed);
+            const int64_t top = m_top.load(std::memory_order_relaxed);
+            return bottom > top ? static_cast<std::size_t>(bottom - top) : 0;
+        }
+
+    private:
+        alignas(64) std::atomic<int64_t> m_top{0};
+        alignas(64) std::atomic<int64_t> m_bottom{0};
+        std::unique_ptr<std::atomic<T*>[]> m_buffer;
+        int64_t m_mask;
+    };
+}
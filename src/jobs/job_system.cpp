@@ -0,0 +1,265 @@
+#include "jobs/job_system.hpp"
+
+#include <string>
+
+#include "core/profiler.hpp"
+#include "memory/frame_arena.hpp"
+#include "memory/memory.hpp"
+
+namespace bloom
+{
+    namespace
+    {
+        struct ThreadBinding
+        {
+            const JobSystem* system = nullptr;
+            void* context = nullptr;
+        };
+
+        thread_local ThreadBinding t_binding;
+
+        uint32_t nextRandom(uint32_t& state)
+        {
+            // xorshift32; only used to pick steal victims.
+            state ^= state << 13;
+            state ^= state >> 17;
+            state ^= state << 5;
+            return state;
+        }
+    }
+
+    JobSystem::JobSystem(unsigned workerCount)
+    {
+        if (workerCount == kAutoWorkers)
+            workerCount = std::max(1u, std::thread::hardware_concurrency()) - 1;
+        m_workerCount = workerCount;
+
+        const unsigned slots = m_workerCount + kMaxExternalThreads;
+        m_contexts.reserve(slots);
+        for (unsigned i = 0; i < slots; ++i)
+        {
+            m_contexts.push_back(std::make_unique<ThreadContext>());
+            m_contexts.back()->rng = 0x9e3779b9u * (i + 1);
+        }
+
+        m_threads.reserve(m_workerCount);
+        for (unsigned i = 0; i < m_workerCount; ++i)
+            m_threads.emplace_back(&JobSystem::workerMain, this, i);
+    }
+
+    JobSystem::~JobSystem()
+    {
+        {
+            std::lock_guard lock(m_sleepMutex);
+            m_stopping.store(true, std::memory_order_seq_cst);
+        }
+        m_sleepCondition.notify_all();
+
+        for (std::thread& thread : m_threads)
+            thread.join();
+
+        if (t_binding.system == this)
+            t_binding = {};
+    }
+
+    bool JobSystem::registerThread()
+    {
+        if (t_binding.system == this)
+            return true;
+
+        const unsigned slot = m_registered.fetch_add(1, std::memory_order_relaxed);
+        if (slot >= kMaxExternalThreads)
+            return false;
+
+        t_binding.system = this;
+        t_binding.context = m_contexts[m_workerCount + slot].get();
+        return true;
+    }
+
+    JobSystem::ThreadContext* JobSystem::currentContext() const
+    {
+        return t_binding.system == this ? static_cast<ThreadContext*>(t_binding.context) : nullptr;
+    }
+
+    void JobSystem::submit(const Job& job)
+    {
+        if (job.counter)
+            job.counter->m_value.fetch_add(1, std::memory_order_relaxed);
+
+        ThreadContext* context = currentContext();
+        if (context)
+        {
+            Job* slot = acquireSlot(context);
+            *slot = job;
+            if (!context->deque.push(slot))
+            {
+                // Deque is full; running inline keeps the producer from
+                // outpacing everyone else.
+                execute(*slot, context);
+                return;
+            }
+        }
+        else
+        {
+            std::lock_guard lock(m_injectionMutex);
+            m_injection.push_back(job);
+        }
+
+        m_queued.fetch_add(1, std::memory_order_seq_cst);
+        notifyWork();
+    }
+
+    Job* JobSystem::acquireSlot(ThreadContext* context)
+    {
+        for (;;)
+        {
+            // Slots usually free up in the order they were filled, so the
+            // next one is almost always available; a long-running job only
+            // pins its own slot.
+            for (std::size_t i = 0; i < kJobPoolSize; ++i)
+            {
+                const std::size_t index = context->poolNext++ & (kJobPoolSize - 1);
+                if (!context->busy[index].load(std::memory_order_acquire))
+                {
+                    context->busy[index].store(true, std::memory_order_relaxed);
+                    return &context->pool[index];
+                }
+            }
+
+            // Every slot holds a queued or running job.
+            if (!helpOnce())
+                std::this_thread::yield();
+        }
+    }
+
+    void JobSystem::notifyWork()
+    {
+        if (m_sleepers.load(std::memory_order_seq_cst) == 0)
+            return;
+
+        std::lock_guard lock(m_sleepMutex);
+        m_sleepCondition.notify_one();
+    }
+
+    Job* JobSystem::findJob(ThreadContext* self, Job& scratch, ThreadContext*& owner)
+    {
+        owner = self;
+        if (self)
+        {
+            if (Job* job = self->deque.pop())
+                return job;
+        }
+
+        if (m_queued.load(std::memory_order_relaxed) <= 0)
+            return nullptr;
+
+        {
+            std::lock_guard lock(m_injectionMutex);
+            if (!m_injection.empty())
+            {
+                scratch = m_injection.front();
+                m_injection.pop_front();
+                owner = nullptr;
+                return &scratch;
+            }
+        }
+
+        thread_local uint32_t t_rng = 0x2545f491u;
+        uint32_t& rng = self ? self->rng : t_rng;
+        const std::size_t count = m_contexts.size();
+        const std::size_t start = nextRandom(rng) % count;
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            ThreadContext* victim = m_contexts[(start + i) % count].get();
+            if (victim == self)
+                continue;
+            if (Job* job = victim->deque.steal())
+            {
+                owner = victim;
+                return job;
+            }
+        }
+        return nullptr;
+    }
+
+    void JobSystem::execute(Job& job, ThreadContext* owner)
+    {
+        JobCounter* counter = job.counter;
+        {
+            // Whatever the job took from this thread's frame arena is
+            // scratch; nested jobs run by wait() rewind only their own.
+            ArenaScope scratch;
+            job.function(job);
+        }
+        // The job runs in place, so its slot stays taken until now.
+        if (owner)
+            owner->busy[&job - owner->pool.get()].store(false, std::memory_order_release);
+        if (counter)
+            counter->m_value.fetch_sub(1, std::memory_order_release);
+    }
+
+    bool JobSystem::helpOnce()
+    {
+        Job scratch;
+        ThreadContext* owner = nullptr;
+        Job* job = findJob(currentContext(), scratch, owner);
+        if (!job)
+            return false;
+
+        m_queued.fetch_sub(1, std::memory_order_relaxed);
+        execute(*job, owner);
+        return true;
+    }
+
+    void JobSystem::wait(JobCounter& counter)
+    {
+        unsigned idle = 0;
+        while (!counter.done())
+        {
+            if (helpOnce())
+            {
+                idle = 0;
+                continue;
+            }
+
+            // Nothing to steal; the remaining jobs are running elsewhere.
+            if (++idle > 64)
+                std::this_thread::yield();
+        }
+    }
+
+    void JobSystem::workerMain(unsigned index)
+    {
+        t_binding.system = this;
+        t_binding.context = m_contexts[index].get();
+        Memory::setCurrentTag(MemoryTag::Jobs);
+        Profiler::setThreadName(("Worker " + std::to_string(index)).c_str());
+
+        unsigned idle = 0;
+        while (!m_stopping.load(std::memory_order_acquire))
+        {
+            if (helpOnce())
+            {
+                idle = 0;
+                continue;
+            }
+
+            if (++idle < 256)
+            {
+                std::this_thread::yield();
+                continue;
+            }
+
+            m_sleepers.fetch_add(1, std::memory_order_seq_cst);
+            {
+                std::unique_lock lock(m_sleepMutex);
+                m_sleepCondition.wait(lock, [this]
+                {
+                    return m_queued.load(std::memory_order_seq_cst) > 0 || m_stopping.load(std::memory_order_acquire);
+                });
+            }
+            m_sleepers.fetch_sub(1, std::memory_order_seq_cst);
+            idle = 0;
+        }
+    }
+}
@@ -0,0 +1,190 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#include "jobs/chase_lev_deque.hpp"
+
+namespace bloom
+{
+    // Counts outstanding jobs. Jobs submitted with a counter increment it and
+    // decrement it once they have finished running; JobSystem::wait() on a
+    // counter returns once it has dropped back to zero.
+    class JobCounter
+    {
+    public:
+        bool done() const { return m_value.load(std::memory_order_acquire) == 0; }
+        int value() const { return m_value.load(std::memory_order_acquire); }
+
+    private:
+        friend class JobSystem;
+        std::atomic<int> m_value{0};
+    };
+
+    // A unit of work: a function pointer plus a small inline payload. The
+    // payload is sized so a job fills exactly one cache line.
+    struct alignas(64) Job
+    {
+        using Function = void (*)(Job& job);
+        static constexpr std::size_t kPayloadSize = 48;
+
+        Function function = nullptr;
+        JobCounter* counter = nullptr;
+        alignas(std::max_align_t) std::byte payload[kPayloadSize];
+
+        template <typename F>
+        static Job make(F&& fn, JobCounter* counter)
+        {
+            using Callable = std::decay_t<F>;
+            static_assert(sizeof(Callable) <= kPayloadSize, "job callable does not fit the inline payload");
+            static_assert(std::is_trivially_copyable_v<Callable> && std::is_trivially_destructible_v<Callable>,
+                          "job callables are copied by value and never destroyed; capture by reference or pointer");
+
+            Job job;
+            job.counter = counter;
+            job.function = [](Job& self)
+            {
+                (*std::launder(reinterpret_cast<Callable*>(self.payload)))();
+            };
+            new (job.payload) Callable(std::forward<F>(fn));
+            return job;
+        }
+    };
+
+    // Work-stealing scheduler. Each participating thread owns a Chase-Lev
+    // deque and a ring of job slots; idle threads steal from random victims.
+    // A slot is reused only once the job in it has finished running, and a
+    // thread whose slots are all taken runs other jobs until one frees up.
+    // Threads that were never registered submit through a locked injection
+    // queue instead, but can still help by stealing while they wait.
+    //
+    // There are no fibers: wait() keeps the calling thread busy running other
+    // jobs until the counter it waits on reaches zero.
+    class JobSystem
+    {
+    public:
+        static constexpr std::size_t kDequeCapacity = 4096;
+        static constexpr std::size_t kJobPoolSize = kDequeCapacity * 2;
+        static constexpr unsigned kMaxExternalThreads = 8;
+        static constexpr unsigned kAutoWorkers = ~0u;
+
+        // kAutoWorkers picks one worker per hardware thread, minus one for
+        // the thread that creates the system. With no workers at all, jobs
+        // only run inside wait() and helpOnce() on the threads calling them.
+        explicit JobSystem(unsigned workerCount = kAutoWorkers);
+        ~JobSystem();
+
+        JobSystem(const JobSystem&) = delete;
+        JobSystem& operator=(const JobSystem&) = delete;
+
+        unsigned workerCount() const { return m_workerCount; }
+
+        // Gives the calling thread its own deque. Safe to call more than once.
+        bool registerThread();
+
+        void submit(const Job& job);
+
+        template <typename F>
+        void run(F&& fn, JobCounter* counter = nullptr)
+        {
+            submit(Job::make(std::forward<F>(fn), counter));
+        }
+
+        // Runs `fn` once `dependency` has completed. The job helps with other
+        // work while the dependency is still pending.
+        template <typename F>
+        void runAfter(JobCounter& dependency, F&& fn, JobCounter* counter = nullptr)
+        {
+            using Callable = std::decay_t<F>;
+            struct Continuation
+            {
+                JobSystem* system;
+                JobCounter* dependency;
+                Callable fn;
+                void operator()() { system->wait(*dependency); fn(); }
+            };
+            run(Continuation{this, &dependency, std::forward<F>(fn)}, counter);
+        }
+
+        // Splits [0, count) into chunks of at most `grain` items, runs
+        // fn(begin, end) for each chunk in parallel and waits for all of them.
+        template <typename F>
+        void parallelFor(uint32_t count, uint32_t grain, F&& fn)
+        {
+            if (count == 0)
+                return;
+            grain = std::max<uint32_t>(grain, 1);
+            if (count <= grain)
+            {
+                fn(uint32_t{0}, count);
+                return;
+            }
+
+            using Callable = std::remove_reference_t<F>;
+            Callable* body = &fn;
+            JobCounter counter;
+            for (uint32_t begin = 0; begin < count; begin += grain)
+            {
+                const uint32_t end = std::min(count, begin + grain);
+                run([body, begin, end]() { (*body)(begin, end); }, &counter);
+            }
+            wait(counter);
+        }
+
+        void wait(JobCounter& counter);
+
+        // Runs at most one pending job on the calling thread.
+        bool helpOnce();
+
+    private:
+        struct alignas(64) ThreadContext
+        {
+            ThreadContext()
+                : deque(kDequeCapacity)
+                , pool(std::make_unique<Job[]>(kJobPoolSize))
+                , busy(std::make_unique<std::atomic<bool>[]>(kJobPoolSize))
+            {
+            }
+
+            ChaseLevDeque<Job> deque;
+            std::unique_ptr<Job[]> pool;
+            // Set by the owner when it fills a slot, cleared by whichever
+            // thread finishes running the job in it.
+            std::unique_ptr<std::atomic<bool>[]> busy;
+            std::size_t poolNext = 0;
+            uint32_t rng = 0;
+        };
+
+        void workerMain(unsigned index);
+        ThreadContext* currentContext() const;
+        Job* acquireSlot(ThreadContext* context);
+        Job* findJob(ThreadContext* self, Job& scratch, ThreadContext*& owner);
+        void execute(Job& job, ThreadContext* owner);
+        void notifyWork();
+
+        unsigned m_workerCount;
+        std::vector<std::unique_ptr<ThreadContext>> m_contexts;
+        std::atomic<unsigned> m_registered{0};
+        std::vector<std::thread> m_threads;
+
+        std::mutex m_injectionMutex;
+        std::deque<Job> m_injection;
+
+        std::atomic<int64_t> m_queued{0};
+        std::atomic<unsigned> m_sleepers{0};
+        std::atomic<bool> m_stopping{false};
+        std::mutex m_sleepMutex;
+        std::condition_variable m_sleepCondition;
+    };
+}
@@ -1,9 +1,615 @@
-#include <iostream>
-#include "GLFW/glfw3.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <numbers>
+#include <span>
+#include <vector>
+
 #include "glad/glad.h"
+#include "GLFW/glfw3.h"
 
-int main()
+#include "core/engine.hpp"
+#include "core/profiler.hpp"
+#include "core/clock.hpp"
+#include "core/state_buffer.hpp"
+#include "render/bloom_effect.hpp"
+#include "render/gl_backend.hpp"
+#include "render/gl_shader.hpp"
+#include "render/gpu_particles.hpp"
+#include "render/particle_renderer.hpp"
+#include "render/render_graph.hpp"
+#include "render/render_queue.hpp"
+#include "render/sort_key.hpp"
+#include "render/uniform_ring.hpp"
+
+namespace
 {
-    std::cout << "Hello, World!" << std::endl;
-    return 0;
+    constexpr int kGridSize = 8;
+    constexpr uint32_t kComputePass = 0;
+    constexpr uint32_t kScenePass = 1;
+    constexpr uint32_t kParticleGrain = 16384;
+    constexpr GLsizeiptr kUniformBytesPerFrame = 64 * 1024;
+
+    // Per-spinner parameters come from the UniformRing: the draw's
+    // baseInstance indexes the frame's array through the draw index
+    // attribute (UniformRing::kDrawIndexAttribute).
+    const char* const kSpinnerVertexShader = R"(#version 460 core
+layout(location = 15) in uint a_drawIndex;
+layout(std430, binding = 0) readonly buffer Spinners
+{
+    vec4 u_spinners[]; // xy offset, z angle, w scale
+};
+out vec3 v_color;
+void main()
+{
+    vec4 spinner = u_spinners[a_drawIndex];
+    float a = spinner.z + float(gl_VertexID) * 2.0943951;
+    v_color = vec3(gl_VertexID == 0, gl_VertexID == 1, gl_VertexID == 2) * 0.8 + 0.2;
+    gl_Position = vec4(spinner.xy + spinner.w * vec2(cos(a), sin(a)), 0.0, 1.0);
+}
+)";
+
+    // INTENSITY lifts the colors into HDR range when bloom is on.
+    const char* const kSpinnerFragmentShader = R"(#version 460 core
+#ifndef INTENSITY
+#define INTENSITY 1.0
+#endif
+in vec3 v_color;
+out vec4 o_color;
+void main()
+{
+    o_color = vec4(v_color * INTENSITY, 1.0);
+}
+)";
+
+    // Default controls; --bindings replaces them with a file in the same
+    // format (see ActionMap).
+    const char* const kDefaultBindings = R"(
+# action  device  control
+pause     key     SPACE
+pause     mouse   LEFT
+faster    key     UP
+slower    key     DOWN
+quit      key     ESCAPE
+)";
+
+    uint32_t hashParticle(uint32_t i)
+    {
+        i ^= i >> 16;
+        i *= 0x7feb352du;
+        i ^= i >> 15;
+        i *= 0x846ca68bu;
+        return i ^ (i >> 16);
+    }
+
+    // The fountain of GLFW's examples/particles.c, with its constants, in
+    // its units (metres, seconds) and its Z-up space. The example keeps its
+    // particles alive by giving each birth the first dead slot; at that
+    // steady state the births go round the slots, so here slot i is simply
+    // reborn every kFountainLifeSpan seconds, i / count of a life span after
+    // slot 0. Every particle is then independent and any job can step any
+    // range of them.
+    constexpr float kFountainLifeSpan = 8.f;
+    constexpr float kFountainParticleSize = 0.7f;
+    constexpr float kFountainGravity = 9.8f;
+    constexpr float kFountainVelocity = 8.f;
+    constexpr float kFountainFriction = 0.75f;
+    constexpr float kFountainHeight = 3.f;
+    constexpr float kFountainRadius = 1.6f;
+    // MIN_DELTA_T at the example's 3000 particles. The example shrinks it
+    // with the count only because it gives birth between steps.
+    constexpr float kFountainStep = kFountainLifeSpan / 3000.f * 0.5f;
+    // Example metres to scene units; the floor sits at the hills' level.
+    constexpr float kFountainScale = 0.08f;
+    constexpr float kFountainFloor = -0.3f;
+
+    struct FountainParticle
+    {
+        float position[3];
+        float velocity[3];
+        float life;             // 1 at birth, 0 at death
+        uint32_t color;         // RGB8, fixed at birth
+    };
+
+    // init_particle(): `t` is the birth time and `seed` stands in for rand().
+    void initFountainParticle(FountainParticle& p, double t, uint32_t seed)
+    {
+        const uint32_t h = hashParticle(seed);
+        const float xyAngle = (2.f * std::numbers::pi_v<float> / 4096.f) * static_cast<float>(h & 4095);
+        const float velocity = kFountainVelocity * (0.8f + 0.1f * static_cast<float>(std::sin(0.5 * t) + std::sin(1.31 * t)));
+        p.position[0] = 0.f;
+        p.position[1] = 0.f;
+        p.position[2] = kFountainHeight;
+        p.velocity[0] = 0.4f * std::cos(xyAngle) * velocity;
+        p.velocity[1] = 0.4f * std::sin(xyAngle) * velocity;
+        p.velocity[2] = (0.7f + (0.3f / 4096.f) * static_cast<float>(h >> 12 & 4095)) * velocity;
+
+        const auto channel = [](double value) { return static_cast<uint32_t>(value * 255.0); };
+        p.color = channel(0.7 + 0.3 * std::sin(0.34 * t + 0.1)) | channel(0.6 + 0.4 * std::sin(0.63 * t + 1.1)) << 8 |
+                  channel(0.6 + 0.4 * std::sin(0.91 * t + 2.1)) << 16;
+        p.life = 1.f;
+    }
+
+    // update_particle(), less the death check: a slot is reborn on time
+    // instead of being left dead.
+    void updateFountainParticle(FountainParticle& p, float dt)
+    {
+        constexpr float kHalfSize = kFountainParticleSize / 2.f;
+        constexpr float kBasinRadius2 = (kFountainRadius + kHalfSize) * (kFountainRadius + kHalfSize);
+
+        p.life -= dt * (1.f / kFountainLifeSpan);
+        p.velocity[2] -= kFountainGravity * dt;
+        for (int axis = 0; axis < 3; ++axis)
+            p.position[axis] += p.velocity[axis] * dt;
+
+        // Bounce on the fountain, else on the floor, with friction.
+        if (p.velocity[2] < 0.f)
+        {
+            const float x = p.position[0];
+            const float y = p.position[1];
+            if (x * x + y * y < kBasinRadius2 && p.position[2] < kFountainHeight + kHalfSize)
+            {
+                p.velocity[2] = -kFountainFriction * p.velocity[2];
+                p.position[2] = kFountainHeight + kHalfSize + kFountainFriction * (kFountainHeight + kHalfSize - p.position[2]);
+            }
+            else if (p.position[2] < kHalfSize)
+            {
+                p.velocity[2] = -kFountainFriction * p.velocity[2];
+                p.position[2] = kHalfSize + kFountainFriction * (kHalfSize - p.position[2]);
+            }
+        }
+    }
+
+    // Slots born by `time`: they start out dead and come alive in order.
+    uint32_t fountainLiveCount(std::size_t count, double time)
+    {
+        const double interval = kFountainLifeSpan / static_cast<double>(count);
+        return static_cast<uint32_t>(std::min(static_cast<double>(count), std::ceil(time / interval)));
+    }
+
+    // particle_engine() and draw_particles() for the live slots [begin,
+    // end): rebirths the slots due in [time - dt, time), steps the rest
+    // from time - dt in the example's substeps and writes each particle's
+    // billboard with its alpha rule.
+    void stepFountain(std::span<FountainParticle> particles, std::span<bloom::ParticleInstance> out, uint32_t begin, uint32_t end,
+                      double time, float dt)
+    {
+        const double interval = kFountainLifeSpan / static_cast<double>(particles.size());
+        for (uint32_t i = begin; i < end; ++i)
+        {
+            FountainParticle& p = particles[i];
+            const double phase = static_cast<double>(i) * interval;
+            const double lives = std::ceil((time - phase) / kFountainLifeSpan) - 1.0;
+            const double birth = phase + lives * kFountainLifeSpan;
+
+            float remaining = dt;
+            if (birth >= time - dt)
+            {
+                initFountainParticle(p, birth, i ^ hashParticle(static_cast<uint32_t>(lives)));
+                remaining = static_cast<float>(time - birth);
+            }
+            while (remaining > 0.f)
+            {
+                const float step = std::min(remaining, kFountainStep);
+                updateFountainParticle(p, step);
+                remaining -= step;
+            }
+
+            // Full intensity for 75% of the life, then fading out.
+            const float alpha = std::clamp(4.f * p.life, 0.f, 1.f);
+
+            bloom::ParticleInstance particle;
+            particle.position[0] = p.position[0] * kFountainScale;
+            particle.position[1] = kFountainFloor + p.position[2] * kFountainScale;
+            particle.position[2] = p.position[1] * kFountainScale;
+            particle.size = kFountainParticleSize / 2.f * kFountainScale;
+            particle.color = p.color | static_cast<uint32_t>(alpha * 255.f) << 24;
+            out[i] = particle;      // whole-struct store into write-combined memory
+        }
+    }
+
+    constexpr int kHillsSize = 64;
+    constexpr bloom::HeightFieldRect kHillsRect{-1.5f, -1.5f, 3.f, 3.f};
+
+    void makeHills(float* heights)
+    {
+        for (int z = 0; z < kHillsSize; ++z)
+        {
+            for (int x = 0; x < kHillsSize; ++x)
+            {
+                const float wx = kHillsRect.x + (static_cast<float>(x) + 0.5f) * kHillsRect.width / kHillsSize;
+                const float wz = kHillsRect.z + (static_cast<float>(z) + 0.5f) * kHillsRect.depth / kHillsSize;
+                heights[z * kHillsSize + x] = 0.1f * std::sin(4.f * wx) * std::cos(4.f * wz) - 0.3f;
+            }
+        }
+    }
+
+    struct SpinnerState
+    {
+        float angle = 0.f;
+        float speed = 90.f;     // degrees per second
+        bool paused = false;
+    };
+
+    // Placeholder scene: a grid of triangles spun by the simulation thread,
+    // which also applies the pause and speed actions. The render thread
+    // interpolates the angle between ticks and records one row of the grid
+    // per job into the render queue, each job writing its row's parameters
+    // into the UniformRing. With --particles, the jobs also step the
+    // fountain of GLFW's particles.c and write its billboards straight into
+    // the ParticleRenderer's mapped buffer. With --gpu-particles, a
+    // compute-shader fountain sprays over a height field, its nozzle turned
+    // by the spinners' angle. With --bloom, the scene pass renders into an
+    // HDR target that a render graph runs through BloomEffect on the way to
+    // the backbuffer.
+    class SpinnerApp final : public bloom::Application
+    {
+    public:
+        SpinnerApp(const char* bindingsPath, uint32_t particleCount, uint32_t gpuParticleCount, bool bloom)
+            : m_bindingsPath(bindingsPath)
+            , m_particleCount(particleCount)
+            , m_gpuParticleCount(gpuParticleCount)
+            , m_bloomEnabled(bloom)
+        {
+        }
+
+        bool onInit(bloom::Engine& engine) override
+        {
+            m_engine = &engine;
+
+            bloom::ActionMap& actions = engine.input().actions();
+            const bool loaded = m_bindingsPath ? actions.load(m_bindingsPath) : actions.parse(kDefaultBindings);
+            if (!loaded)
+                return false;
+
+            m_pause = actions.find("pause");
+            m_faster = actions.find("faster");
+            m_slower = actions.find("slower");
+            m_quit = actions.find("quit");
+            return true;
+        }
+
+        void onTick(const bloom::TickContext& tick) override
+        {
+            const bloom::InputState& input = *tick.input;
+            if (input.wasPressed(m_quit))
+                m_engine->requestExit();
+            if (input.wasPressed(m_pause))
+                m_state.paused = !m_state.paused;
+            if (input.wasPressed(m_faster))
+                m_state.speed *= 1.5f;
+            if (input.wasPressed(m_slower))
+                m_state.speed /= 1.5f;
+
+            if (!m_state.paused)
+                m_state.angle = std::fmod(m_state.angle + static_cast<float>(tick.deltaTime) * m_state.speed, 360.f);
+            m_states.publish(m_state, tick.timestamp);
+        }
+
+        bool onRenderInit() override
+        {
+            const bloom::ShaderStage stages[] = {{GL_VERTEX_SHADER, kSpinnerVertexShader},
+                                                 {GL_FRAGMENT_SHADER, kSpinnerFragmentShader}};
+            m_program = bloom::compileProgram(stages, m_bloomEnabled ? "#define INTENSITY 4.0\n" : "");
+            glCreateVertexArrays(1, &m_vertexArray);
+            if (!m_uniforms.init(kUniformBytesPerFrame))
+                return false;
+            m_uniforms.attachDrawIndex(m_vertexArray);
+            m_backend.setProfiler(&m_engine->gpuProfiler());
+            m_engine->setRenderState(&m_backend.state());
+            if (m_bloomEnabled && !m_bloom.init())
+                return false;
+            if (m_particleCount > 0)
+            {
+                if (!m_particles.init(m_particleCount))
+                    return false;
+                m_fountain.resize(m_particleCount);
+            }
+            if (m_gpuParticleCount > 0)
+            {
+                if (!m_gpuParticles.init(m_gpuParticleCount))
+                    return false;
+                float hills[kHillsSize * kHillsSize];
+                makeHills(hills);
+                m_gpuParticles.setHeightField(m_backend.state(), hills, kHillsSize, kHillsSize, kHillsRect);
+            }
+            return m_program != 0;
+        }
+
+        void onRender(const bloom::FrameContext& frame) override
+        {
+            m_queue.reset();
+            m_uniforms.beginFrame();
+            if (m_bloomEnabled && frame.width > 0 && frame.height > 0)
+                declareFrame(frame);
+            else
+                m_backend.setPass(kScenePass, bloom::PassDesc{0, {0, 0, frame.width, frame.height}});
+
+            bloom::ClearCommand clear;
+            clear.color[0] = 0.08f;
+            clear.color[1] = 0.08f;
+            clear.color[2] = 0.1f;
+            m_queue.acquireBucket().record(bloom::SortKey::encode(kScenePass, 0, 0, 0), clear);
+
+            m_states.acquire();
+            if (m_states.valid())
+            {
+                const float alpha = m_states.alpha(frame.timestamp, frame.tickInterval);
+                float from = m_states.previous().angle;
+                float to = m_states.current().angle;
+                if (to < from)
+                    to += 360.f;
+                const float angle = (from + (to - from) * alpha) * std::numbers::pi_v<float> / 180.f;
+                const float elapsed = m_lastFrame ? static_cast<float>(bloom::Clock::toSeconds(frame.timestamp - m_lastFrame)) : 0.f;
+                const float deltaTime = std::min(elapsed, 0.1f);
+                m_lastFrame = frame.timestamp;
+
+                BLOOM_PROFILE_ZONE("Record");
+                m_engine->jobs().parallelFor(kGridSize, 1, [this, angle](uint32_t begin, uint32_t end)
+                {
+                    BLOOM_PROFILE_ZONE("Record rows");
+                    bloom::CommandBuffer& bucket = m_queue.acquireBucket();
+                    for (uint32_t row = begin; row < end; ++row)
+                        recordRow(bucket, row, angle);
+                });
+
+                if (m_particleCount > 0 || m_gpuParticleCount > 0)
+                    setParticleCameras(frame);
+                if (m_particleCount > 0)
+                    recordParticles(deltaTime);
+                if (m_gpuParticleCount > 0)
+                    recordGpuParticles(angle, deltaTime);
+            }
+
+            {
+                BLOOM_PROFILE_ZONE("Sort");
+                m_queue.sort();
+            }
+            {
+                BLOOM_PROFILE_ZONE("Execute");
+                BLOOM_PROFILE_GPU_ZONE(m_engine->gpuProfiler(), "Scene");
+                m_backend.execute(m_queue);
+            }
+            m_uniforms.endFrame();
+            m_particles.endFrame();
+            m_backend.state().endFrame();
+        }
+
+        void onRenderShutdown() override
+        {
+            const bloom::GLStateCache::Counters& calls = m_backend.state().lastFrame();
+            std::fprintf(stderr, "GL state calls per frame: %u issued, %u elided\n", calls.totalIssued(), calls.totalElided());
+            if (m_particleCount > 0)
+                std::fprintf(stderr, "Particle buffer waits: %llu\n", static_cast<unsigned long long>(m_particles.stalls()));
+
+            m_uniforms.release();
+            m_particles.release();
+            m_gpuParticles.release(&m_backend.state());
+            m_bloom.release();
+            m_graph.release();
+            glDeleteVertexArrays(1, &m_vertexArray);
+            glDeleteProgram(m_program);
+        }
+
+    private:
+        // The scene pass is the graph's first, so it keeps kScenePass and
+        // everything recorded for it below lands in the HDR target.
+        void declareFrame(const bloom::FrameContext& frame)
+        {
+            BLOOM_PROFILE_ZONE("Render graph");
+            m_graph.reset(frame.width, frame.height);
+            const bloom::GraphTexture color = m_graph.createTexture("scene", {frame.width, frame.height, GL_RGBA16F});
+            const bloom::GraphTexture depth = m_graph.createTexture("scene depth", {frame.width, frame.height, GL_DEPTH_COMPONENT24});
+            const uint32_t scene = m_graph.addPass("scene", bloom::PassKind::Graphics, nullptr, nullptr);
+            m_graph.write(scene, color, bloom::TextureAccess::ColorTarget);
+            m_graph.write(scene, depth, bloom::TextureAccess::DepthTarget);
+            m_bloom.addPasses(m_graph, color);
+            if (m_graph.compile())
+                m_graph.execute(m_queue, m_backend, kScenePass);
+        }
+
+        void setParticleCameras(const bloom::FrameContext& frame)
+        {
+            const float aspect = static_cast<float>(frame.width) / static_cast<float>(frame.height > 0 ? frame.height : 1);
+            const bloom::Mat4 view = bloom::Mat4::lookAt({0.f, 1.2f, 1.8f}, {0.f, 0.f, 0.f}, {0.f, 1.f, 0.f});
+            const bloom::Mat4 projection = bloom::Mat4::perspective(std::numbers::pi_v<float> / 4.f, aspect, 0.1f, 10.f);
+            if (m_particleCount > 0)
+                m_particles.setCamera(view, projection);
+            if (m_gpuParticleCount > 0)
+                m_gpuParticles.setCamera(view, projection);
+        }
+
+        void recordParticles(float deltaTime)
+        {
+            BLOOM_PROFILE_ZONE("Particles");
+            m_fountainTime += deltaTime;
+            const double time = m_fountainTime;
+            const uint32_t live = fountainLiveCount(m_fountain.size(), time);
+            const std::span<FountainParticle> particles = m_fountain;
+            const std::span<bloom::ParticleInstance> out = m_particles.begin();
+            m_engine->jobs().parallelFor(live, kParticleGrain, [particles, out, time, deltaTime](uint32_t begin, uint32_t end)
+            {
+                BLOOM_PROFILE_ZONE("Step particles");
+                stepFountain(particles, out, begin, end, time, deltaTime);
+            });
+            m_particles.end(live);
+            m_queue.acquireBucket().record(bloom::SortKey::encode(kScenePass, 2, 0, 0), m_particles.draw());
+        }
+
+        // Only the emitter is touched here; the particles never leave the GPU.
+        void recordGpuParticles(float angle, float deltaTime)
+        {
+            bloom::EmitterParams emitter = m_gpuParticles.emitter();
+            emitter.rate = static_cast<float>(m_gpuParticleCount) / emitter.lifetime;
+            emitter.velocity = {0.8f * std::cos(angle), 2.5f, 0.8f * std::sin(angle)};
+            emitter.spread = 0.4f;
+            emitter.size = 0.006f;
+            m_gpuParticles.setEmitter(emitter);
+
+            bloom::CommandBuffer& bucket = m_queue.acquireBucket();
+            m_gpuParticles.recordStep(bucket, bloom::SortKey::encode(kComputePass, 0, 0, 0), deltaTime);
+            bucket.record(bloom::SortKey::encode(kScenePass, 3, 0, 0), m_gpuParticles.draw());
+        }
+
+        void recordRow(bloom::CommandBuffer& bucket, uint32_t row, float angle)
+        {
+            struct Spinner
+            {
+                float params[4];
+            };
+
+            uint32_t first = 0;
+            Spinner* spinners = m_uniforms.allocateArray<Spinner>(kGridSize, first);
+            if (!spinners)
+                return;
+
+            constexpr float cell = 2.f / kGridSize;
+            for (int column = 0; column < kGridSize; ++column)
+            {
+                // One whole-struct store: the ring is write-combined memory.
+                spinners[column] = Spinner{{-1.f + cell * (static_cast<float>(column) + 0.5f),
+                                            -1.f + cell * (static_cast<float>(row) + 0.5f),
+                                            angle * (1.f + 0.1f * static_cast<float>(row * kGridSize + column)),
+                                            cell * 0.4f}};
+
+                bloom::DrawCommand draw;
+                draw.program = m_program;
+                draw.vertexArray = m_vertexArray;
+                draw.count = 3;
+                draw.storageBuffers[0] = m_uniforms.frameRange();
+                draw.baseInstance = first + static_cast<uint32_t>(column);
+                bucket.record(bloom::SortKey::encode(kScenePass, 1, 0, 0), draw);
+            }
+        }
+
+        const char* m_bindingsPath = nullptr;
+        uint32_t m_particleCount = 0;
+        uint32_t m_gpuParticleCount = 0;
+        bool m_bloomEnabled = false;
+        int m_pause = -1;
+        int m_faster = -1;
+        int m_slower = -1;
+        int m_quit = -1;
+
+        bloom::Engine* m_engine = nullptr;
+        SpinnerState m_state;
+        bloom::StateBuffer<SpinnerState> m_states;
+
+        bloom::RenderQueue m_queue;
+        bloom::GLBackend m_backend;
+        GLuint m_program = 0;
+        GLuint m_vertexArray = 0;
+        bloom::UniformRing m_uniforms;
+        bloom::ParticleRenderer m_particles;
+        std::vector<FountainParticle> m_fountain;
+        double m_fountainTime = 0.0;
+        bloom::GpuParticleSystem m_gpuParticles;
+        bloom::RenderGraph m_graph;
+        bloom::BloomEffect m_bloom;
+        uint64_t m_lastFrame = 0;
+    };
+}
+
+namespace
+{
+    void usage()
+    {
+        std::printf("Usage: bloom_engine [options]\n");
+        std::printf("Options:\n");
+        std::printf(" --headless        Render offscreen through OSMesa on the null platform\n");
+        std::printf(" --frames N        Stop after N frames\n");
+        std::printf(" --output PATH     Stream raw RGBA frames to PATH (- for stdout, headless only)\n");
+        std::printf(" --size WxH        Framebuffer size (default 1280x720)\n");
+        std::printf(" --lazy-gl         Resolve GL entry points on first use\n");
+        std::printf(" --shader-cache DIR Keep program binaries in DIR (default: the user cache, e.g. ~/.cache/bloom)\n");
+        std::printf(" --no-shader-cache Compile every program from source\n");
+        std::printf(" --capture DIR     Write every frame to DIR as an image\n");
+        std::printf(" --capture-format  png, qoi or raw (default png)\n");
+        std::printf(" --profile         Show per-zone CPU/GPU timings in the title bar\n");
+        std::printf(" --trace PATH      Write a Chrome trace (chrome://tracing, Perfetto)\n");
+        std::printf(" --bindings PATH   Load input bindings from PATH\n");
+        std::printf(" --particles N     Stream a fountain of N particles per frame\n");
+        std::printf(" --gpu-particles N Simulate N particles in compute shaders\n");
+        std::printf(" --bloom           Render in HDR with bloom and tone mapping\n");
+        std::printf(" -h, --help        Display this help\n");
+    }
+
+    bool parseArguments(int argc, char** argv, bloom::EngineConfig& config, const char*& bindingsPath, uint32_t& particleCount,
+                        uint32_t& gpuParticleCount, bool& bloom)
+    {
+        for (int i = 1; i < argc; ++i)
+        {
+            const char* arg = argv[i];
+            const bool hasValue = i + 1 < argc;
+
+            if (std::strcmp(arg, "--headless") == 0)
+                config.headless = true;
+            else if (std::strcmp(arg, "--lazy-gl") == 0)
+                config.glLoader = bloom::GLLoader::Lazy;
+            else if (std::strcmp(arg, "--frames") == 0 && hasValue)
+                config.frameLimit = std::strtoull(argv[++i], nullptr, 10);
+            else if (std::strcmp(arg, "--output") == 0 && hasValue)
+                config.outputPath = argv[++i];
+            else if (std::strcmp(arg, "--shader-cache") == 0 && hasValue)
+                config.shaderCachePath = argv[++i];
+            else if (std::strcmp(arg, "--no-shader-cache") == 0)
+                config.shaderCache = false;
+            else if (std::strcmp(arg, "--profile") == 0)
+                config.profile = true;
+            else if (std::strcmp(arg, "--trace") == 0 && hasValue)
+                config.tracePath = argv[++i];
+            else if (std::strcmp(arg, "--bindings") == 0 && hasValue)
+                bindingsPath = argv[++i];
+            else if (std::strcmp(arg, "--particles") == 0 && hasValue)
+                particleCount = static_cast<uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+            else if (std::strcmp(arg, "--gpu-particles") == 0 && hasValue)
+                gpuParticleCount = static_cast<uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+            else if (std::strcmp(arg, "--bloom") == 0)
+                bloom = true;
+            else if (std::strcmp(arg, "--capture") == 0 && hasValue)
+                config.capturePath = argv[++i];
+            else if (std::strcmp(arg, "--capture-format") == 0 && hasValue)
+            {
+                const char* format = argv[++i];
+                if (std::strcmp(format, "png") == 0)
+                    config.captureFormat = bloom::CaptureFormat::Png;
+                else if (std::strcmp(format, "qoi") == 0)
+                    config.captureFormat = bloom::CaptureFormat::Qoi;
+                else if (std::strcmp(format, "raw") == 0)
+                    config.captureFormat = bloom::CaptureFormat::Raw;
+                else
+                    return false;
+            }
+            else if (std::strcmp(arg, "--size") == 0 && hasValue)
+            {
+                if (std::sscanf(argv[++i], "%dx%d", &config.width, &config.height) != 2)
+                    return false;
+            }
+            else
+                return false;
+        }
+        return true;
+    }
+}
+
+int main(int argc, char** argv)
+{
+    bloom::EngineConfig config;
+    config.title = "bloom";
+
+    const char* bindingsPath = nullptr;
+    uint32_t particleCount = 0;
+    uint32_t gpuParticleCount = 0;
+    bool bloom = false;
+    if (!parseArguments(argc, argv, config, bindingsPath, particleCount, gpuParticleCount, bloom))
+    {
+        usage();
+        return EXIT_FAILURE;
+    }
+
+    bloom::Engine engine(config);
+    SpinnerApp app(bindingsPath, particleCount, gpuParticleCount, bloom);
+    return engine.run(app);
 }
@@ -0,0 +1,135 @@
+#include "math/batch.hpp"
+
+namespace bloom
+{
+    void composeTransforms(const TransformArrays& in, Mat4* out, std::size_t count)
+    {
+        using namespace simd;
+
+        const Float4 one = splat(1.f);
+        const Float4 two = splat(2.f);
+
+        std::size_t i = 0;
+        for (; i + 4 <= count; i += 4)
+        {
+            // Four entities per lane group; each Float4 below holds one
+            // matrix element for all four of them.
+            const Float4 qx = loadu(in.rotationX + i);
+            const Float4 qy = loadu(in.rotationY + i);
+            const Float4 qz = loadu(in.rotationZ + i);
+            const Float4 qw = loadu(in.rotationW + i);
+            const Float4 sx = loadu(in.scaleX + i);
+            const Float4 sy = loadu(in.scaleY + i);
+            const Float4 sz = loadu(in.scaleZ + i);
+
+            const Float4 xx = mul(qx, qx), yy = mul(qy, qy), zz = mul(qz, qz);
+            const Float4 xy = mul(qx, qy), xz = mul(qx, qz), yz = mul(qy, qz);
+            const Float4 wx = mul(qw, qx), wy = mul(qw, qy), wz = mul(qw, qz);
+
+            Float4 c0x = mul(nmadd(two, add(yy, zz), one), sx);
+            Float4 c0y = mul(mul(two, add(xy, wz)), sx);
+            Float4 c0z = mul(mul(two, sub(xz, wy)), sx);
+            Float4 c0w = zero();
+
+            Float4 c1x = mul(mul(two, sub(xy, wz)), sy);
+            Float4 c1y = mul(nmadd(two, add(xx, zz), one), sy);
+            Float4 c1z = mul(mul(two, add(yz, wx)), sy);
+            Float4 c1w = zero();
+
+            Float4 c2x = mul(mul(two, add(xz, wy)), sz);
+            Float4 c2y = mul(mul(two, sub(yz, wx)), sz);
+            Float4 c2z = mul(nmadd(two, add(xx, yy), one), sz);
+            Float4 c2w = zero();
+
+            Float4 c3x = loadu(in.positionX + i);
+            Float4 c3y = loadu(in.positionY + i);
+            Float4 c3z = loadu(in.positionZ + i);
+            Float4 c3w = one;
+
+            // Back to one matrix per entity.
+            transpose(c0x, c0y, c0z, c0w);
+            transpose(c1x, c1y, c1z, c1w);
+            transpose(c2x, c2y, c2z, c2w);
+            transpose(c3x, c3y, c3z, c3w);
+
+            const Float4 columns[4][4] = {{c0x, c1x, c2x, c3x}, {c0y, c1y, c2y, c3y}, {c0z, c1z, c2z, c3z}, {c0w, c1w, c2w, c3w}};
+            for (int e = 0; e < 4; ++e)
+            {
+                float* dst = out[i + e].data();
+                store(dst + 0, columns[e][0]);
+                store(dst + 4, columns[e][1]);
+                store(dst + 8, columns[e][2]);
+                store(dst + 12, columns[e][3]);
+            }
+        }
+
+        for (; i < count; ++i)
+        {
+            out[i] = Mat4::trs({in.positionX[i], in.positionY[i], in.positionZ[i]},
+                               {in.rotationX[i], in.rotationY[i], in.rotationZ[i], in.rotationW[i]},
+                               {in.scaleX[i], in.scaleY[i], in.scaleZ[i]});
+        }
+    }
+
+    void multiplyBatch(const Mat4* a, const Mat4* b, Mat4* out, std::size_t count)
+    {
+        for (std::size_t i = 0; i < count; ++i)
+            out[i] = a[i] * b[i];
+    }
+
+    void multiplyBatch(const Mat4& parent, const Mat4* local, Mat4* out, std::size_t count)
+    {
+        // Keep the parent in registers across the whole batch.
+        const Mat4 p = parent;
+        for (std::size_t i = 0; i < count; ++i)
+            out[i] = p * local[i];
+    }
+
+    void transformPoints(const Mat4& m, const float* x, const float* y, const float* z,
+                         float* outX, float* outY, float* outZ, std::size_t count)
+    {
+        std::size_t i = 0;
+
+#if defined(BLOOM_MATH_AVX2)
+        {
+            using namespace simd;
+            const Float8 m00 = splat8(m.cols[0].x), m10 = splat8(m.cols[0].y), m20 = splat8(m.cols[0].z);
+            const Float8 m01 = splat8(m.cols[1].x), m11 = splat8(m.cols[1].y), m21 = splat8(m.cols[1].z);
+            const Float8 m02 = splat8(m.cols[2].x), m12 = splat8(m.cols[2].y), m22 = splat8(m.cols[2].z);
+            const Float8 m03 = splat8(m.cols[3].x), m13 = splat8(m.cols[3].y), m23 = splat8(m.cols[3].z);
+
+            for (; i + 8 <= count; i += 8)
+            {
+                const Float8 px = load8(x + i), py = load8(y + i), pz = load8(z + i);
+                store8(outX + i, madd(m02, pz, madd(m01, py, madd(m00, px, m03))));
+                store8(outY + i, madd(m12, pz, madd(m11, py, madd(m10, px, m13))));
+                store8(outZ + i, madd(m22, pz, madd(m21, py, madd(m20, px, m23))));
+            }
+        }
+#endif
+
+        {
+            using namespace simd;
+            const Float4 m00 = splat(m.cols[0].x), m10 = splat(m.cols[0].y), m20 = splat(m.cols[0].z);
+            const Float4 m01 = splat(m.cols[1].x), m11 = splat(m.cols[1].y), m21 = splat(m.cols[1].z);
+            const Float4 m02 = splat(m.cols[2].x), m12 = splat(m.cols[2].y), m22 = splat(m.cols[2].z);
+            const Float4 m03 = splat(m.cols[3].x), m13 = splat(m.cols[3].y), m23 = splat(m.cols[3].z);
+
+            for (; i + 4 <= count; i += 4)
+            {
+                const Float4 px = loadu(x + i), py = loadu(y + i), pz = loadu(z + i);
+                storeu(outX + i, madd(m02, pz, madd(m01, py, madd(m00, px, m03))));
+                storeu(outY + i, madd(m12, pz, madd(m11, py, madd(m10, px, m13))));
+                storeu(outZ + i, madd(m22, pz, madd(m21, py, madd(m20, px, m23))));
+            }
+        }
+
+        for (; i < count; ++i)
+        {
+            const Vec3 p = transformPoint(m, {x[i], y[i], z[i]});
+            outX[i] = p.x;
+            outY[i] = p.y;
+            outZ[i] = p.z;
+        }
+    }
+}
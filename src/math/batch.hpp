@@ -0,0 +1,38 @@
+#pragma once
+
+#include <cstddef>
+
+#include "math/mat4.hpp"
+
+namespace bloom
+{
+    // Local transforms as structure-of-arrays: one array per component so
+    // the batch kernels can load four (or eight) entities per register.
+    struct TransformArrays
+    {
+        const float* positionX;
+        const float* positionY;
+        const float* positionZ;
+        const float* rotationX;     // unit quaternions
+        const float* rotationY;
+        const float* rotationZ;
+        const float* rotationW;
+        const float* scaleX;
+        const float* scaleY;
+        const float* scaleZ;
+    };
+
+    // out[i] = Mat4::trs(position[i], rotation[i], scale[i])
+    void composeTransforms(const TransformArrays& in, Mat4* out, std::size_t count);
+
+    // out[i] = a[i] * b[i]; `out` may alias either input.
+    void multiplyBatch(const Mat4* a, const Mat4* b, Mat4* out, std::size_t count);
+
+    // out[i] = parent * local[i]; `out` may alias `local`.
+    void multiplyBatch(const Mat4& parent, const Mat4* local, Mat4* out, std::size_t count);
+
+    // Transforms SoA points (w = 1) by one matrix, eight at a time on AVX2
+    // and four otherwise. Output arrays may alias the inputs.
+    void transformPoints(const Mat4& m, const float* x, const float* y, const float* z,
+                         float* outX, float* outY, float* outZ, std::size_t count);
+}
@@ -0,0 +1,251 @@
+#pragma once
+
+#include <cmath>
+
+#include "math/quat.hpp"
+#include "math/vec.hpp"
+
+namespace bloom
+{
+    // Column-major 4x4 matrix, laid out the way glUniformMatrix4fv expects
+    // with transpose = GL_FALSE. Vectors are columns: p' = M * p.
+    struct alignas(16) Mat4
+    {
+        Vec4 cols[4] = {{1.f, 0.f, 0.f, 0.f}, {0.f, 1.f, 0.f, 0.f}, {0.f, 0.f, 1.f, 0.f}, {0.f, 0.f, 0.f, 1.f}};
+
+        constexpr Mat4() = default;
+        constexpr Mat4(Vec4 c0, Vec4 c1, Vec4 c2, Vec4 c3) : cols{c0, c1, c2, c3} {}
+
+        static constexpr Mat4 identity() { return {}; }
+
+        static constexpr Mat4 translation(Vec3 t)
+        {
+            Mat4 m;
+            m.cols[3] = {t, 1.f};
+            return m;
+        }
+
+        static constexpr Mat4 scale(Vec3 s)
+        {
+            return {{s.x, 0.f, 0.f, 0.f}, {0.f, s.y, 0.f, 0.f}, {0.f, 0.f, s.z, 0.f}, {0.f, 0.f, 0.f, 1.f}};
+        }
+
+        static constexpr Mat4 rotation(Quat q)
+        {
+            const float xx = q.x * q.x, yy = q.y * q.y, zz = q.z * q.z;
+            const float xy = q.x * q.y, xz = q.x * q.z, yz = q.y * q.z;
+            const float wx = q.w * q.x, wy = q.w * q.y, wz = q.w * q.z;
+            return {{1.f - 2.f * (yy + zz), 2.f * (xy + wz), 2.f * (xz - wy), 0.f},
+                    {2.f * (xy - wz), 1.f - 2.f * (xx + zz), 2.f * (yz + wx), 0.f},
+                    {2.f * (xz + wy), 2.f * (yz - wx), 1.f - 2.f * (xx + yy), 0.f},
+                    {0.f, 0.f, 0.f, 1.f}};
+        }
+
+        // translation * rotation * scale in one step.
+        static constexpr Mat4 trs(Vec3 t, Quat r, Vec3 s)
+        {
+            Mat4 m = rotation(r);
+            m.cols[0] *= s.x;
+            m.cols[1] *= s.y;
+            m.cols[2] *= s.z;
+            m.cols[3] = {t, 1.f};
+            return m;
+        }
+
+        // OpenGL clip space (z in [-1, 1]), right-handed view space.
+        static Mat4 perspective(float fovY, float aspect, float zNear, float zFar)
+        {
+            const float f = 1.f / std::tan(fovY * 0.5f);
+            const float range = 1.f / (zNear - zFar);
+            return {{f / aspect, 0.f, 0.f, 0.f},
+                    {0.f, f, 0.f, 0.f},
+                    {0.f, 0.f, (zFar + zNear) * range, -1.f},
+                    {0.f, 0.f, 2.f * zFar * zNear * range, 0.f}};
+        }
+
+        static constexpr Mat4 ortho(float left, float right, float bottom, float top, float zNear, float zFar)
+        {
+            return {{2.f / (right - left), 0.f, 0.f, 0.f},
+                    {0.f, 2.f / (top - bottom), 0.f, 0.f},
+                    {0.f, 0.f, -2.f / (zFar - zNear), 0.f},
+                    {-(right + left) / (right - left), -(top + bottom) / (top - bottom), -(zFar + zNear) / (zFar - zNear), 1.f}};
+        }
+
+        static Mat4 lookAt(Vec3 eye, Vec3 target, Vec3 up)
+        {
+            const Vec3 f = normalize(target - eye);
+            const Vec3 s = normalize(cross(f, up));
+            const Vec3 u = cross(s, f);
+            return {{s.x, u.x, -f.x, 0.f},
+                    {s.y, u.y, -f.y, 0.f},
+                    {s.z, u.z, -f.z, 0.f},
+                    {-dot(s, eye), -dot(u, eye), dot(f, eye), 1.f}};
+        }
+
+        const float* data() const { return cols[0].data(); }
+        float* data() { return cols[0].data(); }
+    };
+
+    constexpr Vec4 operator*(const Mat4& m, Vec4 v)
+    {
+        if consteval
+        {
+            return m.cols[0] * v.x + m.cols[1] * v.y + m.cols[2] * v.z + m.cols[3] * v.w;
+        }
+
+        const simd::Float4 p = v.simd();
+        simd::Float4 r = simd::mul(m.cols[0].simd(), simd::splat<0>(p));
+        r = simd::madd(m.cols[1].simd(), simd::splat<1>(p), r);
+        r = simd::madd(m.cols[2].simd(), simd::splat<2>(p), r);
+        return simd::madd(m.cols[3].simd(), simd::splat<3>(p), r);
+    }
+
+    constexpr Mat4 operator*(const Mat4& a, const Mat4& b)
+    {
+        if consteval
+        {
+            return {a * b.cols[0], a * b.cols[1], a * b.cols[2], a * b.cols[3]};
+        }
+
+        Mat4 r;
+#if defined(BLOOM_MATH_AVX2)
+        // Two result columns per 256-bit register: each column of `a` is
+        // broadcast to both halves and scaled by the matching element of
+        // b's column pair.
+        const __m256 a0 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(a.cols[0].data()));
+        const __m256 a1 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(a.cols[1].data()));
+        const __m256 a2 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(a.cols[2].data()));
+        const __m256 a3 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(a.cols[3].data()));
+        for (int c = 0; c < 4; c += 2)
+        {
+            const __m256 bc = _mm256_loadu_ps(b.cols[c].data());
+            __m256 rc = _mm256_mul_ps(a0, _mm256_shuffle_ps(bc, bc, 0x00));
+            rc = _mm256_fmadd_ps(a1, _mm256_shuffle_ps(bc, bc, 0x55), rc);
+            rc = _mm256_fmadd_ps(a2, _mm256_shuffle_ps(bc, bc, 0xaa), rc);
+            rc = _mm256_fmadd_ps(a3, _mm256_shuffle_ps(bc, bc, 0xff), rc);
+            _mm256_storeu_ps(r.cols[c].data(), rc);
+        }
+#else
+        for (int c = 0; c < 4; ++c)
+            r.cols[c] = a * b.cols[c];
+#endif
+        return r;
+    }
+
+    constexpr Mat4& operator*=(Mat4& a, const Mat4& b) { return a = a * b; }
+
+    constexpr Vec3 transformPoint(const Mat4& m, Vec3 p) { return (m * Vec4(p, 1.f)).xyz(); }
+    constexpr Vec3 transformVector(const Mat4& m, Vec3 v) { return (m * Vec4(v, 0.f)).xyz(); }
+
+    constexpr Mat4 transpose(const Mat4& m)
+    {
+        if consteval
+        {
+            return {{m.cols[0].x, m.cols[1].x, m.cols[2].x, m.cols[3].x},
+                    {m.cols[0].y, m.cols[1].y, m.cols[2].y, m.cols[3].y},
+                    {m.cols[0].z, m.cols[1].z, m.cols[2].z, m.cols[3].z},
+                    {m.cols[0].w, m.cols[1].w, m.cols[2].w, m.cols[3].w}};
+        }
+
+        simd::Float4 c0 = m.cols[0].simd(), c1 = m.cols[1].simd(), c2 = m.cols[2].simd(), c3 = m.cols[3].simd();
+        simd::transpose(c0, c1, c2, c3);
+        return {c0, c1, c2, c3};
+    }
+
+    namespace detail
+    {
+        // 2x2 blocks packed (m00, m01, m10, m11), see inverse().
+        BLOOM_FORCE_INLINE simd::Float4 mat2Mul(simd::Float4 a, simd::Float4 b)
+        {
+            return simd::madd(a, simd::swizzle<0, 3, 0, 3>(b), simd::mul(simd::swizzle<1, 0, 3, 2>(a), simd::swizzle<2, 1, 2, 1>(b)));
+        }
+
+        // adj(a) * b
+        BLOOM_FORCE_INLINE simd::Float4 mat2AdjMul(simd::Float4 a, simd::Float4 b)
+        {
+            return simd::sub(simd::mul(simd::swizzle<3, 3, 0, 0>(a), b), simd::mul(simd::swizzle<1, 1, 2, 2>(a), simd::swizzle<2, 3, 0, 1>(b)));
+        }
+
+        // a * adj(b)
+        BLOOM_FORCE_INLINE simd::Float4 mat2MulAdj(simd::Float4 a, simd::Float4 b)
+        {
+            return simd::sub(simd::mul(a, simd::swizzle<3, 0, 3, 0>(b)), simd::mul(simd::swizzle<1, 0, 3, 2>(a), simd::swizzle<2, 1, 2, 1>(b)));
+        }
+    }
+
+    // General inverse by 2x2 block decomposition (the SIMD-friendly form of
+    // the cofactor expansion): all four blocks are worked on in registers
+    // with no scalar cofactors. Singular matrices give inf/NaN; use
+    // inverseAffine() for rigid transforms.
+    inline Mat4 inverse(const Mat4& m)
+    {
+        using namespace simd;
+        using namespace detail;
+
+        // The algorithm is written for rows; feeding it columns inverts the
+        // transpose, and the transpose of that is read back as columns.
+        const Float4 r0 = m.cols[0].simd(), r1 = m.cols[1].simd(), r2 = m.cols[2].simd(), r3 = m.cols[3].simd();
+
+        const Float4 a = lowHalves(r0, r1);
+        const Float4 b = highHalves(r0, r1);
+        const Float4 c = lowHalves(r2, r3);
+        const Float4 d = highHalves(r2, r3);
+
+        // (|A|, |B|, |C|, |D|)
+        const Float4 detSub = sub(mul(shuffle<0, 2, 0, 2>(r0, r2), shuffle<1, 3, 1, 3>(r1, r3)),
+                                  mul(shuffle<1, 3, 1, 3>(r0, r2), shuffle<0, 2, 0, 2>(r1, r3)));
+        const Float4 detA = splat<0>(detSub);
+        const Float4 detB = splat<1>(detSub);
+        const Float4 detC = splat<2>(detSub);
+        const Float4 detD = splat<3>(detSub);
+
+        const Float4 dc = mat2AdjMul(d, c);
+        const Float4 ab = mat2AdjMul(a, b);
+
+        Float4 x = sub(mul(detD, a), mat2Mul(b, dc));
+        Float4 w = sub(mul(detA, d), mat2Mul(c, ab));
+        Float4 y = sub(mul(detB, c), mat2MulAdj(d, ab));
+        Float4 z = sub(mul(detC, b), mat2MulAdj(a, dc));
+
+        // |M| = |A||D| + |B||C| - tr(adj(A)B adj(D)C)
+        Float4 tr = mul(ab, swizzle<0, 2, 1, 3>(dc));
+        tr = add(tr, swizzle<1, 0, 3, 2>(tr));
+        tr = add(tr, swizzle<2, 3, 0, 1>(tr));
+        const Float4 detM = sub(madd(detA, detD, mul(detB, detC)), tr);
+
+        const Float4 rcpDet = div(set(1.f, -1.f, -1.f, 1.f), detM);
+        x = mul(x, rcpDet);
+        y = mul(y, rcpDet);
+        z = mul(z, rcpDet);
+        w = mul(w, rcpDet);
+
+        return {shuffle<3, 1, 3, 1>(x, y), shuffle<2, 0, 2, 0>(x, y), shuffle<3, 1, 3, 1>(z, w), shuffle<2, 0, 2, 0>(z, w)};
+    }
+
+    // Inverse of a matrix whose last row is (0, 0, 0, 1) and whose upper
+    // 3x3 has no shear: transpose the rotation, divide out the scale and
+    // rotate the translation back.
+    inline Mat4 inverseAffine(const Mat4& m)
+    {
+        using namespace simd;
+
+        Float4 c0 = m.cols[0].simd(), c1 = m.cols[1].simd(), c2 = m.cols[2].simd(), c3 = zero();
+        transpose(c0, c1, c2, c3);
+
+        // Squared column lengths (scale^2) in lanes 0-2; lane 3 is padded
+        // to 1 so the zero w lanes stay zero.
+        const Float4 scaleSq = add(madd(c0, c0, madd(c1, c1, mul(c2, c2))), set(0.f, 0.f, 0.f, 1.f));
+        const Float4 rcpScaleSq = div(splat(1.f), scaleSq);
+        c0 = mul(c0, rcpScaleSq);
+        c1 = mul(c1, rcpScaleSq);
+        c2 = mul(c2, rcpScaleSq);
+
+        const Float4 t = m.cols[3].simd();
+        Float4 translation = mul(c0, splat<0>(t));
+        translation = madd(c1, splat<1>(t), translation);
+        translation = madd(c2, splat<2>(t), translation);
+        translation = sub(set(0.f, 0.f, 0.f, 1.f), translation);
+
+        return {c0, c1, c2, translation};
+    }
+}
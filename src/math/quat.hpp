@@ -0,0 +1,99 @@
+#pragma once
+
+#include <cmath>
+
+#include "math/vec.hpp"
+
+namespace bloom
+{
+    // Unit quaternion rotation, stored (x, y, z, w) with w the scalar part
+    // so it loads straight into a Float4.
+    struct alignas(16) Quat
+    {
+        float x = 0.f;
+        float y = 0.f;
+        float z = 0.f;
+        float w = 1.f;
+
+        constexpr Quat() = default;
+        constexpr Quat(float x, float y, float z, float w) : x(x), y(y), z(z), w(w) {}
+
+        Quat(simd::Float4 v) { simd::store(&x, v); }
+        simd::Float4 simd() const { return simd::load(&x); }
+
+        static Quat fromAxisAngle(Vec3 axis, float radians)
+        {
+            const Vec3 n = normalize(axis);
+            const float s = std::sin(radians * 0.5f);
+            return {n.x * s, n.y * s, n.z * s, std::cos(radians * 0.5f)};
+        }
+
+        static Quat fromEuler(float pitch, float yaw, float roll)
+        {
+            return fromAxisAngle({0.f, 1.f, 0.f}, yaw) * fromAxisAngle({1.f, 0.f, 0.f}, pitch) * fromAxisAngle({0.f, 0.f, 1.f}, roll);
+        }
+
+        friend constexpr Quat operator*(Quat a, Quat b)
+        {
+            if consteval
+            {
+                return {a.w * b.x + a.x * b.w + a.y * b.z - a.z * b.y,
+                        a.w * b.y - a.x * b.z + a.y * b.w + a.z * b.x,
+                        a.w * b.z + a.x * b.y - a.y * b.x + a.z * b.w,
+                        a.w * b.w - a.x * b.x - a.y * b.y - a.z * b.z};
+            }
+
+            // Hamilton product as four broadcast-multiply-adds with the
+            // signs folded into constant masks.
+            const simd::Float4 qa = a.simd();
+            const simd::Float4 qb = b.simd();
+            simd::Float4 r = simd::mul(simd::splat<3>(qa), qb);
+            r = simd::madd(simd::mul(simd::splat<0>(qa), simd::set(1.f, -1.f, 1.f, -1.f)), simd::swizzle<3, 2, 1, 0>(qb), r);
+            r = simd::madd(simd::mul(simd::splat<1>(qa), simd::set(1.f, 1.f, -1.f, -1.f)), simd::swizzle<2, 3, 0, 1>(qb), r);
+            r = simd::madd(simd::mul(simd::splat<2>(qa), simd::set(-1.f, 1.f, 1.f, -1.f)), simd::swizzle<1, 0, 3, 2>(qb), r);
+            return r;
+        }
+    };
+
+    constexpr Quat conjugate(Quat q) { return {-q.x, -q.y, -q.z, q.w}; }
+    constexpr float dot(Quat a, Quat b) { return a.x * b.x + a.y * b.y + a.z * b.z + a.w * b.w; }
+
+    inline Quat normalize(Quat q)
+    {
+        const simd::Float4 v = q.simd();
+        return simd::div(v, simd::sqrt(simd::dot4(v, v)));
+    }
+
+    // v' = v + 2w(u x v) + 2u x (u x v), cheaper than q v q*.
+    constexpr Vec3 rotate(Quat q, Vec3 v)
+    {
+        const Vec3 u{q.x, q.y, q.z};
+        const Vec3 t = cross(u, v) * 2.f;
+        return v + t * q.w + cross(u, t);
+    }
+
+    // Normalized linear interpolation along the shorter arc; close enough
+    // to slerp for animation blending and much cheaper.
+    inline Quat nlerp(Quat a, Quat b, float t)
+    {
+        const float sign = dot(a, b) < 0.f ? -1.f : 1.f;
+        const simd::Float4 from = a.simd();
+        const simd::Float4 to = simd::mul(b.simd(), simd::splat(sign));
+        return normalize(Quat(simd::madd(simd::sub(to, from), simd::splat(t), from)));
+    }
+
+    inline Quat slerp(Quat a, Quat b, float t)
+    {
+        float cosTheta = dot(a, b);
+        const float sign = cosTheta < 0.f ? -1.f : 1.f;
+        cosTheta *= sign;
+        if (cosTheta > 0.9995f)
+            return nlerp(a, b, t);
+
+        const float theta = std::acos(cosTheta);
+        const float inv = 1.f / std::sin(theta);
+        const float wa = std::sin((1.f - t) * theta) * inv;
+        const float wb = std::sin(t * theta) * inv * sign;
+        return simd::madd(a.simd(), simd::splat(wa), simd::mul(b.simd(), simd::splat(wb)));
+    }
+}
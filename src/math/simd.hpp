@@ -0,0 +1,280 @@
+#pragma once
+
+// Thin portable layer over 4-wide (and, with AVX2, 8-wide) float vectors.
+// The math types are written once against these helpers; the instruction
+// set is chosen at compile time:
+//
+//     BLOOM_MATH_AVX2    x86 with AVX2 + FMA (BLOOM_ENABLE_AVX2 in CMake)
+//     BLOOM_MATH_SSE     any other x86-64 (SSE2 is part of the ABI)
+//     BLOOM_MATH_NEON    AArch64 / ARMv7 NEON with GCC or Clang
+//     BLOOM_MATH_SCALAR  everything else, and BLOOM_MATH_FORCE_SCALAR
+//
+// Every TU must agree on the choice, so the CMake flags that select it are
+// PUBLIC on the bloom target.
+
+#include <cmath>
+
+#if !defined(BLOOM_MATH_FORCE_SCALAR) && defined(__AVX2__) && defined(__FMA__)
+    #define BLOOM_MATH_AVX2 1
+    #define BLOOM_MATH_SSE 1
+    #include <immintrin.h>
+#elif !defined(BLOOM_MATH_FORCE_SCALAR) && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+    #define BLOOM_MATH_SSE 1
+    #include <emmintrin.h>
+#elif !defined(BLOOM_MATH_FORCE_SCALAR) && defined(__ARM_NEON) && (defined(__GNUC__) || defined(__clang__))
+    #define BLOOM_MATH_NEON 1
+    #include <arm_neon.h>
+#else
+    #define BLOOM_MATH_SCALAR 1
+#endif
+
+#if defined(_MSC_VER) && !defined(__clang__)
+    #define BLOOM_FORCE_INLINE __forceinline
+#else
+    #define BLOOM_FORCE_INLINE inline __attribute__((always_inline))
+#endif
+
+namespace bloom::simd
+{
+    constexpr const char* kInstructionSet =
+#if defined(BLOOM_MATH_AVX2)
+        "avx2";
+#elif defined(BLOOM_MATH_SSE)
+        "sse2";
+#elif defined(BLOOM_MATH_NEON)
+        "neon";
+#else
+        "scalar";
+#endif
+
+#if defined(BLOOM_MATH_SSE)
+    struct Float4
+    {
+        __m128 v;
+    };
+
+    BLOOM_FORCE_INLINE Float4 load(const float* p) { return {_mm_load_ps(p)}; }
+    BLOOM_FORCE_INLINE Float4 loadu(const float* p) { return {_mm_loadu_ps(p)}; }
+    BLOOM_FORCE_INLINE void store(float* p, Float4 a) { _mm_store_ps(p, a.v); }
+    BLOOM_FORCE_INLINE void storeu(float* p, Float4 a) { _mm_storeu_ps(p, a.v); }
+    BLOOM_FORCE_INLINE Float4 set(float x, float y, float z, float w) { return {_mm_setr_ps(x, y, z, w)}; }
+    BLOOM_FORCE_INLINE Float4 splat(float s) { return {_mm_set1_ps(s)}; }
+    BLOOM_FORCE_INLINE Float4 zero() { return {_mm_setzero_ps()}; }
+
+    BLOOM_FORCE_INLINE Float4 add(Float4 a, Float4 b) { return {_mm_add_ps(a.v, b.v)}; }
+    BLOOM_FORCE_INLINE Float4 sub(Float4 a, Float4 b) { return {_mm_sub_ps(a.v, b.v)}; }
+    BLOOM_FORCE_INLINE Float4 mul(Float4 a, Float4 b) { return {_mm_mul_ps(a.v, b.v)}; }
+    BLOOM_FORCE_INLINE Float4 div(Float4 a, Float4 b) { return {_mm_div_ps(a.v, b.v)}; }
+    BLOOM_FORCE_INLINE Float4 min(Float4 a, Float4 b) { return {_mm_min_ps(a.v, b.v)}; }
+    BLOOM_FORCE_INLINE Float4 max(Float4 a, Float4 b) { return {_mm_max_ps(a.v, b.v)}; }
+    BLOOM_FORCE_INLINE Float4 sqrt(Float4 a) { return {_mm_sqrt_ps(a.v)}; }
+
+    // a * b + c
+    BLOOM_FORCE_INLINE Float4 madd(Float4 a, Float4 b, Float4 c)
+    {
+    #if defined(BLOOM_MATH_AVX2)
+        return {_mm_fmadd_ps(a.v, b.v, c.v)};
+    #else
+        return {_mm_add_ps(_mm_mul_ps(a.v, b.v), c.v)};
+    #endif
+    }
+
+    // c - a * b
+    BLOOM_FORCE_INLINE Float4 nmadd(Float4 a, Float4 b, Float4 c)
+    {
+    #if defined(BLOOM_MATH_AVX2)
+        return {_mm_fnmadd_ps(a.v, b.v, c.v)};
+    #else
+        return {_mm_sub_ps(c.v, _mm_mul_ps(a.v, b.v))};
+    #endif
+    }
+
+    // (a[X], a[Y], b[Z], b[W])
+    template <int X, int Y, int Z, int W>
+    BLOOM_FORCE_INLINE Float4 shuffle(Float4 a, Float4 b)
+    {
+        return {_mm_shuffle_ps(a.v, b.v, _MM_SHUFFLE(W, Z, Y, X))};
+    }
+
+    template <int X, int Y, int Z, int W>
+    BLOOM_FORCE_INLINE Float4 swizzle(Float4 a)
+    {
+        return {_mm_castsi128_ps(_mm_shuffle_epi32(_mm_castps_si128(a.v), _MM_SHUFFLE(W, Z, Y, X)))};
+    }
+
+    // (a0, a1, b0, b1) and (a2, a3, b2, b3)
+    BLOOM_FORCE_INLINE Float4 lowHalves(Float4 a, Float4 b) { return {_mm_movelh_ps(a.v, b.v)}; }
+    BLOOM_FORCE_INLINE Float4 highHalves(Float4 a, Float4 b) { return {_mm_movehl_ps(b.v, a.v)}; }
+
+    template <int I>
+    BLOOM_FORCE_INLINE float lane(Float4 a) { return _mm_cvtss_f32(swizzle<I, I, I, I>(a).v); }
+
+    // Bit i is set when lane i is below zero (-0 and NaN are not).
+    BLOOM_FORCE_INLINE int negativeMask(Float4 a) { return _mm_movemask_ps(_mm_cmplt_ps(a.v, _mm_setzero_ps())); }
+
+    BLOOM_FORCE_INLINE void transpose(Float4& a, Float4& b, Float4& c, Float4& d)
+    {
+        _MM_TRANSPOSE4_PS(a.v, b.v, c.v, d.v);
+    }
+#elif defined(BLOOM_MATH_NEON)
+    struct Float4
+    {
+        float32x4_t v;
+    };
+
+    BLOOM_FORCE_INLINE Float4 load(const float* p) { return {vld1q_f32(p)}; }
+    BLOOM_FORCE_INLINE Float4 loadu(const float* p) { return {vld1q_f32(p)}; }
+    BLOOM_FORCE_INLINE void store(float* p, Float4 a) { vst1q_f32(p, a.v); }
+    BLOOM_FORCE_INLINE void storeu(float* p, Float4 a) { vst1q_f32(p, a.v); }
+    BLOOM_FORCE_INLINE Float4 set(float x, float y, float z, float w) { return {float32x4_t{x, y, z, w}}; }
+    BLOOM_FORCE_INLINE Float4 splat(float s) { return {vdupq_n_f32(s)}; }
+    BLOOM_FORCE_INLINE Float4 zero() { return {vdupq_n_f32(0.f)}; }
+
+    BLOOM_FORCE_INLINE Float4 add(Float4 a, Float4 b) { return {vaddq_f32(a.v, b.v)}; }
+    BLOOM_FORCE_INLINE Float4 sub(Float4 a, Float4 b) { return {vsubq_f32(a.v, b.v)}; }
+    BLOOM_FORCE_INLINE Float4 mul(Float4 a, Float4 b) { return {vmulq_f32(a.v, b.v)}; }
+    BLOOM_FORCE_INLINE Float4 min(Float4 a, Float4 b) { return {vminq_f32(a.v, b.v)}; }
+    BLOOM_FORCE_INLINE Float4 max(Float4 a, Float4 b) { return {vmaxq_f32(a.v, b.v)}; }
+
+    #if defined(__aarch64__)
+    BLOOM_FORCE_INLINE Float4 div(Float4 a, Float4 b) { return {vdivq_f32(a.v, b.v)}; }
+    BLOOM_FORCE_INLINE Float4 sqrt(Float4 a) { return {vsqrtq_f32(a.v)}; }
+    BLOOM_FORCE_INLINE Float4 madd(Float4 a, Float4 b, Float4 c) { return {vfmaq_f32(c.v, a.v, b.v)}; }
+    BLOOM_FORCE_INLINE Float4 nmadd(Float4 a, Float4 b, Float4 c) { return {vfmsq_f32(c.v, a.v, b.v)}; }
+    #else
+    BLOOM_FORCE_INLINE Float4 div(Float4 a, Float4 b) { return {a.v / b.v}; }
+    BLOOM_FORCE_INLINE Float4 sqrt(Float4 a)
+    {
+        return {float32x4_t{std::sqrt(a.v[0]), std::sqrt(a.v[1]), std::sqrt(a.v[2]), std::sqrt(a.v[3])}};
+    }
+    BLOOM_FORCE_INLINE Float4 madd(Float4 a, Float4 b, Float4 c) { return {vmlaq_f32(c.v, a.v, b.v)}; }
+    BLOOM_FORCE_INLINE Float4 nmadd(Float4 a, Float4 b, Float4 c) { return {vmlsq_f32(c.v, a.v, b.v)}; }
+    #endif
+
+    template <int X, int Y, int Z, int W>
+    BLOOM_FORCE_INLINE Float4 shuffle(Float4 a, Float4 b)
+    {
+        return {__builtin_shufflevector(a.v, b.v, X, Y, Z + 4, W + 4)};
+    }
+
+    template <int X, int Y, int Z, int W>
+    BLOOM_FORCE_INLINE Float4 swizzle(Float4 a)
+    {
+        return {__builtin_shufflevector(a.v, a.v, X, Y, Z, W)};
+    }
+
+    BLOOM_FORCE_INLINE Float4 lowHalves(Float4 a, Float4 b) { return {vcombine_f32(vget_low_f32(a.v), vget_low_f32(b.v))}; }
+    BLOOM_FORCE_INLINE Float4 highHalves(Float4 a, Float4 b) { return {vcombine_f32(vget_high_f32(a.v), vget_high_f32(b.v))}; }
+
+    template <int I>
+    BLOOM_FORCE_INLINE float lane(Float4 a) { return vgetq_lane_f32(a.v, I); }
+
+    BLOOM_FORCE_INLINE int negativeMask(Float4 a)
+    {
+        const uint32x4_t m = vcltq_f32(a.v, vdupq_n_f32(0.f));
+        return static_cast<int>((vgetq_lane_u32(m, 0) & 1) | (vgetq_lane_u32(m, 1) & 2) |
+                                (vgetq_lane_u32(m, 2) & 4) | (vgetq_lane_u32(m, 3) & 8));
+    }
+
+    BLOOM_FORCE_INLINE void transpose(Float4& a, Float4& b, Float4& c, Float4& d)
+    {
+        const float32x4x2_t ab = vtrnq_f32(a.v, b.v);
+        const float32x4x2_t cd = vtrnq_f32(c.v, d.v);
+        a.v = vcombine_f32(vget_low_f32(ab.val[0]), vget_low_f32(cd.val[0]));
+        b.v = vcombine_f32(vget_low_f32(ab.val[1]), vget_low_f32(cd.val[1]));
+        c.v = vcombine_f32(vget_high_f32(ab.val[0]), vget_high_f32(cd.val[0]));
+        d.v = vcombine_f32(vget_high_f32(ab.val[1]), vget_high_f32(cd.val[1]));
+    }
+#else
+    struct Float4
+    {
+        float v[4];
+    };
+
+    inline Float4 load(const float* p) { return {{p[0], p[1], p[2], p[3]}}; }
+    inline Float4 loadu(const float* p) { return load(p); }
+    inline void store(float* p, Float4 a) { for (int i = 0; i < 4; ++i) p[i] = a.v[i]; }
+    inline void storeu(float* p, Float4 a) { store(p, a); }
+    inline Float4 set(float x, float y, float z, float w) { return {{x, y, z, w}}; }
+    inline Float4 splat(float s) { return {{s, s, s, s}}; }
+    inline Float4 zero() { return splat(0.f); }
+
+    #define BLOOM_SIMD_SCALAR_OP(name, expr) \
+        inline Float4 name(Float4 a, Float4 b) \
+        { \
+            Float4 r; \
+            for (int i = 0; i < 4; ++i) \
+                r.v[i] = expr; \
+            return r; \
+        }
+    BLOOM_SIMD_SCALAR_OP(add, a.v[i] + b.v[i])
+    BLOOM_SIMD_SCALAR_OP(sub, a.v[i] - b.v[i])
+    BLOOM_SIMD_SCALAR_OP(mul, a.v[i] * b.v[i])
+    BLOOM_SIMD_SCALAR_OP(div, a.v[i] / b.v[i])
+    BLOOM_SIMD_SCALAR_OP(min, a.v[i] < b.v[i] ? a.v[i] : b.v[i])
+    BLOOM_SIMD_SCALAR_OP(max, a.v[i] > b.v[i] ? a.v[i] : b.v[i])
+    #undef BLOOM_SIMD_SCALAR_OP
+
+    inline Float4 sqrt(Float4 a) { return {{std::sqrt(a.v[0]), std::sqrt(a.v[1]), std::sqrt(a.v[2]), std::sqrt(a.v[3])}}; }
+    inline Float4 madd(Float4 a, Float4 b, Float4 c) { return add(mul(a, b), c); }
+    inline Float4 nmadd(Float4 a, Float4 b, Float4 c) { return sub(c, mul(a, b)); }
+
+    template <int X, int Y, int Z, int W>
+    inline Float4 shuffle(Float4 a, Float4 b) { return {{a.v[X], a.v[Y], b.v[Z], b.v[W]}}; }
+
+    template <int X, int Y, int Z, int W>
+    inline Float4 swizzle(Float4 a) { return {{a.v[X], a.v[Y], a.v[Z], a.v[W]}}; }
+
+    inline Float4 lowHalves(Float4 a, Float4 b) { return {{a.v[0], a.v[1], b.v[0], b.v[1]}}; }
+    inline Float4 highHalves(Float4 a, Float4 b) { return {{a.v[2], a.v[3], b.v[2], b.v[3]}}; }
+
+    template <int I>
+    inline float lane(Float4 a) { return a.v[I]; }
+
+    inline int negativeMask(Float4 a)
+    {
+        int mask = 0;
+        for (int i = 0; i < 4; ++i)
+            mask |= (a.v[i] < 0.f ? 1 : 0) << i;
+        return mask;
+    }
+
+    inline void transpose(Float4& a, Float4& b, Float4& c, Float4& d)
+    {
+        const Float4 t0 = a, t1 = b, t2 = c, t3 = d;
+        a = {{t0.v[0], t1.v[0], t2.v[0], t3.v[0]}};
+        b = {{t0.v[1], t1.v[1], t2.v[1], t3.v[1]}};
+        c = {{t0.v[2], t1.v[2], t2.v[2], t3.v[2]}};
+        d = {{t0.v[3], t1.v[3], t2.v[3], t3.v[3]}};
+    }
+#endif
+
+    template <int I>
+    BLOOM_FORCE_INLINE Float4 splat(Float4 a) { return swizzle<I, I, I, I>(a); }
+
+    // Dot product of all four lanes, broadcast to every lane.
+    BLOOM_FORCE_INLINE Float4 dot4(Float4 a, Float4 b)
+    {
+        const Float4 m = mul(a, b);
+        const Float4 s = add(m, swizzle<1, 0, 3, 2>(m));
+        return add(s, swizzle<2, 3, 0, 1>(s));
+    }
+
+#if defined(BLOOM_MATH_AVX2)
+    // Eight lanes; only the batch kernels use it.
+    struct Float8
+    {
+        __m256 v;
+    };
+
+    BLOOM_FORCE_INLINE Float8 load8(const float* p) { return {_mm256_loadu_ps(p)}; }
+    BLOOM_FORCE_INLINE void store8(float* p, Float8 a) { _mm256_storeu_ps(p, a.v); }
+    BLOOM_FORCE_INLINE Float8 splat8(float s) { return {_mm256_set1_ps(s)}; }
+    BLOOM_FORCE_INLINE Float8 add(Float8 a, Float8 b) { return {_mm256_add_ps(a.v, b.v)}; }
+    BLOOM_FORCE_INLINE Float8 sub(Float8 a, Float8 b) { return {_mm256_sub_ps(a.v, b.v)}; }
+    BLOOM_FORCE_INLINE Float8 mul(Float8 a, Float8 b) { return {_mm256_mul_ps(a.v, b.v)}; }
+    BLOOM_FORCE_INLINE Float8 madd(Float8 a, Float8 b, Float8 c) { return {_mm256_fmadd_ps(a.v, b.v, c.v)}; }
+    BLOOM_FORCE_INLINE Float8 min(Float8 a, Float8 b) { return {_mm256_min_ps(a.v, b.v)}; }
+    BLOOM_FORCE_INLINE int negativeMask(Float8 a) { return _mm256_movemask_ps(_mm256_cmp_ps(a.v, _mm256_setzero_ps(), _CMP_LT_OQ)); }
+#endif
+}
@@ -0,0 +1,146 @@
+#pragma once
+
+#include <cmath>
+
+#include "math/simd.hpp"
+
+namespace bloom
+{
+    // Three floats, no padding, plain scalar code: vec3 math gains nothing
+    // from 4-wide registers and the tight layout matters more in arrays.
+    struct Vec3
+    {
+        float x = 0.f;
+        float y = 0.f;
+        float z = 0.f;
+
+        constexpr Vec3() = default;
+        constexpr Vec3(float x, float y, float z) : x(x), y(y), z(z) {}
+        constexpr explicit Vec3(float s) : x(s), y(s), z(s) {}
+
+        constexpr float operator[](int i) const { return i == 0 ? x : (i == 1 ? y : z); }
+    };
+
+    constexpr Vec3 operator+(Vec3 a, Vec3 b) { return {a.x + b.x, a.y + b.y, a.z + b.z}; }
+    constexpr Vec3 operator-(Vec3 a, Vec3 b) { return {a.x - b.x, a.y - b.y, a.z - b.z}; }
+    constexpr Vec3 operator-(Vec3 a) { return {-a.x, -a.y, -a.z}; }
+    constexpr Vec3 operator*(Vec3 a, Vec3 b) { return {a.x * b.x, a.y * b.y, a.z * b.z}; }
+    constexpr Vec3 operator*(Vec3 a, float s) { return {a.x * s, a.y * s, a.z * s}; }
+    constexpr Vec3 operator*(float s, Vec3 a) { return a * s; }
+    constexpr Vec3 operator/(Vec3 a, float s) { return {a.x / s, a.y / s, a.z / s}; }
+    constexpr Vec3& operator+=(Vec3& a, Vec3 b) { return a = a + b; }
+    constexpr Vec3& operator-=(Vec3& a, Vec3 b) { return a = a - b; }
+    constexpr Vec3& operator*=(Vec3& a, float s) { return a = a * s; }
+    constexpr bool operator==(Vec3 a, Vec3 b) { return a.x == b.x && a.y == b.y && a.z == b.z; }
+
+    constexpr float dot(Vec3 a, Vec3 b) { return a.x * b.x + a.y * b.y + a.z * b.z; }
+    constexpr Vec3 cross(Vec3 a, Vec3 b) { return {a.y * b.z - a.z * b.y, a.z * b.x - a.x * b.z, a.x * b.y - a.y * b.x}; }
+    constexpr Vec3 min(Vec3 a, Vec3 b) { return {a.x < b.x ? a.x : b.x, a.y < b.y ? a.y : b.y, a.z < b.z ? a.z : b.z}; }
+    constexpr Vec3 max(Vec3 a, Vec3 b) { return {a.x > b.x ? a.x : b.x, a.y > b.y ? a.y : b.y, a.z > b.z ? a.z : b.z}; }
+    constexpr Vec3 lerp(Vec3 a, Vec3 b, float t) { return a + (b - a) * t; }
+    inline float length(Vec3 a) { return std::sqrt(dot(a, a)); }
+    inline Vec3 normalize(Vec3 a) { return a * (1.f / length(a)); }
+
+    // Four floats in one SIMD register. Every operation is constexpr: in
+    // constant evaluation it takes the scalar path, at run time the vector
+    // one.
+    struct alignas(16) Vec4
+    {
+        float x = 0.f;
+        float y = 0.f;
+        float z = 0.f;
+        float w = 0.f;
+
+        constexpr Vec4() = default;
+        constexpr Vec4(float x, float y, float z, float w) : x(x), y(y), z(z), w(w) {}
+        constexpr Vec4(Vec3 v, float w) : x(v.x), y(v.y), z(v.z), w(w) {}
+        constexpr explicit Vec4(float s) : x(s), y(s), z(s), w(s) {}
+
+        Vec4(simd::Float4 v) { simd::store(&x, v); }
+        simd::Float4 simd() const { return simd::load(&x); }
+
+        constexpr Vec3 xyz() const { return {x, y, z}; }
+        constexpr float operator[](int i) const { return i == 0 ? x : (i == 1 ? y : (i == 2 ? z : w)); }
+        float* data() { return &x; }
+        const float* data() const { return &x; }
+    };
+
+    constexpr Vec4 operator+(Vec4 a, Vec4 b)
+    {
+        if consteval
+        {
+            return {a.x + b.x, a.y + b.y, a.z + b.z, a.w + b.w};
+        }
+        return simd::add(a.simd(), b.simd());
+    }
+
+    constexpr Vec4 operator-(Vec4 a, Vec4 b)
+    {
+        if consteval
+        {
+            return {a.x - b.x, a.y - b.y, a.z - b.z, a.w - b.w};
+        }
+        return simd::sub(a.simd(), b.simd());
+    }
+
+    constexpr Vec4 operator*(Vec4 a, Vec4 b)
+    {
+        if consteval
+        {
+            return {a.x * b.x, a.y * b.y, a.z * b.z, a.w * b.w};
+        }
+        return simd::mul(a.simd(), b.simd());
+    }
+
+    constexpr Vec4 operator*(Vec4 a, float s)
+    {
+        if consteval
+        {
+            return {a.x * s, a.y * s, a.z * s, a.w * s};
+        }
+        return simd::mul(a.simd(), simd::splat(s));
+    }
+
+    constexpr Vec4 operator*(float s, Vec4 a) { return a * s; }
+    constexpr Vec4 operator-(Vec4 a) { return a * -1.f; }
+    constexpr Vec4& operator+=(Vec4& a, Vec4 b) { return a = a + b; }
+    constexpr Vec4& operator-=(Vec4& a, Vec4 b) { return a = a - b; }
+    constexpr Vec4& operator*=(Vec4& a, float s) { return a = a * s; }
+    constexpr bool operator==(Vec4 a, Vec4 b) { return a.x == b.x && a.y == b.y && a.z == b.z && a.w == b.w; }
+
+    constexpr float dot(Vec4 a, Vec4 b)
+    {
+        if consteval
+        {
+            return a.x * b.x + a.y * b.y + a.z * b.z + a.w * b.w;
+        }
+        return simd::lane<0>(simd::dot4(a.simd(), b.simd()));
+    }
+
+    constexpr Vec4 min(Vec4 a, Vec4 b)
+    {
+        if consteval
+        {
+            return {a.x < b.x ? a.x : b.x, a.y < b.y ? a.y : b.y, a.z < b.z ? a.z : b.z, a.w < b.w ? a.w : b.w};
+        }
+        return simd::min(a.simd(), b.simd());
+    }
+
+    constexpr Vec4 max(Vec4 a, Vec4 b)
+    {
+        if consteval
+        {
+            return {a.x > b.x ? a.x : b.x, a.y > b.y ? a.y : b.y, a.z > b.z ? a.z : b.z, a.w > b.w ? a.w : b.w};
+        }
+        return simd::max(a.simd(), b.simd());
+    }
+
+    constexpr Vec4 lerp(Vec4 a, Vec4 b, float t) { return a + (b - a) * t; }
+    inline float length(Vec4 a) { return std::sqrt(dot(a, a)); }
+
+    inline Vec4 normalize(Vec4 a)
+    {
+        const simd::Float4 v = a.simd();
+        return simd::div(v, simd::sqrt(simd::dot4(v, v)));
+    }
+}
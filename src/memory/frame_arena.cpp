@@ -0,0 +1,138 @@
+#include "memory/frame_arena.hpp"
+
+#include <algorithm>
+#include <bit>
+
+#include "memory/memory.hpp"
+
+namespace bloom
+{
+    // Overflow storage is itself bump-allocated in blocks that double in
+    // size, starting from the size of the main block.
+    struct alignas(std::max_align_t) FrameArena::OverflowBlock
+    {
+        OverflowBlock* next;
+        std::size_t capacity;
+        std::size_t offset;
+
+        std::byte* data() { return reinterpret_cast<std::byte*>(this + 1); }
+    };
+
+    namespace
+    {
+        std::byte* alignPointer(std::byte* p, std::size_t alignment)
+        {
+            return reinterpret_cast<std::byte*>((reinterpret_cast<uintptr_t>(p) + alignment - 1) & ~(uintptr_t(alignment) - 1));
+        }
+    }
+
+    FrameArena::FrameArena(std::size_t capacity)
+        : m_capacity(capacity)
+    {
+    }
+
+    FrameArena::~FrameArena()
+    {
+        releaseOverflow(nullptr);
+        Memory::deallocate(m_block);
+    }
+
+    FrameArena& FrameArena::thread()
+    {
+        thread_local FrameArena t_arena;
+        return t_arena;
+    }
+
+    void* FrameArena::allocate(std::size_t size, std::size_t alignment)
+    {
+        if (!m_block)
+            m_block = static_cast<std::byte*>(Memory::allocate(m_capacity, MemoryTag::FrameArena, 64));
+
+        std::byte* p = alignPointer(m_block + m_offset, alignment);
+        if (!m_overflow && p + size <= m_block + m_capacity)
+        {
+            m_offset = static_cast<std::size_t>(p + size - m_block);
+            m_peak = std::max(m_peak, m_offset);
+            return p;
+        }
+        return allocateOverflow(size, alignment);
+    }
+
+    void* FrameArena::allocateOverflow(std::size_t size, std::size_t alignment)
+    {
+        if (m_overflow)
+        {
+            std::byte* p = alignPointer(m_overflow->data() + m_overflow->offset, alignment);
+            if (p + size <= m_overflow->data() + m_overflow->capacity)
+            {
+                const std::size_t end = static_cast<std::size_t>(p + size - m_overflow->data());
+                m_overflowBytes += end - m_overflow->offset;
+                m_overflow->offset = end;
+                m_peak = std::max(m_peak, m_offset + m_overflowBytes);
+                return p;
+            }
+        }
+
+        const std::size_t previous = m_overflow ? m_overflow->capacity * 2 : m_capacity;
+        const std::size_t capacity = std::max(previous, size + alignment);
+        void* memory = Memory::allocate(sizeof(OverflowBlock) + capacity, MemoryTag::FrameArena);
+        if (!memory)
+            return nullptr;
+
+        m_overflow = new (memory) OverflowBlock{m_overflow, capacity, 0};
+        ++m_overflows;
+        return allocateOverflow(size, alignment);
+    }
+
+    FrameArena::Marker FrameArena::mark() const
+    {
+        return {m_offset, m_overflow, m_overflow ? m_overflow->offset : 0};
+    }
+
+    void FrameArena::rewind(const Marker& marker)
+    {
+        // Back to empty, as after every job on a worker, whose arena never
+        // sees reset(): nothing can point into the arena any more, so size
+        // it for the peak the same way.
+        if (marker.offset == 0 && !marker.overflow)
+        {
+            reset();
+            return;
+        }
+
+        OverflowBlock* block = static_cast<OverflowBlock*>(marker.overflow);
+        releaseOverflow(block);
+        if (block)
+        {
+            m_overflowBytes -= block->offset - marker.overflowOffset;
+            block->offset = marker.overflowOffset;
+        }
+        m_offset = marker.offset;
+    }
+
+    void FrameArena::reset()
+    {
+        releaseOverflow(nullptr);
+        m_offset = 0;
+
+        // Spilled this frame: size the block for it so the next one won't.
+        if (m_peak > m_capacity)
+        {
+            Memory::deallocate(m_block);
+            m_block = nullptr;
+            m_capacity = std::bit_ceil(m_peak);
+        }
+        m_peak = 0;
+    }
+
+    void FrameArena::releaseOverflow(OverflowBlock* until)
+    {
+        while (m_overflow != until)
+        {
+            OverflowBlock* next = m_overflow->next;
+            m_overflowBytes -= m_overflow->offset;
+            Memory::deallocate(m_overflow);
+            m_overflow = next;
+        }
+    }
+}
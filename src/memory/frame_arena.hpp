@@ -0,0 +1,127 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <type_traits>
+
+namespace bloom
+{
+    // Linear allocator for data that lives at most until the end of the
+    // current frame. Allocation is a pointer bump, there is no per-block
+    // free, and reset() releases everything at once.
+    //
+    // A frame that outgrows the block spills into overflow blocks from the
+    // tracking allocator; the next reset() frees them and grows the main
+    // block to the frame's peak, so after the first few frames a steady
+    // workload never touches the heap.
+    //
+    // Every thread has its own arena (FrameArena::thread()). The engine
+    // resets the main, simulation and render threads' arenas at their frame
+    // boundaries, and the job system rewinds a worker's arena after each
+    // job, so job code can use it as scratch without any bookkeeping.
+    // Rewinding to an empty arena counts as a reset, which is what lets a
+    // worker's arena grow too.
+    class FrameArena
+    {
+    public:
+        struct Marker
+        {
+            std::size_t offset = 0;
+            void* overflow = nullptr;
+            std::size_t overflowOffset = 0;
+        };
+
+        struct Stats
+        {
+            std::size_t capacity = 0;
+            std::size_t used = 0;
+            std::size_t peak = 0;           // bytes, since the last reset
+            uint64_t overflows = 0;         // since construction
+        };
+
+        static constexpr std::size_t kDefaultCapacity = 256 * 1024;
+
+        explicit FrameArena(std::size_t capacity = kDefaultCapacity);
+        ~FrameArena();
+
+        FrameArena(const FrameArena&) = delete;
+        FrameArena& operator=(const FrameArena&) = delete;
+
+        // The calling thread's arena, created on first use.
+        static FrameArena& thread();
+
+        void* allocate(std::size_t size, std::size_t alignment = alignof(std::max_align_t));
+
+        // Uninitialised storage for `count` objects; T must not need its
+        // destructor run.
+        template <typename T>
+        T* allocateArray(std::size_t count)
+        {
+            static_assert(std::is_trivially_destructible_v<T>, "arena memory is never destroyed");
+            return static_cast<T*>(allocate(sizeof(T) * count, alignof(T)));
+        }
+
+        Marker mark() const;
+        // Releases everything allocated since `marker`, resizing like
+        // reset() when the marker was taken on an empty arena.
+        void rewind(const Marker& marker);
+        void reset();
+
+        Stats stats() const { return {m_capacity, m_offset, m_peak, m_overflows}; }
+
+    private:
+        struct OverflowBlock;
+
+        void* allocateOverflow(std::size_t size, std::size_t alignment);
+        void releaseOverflow(OverflowBlock* until);
+
+        std::byte* m_block = nullptr;   // allocated on first use
+        std::size_t m_capacity = 0;
+        std::size_t m_offset = 0;
+        std::size_t m_peak = 0;
+        OverflowBlock* m_overflow = nullptr;    // newest first
+        std::size_t m_overflowBytes = 0;
+        uint64_t m_overflows = 0;
+    };
+
+    // Rewinds an arena to where it was when the scope opened.
+    class ArenaScope
+    {
+    public:
+        explicit ArenaScope(FrameArena& arena = FrameArena::thread()) : m_arena(arena), m_marker(arena.mark()) {}
+        ~ArenaScope() { m_arena.rewind(m_marker); }
+
+        ArenaScope(const ArenaScope&) = delete;
+        ArenaScope& operator=(const ArenaScope&) = delete;
+
+    private:
+        FrameArena& m_arena;
+        FrameArena::Marker m_marker;
+    };
+
+    // Standard allocator over a FrameArena, for containers that live within
+    // a frame. Deallocation is a no-op; growth leaves the old storage behind
+    // until the arena resets, so reserve() up front where the size is known.
+    template <typename T>
+    class ArenaAllocator
+    {
+    public:
+        using value_type = T;
+
+        explicit ArenaAllocator(FrameArena& arena = FrameArena::thread()) : m_arena(&arena) {}
+        template <typename U>
+        ArenaAllocator(const ArenaAllocator<U>& other) : m_arena(other.arena()) {}
+
+        T* allocate(std::size_t count) { return static_cast<T*>(m_arena->allocate(sizeof(T) * count, alignof(T))); }
+        void deallocate(T*, std::size_t) {}
+
+        FrameArena* arena() const { return m_arena; }
+
+        template <typename U>
+        bool operator==(const ArenaAllocator<U>& other) const { return m_arena == other.arena(); }
+
+    private:
+        FrameArena* m_arena;
+    };
+}
@@ -0,0 +1,270 @@
+#include "memory/memory.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iterator>
+#include <new>
+
+#include "GLFW/glfw3.h"
+
+namespace bloom
+{
+    namespace
+    {
+        // Sits immediately before every block handed out. `offset` is the
+        // distance back to what malloc returned, non-zero only for
+        // over-aligned blocks.
+        struct alignas(16) BlockHeader
+        {
+            uint64_t size;
+            uint32_t offset;
+            MemoryTag tag;
+        };
+
+        struct alignas(64) TagCounters
+        {
+            std::atomic<uint64_t> bytes{0};
+            std::atomic<uint64_t> peakBytes{0};
+            std::atomic<uint64_t> allocations{0};
+            std::atomic<uint64_t> liveAllocations{0};
+        };
+
+        // Constant-initialised, so operator new may run before any dynamic
+        // initialiser and after static destructors.
+        constinit TagCounters s_counters[static_cast<std::size_t>(MemoryTag::Count)];
+        constinit std::atomic<uint64_t> s_allocationCount{0};
+        constinit thread_local MemoryTag t_tag = MemoryTag::General;
+
+        constexpr const char* kTagNames[] = {
+            "general", "glfw", "jobs", "ecs", "scene", "render", "capture", "input", "io", "profiler", "frame arena", "pool",
+        };
+        static_assert(std::size(kTagNames) == static_cast<std::size_t>(MemoryTag::Count));
+
+        void charge(MemoryTag tag, uint64_t size)
+        {
+            TagCounters& c = s_counters[static_cast<std::size_t>(tag)];
+            const uint64_t bytes = c.bytes.fetch_add(size, std::memory_order_relaxed) + size;
+            uint64_t peak = c.peakBytes.load(std::memory_order_relaxed);
+            while (bytes > peak && !c.peakBytes.compare_exchange_weak(peak, bytes, std::memory_order_relaxed))
+            {
+            }
+            c.allocations.fetch_add(1, std::memory_order_relaxed);
+            c.liveAllocations.fetch_add(1, std::memory_order_relaxed);
+            s_allocationCount.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        void refund(MemoryTag tag, uint64_t size)
+        {
+            TagCounters& c = s_counters[static_cast<std::size_t>(tag)];
+            c.bytes.fetch_sub(size, std::memory_order_relaxed);
+            c.liveAllocations.fetch_sub(1, std::memory_order_relaxed);
+        }
+
+        BlockHeader* headerOf(void* block)
+        {
+            return static_cast<BlockHeader*>(block) - 1;
+        }
+
+        void* glfwAllocate(std::size_t size, void*)
+        {
+            return Memory::allocate(size, MemoryTag::Glfw);
+        }
+
+        void* glfwReallocate(void* block, std::size_t size, void*)
+        {
+            return Memory::reallocate(block, size);
+        }
+
+        void glfwDeallocate(void* block, void*)
+        {
+            Memory::deallocate(block);
+        }
+
+        constinit GLFWallocator s_glfwAllocator{glfwAllocate, glfwReallocate, glfwDeallocate, nullptr};
+    }
+
+    const char* memoryTagName(MemoryTag tag)
+    {
+        return kTagNames[static_cast<std::size_t>(tag)];
+    }
+
+    void* Memory::allocate(std::size_t size, std::size_t alignment)
+    {
+        return allocate(size, t_tag, alignment);
+    }
+
+    void* Memory::allocate(std::size_t size, MemoryTag tag, std::size_t alignment)
+    {
+        // Up to 16-byte alignment the header keeps malloc's alignment; past
+        // that, over-allocate and slide the block forward.
+        const std::size_t slack = alignment > alignof(BlockHeader) ? alignment : 0;
+        std::byte* raw = static_cast<std::byte*>(std::malloc(sizeof(BlockHeader) + slack + size));
+        if (!raw)
+            return nullptr;
+
+        std::byte* block = raw + sizeof(BlockHeader);
+        if (slack)
+            block = reinterpret_cast<std::byte*>((reinterpret_cast<uintptr_t>(block) + alignment - 1) & ~(uintptr_t(alignment) - 1));
+
+        BlockHeader* header = headerOf(block);
+        header->size = size;
+        header->offset = static_cast<uint32_t>(block - raw - sizeof(BlockHeader));
+        header->tag = tag;
+        charge(tag, size);
+        return block;
+    }
+
+    void* Memory::reallocate(void* block, std::size_t size)
+    {
+        if (!block)
+            return allocate(size);
+
+        // Over-aligned blocks cannot go through realloc, which would lose
+        // the alignment; GLFW never asks for one, and copying is fine here.
+        BlockHeader* header = headerOf(block);
+        if (header->offset != 0)
+        {
+            void* moved = allocate(size, header->tag);
+            if (moved)
+            {
+                std::memcpy(moved, block, std::min<std::size_t>(size, header->size));
+                deallocate(block);
+            }
+            return moved;
+        }
+
+        const MemoryTag tag = header->tag;
+        const uint64_t oldSize = header->size;
+        header = static_cast<BlockHeader*>(std::realloc(header, sizeof(BlockHeader) + size));
+        if (!header)
+            return nullptr;
+
+        refund(tag, oldSize);
+        header->size = size;
+        charge(tag, size);
+        return header + 1;
+    }
+
+    void Memory::deallocate(void* block)
+    {
+        if (!block)
+            return;
+
+        BlockHeader* header = headerOf(block);
+        refund(header->tag, header->size);
+        std::free(reinterpret_cast<std::byte*>(header) - header->offset);
+    }
+
+    MemoryTagStats Memory::stats(MemoryTag tag)
+    {
+        const TagCounters& c = s_counters[static_cast<std::size_t>(tag)];
+        MemoryTagStats stats;
+        stats.bytes = c.bytes.load(std::memory_order_relaxed);
+        stats.peakBytes = c.peakBytes.load(std::memory_order_relaxed);
+        stats.allocations = c.allocations.load(std::memory_order_relaxed);
+        stats.liveAllocations = c.liveAllocations.load(std::memory_order_relaxed);
+        return stats;
+    }
+
+    uint64_t Memory::allocationCount()
+    {
+        return s_allocationCount.load(std::memory_order_relaxed);
+    }
+
+    MemoryTag Memory::currentTag()
+    {
+        return t_tag;
+    }
+
+    void Memory::setCurrentTag(MemoryTag tag)
+    {
+        t_tag = tag;
+    }
+
+    const GLFWallocator& Memory::glfwAllocator()
+    {
+        return s_glfwAllocator;
+    }
+
+    std::string Memory::formatStats()
+    {
+        std::string text;
+        char line[160];
+        std::snprintf(line, sizeof(line), "%-12s %12s %12s %12s %10s\n", "tag", "live KiB", "peak KiB", "allocations", "live");
+        text += line;
+        for (std::size_t i = 0; i < static_cast<std::size_t>(MemoryTag::Count); ++i)
+        {
+            const MemoryTagStats s = stats(static_cast<MemoryTag>(i));
+            if (s.allocations == 0)
+                continue;
+            std::snprintf(line, sizeof(line), "%-12s %12.1f %12.1f %12llu %10llu\n", kTagNames[i], s.bytes / 1024.0,
+                          s.peakBytes / 1024.0, static_cast<unsigned long long>(s.allocations),
+                          static_cast<unsigned long long>(s.liveAllocations));
+            text += line;
+        }
+        return text;
+    }
+}
+
+// Every C++ allocation in the process goes through the tracker, charged to
+// the calling thread's current tag.
+
+void* operator new(std::size_t size)
+{
+    if (void* block = bloom::Memory::allocate(size))
+        return block;
+    throw std::bad_alloc();
+}
+
+void* operator new[](std::size_t size)
+{
+    return operator new(size);
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment)
+{
+    if (void* block = bloom::Memory::allocate(size, static_cast<std::size_t>(alignment)))
+        return block;
+    throw std::bad_alloc();
+}
+
+void* operator new[](std::size_t size, std::align_val_t alignment)
+{
+    return operator new(size, alignment);
+}
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept
+{
+    return bloom::Memory::allocate(size);
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept
+{
+    return bloom::Memory::allocate(size);
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept
+{
+    return bloom::Memory::allocate(size, static_cast<std::size_t>(alignment));
+}
+
+void* operator new[](std::size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept
+{
+    return bloom::Memory::allocate(size, static_cast<std::size_t>(alignment));
+}
+
+void operator delete(void* block) noexcept { bloom::Memory::deallocate(block); }
+void operator delete[](void* block) noexcept { bloom::Memory::deallocate(block); }
+void operator delete(void* block, std::size_t) noexcept { bloom::Memory::deallocate(block); }
+void operator delete[](void* block, std::size_t) noexcept { bloom::Memory::deallocate(block); }
+void operator delete(void* block, std::align_val_t) noexcept { bloom::Memory::deallocate(block); }
+void operator delete[](void* block, std::align_val_t) noexcept { bloom::Memory::deallocate(block); }
+void operator delete(void* block, std::size_t, std::align_val_t) noexcept { bloom::Memory::deallocate(block); }
+void operator delete[](void* block, std::size_t, std::align_val_t) noexcept { bloom::Memory::deallocate(block); }
+void operator delete(void* block, const std::nothrow_t&) noexcept { bloom::Memory::deallocate(block); }
+void operator delete[](void* block, const std::nothrow_t&) noexcept { bloom::Memory::deallocate(block); }
+void operator delete(void* block, std::align_val_t, const std::nothrow_t&) noexcept { bloom::Memory::deallocate(block); }
+void operator delete[](void* block, std::align_val_t, const std::nothrow_t&) noexcept { bloom::Memory::deallocate(block); }
@@ -0,0 +1,84 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+struct GLFWallocator;
+
+namespace bloom
+{
+    // Which subsystem an allocation is charged to. Allocations made without
+    // an explicit tag take the calling thread's current one (see
+    // MemoryTagScope), including every operator new in the process.
+    enum class MemoryTag : uint8_t
+    {
+        General,
+        Glfw,
+        Jobs,
+        Ecs,
+        Scene,
+        Render,
+        Capture,
+        Input,
+        Io,
+        Profiler,
+        FrameArena,
+        Pool,
+        Count
+    };
+
+    const char* memoryTagName(MemoryTag tag);
+
+    struct MemoryTagStats
+    {
+        uint64_t bytes = 0;             // live
+        uint64_t peakBytes = 0;
+        uint64_t allocations = 0;       // since startup
+        uint64_t liveAllocations = 0;
+    };
+
+    // The tracking general-purpose allocator behind everything else: a thin
+    // layer over malloc that prefixes each block with its size and tag so
+    // frees can be charged back without the caller knowing either. The
+    // global operator new and delete, GLFW (through glfwAllocator()), the
+    // frame arenas and the pools all allocate through it.
+    class Memory
+    {
+    public:
+        static void* allocate(std::size_t size, std::size_t alignment = alignof(std::max_align_t));
+        static void* allocate(std::size_t size, MemoryTag tag, std::size_t alignment = alignof(std::max_align_t));
+        static void* reallocate(void* block, std::size_t size);
+        static void deallocate(void* block);
+
+        static MemoryTagStats stats(MemoryTag tag);
+        // Heap allocations by any thread since startup; the difference
+        // across a frame says whether it allocated.
+        static uint64_t allocationCount();
+
+        static MemoryTag currentTag();
+        static void setCurrentTag(MemoryTag tag);
+
+        // Routes GLFW's heap through the tracker, charged to MemoryTag::Glfw.
+        // Pass to glfwInitAllocator before glfwInit.
+        static const GLFWallocator& glfwAllocator();
+
+        // One line per tag that has ever allocated.
+        static std::string formatStats();
+    };
+
+    // Charges the calling thread's untagged allocations to `tag` for the
+    // lifetime of the scope.
+    class MemoryTagScope
+    {
+    public:
+        explicit MemoryTagScope(MemoryTag tag) : m_previous(Memory::currentTag()) { Memory::setCurrentTag(tag); }
+        ~MemoryTagScope() { Memory::setCurrentTag(m_previous); }
+
+        MemoryTagScope(const MemoryTagScope&) = delete;
+        MemoryTagScope& operator=(const MemoryTagScope&) = delete;
+
+    private:
+        MemoryTag m_previous;
+    };
+}
@@ -0,0 +1,80 @@
+#include "memory/pool.hpp"
+
+#include <algorithm>
+
+namespace bloom
+{
+    PoolAllocator::PoolAllocator(std::size_t blockSize, std::size_t alignment, std::size_t blocksPerChunk, MemoryTag tag)
+        : m_alignment(std::max(alignment, alignof(FreeBlock)))
+        , m_blocksPerChunk(std::max<std::size_t>(blocksPerChunk, 1))
+        , m_tag(tag)
+    {
+        // Every block must be able to hold the free-list link and keep the
+        // next block aligned.
+        blockSize = std::max(blockSize, sizeof(FreeBlock));
+        m_blockSize = (blockSize + m_alignment - 1) & ~(m_alignment - 1);
+    }
+
+    PoolAllocator::~PoolAllocator()
+    {
+        while (m_chunks)
+        {
+            void* previous = *static_cast<void**>(m_chunks);
+            Memory::deallocate(m_chunks);
+            m_chunks = previous;
+        }
+    }
+
+    void* PoolAllocator::allocate()
+    {
+        if (!m_free && !grow())
+            return nullptr;
+
+        FreeBlock* block = m_free;
+        m_free = block->next;
+        m_peak = std::max(m_peak, ++m_used);
+        return block;
+    }
+
+    void PoolAllocator::deallocate(void* block)
+    {
+        if (!block)
+            return;
+
+        FreeBlock* freed = static_cast<FreeBlock*>(block);
+        freed->next = m_free;
+        m_free = freed;
+        --m_used;
+    }
+
+    void PoolAllocator::reserve(std::size_t blocks)
+    {
+        while (m_capacity < blocks && grow())
+        {
+        }
+    }
+
+    bool PoolAllocator::grow()
+    {
+        // The chunk link sits in a header padded to the block alignment.
+        const std::size_t header = std::max(sizeof(void*), m_alignment);
+        std::byte* chunk = static_cast<std::byte*>(Memory::allocate(header + m_blockSize * m_blocksPerChunk, m_tag, m_alignment));
+        if (!chunk)
+            return false;
+
+        *reinterpret_cast<void**>(chunk) = m_chunks;
+        m_chunks = chunk;
+        ++m_chunkCount;
+
+        // Thread the new blocks onto the free list in address order.
+        std::byte* blocks = chunk + header;
+        for (std::size_t i = m_blocksPerChunk; i-- > 0;)
+        {
+            FreeBlock* block = reinterpret_cast<FreeBlock*>(blocks + i * m_blockSize);
+            block->next = m_free;
+            m_free = block;
+        }
+        m_capacity += m_blocksPerChunk;
+        return true;
+    }
+}
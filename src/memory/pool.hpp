@@ -0,0 +1,93 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <utility>
+
+#include "memory/memory.hpp"
+
+namespace bloom
+{
+    // Fixed-size blocks carved from chunks of the tracking allocator, with
+    // freed blocks kept on an intrusive free list. Allocation and release are
+    // a couple of pointer moves and never return memory to the heap until
+    // the pool is destroyed, so a pool sized for its peak stops allocating.
+    // Not thread-safe: give each thread its own or guard it.
+    class PoolAllocator
+    {
+    public:
+        struct Stats
+        {
+            std::size_t blockSize = 0;
+            std::size_t capacity = 0;   // blocks
+            std::size_t used = 0;
+            std::size_t peak = 0;
+            std::size_t chunks = 0;
+        };
+
+        PoolAllocator(std::size_t blockSize, std::size_t alignment, std::size_t blocksPerChunk, MemoryTag tag = MemoryTag::Pool);
+        ~PoolAllocator();
+
+        PoolAllocator(const PoolAllocator&) = delete;
+        PoolAllocator& operator=(const PoolAllocator&) = delete;
+
+        void* allocate();
+        void deallocate(void* block);
+        // Grows to at least `blocks` up front.
+        void reserve(std::size_t blocks);
+
+        Stats stats() const { return {m_blockSize, m_capacity, m_used, m_peak, m_chunkCount}; }
+
+    private:
+        struct FreeBlock
+        {
+            FreeBlock* next;
+        };
+
+        bool grow();
+
+        std::size_t m_blockSize;
+        std::size_t m_alignment;
+        std::size_t m_blocksPerChunk;
+        MemoryTag m_tag;
+        FreeBlock* m_free = nullptr;
+        void* m_chunks = nullptr;   // each chunk starts with a link to the previous one
+        std::size_t m_capacity = 0;
+        std::size_t m_used = 0;
+        std::size_t m_peak = 0;
+        std::size_t m_chunkCount = 0;
+    };
+
+    // Typed front end: construct and destroy T in pool blocks.
+    template <typename T>
+    class ObjectPool
+    {
+    public:
+        explicit ObjectPool(std::size_t objectsPerChunk = 256, MemoryTag tag = MemoryTag::Pool)
+            : m_pool(sizeof(T), alignof(T), objectsPerChunk, tag)
+        {
+        }
+
+        template <typename... Args>
+        T* create(Args&&... args)
+        {
+            void* block = m_pool.allocate();
+            return block ? new (block) T(std::forward<Args>(args)...) : nullptr;
+        }
+
+        void destroy(T* object)
+        {
+            if (!object)
+                return;
+            object->~T();
+            m_pool.deallocate(object);
+        }
+
+        void reserve(std::size_t objects) { m_pool.reserve(objects); }
+        PoolAllocator::Stats stats() const { return m_pool.stats(); }
+
+    private:
+        PoolAllocator m_pool;
+    };
+}
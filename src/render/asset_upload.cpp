@@ -0,0 +1,92 @@
+#include "render/asset_upload.hpp"
+
+#include <algorithm>
+
+namespace bloom
+{
+    GpuMesh uploadMesh(const MeshView& view)
+    {
+        const MeshInfo& info = *view.info;
+        GpuMesh mesh;
+        mesh.vertexCount = static_cast<GLsizei>(info.vertexCount);
+        mesh.indexCount = static_cast<GLsizei>(info.indexCount);
+        mesh.indexType = info.indexType;
+
+        glCreateBuffers(1, &mesh.vertexBuffer);
+        glNamedBufferStorage(mesh.vertexBuffer, static_cast<GLsizeiptr>(info.vertexSize), view.vertices, 0);
+        if (info.indexCount > 0)
+        {
+            glCreateBuffers(1, &mesh.indexBuffer);
+            glNamedBufferStorage(mesh.indexBuffer, static_cast<GLsizeiptr>(info.indexSize), view.indices, 0);
+        }
+        mesh.vertexArray = createVertexArray(info, mesh.vertexBuffer, mesh.indexBuffer);
+        return mesh;
+    }
+
+    GLuint createVertexArray(const MeshInfo& info, GLuint vertexBuffer, GLuint indexBuffer)
+    {
+        GLuint vertexArray = 0;
+        glCreateVertexArrays(1, &vertexArray);
+        glVertexArrayVertexBuffer(vertexArray, 0, vertexBuffer, 0, static_cast<GLsizei>(info.vertexStride));
+        for (uint32_t i = 0; i < info.attributeCount; ++i)
+        {
+            const VertexAttribute& attribute = info.attributes[i];
+            if (attribute.integer)
+                glVertexArrayAttribIFormat(vertexArray, attribute.location, attribute.components, attribute.type, attribute.offset);
+            else
+                glVertexArrayAttribFormat(vertexArray, attribute.location, attribute.components, attribute.type,
+                                          attribute.normalized ? GL_TRUE : GL_FALSE, attribute.offset);
+            glVertexArrayAttribBinding(vertexArray, attribute.location, 0);
+            glEnableVertexArrayAttrib(vertexArray, attribute.location);
+        }
+        if (indexBuffer)
+            glVertexArrayElementBuffer(vertexArray, indexBuffer);
+        return vertexArray;
+    }
+
+    void releaseMesh(GLStateCache& state, GpuMesh& mesh)
+    {
+        state.forgetVertexArray(mesh.vertexArray);
+        glDeleteVertexArrays(1, &mesh.vertexArray);
+        state.forgetBuffer(mesh.vertexBuffer);
+        glDeleteBuffers(1, &mesh.vertexBuffer);
+        if (mesh.indexBuffer)
+        {
+            state.forgetBuffer(mesh.indexBuffer);
+            glDeleteBuffers(1, &mesh.indexBuffer);
+        }
+        mesh = {};
+    }
+
+    GLuint uploadTexture(GLStateCache& state, const TextureView& view)
+    {
+        const TextureInfo& info = *view.info;
+        const bool compressed = info.format == 0;
+
+        GLuint texture = 0;
+        glCreateTextures(GL_TEXTURE_2D, 1, &texture);
+        glTextureStorage2D(texture, static_cast<GLsizei>(info.levels), info.internalFormat, static_cast<GLsizei>(info.width),
+                           static_cast<GLsizei>(info.height));
+
+        // Levels are stored tightly packed and read straight from the
+        // mapping, not from an unpack buffer.
+        state.bindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+        state.pixelStore(GL_UNPACK_ALIGNMENT, 1);
+        state.pixelStore(GL_UNPACK_ROW_LENGTH, 0);
+        for (uint32_t level = 0; level < info.levels; ++level)
+        {
+            const GLsizei width = static_cast<GLsizei>(std::max(info.width >> level, 1u));
+            const GLsizei height = static_cast<GLsizei>(std::max(info.height >> level, 1u));
+            if (compressed)
+                glCompressedTextureSubImage2D(texture, static_cast<GLint>(level), 0, 0, width, height, info.internalFormat,
+                                              static_cast<GLsizei>(info.levelSize[level]), view.level(level));
+            else
+                glTextureSubImage2D(texture, static_cast<GLint>(level), 0, 0, width, height, info.format, info.type, view.level(level));
+        }
+
+        glTextureParameteri(texture, GL_TEXTURE_MAX_LEVEL, static_cast<GLint>(info.levels - 1));
+        glTextureParameteri(texture, GL_TEXTURE_MIN_FILTER, info.levels > 1 ? GL_LINEAR_MIPMAP_LINEAR : GL_LINEAR);
+        glTextureParameteri(texture, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+        return texture;
+    }
+}
@@ -0,0 +1,38 @@
+#pragma once
+
+#include "glad/glad.h"
+
+#include "asset/asset_file.hpp"
+#include "render/gl_state_cache.hpp"
+
+namespace bloom
+{
+    struct GpuMesh
+    {
+        GLuint vertexArray = 0;
+        GLuint vertexBuffer = 0;
+        GLuint indexBuffer = 0;
+        GLsizei vertexCount = 0;
+        GLsizei indexCount = 0;
+        GLenum indexType = 0;
+    };
+
+    // Create immutable GL storage straight from a mapped container: the
+    // pointers handed to glNamedBufferStorage and glTextureSubImage2D are
+    // the mapping itself, so the only copy is the driver's. The pages fault
+    // in during the call; AssetFile::prefetch() ahead of time overlaps that
+    // with other work. Need GL 4.5 and a current context.
+    GpuMesh uploadMesh(const MeshView& mesh);
+    // Reports the objects to `state` before deleting them, so a later
+    // object GL gives the same name is not taken for one already bound.
+    void releaseMesh(GLStateCache& state, GpuMesh& mesh);
+
+    // The vertex array for buffers laid out as `info` says. Vertex arrays
+    // are not shared between contexts, so a mesh whose buffers were filled
+    // on another context gets its vertex array from here.
+    GLuint createVertexArray(const MeshInfo& info, GLuint vertexBuffer, GLuint indexBuffer);
+
+    // Sets the unpack state it needs through `state`, the cache of the
+    // current context. GL errors surface through the debug output.
+    GLuint uploadTexture(GLStateCache& state, const TextureView& texture);
+}
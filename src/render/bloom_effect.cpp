@@ -0,0 +1,374 @@
+#include "render/bloom_effect.hpp"
+
+#include <algorithm>
+#include <bit>
+
+#include "render/gl_shader.hpp"
+
+namespace bloom
+{
+    namespace
+    {
+        // Half-resolution texels one downsample workgroup covers per side.
+        constexpr int kTile = 64;
+        constexpr int kUpsampleGroup = 8;
+
+        const char* const kDownsampleShader = R"(#version 450 core
+layout(local_size_x = 16, local_size_y = 16) in;
+
+layout(binding = 0) uniform sampler2D u_scene;
+layout(binding = 0, rgba16f) coherent uniform image2D u_levels[8];
+layout(std430, binding = 0) coherent buffer Counter
+{
+    uint groupsDone;
+};
+
+// x chain levels, y workgroups in the dispatch
+layout(location = 0) uniform vec4 u_constants;
+
+shared vec4 s_tile[16][16];
+shared bool s_last;
+
+float luma(vec3 c)
+{
+    return dot(c, vec3(0.2126, 0.7152, 0.0722));
+}
+
+// Four bilinear taps over the 4x4 scene texels around a half-resolution
+// texel, each weighted by 1 / (1 + luma) so a lone bright texel cannot
+// dominate its neighbourhood.
+vec4 karisAverage(vec2 uv, vec2 texel)
+{
+    vec3 a = textureLod(u_scene, uv + vec2(-texel.x, -texel.y), 0.0).rgb;
+    vec3 b = textureLod(u_scene, uv + vec2(texel.x, -texel.y), 0.0).rgb;
+    vec3 c = textureLod(u_scene, uv + vec2(-texel.x, texel.y), 0.0).rgb;
+    vec3 d = textureLod(u_scene, uv + vec2(texel.x, texel.y), 0.0).rgb;
+    float wa = 1.0 / (1.0 + luma(a));
+    float wb = 1.0 / (1.0 + luma(b));
+    float wc = 1.0 / (1.0 + luma(c));
+    float wd = 1.0 / (1.0 + luma(d));
+    return vec4((a * wa + b * wb + c * wc + d * wd) / (wa + wb + wc + wd), 1.0);
+}
+
+void store(int level, ivec2 p, vec4 value)
+{
+    if (all(lessThan(p, imageSize(u_levels[level]))))
+        imageStore(u_levels[level], p, value);
+}
+
+// The average of the 2x2 tile texels under this invocation, for the
+// first `size` x `size` invocations.
+vec4 reduceTile(int size)
+{
+    ivec2 local = ivec2(gl_LocalInvocationID.xy);
+    if (any(greaterThanEqual(local, ivec2(size))))
+        return vec4(0.0);
+    ivec2 q = local * 2;
+    return 0.25 * (s_tile[q.y][q.x] + s_tile[q.y][q.x + 1] + s_tile[q.y + 1][q.x] + s_tile[q.y + 1][q.x + 1]);
+}
+
+void storeTile(int level, int size, vec4 value, int levels)
+{
+    ivec2 local = ivec2(gl_LocalInvocationID.xy);
+    if (level >= levels || any(greaterThanEqual(local, ivec2(size))))
+        return;
+    s_tile[local.y][local.x] = value;
+    store(level, ivec2(gl_WorkGroupID.xy) * size + local, value);
+}
+
+void main()
+{
+    int levels = int(u_constants.x);
+    ivec2 group = ivec2(gl_WorkGroupID.xy);
+    ivec2 local = ivec2(gl_LocalInvocationID.xy);
+    vec2 texel = 1.0 / vec2(textureSize(u_scene, 0));
+
+    // Level 0: a 4x4 block per invocation, kept in registers.
+    vec4 level0[4][4];
+    ivec2 base = group * 64 + local * 4;
+    for (int y = 0; y < 4; ++y)
+    {
+        for (int x = 0; x < 4; ++x)
+        {
+            ivec2 p = base + ivec2(x, y);
+            level0[y][x] = karisAverage((vec2(p) * 2.0 + 1.0) * texel, texel);
+            store(0, p, level0[y][x]);
+        }
+    }
+
+    // Levels 1 and 2 from the registers.
+    if (levels > 1)
+    {
+        vec4 level1[2][2];
+        for (int y = 0; y < 2; ++y)
+        {
+            for (int x = 0; x < 2; ++x)
+            {
+                level1[y][x] = 0.25 * (level0[y * 2][x * 2] + level0[y * 2][x * 2 + 1] +
+                                       level0[y * 2 + 1][x * 2] + level0[y * 2 + 1][x * 2 + 1]);
+                store(1, group * 32 + local * 2 + ivec2(x, y), level1[y][x]);
+            }
+        }
+        if (levels > 2)
+        {
+            vec4 value = 0.25 * (level1[0][0] + level1[0][1] + level1[1][0] + level1[1][1]);
+            store(2, group * 16 + local, value);
+            s_tile[local.y][local.x] = value;
+        }
+    }
+
+    // Levels 3 to 6 through shared memory, down to one texel per group.
+    // Unrolled so every barrier sits at the top level of main().
+    memoryBarrierShared();
+    barrier();
+    vec4 value = reduceTile(8);
+    memoryBarrierShared();
+    barrier();
+    storeTile(3, 8, value, levels);
+    memoryBarrierShared();
+    barrier();
+    value = reduceTile(4);
+    memoryBarrierShared();
+    barrier();
+    storeTile(4, 4, value, levels);
+    memoryBarrierShared();
+    barrier();
+    value = reduceTile(2);
+    memoryBarrierShared();
+    barrier();
+    storeTile(5, 2, value, levels);
+    memoryBarrierShared();
+    barrier();
+    value = reduceTile(1);
+    storeTile(6, 1, value, levels);
+
+    // Level 7 needs every group's level 6 texel: the last group to get
+    // here builds it and rearms the counter for the next frame.
+    memoryBarrierImage();
+    barrier();
+    if (levels == 8 && gl_LocalInvocationIndex == 0u)
+        s_last = atomicAdd(groupsDone, 1u) == uint(u_constants.y) - 1u;
+    memoryBarrierShared();
+    barrier();
+    if (levels < 8 || !s_last)
+        return;
+    if (gl_LocalInvocationIndex == 0u)
+        groupsDone = 0u;
+
+    ivec2 size = imageSize(u_levels[7]);
+    for (int i = int(gl_LocalInvocationIndex); i < size.x * size.y; i += 256)
+    {
+        ivec2 p = ivec2(i % size.x, i / size.x);
+        ivec2 q = p * 2;
+        vec4 value = 0.25 * (imageLoad(u_levels[6], q) + imageLoad(u_levels[6], q + ivec2(1, 0)) +
+                             imageLoad(u_levels[6], q + ivec2(0, 1)) + imageLoad(u_levels[6], q + ivec2(1, 1)));
+        imageStore(u_levels[7], p, value);
+    }
+}
+)";
+
+        const char* const kUpsampleShader = R"(#version 450 core
+layout(local_size_x = 8, local_size_y = 8) in;
+
+layout(binding = 0) uniform sampler2D u_chain;
+layout(binding = 0, rgba16f) uniform image2D u_target;
+
+// x level sampled (the one below the target), y tent radius in its texels
+layout(location = 0) uniform vec4 u_constants;
+
+void main()
+{
+    ivec2 p = ivec2(gl_GlobalInvocationID.xy);
+    ivec2 size = imageSize(u_target);
+    if (any(greaterThanEqual(p, size)))
+        return;
+
+    float below = u_constants.x;
+    vec2 uv = (vec2(p) + 0.5) / vec2(size);
+    vec2 r = u_constants.y / vec2(textureSize(u_chain, int(below)));
+
+    // 3x3 tent: 1 2 1 / 2 4 2 / 1 2 1, over bilinear taps.
+    vec3 sum = textureLod(u_chain, uv, below).rgb * 4.0;
+    sum += (textureLod(u_chain, uv + vec2(-r.x, 0.0), below).rgb + textureLod(u_chain, uv + vec2(r.x, 0.0), below).rgb +
+            textureLod(u_chain, uv + vec2(0.0, -r.y), below).rgb + textureLod(u_chain, uv + vec2(0.0, r.y), below).rgb) * 2.0;
+    sum += textureLod(u_chain, uv + vec2(-r.x, -r.y), below).rgb + textureLod(u_chain, uv + vec2(r.x, -r.y), below).rgb +
+           textureLod(u_chain, uv + vec2(-r.x, r.y), below).rgb + textureLod(u_chain, uv + vec2(r.x, r.y), below).rgb;
+
+    imageStore(u_target, p, imageLoad(u_target, p) + vec4(sum / 16.0, 0.0));
+}
+)";
+
+        const char* const kTonemapVertexShader = R"(#version 450 core
+out vec2 v_uv;
+void main()
+{
+    // One triangle covering the screen.
+    vec2 corner = vec2((gl_VertexID << 1) & 2, gl_VertexID & 2);
+    v_uv = corner;
+    gl_Position = vec4(corner * 2.0 - 1.0, 0.0, 1.0);
+}
+)";
+
+        const char* const kTonemapFragmentShader = R"(#version 450 core
+layout(binding = 0) uniform sampler2D u_scene;
+layout(binding = 1) uniform sampler2D u_bloom;
+
+// x exposure, y bloom intensity, z 1 / chain levels
+layout(location = 0) uniform vec4 u_constants;
+
+in vec2 v_uv;
+out vec4 o_color;
+
+// Narkowicz's fit of the ACES filmic curve.
+vec3 aces(vec3 x)
+{
+    return clamp((x * (2.51 * x + 0.03)) / (x * (2.43 * x + 0.59) + 0.14), 0.0, 1.0);
+}
+
+void main()
+{
+    vec3 scene = texelFetch(u_scene, ivec2(gl_FragCoord.xy), 0).rgb;
+    // Level 0 holds the sum of every level after the upsample.
+    vec3 bloom = textureLod(u_bloom, v_uv, 0.0).rgb * u_constants.z;
+    vec3 color = mix(scene, bloom, u_constants.y) * u_constants.x;
+    o_color = vec4(pow(aces(color), vec3(1.0 / 2.2)), 1.0);
+}
+)";
+
+        GLuint groupsFor(int size, int group)
+        {
+            return static_cast<GLuint>((size + group - 1) / group);
+        }
+    }
+
+    BloomEffect::~BloomEffect()
+    {
+        release();
+    }
+
+    bool BloomEffect::init()
+    {
+        release();
+
+        m_downsampleProgram = compileComputeProgram(kDownsampleShader);
+        m_upsampleProgram = compileComputeProgram(kUpsampleShader);
+        m_tonemapProgram = compileProgram(kTonemapVertexShader, kTonemapFragmentShader);
+        if (!m_downsampleProgram || !m_upsampleProgram || !m_tonemapProgram)
+        {
+            release();
+            return false;
+        }
+
+        glCreateVertexArrays(1, &m_vertexArray);
+        const uint32_t zero = 0;
+        glCreateBuffers(1, &m_counter);
+        glNamedBufferStorage(m_counter, sizeof(zero), &zero, 0);
+        return true;
+    }
+
+    void BloomEffect::release()
+    {
+        for (GLuint* program : {&m_downsampleProgram, &m_upsampleProgram, &m_tonemapProgram})
+        {
+            if (*program)
+                glDeleteProgram(*program);
+            *program = 0;
+        }
+        if (m_vertexArray)
+            glDeleteVertexArrays(1, &m_vertexArray);
+        if (m_counter)
+            glDeleteBuffers(1, &m_counter);
+        m_vertexArray = 0;
+        m_counter = 0;
+    }
+
+    int BloomEffect::addPasses(RenderGraph& graph, GraphTexture scene)
+    {
+        const GraphTextureDesc& desc = graph.textureDesc(scene);
+        m_scene = scene;
+        m_chainWidth = std::max(desc.width / 2, 1);
+        m_chainHeight = std::max(desc.height / 2, 1);
+        // Every level keeps at least one texel per side without rounding
+        // up, so each texel reduces exactly four of the level above.
+        const int fit = std::bit_width(static_cast<unsigned>(std::min(m_chainWidth, m_chainHeight)));
+        m_levels = std::clamp(m_settings.levels, 1, std::min(kMaxLevels, fit));
+
+        m_chain = graph.createTexture("bloom chain", {m_chainWidth, m_chainHeight, GL_RGBA16F, m_levels});
+
+        const uint32_t down = graph.addPass("bloom downsample", PassKind::Compute, downsample, this);
+        graph.read(down, scene, TextureAccess::Sampled);
+        graph.write(down, m_chain, TextureAccess::Image);
+
+        if (m_levels > 1)
+        {
+            const uint32_t up = graph.addPass("bloom upsample", PassKind::Compute, upsample, this);
+            graph.read(up, m_chain, TextureAccess::Sampled);
+            graph.write(up, m_chain, TextureAccess::Image);
+        }
+
+        const uint32_t tone = graph.addPass("tonemap", PassKind::Graphics, tonemap, this);
+        graph.read(tone, scene, TextureAccess::Sampled);
+        graph.read(tone, m_chain, TextureAccess::Sampled);
+        graph.markOutput(tone);
+        return m_levels;
+    }
+
+    void BloomEffect::downsample(const PassContext& context, void* user)
+    {
+        const auto* self = static_cast<const BloomEffect*>(user);
+        const GLuint chain = context.texture(self->m_chain);
+
+        DispatchCommand dispatch;
+        dispatch.program = self->m_downsampleProgram;
+        dispatch.groups[0] = groupsFor(self->m_chainWidth, kTile);
+        dispatch.groups[1] = groupsFor(self->m_chainHeight, kTile);
+        dispatch.storageBuffers[0] = BufferRange{self->m_counter};
+        dispatch.textures[0] = context.texture(self->m_scene);
+        for (int level = 0; level < self->m_levels; ++level)
+            dispatch.images[level] = {chain, level, GL_READ_WRITE, GL_RGBA16F};
+        dispatch.hasConstants = true;
+        dispatch.constants[0] = static_cast<float>(self->m_levels);
+        dispatch.constants[1] = static_cast<float>(dispatch.groups[0] * dispatch.groups[1]);
+        context.commands->record(context.key(), dispatch);
+    }
+
+    void BloomEffect::upsample(const PassContext& context, void* user)
+    {
+        const auto* self = static_cast<const BloomEffect*>(user);
+        const GLuint chain = context.texture(self->m_chain);
+
+        // Smallest level first; each dispatch samples what the previous one
+        // wrote. The depth field keeps them in order.
+        for (int level = self->m_levels - 2, step = 0; level >= 0; --level, ++step)
+        {
+            DispatchCommand dispatch;
+            dispatch.program = self->m_upsampleProgram;
+            dispatch.groups[0] = groupsFor(std::max(self->m_chainWidth >> level, 1), kUpsampleGroup);
+            dispatch.groups[1] = groupsFor(std::max(self->m_chainHeight >> level, 1), kUpsampleGroup);
+            dispatch.barrier = level > 0 ? GL_TEXTURE_FETCH_BARRIER_BIT : 0;
+            dispatch.textures[0] = chain;
+            dispatch.images[0] = {chain, level, GL_READ_WRITE, GL_RGBA16F};
+            dispatch.hasConstants = true;
+            dispatch.constants[0] = static_cast<float>(level + 1);
+            dispatch.constants[1] = self->m_settings.radius;
+            context.commands->record(context.key(0, 0, static_cast<uint32_t>(step)), dispatch);
+        }
+    }
+
+    void BloomEffect::tonemap(const PassContext& context, void* user)
+    {
+        const auto* self = static_cast<const BloomEffect*>(user);
+
+        DrawCommand draw;
+        draw.program = self->m_tonemapProgram;
+        draw.vertexArray = self->m_vertexArray;
+        draw.count = 3;
+        draw.textures[0] = context.texture(self->m_scene);
+        draw.textures[1] = context.texture(self->m_chain);
+        draw.hasConstants = true;
+        draw.constants[0] = self->m_settings.exposure;
+        draw.constants[1] = self->m_settings.intensity;
+        draw.constants[2] = 1.f / static_cast<float>(self->m_levels);
+        context.commands->record(context.key(), draw);
+    }
+}
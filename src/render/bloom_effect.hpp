@@ -0,0 +1,84 @@
+#pragma once
+
+#include <cstdint>
+
+#include "glad/glad.h"
+
+#include "render/render_graph.hpp"
+
+namespace bloom
+{
+    struct BloomSettings
+    {
+        int levels = 6;             // mip levels of the chain, from half resolution down
+        float radius = 1.f;         // upsample tent radius, in texels of the smaller level
+        float intensity = 0.05f;    // share of the blurred chain mixed into the scene
+        float exposure = 1.f;
+    };
+
+    // HDR bloom and tone mapping as three render graph passes.
+    //
+    // "bloom downsample" builds the whole mip chain in one dispatch. Each
+    // 16x16 workgroup reduces a 128x128 tile of the scene: every invocation
+    // filters a 4x4 block of the half-resolution level with four bilinear
+    // taps, Karis-averaged (weighted by 1 / (1 + luma)) so single bright
+    // pixels do not flicker, then box-filters it in registers to the next
+    // two levels; shared memory takes the tile the rest of the way down to
+    // one texel at level 6. The last workgroup to finish, found with an
+    // atomic counter, builds level 7 from level 6.
+    //
+    // "bloom upsample" walks back up, one dispatch per level, adding a 3x3
+    // tent-filtered sample of the level below to each level. "tonemap"
+    // mixes level 0 into the scene, applies exposure and a fitted ACES
+    // curve and draws a full-screen triangle to the backbuffer.
+    //
+    // addPasses() only declares resources and passes and records commands
+    // into buckets the queue reuses, so once the graph and queue have grown
+    // to the frame's size it allocates nothing.
+    class BloomEffect
+    {
+    public:
+        static constexpr int kMaxLevels = 8;
+
+        BloomEffect() = default;
+        ~BloomEffect();
+
+        BloomEffect(const BloomEffect&) = delete;
+        BloomEffect& operator=(const BloomEffect&) = delete;
+
+        // Render thread.
+        bool init();
+        void release();
+
+        BloomSettings& settings() { return m_settings; }
+
+        // Declares the chain on `graph`, reading `scene`, an RGBA16F target
+        // an earlier pass wrote. The tonemap pass is an output. Returns the
+        // number of chain levels used, which small targets clamp.
+        int addPasses(RenderGraph& graph, GraphTexture scene);
+
+        // For inspection (tests, tools): the chain declared by the last
+        // addPasses(); resolve it with RenderGraph::texture() after execute().
+        GraphTexture chain() const { return m_chain; }
+
+    private:
+        static void downsample(const PassContext& context, void* user);
+        static void upsample(const PassContext& context, void* user);
+        static void tonemap(const PassContext& context, void* user);
+
+        GLuint m_downsampleProgram = 0;
+        GLuint m_upsampleProgram = 0;
+        GLuint m_tonemapProgram = 0;
+        GLuint m_vertexArray = 0;
+        GLuint m_counter = 0;
+
+        BloomSettings m_settings;
+
+        // This frame's declarations, for the pass callbacks.
+        GraphTexture m_scene;
+        GraphTexture m_chain;
+        int m_levels = 0;
+        int m_chainWidth = 0;
+        int m_chainHeight = 0;
+    };
+}
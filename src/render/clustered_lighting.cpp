@@ -0,0 +1,428 @@
+#include "render/clustered_lighting.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+namespace bloom
+{
+    namespace
+    {
+        constexpr GLuint kCountBinding = 0;
+        constexpr uint32_t kBinGroup = 64;
+
+        // Declarations shared by the binning shaders and the fragment
+        // library. u_clusters holds an (offset, count) pair per cluster,
+        // then the light index list the offsets point into.
+        const char* const kCommonSource = R"(
+layout(std140, binding = 1) uniform ClusterParams
+{
+    mat4 u_clusterView;
+    vec4 u_clusterProjection;   // P[0][0], P[1][1], near, far
+    vec4 u_clusterSlices;       // log-depth scale, bias, tiles per pixel x, y
+    uvec4 u_clusterGrid;        // tiles x, y, slices, light count
+    uvec4 u_clusterLimits;      // max indices, cluster count
+};
+
+struct PointLight
+{
+    vec4 positionRadius;
+    vec4 colorIntensity;
+};
+
+layout(std430, binding = 2) readonly buffer Lights
+{
+    PointLight u_lights[];
+};
+
+uint clusterSlice(float depth)
+{
+    float slice = floor(log(max(depth, u_clusterProjection.z)) * u_clusterSlices.x + u_clusterSlices.y);
+    return uint(clamp(slice, 0.0, float(u_clusterGrid.z - 1u)));
+}
+
+uint clusterIndex(uint x, uint y, uint slice)
+{
+    return (slice * u_clusterGrid.y + y) * u_clusterGrid.x + x;
+}
+)";
+
+        // One invocation per light; BIN_FILL selects the second walk.
+        const char* const kBinSource = R"(
+layout(local_size_x = 64) in;
+
+layout(std430, binding = 0) buffer Counts
+{
+    uint u_counts[];
+};
+
+layout(std430, binding = 3) buffer Clusters
+{
+    uint u_clusters[];
+};
+
+float sliceDepth(uint slice)
+{
+    return exp((float(slice) - u_clusterSlices.y) / u_clusterSlices.x);
+}
+
+int tileOf(float ndc, uint tiles)
+{
+    return clamp(int(floor((ndc * 0.5 + 0.5) * float(tiles))), 0, int(tiles) - 1);
+}
+
+void main()
+{
+    uint index = gl_GlobalInvocationID.x;
+    if (index >= u_clusterGrid.w)
+        return;
+
+    vec4 light = u_lights[index].positionRadius;
+    vec3 center = (u_clusterView * vec4(light.xyz, 1.0)).xyz;
+    float radius = light.w;
+    float nearDepth = max(-center.z - radius, u_clusterProjection.z);
+    float farDepth = min(-center.z + radius, u_clusterProjection.w);
+    if (nearDepth > farDepth)
+        return;
+
+    // The sphere's view-space box projects widest at one of its two
+    // depths, so this bounds it on screen.
+    vec2 scale = u_clusterProjection.xy;
+    vec2 low = center.xy - radius;
+    vec2 high = center.xy + radius;
+    vec2 ndcLow = min(low / nearDepth, low / farDepth) * scale;
+    vec2 ndcHigh = max(high / nearDepth, high / farDepth) * scale;
+    if (any(greaterThan(ndcLow, vec2(1.0))) || any(lessThan(ndcHigh, vec2(-1.0))))
+        return;
+
+    int x0 = tileOf(ndcLow.x, u_clusterGrid.x);
+    int x1 = tileOf(ndcHigh.x, u_clusterGrid.x);
+    int y0 = tileOf(ndcLow.y, u_clusterGrid.y);
+    int y1 = tileOf(ndcHigh.y, u_clusterGrid.y);
+    uint z0 = clusterSlice(nearDepth);
+    uint z1 = clusterSlice(farDepth);
+    uint clusterCount = u_clusterLimits.y;
+    vec2 tileSize = 2.0 / vec2(u_clusterGrid.xy);
+
+    for (uint z = z0; z <= z1; ++z)
+    {
+        float depth0 = sliceDepth(z);
+        float depth1 = sliceDepth(z + 1u);
+        for (int y = y0; y <= y1; ++y)
+        {
+            float ndcY0 = -1.0 + float(y) * tileSize.y;
+            float ndcY1 = ndcY0 + tileSize.y;
+            for (int x = x0; x <= x1; ++x)
+            {
+                // The froxel's view-space bounding box.
+                float ndcX0 = -1.0 + float(x) * tileSize.x;
+                float ndcX1 = ndcX0 + tileSize.x;
+                vec4 xs = vec4(ndcX0 * depth0, ndcX0 * depth1, ndcX1 * depth0, ndcX1 * depth1) / scale.x;
+                vec4 ys = vec4(ndcY0 * depth0, ndcY0 * depth1, ndcY1 * depth0, ndcY1 * depth1) / scale.y;
+                vec3 boxMin = vec3(min(min(xs.x, xs.y), min(xs.z, xs.w)), min(min(ys.x, ys.y), min(ys.z, ys.w)), -depth1);
+                vec3 boxMax = vec3(max(max(xs.x, xs.y), max(xs.z, xs.w)), max(max(ys.x, ys.y), max(ys.z, ys.w)), -depth0);
+                vec3 offset = clamp(center, boxMin, boxMax) - center;
+                if (dot(offset, offset) > radius * radius)
+                    continue;
+
+                uint cluster = clusterIndex(uint(x), uint(y), z);
+#ifdef BIN_FILL
+                // Counting down leaves the counter at zero for next frame.
+                uint slot = atomicAdd(u_counts[cluster], 0xffffffffu) - 1u;
+                if (slot < u_clusters[cluster * 2u + 1u])
+                    u_clusters[clusterCount * 2u + u_clusters[cluster * 2u] + slot] = index;
+#else
+                atomicAdd(u_counts[cluster], 1u);
+#endif
+            }
+        }
+    }
+}
+)";
+
+        // Exclusive prefix sum of the counts in one workgroup: each
+        // invocation sums a run of clusters, the run totals are scanned in
+        // shared memory, and the runs are written out with their offsets.
+        const char* const kScanSource = R"(
+layout(local_size_x = 1024) in;
+
+layout(std430, binding = 0) readonly buffer Counts
+{
+    uint u_counts[];
+};
+
+layout(std430, binding = 3) writeonly buffer Clusters
+{
+    uint u_clusters[];
+};
+
+shared uint s_sums[1024];
+
+void main()
+{
+    uint id = gl_LocalInvocationIndex;
+    uint clusterCount = u_clusterLimits.y;
+    uint run = (clusterCount + 1023u) / 1024u;
+    uint begin = min(id * run, clusterCount);
+    uint end = min(begin + run, clusterCount);
+
+    uint total = 0u;
+    for (uint i = begin; i < end; ++i)
+        total += u_counts[i];
+    s_sums[id] = total;
+    barrier();
+
+    for (uint step = 1u; step < 1024u; step <<= 1)
+    {
+        uint add = id >= step ? s_sums[id - step] : 0u;
+        barrier();
+        s_sums[id] += add;
+        barrier();
+    }
+
+    uint capacity = u_clusterLimits.x;
+    uint offset = s_sums[id] - total;
+    for (uint i = begin; i < end; ++i)
+    {
+        uint count = u_counts[i];
+        u_clusters[i * 2u] = offset;
+        u_clusters[i * 2u + 1u] = offset < capacity ? min(count, capacity - offset) : 0u;
+        offset += count;
+    }
+}
+)";
+
+        const char* const kFragmentSource = R"(
+layout(std430, binding = 3) readonly buffer Clusters
+{
+    uint u_clusters[];
+};
+
+vec3 clusteredLighting(vec3 position, vec3 normal, vec3 albedo)
+{
+    float depth = -(u_clusterView * vec4(position, 1.0)).z;
+    uvec2 tile = min(uvec2(gl_FragCoord.xy * u_clusterSlices.zw), u_clusterGrid.xy - 1u);
+    uint cluster = clusterIndex(tile.x, tile.y, clusterSlice(depth));
+    uint first = u_clusterLimits.y * 2u + u_clusters[cluster * 2u];
+    uint count = u_clusters[cluster * 2u + 1u];
+
+    vec3 sum = vec3(0.0);
+    for (uint i = 0u; i < count; ++i)
+    {
+        PointLight light = u_lights[u_clusters[first + i]];
+        vec3 toLight = light.positionRadius.xyz - position;
+        float distanceSquared = dot(toLight, toLight);
+        float radiusSquared = light.positionRadius.w * light.positionRadius.w;
+        if (distanceSquared >= radiusSquared)
+            continue;
+
+        // Inverse square, windowed to reach zero at the radius.
+        float ratio = distanceSquared / radiusSquared;
+        float window = clamp(1.0 - ratio * ratio, 0.0, 1.0);
+        float attenuation = window * window / (distanceSquared + 1.0);
+        float diffuse = max(dot(normal, toLight * inversesqrt(distanceSquared)), 0.0);
+        sum += light.colorIntensity.rgb * (light.colorIntensity.w * attenuation * diffuse);
+    }
+    return sum * albedo;
+}
+)";
+
+        std::string withCommon(const char* source)
+        {
+            std::string result = "#version 450 core\n";
+            result += kCommonSource;
+            result += source;
+            return result;
+        }
+    }
+
+    ClusteredLighting::~ClusteredLighting()
+    {
+        release();
+    }
+
+    bool ClusteredLighting::init(const ClusterSettings& settings)
+    {
+        release();
+
+        m_settings = settings;
+        const uint32_t clusters = clusterCount();
+        if (clusters == 0 || settings.maxLights == 0)
+            return false;
+
+        const std::string bin = withCommon(kBinSource);
+        const std::string scan = withCommon(kScanSource);
+        const ShaderStage binStage[] = {{GL_COMPUTE_SHADER, bin.c_str()}};
+        const ShaderStage scanStage[] = {{GL_COMPUTE_SHADER, scan.c_str()}};
+        m_countProgram = compileProgram(binStage);
+        m_fillProgram = compileProgram(binStage, "#define BIN_FILL 1\n");
+        m_scanProgram = compileProgram(scanStage);
+        m_fragmentSource = withCommon(kFragmentSource);
+        if (!m_countProgram || !m_fillProgram || !m_scanProgram)
+        {
+            release();
+            return false;
+        }
+
+        GLint uniformAlignment = 0;
+        GLint storageAlignment = 0;
+        glGetIntegerv(GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT, &uniformAlignment);
+        glGetIntegerv(GL_SHADER_STORAGE_BUFFER_OFFSET_ALIGNMENT, &storageAlignment);
+        const GLsizeiptr alignment = std::max({uniformAlignment, storageAlignment, 16});
+        m_alignment = alignment;
+        m_paramsBytes = (static_cast<GLsizeiptr>(sizeof(Params)) + alignment - 1) / alignment * alignment;
+        const GLsizeiptr lightBytes = static_cast<GLsizeiptr>(settings.maxLights) * static_cast<GLsizeiptr>(sizeof(PointLight));
+        m_regionBytes = (m_paramsBytes + lightBytes + alignment - 1) / alignment * alignment;
+        if (!m_ring.init(m_regionBytes * kFramesInFlight))
+        {
+            release();
+            return false;
+        }
+
+        // The counters must start at zero; the fill pass returns them there.
+        const std::vector<uint32_t> zeros(clusters, 0);
+        glCreateBuffers(1, &m_counts);
+        glNamedBufferStorage(m_counts, static_cast<GLsizeiptr>(clusters * sizeof(uint32_t)), zeros.data(), 0);
+        m_clusterBytes = static_cast<GLsizeiptr>((uint64_t{clusters} * 2 + settings.maxIndices) * sizeof(uint32_t));
+        glCreateBuffers(1, &m_clusters);
+        glNamedBufferStorage(m_clusters, m_clusterBytes, nullptr, 0);
+        return true;
+    }
+
+    void ClusteredLighting::release()
+    {
+        for (GLuint* program : {&m_countProgram, &m_scanProgram, &m_fillProgram})
+        {
+            if (*program)
+                glDeleteProgram(*program);
+            *program = 0;
+        }
+        for (GLuint* buffer : {&m_counts, &m_clusters})
+        {
+            if (*buffer)
+                glDeleteBuffers(1, buffer);
+            *buffer = 0;
+        }
+        m_ring.release();
+        m_region = nullptr;
+        m_regionOffset = -1;
+        m_lightCount = 0;
+    }
+
+    void ClusteredLighting::beginRegion()
+    {
+        const StagingRing::Allocation region = m_ring.allocate(m_regionBytes, m_alignment);
+        m_regionOffset = region.offset;
+        m_region = region.pointer;
+    }
+
+    std::span<PointLight> ClusteredLighting::beginLights()
+    {
+        if (!m_region && m_ring.isOpen())
+            beginRegion();
+        if (!m_region)
+            return {};
+        return {reinterpret_cast<PointLight*>(m_region + m_paramsBytes), m_settings.maxLights};
+    }
+
+    void ClusteredLighting::endLights(uint32_t count)
+    {
+        m_lightCount = std::min(count, m_settings.maxLights);
+    }
+
+    void ClusteredLighting::setCamera(const Mat4& view, const Mat4& projection, int width, int height)
+    {
+        // Recover the planes from the GL projection's depth terms.
+        const float depthScale = projection.cols[2].z;
+        const float depthOffset = projection.cols[3].z;
+        const float zNear = depthOffset / (depthScale - 1.f);
+        const float zFar = depthOffset / (depthScale + 1.f);
+        const auto slices = static_cast<float>(m_settings.slices);
+        const float logRange = std::log(zFar / zNear);
+
+        m_params.view = view;
+        m_params.projection[0] = projection.cols[0].x;
+        m_params.projection[1] = projection.cols[1].y;
+        m_params.projection[2] = zNear;
+        m_params.projection[3] = zFar;
+        m_params.slices[0] = slices / logRange;
+        m_params.slices[1] = -slices * std::log(zNear) / logRange;
+        m_params.slices[2] = static_cast<float>(m_settings.tilesX) / static_cast<float>(std::max(width, 1));
+        m_params.slices[3] = static_cast<float>(m_settings.tilesY) / static_cast<float>(std::max(height, 1));
+        m_params.grid[0] = m_settings.tilesX;
+        m_params.grid[1] = m_settings.tilesY;
+        m_params.grid[2] = m_settings.slices;
+        m_params.limits[0] = m_settings.maxIndices;
+        m_params.limits[1] = clusterCount();
+    }
+
+    GraphBuffer ClusteredLighting::addPasses(RenderGraph& graph)
+    {
+        if (!m_region && m_ring.isOpen())
+            beginRegion();
+        if (m_region)
+        {
+            m_params.grid[3] = m_lightCount;
+            std::memcpy(m_region, &m_params, sizeof(Params));
+        }
+
+        const GraphBuffer clusters = graph.importBuffer("light clusters", m_clusters, m_clusterBytes);
+        const uint32_t pass = graph.addPass("light binning", PassKind::Compute, bin, this);
+        graph.write(pass, clusters, BufferAccess::Storage);
+        return clusters;
+    }
+
+    void ClusteredLighting::bin(const PassContext& context, void* user)
+    {
+        const auto* self = static_cast<const ClusteredLighting*>(user);
+        if (!self->m_region)
+            return;
+
+        const BufferRange params{self->m_ring.buffer(), self->m_regionOffset, static_cast<GLsizeiptr>(sizeof(Params))};
+        const BufferRange lights{self->m_ring.buffer(), self->m_regionOffset + self->m_paramsBytes,
+                                 std::max<GLsizeiptr>(self->m_lightCount, 1) * static_cast<GLsizeiptr>(sizeof(PointLight))};
+        const BufferRange counts{self->m_counts};
+        const BufferRange clusters{self->m_clusters};
+
+        // Count, scan and fill, each reading what the previous one wrote;
+        // the depth field keeps them in order.
+        DispatchCommand count;
+        count.program = self->m_countProgram;
+        count.groups[0] = std::max<GLuint>((self->m_lightCount + kBinGroup - 1) / kBinGroup, 1);
+        count.barrier = GL_SHADER_STORAGE_BARRIER_BIT;
+        count.uniformBuffers[kParamsBinding] = params;
+        count.storageBuffers[kCountBinding] = counts;
+        count.storageBuffers[kLightBinding] = lights;
+        count.storageBuffers[kClusterBinding] = clusters;
+        context.commands->record(context.key(0, 0, 0), count);
+
+        DispatchCommand scan = count;
+        scan.program = self->m_scanProgram;
+        scan.groups[0] = 1;
+        context.commands->record(context.key(0, 0, 1), scan);
+
+        DispatchCommand fill = count;
+        fill.program = self->m_fillProgram;
+        fill.barrier = 0;
+        context.commands->record(context.key(0, 0, 2), fill);
+    }
+
+    void ClusteredLighting::bind(DrawCommand& draw) const
+    {
+        draw.uniformBuffers[kParamsBinding] = {m_ring.buffer(), m_regionOffset, static_cast<GLsizeiptr>(sizeof(Params))};
+        draw.storageBuffers[kLightBinding] = {m_ring.buffer(), m_regionOffset + m_paramsBytes,
+                                              std::max<GLsizeiptr>(m_lightCount, 1) * static_cast<GLsizeiptr>(sizeof(PointLight))};
+        draw.storageBuffers[kClusterBinding] = {m_clusters};
+    }
+
+    void ClusteredLighting::endFrame()
+    {
+        if (m_region)
+            m_ring.fence();
+        m_region = nullptr;
+        m_regionOffset = -1;
+        m_lightCount = 0;
+    }
+}
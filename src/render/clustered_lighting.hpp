@@ -0,0 +1,150 @@
+#pragma once
+
+#include <cstdint>
+#include <span>
+#include <string>
+
+#include "glad/glad.h"
+
+#include "math/mat4.hpp"
+#include "render/gl_shader.hpp"
+#include "render/render_commands.hpp"
+#include "render/render_graph.hpp"
+#include "render/staging_ring.hpp"
+
+namespace bloom
+{
+    // 32 bytes, matching std430 `struct { vec4 positionRadius; vec4
+    // colorIntensity; }`. World space; the light reaches zero at `radius`.
+    struct PointLight
+    {
+        float position[3];
+        float radius;
+        float color[3];
+        float intensity;
+    };
+
+    struct ClusterSettings
+    {
+        uint32_t tilesX = 16;
+        uint32_t tilesY = 9;
+        uint32_t slices = 24;           // exponential in view depth
+        uint32_t maxLights = 16384;
+        uint32_t maxIndices = 1u << 20; // light references over all clusters
+    };
+
+    // Clustered forward shading: lights are binned into a froxel grid (the
+    // view frustum cut into screen tiles and exponentially spaced depth
+    // slices) once per frame, and each fragment walks only the lights of
+    // its own froxel.
+    //
+    // The "light binning" pass is three dispatches, one invocation per
+    // light. The first bounds each light's sphere in grid space, tests the
+    // froxels in that range against it and counts the hits per froxel; a
+    // single workgroup then prefix-sums the counts into offsets in one
+    // index list; the last repeats the test and writes each light's index
+    // into its froxels, counting the same counters back down so they are
+    // zero again for the next frame. References past maxIndices are
+    // dropped, the furthest froxels in the list first.
+    //
+    // Lights are written straight into a persistently mapped ring, one
+    // region per frame. Per frame, on the render thread:
+    //     std::span<PointLight> out = lighting.beginLights();
+    //     ... fill out[0, n), from any number of jobs ...
+    //     lighting.endLights(n);
+    //     lighting.setCamera(view, projection, width, height);
+    //     GraphBuffer clusters = lighting.addPasses(graph);
+    //     ... a forward pass that reads `clusters` as storage and records
+    //         draws passed through bind() ...
+    //     ... execute the queue ...
+    //     lighting.endFrame();
+    //
+    // Shader interface: link fragmentStage() into the forward program and
+    // declare
+    //     vec3 clusteredLighting(vec3 position, vec3 normal, vec3 albedo);
+    // which sums the diffuse light at a world-space surface point. It uses
+    // the uniform block at kParamsBinding and the storage buffers at
+    // kLightBinding and kClusterBinding, which bind() fills in. The camera
+    // must be a symmetric perspective projection.
+    class ClusteredLighting
+    {
+    public:
+        static constexpr GLuint kParamsBinding = 1;
+        static constexpr GLuint kLightBinding = 2;
+        static constexpr GLuint kClusterBinding = 3;
+        static constexpr int kFramesInFlight = 3;
+
+        ClusteredLighting() = default;
+        ~ClusteredLighting();
+
+        ClusteredLighting(const ClusteredLighting&) = delete;
+        ClusteredLighting& operator=(const ClusteredLighting&) = delete;
+
+        // Render thread.
+        bool init(const ClusterSettings& settings);
+        void release();
+
+        const ClusterSettings& settings() const { return m_settings; }
+        uint32_t clusterCount() const { return m_settings.tilesX * m_settings.tilesY * m_settings.slices; }
+
+        // This frame's lights, maxLights long. Write-combined memory: write
+        // it sequentially and never read it. May wait for the GPU to
+        // release the oldest frame's region.
+        std::span<PointLight> beginLights();
+        void endLights(uint32_t count);
+
+        // `width` and `height` are the forward pass's viewport.
+        void setCamera(const Mat4& view, const Mat4& projection, int width, int height);
+
+        // Declares the binning pass. Returns the cluster buffer, which the
+        // forward pass must read as BufferAccess::Storage so the graph
+        // orders it after binning.
+        GraphBuffer addPasses(RenderGraph& graph);
+
+        // Points the draw's bindings at this frame's lighting data.
+        void bind(DrawCommand& draw) const;
+        ShaderStage fragmentStage() const { return {GL_FRAGMENT_SHADER, m_fragmentSource.c_str()}; }
+
+        // After the frame's commands have been executed.
+        void endFrame();
+
+        // For inspection (tests, tools): per cluster an (offset, count)
+        // pair, followed by the index list. Read it after the GPU is done.
+        GLuint clusterBuffer() const { return m_clusters; }
+        uint32_t lightCount() const { return m_lightCount; }
+        // beginLights() calls that had to wait on the GPU.
+        uint64_t stalls() const { return m_ring.stalls(); }
+
+    private:
+        // std140 block at kParamsBinding.
+        struct Params
+        {
+            Mat4 view;
+            float projection[4];        // P[0][0], P[1][1], near, far
+            float slices[4];            // log-depth scale, bias, tiles per pixel x, y
+            uint32_t grid[4];           // tiles x, y, slices, light count
+            uint32_t limits[4];         // max indices, cluster count
+        };
+
+        static void bin(const PassContext& context, void* user);
+        void beginRegion();
+
+        ClusterSettings m_settings;
+        GLuint m_countProgram = 0;
+        GLuint m_scanProgram = 0;
+        GLuint m_fillProgram = 0;
+        GLuint m_counts = 0;
+        GLuint m_clusters = 0;
+        GLsizeiptr m_clusterBytes = 0;
+        std::string m_fragmentSource;
+
+        StagingRing m_ring;
+        GLsizeiptr m_alignment = 256;
+        GLsizeiptr m_paramsBytes = 0;
+        GLsizeiptr m_regionBytes = 0;
+        GLintptr m_regionOffset = -1;
+        std::byte* m_region = nullptr;
+        uint32_t m_lightCount = 0;
+        Params m_params{};
+    };
+}
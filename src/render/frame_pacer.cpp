@@ -0,0 +1,63 @@
+#include "render/frame_pacer.hpp"
+
+#include <algorithm>
+
+#include "core/clock.hpp"
+
+namespace bloom
+{
+    FramePacer::FramePacer(int maxFramesInFlight)
+        : m_limit(std::clamp(maxFramesInFlight, 1, kMaxFramesInFlight))
+    {
+    }
+
+    FramePacer::~FramePacer()
+    {
+        release();
+    }
+
+    uint64_t FramePacer::wait()
+    {
+        if (m_count < m_limit)
+            return 0;
+
+        const uint64_t start = Clock::now();
+        GLsync fence = m_fences[m_head];
+
+        // Flush on the first attempt so the fence is guaranteed to signal,
+        // then keep waiting in 1 ms slices rather than one unbounded call.
+        GLbitfield flags = GL_SYNC_FLUSH_COMMANDS_BIT;
+        for (;;)
+        {
+            const GLenum result = glClientWaitSync(fence, flags, 1000000);
+            if (result != GL_TIMEOUT_EXPIRED)
+                break;
+            flags = 0;
+        }
+
+        glDeleteSync(fence);
+        m_fences[m_head] = nullptr;
+        m_head = (m_head + 1) % kMaxFramesInFlight;
+        --m_count;
+        return Clock::now() - start;
+    }
+
+    void FramePacer::signal()
+    {
+        const int tail = (m_head + m_count) % kMaxFramesInFlight;
+        m_fences[tail] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+        ++m_count;
+    }
+
+    void FramePacer::release()
+    {
+        while (m_count > 0)
+        {
+            if (m_fences[m_head])
+                glDeleteSync(m_fences[m_head]);
+            m_fences[m_head] = nullptr;
+            m_head = (m_head + 1) % kMaxFramesInFlight;
+            --m_count;
+        }
+    }
+}
@@ -0,0 +1,40 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+
+#include "glad/glad.h"
+
+namespace bloom
+{
+    // Bounded queue of per-frame fences. The render thread calls wait()
+    // before recording a frame and signal() after submitting it; once the
+    // queue is full, wait() blocks on the oldest fence so the CPU is never
+    // more than `maxFramesInFlight` frames ahead of the GPU.
+    //
+    // All methods must be called on the thread that owns the GL context.
+    class FramePacer
+    {
+    public:
+        static constexpr int kMaxFramesInFlight = 8;
+
+        explicit FramePacer(int maxFramesInFlight);
+        ~FramePacer();
+
+        FramePacer(const FramePacer&) = delete;
+        FramePacer& operator=(const FramePacer&) = delete;
+
+        // Returns the number of Clock ticks spent blocked on the GPU.
+        uint64_t wait();
+        void signal();
+        void release();
+
+        int framesInFlight() const { return m_count; }
+
+    private:
+        std::array<GLsync, kMaxFramesInFlight> m_fences{};
+        int m_limit;
+        int m_head = 0;
+        int m_count = 0;
+    };
+}
@@ -0,0 +1,176 @@
+#include "render/gl_backend.hpp"
+
+#include "render/gpu_profiler.hpp"
+#include "render/sort_key.hpp"
+
+namespace bloom
+{
+    void GLBackend::setPass(uint32_t pass, const PassDesc& desc)
+    {
+        if (pass < kMaxPasses)
+            m_passes[pass] = desc;
+    }
+
+    void GLBackend::execute(const RenderQueue& queue)
+    {
+        m_stats = {};
+        uint32_t currentPass = ~0u;
+        int zone = -1;
+
+        for (const RenderQueue::SortedCommand& command : queue.commands())
+        {
+            const uint32_t pass = SortKey::pass(command.key);
+            if (pass != currentPass)
+            {
+                if (m_profiler)
+                {
+                    m_profiler->end(zone);
+                    zone = m_passes[pass].name ? m_profiler->begin(m_passes[pass].name) : -1;
+                }
+                beginPass(pass);
+                currentPass = pass;
+            }
+
+            const auto* header = reinterpret_cast<const CommandHeader*>(command.packet);
+            switch (header->type)
+            {
+            case CommandType::Clear:
+                clear(CommandBuffer::body<ClearCommand>(command.packet));
+                break;
+            case CommandType::Draw:
+                draw(CommandBuffer::body<DrawCommand>(command.packet));
+                break;
+            case CommandType::Dispatch:
+                dispatch(CommandBuffer::body<DispatchCommand>(command.packet));
+                break;
+            }
+            ++m_stats.commands;
+        }
+        if (m_profiler)
+            m_profiler->end(zone);
+    }
+
+    void GLBackend::beginPass(uint32_t pass)
+    {
+        const PassDesc& desc = m_passes[pass];
+        m_state.bindFramebuffer(desc.framebuffer);
+        if (desc.viewport[2] > 0 && desc.viewport[3] > 0)
+            m_state.viewport(desc.viewport[0], desc.viewport[1], desc.viewport[2], desc.viewport[3]);
+        if (desc.barrier)
+            glMemoryBarrier(desc.barrier);
+        ++m_stats.passChanges;
+    }
+
+    void GLBackend::clear(const ClearCommand& command)
+    {
+        if (command.mask & GL_COLOR_BUFFER_BIT)
+            glClearColor(command.color[0], command.color[1], command.color[2], command.color[3]);
+        if (command.mask & GL_DEPTH_BUFFER_BIT)
+        {
+            glClearDepth(command.depth);
+            // Depth clears are masked by the write mask like any other write.
+            m_state.depthMask(true);
+        }
+        glClear(command.mask);
+    }
+
+    void GLBackend::applyState(const RenderState& state)
+    {
+        m_state.enable(GL_DEPTH_TEST, state.depthTest);
+        m_state.depthMask(state.depthWrite);
+
+        m_state.enable(GL_BLEND, state.blend != BlendMode::Opaque);
+        if (state.blend == BlendMode::Alpha)
+            m_state.blendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+        else if (state.blend == BlendMode::Additive)
+            m_state.blendFunc(GL_ONE, GL_ONE);
+
+        m_state.enable(GL_CULL_FACE, state.cull != CullMode::None);
+        if (state.cull != CullMode::None)
+            m_state.cullFace(state.cull == CullMode::Back ? GL_BACK : GL_FRONT);
+    }
+
+    void GLBackend::bindBuffers(GLenum target, std::span<const BufferRange> ranges)
+    {
+        for (std::size_t binding = 0; binding < ranges.size(); ++binding)
+        {
+            const BufferRange& range = ranges[binding];
+            const auto index = static_cast<GLuint>(binding);
+            if (range.buffer && range.size > 0)
+                m_state.bindBufferRange(target, index, range.buffer, range.offset, range.size);
+            else if (range.buffer)
+                m_state.bindBufferBase(target, index, range.buffer);
+        }
+    }
+
+    void GLBackend::draw(const DrawCommand& command)
+    {
+        m_state.useProgram(command.program);
+        m_state.bindVertexArray(command.vertexArray);
+        applyState(command.state);
+
+        for (int unit = 0; unit < DrawCommand::kMaxTextures; ++unit)
+        {
+            if (command.textures[unit])
+                m_state.bindTexture(unit, command.textures[unit]);
+        }
+        bindBuffers(GL_SHADER_STORAGE_BUFFER, command.storageBuffers);
+        bindBuffers(GL_UNIFORM_BUFFER, command.uniformBuffers);
+
+        if (command.hasConstants)
+            glUniform4fv(0, 1, command.constants);
+
+        if (command.indirectBuffer)
+        {
+            m_state.bindBuffer(GL_DRAW_INDIRECT_BUFFER, command.indirectBuffer);
+            const auto* offset = reinterpret_cast<const void*>(static_cast<uintptr_t>(command.indirectOffset));
+            if (command.indexType == GL_NONE && command.drawCount > 1)
+                glMultiDrawArraysIndirect(command.mode, offset, command.drawCount, 0);
+            else if (command.indexType == GL_NONE)
+                glDrawArraysIndirect(command.mode, offset);
+            else if (command.drawCount > 1)
+                glMultiDrawElementsIndirect(command.mode, command.indexType, offset, command.drawCount, 0);
+            else
+                glDrawElementsIndirect(command.mode, command.indexType, offset);
+        }
+        else if (command.indexType == GL_NONE)
+        {
+            glDrawArraysInstancedBaseInstance(command.mode, command.first, command.count,
+                                              command.instanceCount, command.baseInstance);
+        }
+        else
+        {
+            const GLsizei indexSize = command.indexType == GL_UNSIGNED_INT ? 4 : command.indexType == GL_UNSIGNED_SHORT ? 2 : 1;
+            const auto* offset = reinterpret_cast<const void*>(static_cast<uintptr_t>(command.first) * indexSize);
+            glDrawElementsInstancedBaseVertexBaseInstance(command.mode, command.count, command.indexType, offset,
+                                                          command.instanceCount, command.baseVertex,
+                                                          command.baseInstance);
+        }
+        ++m_stats.draws;
+    }
+
+    void GLBackend::dispatch(const DispatchCommand& command)
+    {
+        m_state.useProgram(command.program);
+        bindBuffers(GL_SHADER_STORAGE_BUFFER, command.storageBuffers);
+        bindBuffers(GL_UNIFORM_BUFFER, command.uniformBuffers);
+        for (int unit = 0; unit < DispatchCommand::kMaxTextures; ++unit)
+        {
+            if (command.textures[unit])
+                m_state.bindTexture(unit, command.textures[unit]);
+        }
+        for (int unit = 0; unit < DispatchCommand::kMaxImages; ++unit)
+        {
+            const ImageBinding& image = command.images[unit];
+            if (image.texture)
+                m_state.bindImageTexture(unit, image.texture, image.level, image.access, image.format);
+        }
+        if (command.hasConstants)
+            glUniform4fv(0, 1, command.constants);
+
+        glDispatchCompute(command.groups[0], command.groups[1], command.groups[2]);
+        if (command.barrier)
+            glMemoryBarrier(command.barrier);
+        ++m_stats.dispatches;
+    }
+}
@@ -0,0 +1,70 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <span>
+
+#include "glad/glad.h"
+
+#include "render/gl_state_cache.hpp"
+#include "render/render_commands.hpp"
+#include "render/render_queue.hpp"
+
+namespace bloom
+{
+    class GpuProfiler;
+
+    // Target and viewport shared by every command in one sort-key pass.
+    struct PassDesc
+    {
+        GLuint framebuffer = 0;
+        GLint viewport[4] = {0, 0, 0, 0};
+        // glMemoryBarrier bits issued as the pass begins, for reads of
+        // image or storage writes made by an earlier pass.
+        GLbitfield barrier = 0;
+        // With a profiler set, named passes are timed as GPU zones.
+        const char* name = nullptr;
+    };
+
+    // Translates a sorted RenderQueue into GL calls. This is the only place
+    // the command layer touches GL, so it must run on the thread whose
+    // context is current (the engine's render thread). All state goes
+    // through the backend's GLStateCache, which other render-thread code
+    // should share via state().
+    class GLBackend
+    {
+    public:
+        static constexpr int kMaxPasses = 256;
+
+        struct Stats
+        {
+            uint32_t commands = 0;
+            uint32_t draws = 0;
+            uint32_t dispatches = 0;
+            uint32_t passChanges = 0;
+        };
+
+        void setPass(uint32_t pass, const PassDesc& desc);
+        void execute(const RenderQueue& queue);
+        // Optional; the profiler must outlive the backend's use of it.
+        void setProfiler(GpuProfiler* profiler) { m_profiler = profiler; }
+
+        const Stats& stats() const { return m_stats; }
+        GLStateCache& state() { return m_state; }
+
+    private:
+        void beginPass(uint32_t pass);
+        void clear(const ClearCommand& command);
+        void draw(const DrawCommand& command);
+        void dispatch(const DispatchCommand& command);
+        void applyState(const RenderState& state);
+        // Range when the size is set, whole buffer otherwise; slot i goes
+        // to binding i.
+        void bindBuffers(GLenum target, std::span<const BufferRange> ranges);
+
+        std::array<PassDesc, kMaxPasses> m_passes{};
+        Stats m_stats;
+        GLStateCache m_state;
+        GpuProfiler* m_profiler = nullptr;
+    };
+}
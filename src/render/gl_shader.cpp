@@ -0,0 +1,115 @@
+#include "render/gl_shader.hpp"
+
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+#include "render/shader_cache.hpp"
+
+namespace bloom
+{
+    namespace
+    {
+        GLuint compileStage(GLenum stage, const char* source, std::string_view defines)
+        {
+            // Split after the #version line, which must stay first, and
+            // hand the driver three strings rather than building a copy.
+            const char* parts[3] = {source, "", ""};
+            GLint lengths[3] = {static_cast<GLint>(std::strlen(source)), 0, 0};
+            if (!defines.empty() && std::strncmp(source, "#version", 8) == 0)
+            {
+                const char* newline = std::strchr(source, '\n');
+                const GLint head = newline ? static_cast<GLint>(newline - source + 1) : lengths[0];
+                parts[1] = defines.data();
+                lengths[1] = static_cast<GLint>(defines.size());
+                parts[2] = source + head;
+                lengths[2] = lengths[0] - head;
+                lengths[0] = head;
+            }
+
+            const GLuint shader = glCreateShader(stage);
+            glShaderSource(shader, 3, parts, lengths);
+            glCompileShader(shader);
+
+            GLint status = GL_FALSE;
+            glGetShaderiv(shader, GL_COMPILE_STATUS, &status);
+            if (status != GL_TRUE)
+            {
+                GLint length = 0;
+                glGetShaderiv(shader, GL_INFO_LOG_LENGTH, &length);
+                std::vector<char> log(static_cast<size_t>(length) + 1);
+                glGetShaderInfoLog(shader, length, nullptr, log.data());
+                std::fprintf(stderr, "Shader compilation failed:\n%s\n", log.data());
+                glDeleteShader(shader);
+                return 0;
+            }
+            return shader;
+        }
+
+        GLuint link(GLuint program)
+        {
+            glLinkProgram(program);
+
+            GLint status = GL_FALSE;
+            glGetProgramiv(program, GL_LINK_STATUS, &status);
+            if (status != GL_TRUE)
+            {
+                GLint length = 0;
+                glGetProgramiv(program, GL_INFO_LOG_LENGTH, &length);
+                std::vector<char> log(static_cast<size_t>(length) + 1);
+                glGetProgramInfoLog(program, length, nullptr, log.data());
+                std::fprintf(stderr, "Program link failed:\n%s\n", log.data());
+                glDeleteProgram(program);
+                return 0;
+            }
+            return program;
+        }
+    }
+
+    GLuint linkProgram(std::span<const ShaderStage> stages, std::string_view defines, bool retrievable)
+    {
+        GLuint shaders[8] = {};
+        if (stages.empty() || stages.size() > std::size(shaders))
+            return 0;
+
+        bool ok = true;
+        for (std::size_t i = 0; i < stages.size() && ok; ++i)
+        {
+            shaders[i] = compileStage(stages[i].type, stages[i].source, defines);
+            ok = shaders[i] != 0;
+        }
+
+        GLuint result = 0;
+        if (ok)
+        {
+            const GLuint program = glCreateProgram();
+            if (retrievable)
+                glProgramParameteri(program, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+            for (std::size_t i = 0; i < stages.size(); ++i)
+                glAttachShader(program, shaders[i]);
+            result = link(program);
+        }
+        for (std::size_t i = 0; i < stages.size(); ++i)
+            glDeleteShader(shaders[i]);
+        return result;
+    }
+
+    GLuint compileProgram(std::span<const ShaderStage> stages, std::string_view defines)
+    {
+        if (ShaderCache* cache = ShaderCache::installed())
+            return cache->program(stages, defines);
+        return linkProgram(stages, defines, false);
+    }
+
+    GLuint compileProgram(const char* vertexSource, const char* fragmentSource)
+    {
+        const ShaderStage stages[] = {{GL_VERTEX_SHADER, vertexSource}, {GL_FRAGMENT_SHADER, fragmentSource}};
+        return compileProgram(stages);
+    }
+
+    GLuint compileComputeProgram(const char* computeSource)
+    {
+        const ShaderStage stages[] = {{GL_COMPUTE_SHADER, computeSource}};
+        return compileProgram(stages);
+    }
+}
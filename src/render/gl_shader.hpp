@@ -0,0 +1,29 @@
+#pragma once
+
+#include <span>
+#include <string_view>
+
+#include "glad/glad.h"
+
+namespace bloom
+{
+    struct ShaderStage
+    {
+        GLenum type = GL_VERTEX_SHADER;
+        const char* source = nullptr;
+    };
+
+    // Compiles and links a program from GLSL sources. Returns 0 and prints
+    // the info log to stderr on failure. Must run with a context current.
+    //
+    // `defines` (whole lines, e.g. "#define SHADOWS 1\n") is inserted after
+    // each source's #version line. When a ShaderCache is installed these
+    // go through it, so a warm cache skips the compiler entirely.
+    GLuint compileProgram(std::span<const ShaderStage> stages, std::string_view defines = {});
+    GLuint compileProgram(const char* vertexSource, const char* fragmentSource);
+    GLuint compileComputeProgram(const char* computeSource);
+
+    // Always compiles, bypassing any cache. `retrievable` asks the driver
+    // to keep the binary for glGetProgramBinary.
+    GLuint linkProgram(std::span<const ShaderStage> stages, std::string_view defines, bool retrievable);
+}
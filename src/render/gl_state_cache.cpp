@@ -0,0 +1,356 @@
+#include "render/gl_state_cache.hpp"
+
+#include <numeric>
+
+namespace bloom
+{
+    uint32_t GLStateCache::Counters::totalIssued() const
+    {
+        return std::accumulate(issued.begin(), issued.end(), 0u);
+    }
+
+    uint32_t GLStateCache::Counters::totalElided() const
+    {
+        return std::accumulate(elided.begin(), elided.end(), 0u);
+    }
+
+    GLStateCache::GLStateCache()
+    {
+        invalidate();
+    }
+
+    void GLStateCache::invalidate()
+    {
+        m_program = kUnknown;
+        m_vertexArray = kUnknown;
+        m_framebuffer = kUnknown;
+        m_buffers.fill(kUnknown);
+        for (auto& bindings : m_indexed)
+            bindings.fill(IndexedBinding{});
+        m_textures.fill(kUnknown);
+        m_samplers.fill(kUnknown);
+        m_images.fill(ImageUnit{});
+        m_viewport = {-1, -1, -1, -1};
+        m_pixelStore = {-1, -1, -1, -1};
+
+        m_capabilities.fill(-1);
+        m_depthMask = -1;
+        m_depthFunc = GL_NONE;
+        m_blendSource = GL_NONE;
+        m_blendDestination = GL_NONE;
+        m_cullFace = GL_NONE;
+        m_colorMask = -1;
+    }
+
+    void GLStateCache::endFrame()
+    {
+        m_lastFrame = m_counters;
+        m_counters = {};
+    }
+
+    int GLStateCache::genericSlot(GLenum target)
+    {
+        switch (target)
+        {
+        case GL_ARRAY_BUFFER: return 0;
+        case GL_UNIFORM_BUFFER: return 1;
+        case GL_SHADER_STORAGE_BUFFER: return 2;
+        case GL_DRAW_INDIRECT_BUFFER: return 3;
+        case GL_DISPATCH_INDIRECT_BUFFER: return 4;
+        case GL_PIXEL_PACK_BUFFER: return 5;
+        case GL_PIXEL_UNPACK_BUFFER: return 6;
+        case GL_COPY_READ_BUFFER: return 7;
+        case GL_COPY_WRITE_BUFFER: return 8;
+        case GL_TEXTURE_BUFFER: return 9;
+        case GL_ATOMIC_COUNTER_BUFFER: return 10;
+        case GL_QUERY_BUFFER: return 11;
+        default: return -1;
+        }
+    }
+
+    int GLStateCache::indexedSlot(GLenum target)
+    {
+        switch (target)
+        {
+        case GL_UNIFORM_BUFFER: return 0;
+        case GL_SHADER_STORAGE_BUFFER: return 1;
+        case GL_ATOMIC_COUNTER_BUFFER: return 2;
+        case GL_TRANSFORM_FEEDBACK_BUFFER: return 3;
+        default: return -1;
+        }
+    }
+
+    int GLStateCache::capabilitySlot(GLenum capability)
+    {
+        switch (capability)
+        {
+        case GL_DEPTH_TEST: return DepthTest;
+        case GL_BLEND: return Blend;
+        case GL_CULL_FACE: return CullFace;
+        case GL_SCISSOR_TEST: return ScissorTest;
+        case GL_STENCIL_TEST: return StencilTest;
+        case GL_FRAMEBUFFER_SRGB: return FramebufferSrgb;
+        default: return -1;
+        }
+    }
+
+    int GLStateCache::pixelStoreSlot(GLenum parameter)
+    {
+        switch (parameter)
+        {
+        case GL_UNPACK_ALIGNMENT: return 0;
+        case GL_UNPACK_ROW_LENGTH: return 1;
+        case GL_PACK_ALIGNMENT: return 2;
+        case GL_PACK_ROW_LENGTH: return 3;
+        default: return -1;
+        }
+    }
+
+    void GLStateCache::useProgram(GLuint program)
+    {
+        if (changed(Category::Program, program != m_program))
+        {
+            glUseProgram(program);
+            m_program = program;
+        }
+    }
+
+    void GLStateCache::bindVertexArray(GLuint vertexArray)
+    {
+        if (changed(Category::VertexArray, vertexArray != m_vertexArray))
+        {
+            glBindVertexArray(vertexArray);
+            m_vertexArray = vertexArray;
+        }
+    }
+
+    void GLStateCache::bindBuffer(GLenum target, GLuint buffer)
+    {
+        // The element array binding is vertex array state; it is not
+        // shadowed and always goes through.
+        const int slot = genericSlot(target);
+        if (changed(Category::Buffer, slot < 0 || m_buffers[slot] != buffer))
+        {
+            glBindBuffer(target, buffer);
+            if (slot >= 0)
+                m_buffers[slot] = buffer;
+        }
+    }
+
+    void GLStateCache::bindBufferBase(GLenum target, GLuint index, GLuint buffer)
+    {
+        const int slot = indexedSlot(target);
+        if (slot < 0 || index >= kMaxIndexedBindings)
+        {
+            changed(Category::Buffer, true);
+            glBindBufferBase(target, index, buffer);
+            return;
+        }
+
+        // A base binding is a range binding covering the whole buffer; the
+        // shadow records it with size 0.
+        IndexedBinding& binding = m_indexed[slot][index];
+        if (changed(Category::Buffer, binding.buffer != buffer || binding.offset != 0 || binding.size != 0))
+        {
+            glBindBufferBase(target, index, buffer);
+            binding = IndexedBinding{buffer, 0, 0};
+            // Indexed binds also replace the generic binding point.
+            if (const int generic = genericSlot(target); generic >= 0)
+                m_buffers[generic] = buffer;
+        }
+    }
+
+    void GLStateCache::bindBufferRange(GLenum target, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size)
+    {
+        const int slot = indexedSlot(target);
+        if (slot < 0 || index >= kMaxIndexedBindings)
+        {
+            changed(Category::Buffer, true);
+            glBindBufferRange(target, index, buffer, offset, size);
+            return;
+        }
+
+        IndexedBinding& binding = m_indexed[slot][index];
+        if (changed(Category::Buffer, binding.buffer != buffer || binding.offset != offset || binding.size != size))
+        {
+            glBindBufferRange(target, index, buffer, offset, size);
+            binding = IndexedBinding{buffer, offset, size};
+            if (const int generic = genericSlot(target); generic >= 0)
+                m_buffers[generic] = buffer;
+        }
+    }
+
+    void GLStateCache::bindTexture(GLuint unit, GLuint texture)
+    {
+        const bool tracked = unit < kMaxTextureUnits;
+        if (changed(Category::Texture, !tracked || m_textures[unit] != texture))
+        {
+            glBindTextureUnit(unit, texture);
+            if (tracked)
+                m_textures[unit] = texture;
+        }
+    }
+
+    void GLStateCache::bindSampler(GLuint unit, GLuint sampler)
+    {
+        const bool tracked = unit < kMaxTextureUnits;
+        if (changed(Category::Sampler, !tracked || m_samplers[unit] != sampler))
+        {
+            glBindSampler(unit, sampler);
+            if (tracked)
+                m_samplers[unit] = sampler;
+        }
+    }
+
+    void GLStateCache::bindImageTexture(GLuint unit, GLuint texture, GLint level, GLenum access, GLenum format)
+    {
+        const bool tracked = unit < kMaxImageUnits;
+        const ImageUnit value{texture, level, access, format};
+        if (changed(Category::Texture, !tracked || m_images[unit] != value))
+        {
+            glBindImageTexture(unit, texture, level, GL_FALSE, 0, access, format);
+            if (tracked)
+                m_images[unit] = value;
+        }
+    }
+
+    void GLStateCache::bindFramebuffer(GLuint framebuffer)
+    {
+        if (changed(Category::Framebuffer, framebuffer != m_framebuffer))
+        {
+            glBindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+            m_framebuffer = framebuffer;
+        }
+    }
+
+    void GLStateCache::viewport(GLint x, GLint y, GLsizei width, GLsizei height)
+    {
+        const std::array<GLint, 4> value{x, y, width, height};
+        if (changed(Category::Viewport, value != m_viewport))
+        {
+            glViewport(x, y, width, height);
+            m_viewport = value;
+        }
+    }
+
+    void GLStateCache::pixelStore(GLenum parameter, GLint value)
+    {
+        const int slot = pixelStoreSlot(parameter);
+        if (changed(Category::PixelStore, slot < 0 || m_pixelStore[slot] != value))
+        {
+            glPixelStorei(parameter, value);
+            if (slot >= 0)
+                m_pixelStore[slot] = value;
+        }
+    }
+
+    void GLStateCache::enable(GLenum capability, bool enabled)
+    {
+        const int slot = capabilitySlot(capability);
+        if (changed(Category::Raster, slot < 0 || m_capabilities[slot] != static_cast<int8_t>(enabled)))
+        {
+            if (enabled)
+                glEnable(capability);
+            else
+                glDisable(capability);
+            if (slot >= 0)
+                m_capabilities[slot] = static_cast<int8_t>(enabled);
+        }
+    }
+
+    void GLStateCache::depthMask(bool write)
+    {
+        if (changed(Category::Raster, m_depthMask != static_cast<int8_t>(write)))
+        {
+            glDepthMask(write ? GL_TRUE : GL_FALSE);
+            m_depthMask = static_cast<int8_t>(write);
+        }
+    }
+
+    void GLStateCache::depthFunc(GLenum func)
+    {
+        if (changed(Category::Raster, m_depthFunc != func))
+        {
+            glDepthFunc(func);
+            m_depthFunc = func;
+        }
+    }
+
+    void GLStateCache::blendFunc(GLenum source, GLenum destination)
+    {
+        if (changed(Category::Raster, m_blendSource != source || m_blendDestination != destination))
+        {
+            glBlendFunc(source, destination);
+            m_blendSource = source;
+            m_blendDestination = destination;
+        }
+    }
+
+    void GLStateCache::cullFace(GLenum face)
+    {
+        if (changed(Category::Raster, m_cullFace != face))
+        {
+            glCullFace(face);
+            m_cullFace = face;
+        }
+    }
+
+    void GLStateCache::colorMask(bool r, bool g, bool b, bool a)
+    {
+        const auto mask = static_cast<int8_t>(r | g << 1 | b << 2 | a << 3);
+        if (changed(Category::Raster, m_colorMask != mask))
+        {
+            glColorMask(r, g, b, a);
+            m_colorMask = mask;
+        }
+    }
+
+    void GLStateCache::forgetProgram(GLuint program)
+    {
+        if (m_program == program)
+            m_program = kUnknown;
+    }
+
+    void GLStateCache::forgetVertexArray(GLuint vertexArray)
+    {
+        if (m_vertexArray == vertexArray)
+            m_vertexArray = kUnknown;
+    }
+
+    void GLStateCache::forgetBuffer(GLuint buffer)
+    {
+        for (GLuint& bound : m_buffers)
+        {
+            if (bound == buffer)
+                bound = kUnknown;
+        }
+        for (auto& bindings : m_indexed)
+        {
+            for (IndexedBinding& binding : bindings)
+            {
+                if (binding.buffer == buffer)
+                    binding = IndexedBinding{};
+            }
+        }
+    }
+
+    void GLStateCache::forgetTexture(GLuint texture)
+    {
+        for (GLuint& bound : m_textures)
+        {
+            if (bound == texture)
+                bound = kUnknown;
+        }
+        for (ImageUnit& image : m_images)
+        {
+            if (image.texture == texture)
+                image = ImageUnit{};
+        }
+    }
+
+    void GLStateCache::forgetFramebuffer(GLuint framebuffer)
+    {
+        if (m_framebuffer == framebuffer)
+            m_framebuffer = kUnknown;
+    }
+}
@@ -0,0 +1,150 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "glad/glad.h"
+
+namespace bloom
+{
+    // Shadow copy of the GL binding and fixed-function state for one
+    // context. Every setter compares against the shadow value and only calls
+    // through glad when the value actually changes.
+    //
+    // The shadow is only correct if all state changes go through the cache.
+    // Code that talks to GL directly must call invalidate() afterwards, and
+    // deleting a bound object must be reported with forget*().
+    class GLStateCache
+    {
+    public:
+        static constexpr int kMaxTextureUnits = 32;
+        static constexpr int kMaxIndexedBindings = 16;
+        static constexpr int kMaxImageUnits = 8;
+
+        enum class Category : uint8_t
+        {
+            Program,
+            VertexArray,
+            Buffer,
+            Texture,
+            Sampler,
+            Framebuffer,
+            Viewport,
+            Raster,
+            PixelStore,
+            Count,
+        };
+
+        struct Counters
+        {
+            std::array<uint32_t, static_cast<std::size_t>(Category::Count)> issued{};
+            std::array<uint32_t, static_cast<std::size_t>(Category::Count)> elided{};
+
+            uint32_t totalIssued() const;
+            uint32_t totalElided() const;
+        };
+
+        GLStateCache();
+
+        // Forgets every shadow value; the next call of each setter is issued.
+        void invalidate();
+
+        // Rolls the running counters into lastFrame() and clears them.
+        void endFrame();
+        const Counters& lastFrame() const { return m_lastFrame; }
+        const Counters& current() const { return m_counters; }
+
+        void useProgram(GLuint program);
+        void bindVertexArray(GLuint vertexArray);
+        void bindBuffer(GLenum target, GLuint buffer);
+        void bindBufferBase(GLenum target, GLuint index, GLuint buffer);
+        void bindBufferRange(GLenum target, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size);
+        void bindTexture(GLuint unit, GLuint texture);
+        void bindSampler(GLuint unit, GLuint sampler);
+        // Counted as texture state; layered bindings are not shadowed.
+        void bindImageTexture(GLuint unit, GLuint texture, GLint level, GLenum access, GLenum format);
+        void bindFramebuffer(GLuint framebuffer);
+        void viewport(GLint x, GLint y, GLsizei width, GLsizei height);
+        // Shadows the pack and unpack alignment and row length; other
+        // parameters always go through.
+        void pixelStore(GLenum parameter, GLint value);
+
+        void enable(GLenum capability, bool enabled);
+        void depthMask(bool write);
+        void depthFunc(GLenum func);
+        void blendFunc(GLenum source, GLenum destination);
+        void cullFace(GLenum face);
+        void colorMask(bool r, bool g, bool b, bool a);
+
+        void forgetProgram(GLuint program);
+        void forgetVertexArray(GLuint vertexArray);
+        void forgetBuffer(GLuint buffer);
+        void forgetTexture(GLuint texture);
+        void forgetFramebuffer(GLuint framebuffer);
+
+    private:
+        static constexpr GLuint kUnknown = ~0u;
+
+        struct IndexedBinding
+        {
+            GLuint buffer = kUnknown;
+            GLintptr offset = 0;
+            GLsizeiptr size = 0;
+        };
+
+        struct ImageUnit
+        {
+            GLuint texture = kUnknown;
+            GLint level = 0;
+            GLenum access = GL_NONE;
+            GLenum format = GL_NONE;
+
+            bool operator==(const ImageUnit&) const = default;
+        };
+
+        enum Capability : uint8_t
+        {
+            DepthTest,
+            Blend,
+            CullFace,
+            ScissorTest,
+            StencilTest,
+            FramebufferSrgb,
+            CapabilityCount,
+        };
+
+        bool changed(Category category, bool differs)
+        {
+            ++(differs ? m_counters.issued : m_counters.elided)[static_cast<std::size_t>(category)];
+            return differs;
+        }
+
+        static int capabilitySlot(GLenum capability);
+        static int pixelStoreSlot(GLenum parameter);
+        static int genericSlot(GLenum target);
+        static int indexedSlot(GLenum target);
+
+        Counters m_counters;
+        Counters m_lastFrame;
+
+        GLuint m_program;
+        GLuint m_vertexArray;
+        GLuint m_framebuffer;
+        std::array<GLuint, 12> m_buffers;
+        std::array<std::array<IndexedBinding, kMaxIndexedBindings>, 4> m_indexed;
+        std::array<GLuint, kMaxTextureUnits> m_textures;
+        std::array<GLuint, kMaxTextureUnits> m_samplers;
+        std::array<ImageUnit, kMaxImageUnits> m_images;
+        std::array<GLint, 4> m_viewport;
+        std::array<GLint, 4> m_pixelStore;
+
+        std::array<int8_t, CapabilityCount> m_capabilities;
+        int8_t m_depthMask;
+        GLenum m_depthFunc;
+        GLenum m_blendSource;
+        GLenum m_blendDestination;
+        GLenum m_cullFace;
+        int8_t m_colorMask;
+    };
+}
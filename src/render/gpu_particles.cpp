@@ -0,0 +1,392 @@
+#include "render/gpu_particles.hpp"
+
+#include <cstddef>
+#include <vector>
+
+#include "render/gl_shader.hpp"
+#include "render/particle_renderer.hpp"
+
+namespace bloom
+{
+    namespace
+    {
+        // Storage bindings shared by both kernels.
+        enum Binding : int
+        {
+            kParticleBinding = 0,
+            kStateBinding = 1,
+            kIndirectBinding = 2,
+            kInstanceBinding = 3,
+        };
+
+        // Location 0 is the dispatch constants: x delta time, y emit rate.
+        constexpr GLint kCapacityLocation = 1;
+        constexpr GLint kEmitterPositionLocation = 2;
+        constexpr GLint kEmitterVelocityLocation = 3;
+        constexpr GLint kGravityLocation = 4;
+        constexpr GLint kSurfaceLocation = 5;
+        constexpr GLint kColorLocation = 6;
+        constexpr GLint kHeightRectLocation = 7;
+
+        // Two vec4s per slot in the particle pool.
+        constexpr std::size_t kParticleStride = 32;
+
+        // Buried far below anything, so the default field never collides.
+        constexpr float kNoGround = -1e30f;
+
+        struct State
+        {
+            uint32_t cursor;
+            uint32_t emitStart;
+            uint32_t emitCount;
+            uint32_t seed;
+            float carry;
+        };
+
+        const char* const kEmitShader = R"(#version 450 core
+layout(local_size_x = 1) in;
+layout(location = 0) uniform vec4 u_step;       // x delta time, y rate
+layout(location = 1) uniform uint u_capacity;
+layout(std430, binding = 1) buffer State { uint cursor; uint emitStart; uint emitCount; uint seed; float carry; } state;
+layout(std430, binding = 2) writeonly buffer Draw { uint count; uint instanceCount; uint first; uint baseInstance; } draw;
+void main()
+{
+    float due = state.carry + u_step.x * u_step.y;
+    uint count = uint(min(floor(due), float(u_capacity)));
+    state.carry = count == u_capacity ? 0.0 : due - float(count);
+    state.emitStart = state.cursor;
+    state.emitCount = count;
+    state.cursor = (state.cursor + count) % u_capacity;
+    state.seed += 1u;
+
+    draw.count = 4u;
+    draw.instanceCount = 0u;
+    draw.first = 0u;
+    draw.baseInstance = 0u;
+}
+)";
+
+        const char* const kSimulateShader = R"(#version 450 core
+layout(local_size_x = 256) in;
+struct Particle { vec4 positionLife; vec4 velocitySize; };
+struct Instance { float x, y, z, size; uint color; };
+layout(std430, binding = 0) buffer Particles { Particle particles[]; };
+layout(std430, binding = 1) readonly buffer State { uint cursor; uint emitStart; uint emitCount; uint seed; float carry; } state;
+layout(std430, binding = 2) buffer Draw { uint count; uint instanceCount; uint first; uint baseInstance; } draw;
+layout(std430, binding = 3) writeonly buffer Instances { Instance instances[]; };
+layout(binding = 0) uniform sampler2D u_height;
+layout(location = 0) uniform vec4 u_step;               // x delta time
+layout(location = 1) uniform uint u_capacity;
+layout(location = 2) uniform vec4 u_emitterPosition;    // w lifetime
+layout(location = 3) uniform vec4 u_emitterVelocity;    // w spread
+layout(location = 4) uniform vec4 u_gravity;            // w size
+layout(location = 5) uniform vec4 u_surface;            // x restitution, y friction
+layout(location = 6) uniform vec4 u_color;
+layout(location = 7) uniform vec4 u_heightRect;         // xy origin, zw 1 / extent
+
+shared uint s_count;
+shared uint s_base;
+
+uint hash(uint x)
+{
+    x ^= x >> 16;
+    x *= 0x7feb352du;
+    x ^= x >> 15;
+    x *= 0x846ca68bu;
+    return x ^ (x >> 16);
+}
+
+float random(inout uint rng)
+{
+    rng = hash(rng);
+    return float(rng >> 8) * (1.0 / 16777216.0);
+}
+
+float heightAt(vec2 xz)
+{
+    return textureLod(u_height, (xz - u_heightRect.xy) * u_heightRect.zw, 0.0).r;
+}
+
+void main()
+{
+    uint i = gl_GlobalInvocationID.x;
+    if (gl_LocalInvocationIndex == 0u)
+        s_count = 0u;
+    memoryBarrierShared();
+    barrier();
+
+    bool alive = false;
+    uint slot = 0u;
+    Instance instance;
+    if (i < u_capacity)
+    {
+        Particle p = particles[i];
+        float dt = u_step.x;
+        float lifetime = u_emitterPosition.w;
+        vec3 position = p.positionLife.xyz;
+        vec3 velocity = p.velocitySize.xyz;
+        float life = p.positionLife.w;
+        float size = p.velocitySize.w;
+
+        if ((i + u_capacity - state.emitStart) % u_capacity < state.emitCount)
+        {
+            uint rng = hash(i ^ hash(state.seed));
+            float z = random(rng) * 2.0 - 1.0;
+            float phi = random(rng) * 6.2831853;
+            vec3 direction = vec3(sqrt(1.0 - z * z) * vec2(cos(phi), sin(phi)), z);
+            velocity = u_emitterVelocity.xyz + direction * u_emitterVelocity.w * random(rng);
+            // Born somewhere within the step, so a burst does not move in sheets.
+            float age = dt * random(rng);
+            position = u_emitterPosition.xyz + velocity * age;
+            life = lifetime - age;
+            size = u_gravity.w;
+        }
+        else if (life > 0.0)
+        {
+            velocity += u_gravity.xyz * dt;
+            position += velocity * dt;
+            life -= dt;
+
+            float ground = heightAt(position.xz);
+            if (position.y < ground)
+            {
+                // Central differences one texel apart.
+                vec2 texel = 1.0 / (u_heightRect.zw * vec2(textureSize(u_height, 0)));
+                vec2 slope = vec2(heightAt(position.xz + vec2(texel.x, 0.0)) - heightAt(position.xz - vec2(texel.x, 0.0)),
+                                  heightAt(position.xz + vec2(0.0, texel.y)) - heightAt(position.xz - vec2(0.0, texel.y))) / (2.0 * texel);
+                vec3 normal = normalize(vec3(-slope.x, 1.0, -slope.y));
+                position.y = ground;
+                float into = dot(velocity, normal);
+                if (into < 0.0)
+                {
+                    vec3 tangent = velocity - into * normal;
+                    velocity = tangent * (1.0 - u_surface.y) - into * u_surface.x * normal;
+                }
+            }
+        }
+
+        if (life > 0.0 || p.positionLife.w > 0.0)
+            particles[i] = Particle(vec4(position, life), vec4(velocity, size));
+
+        if (life > 0.0)
+        {
+            alive = true;
+            instance = Instance(position.x, position.y, position.z, size,
+                                packUnorm4x8(vec4(u_color.rgb, u_color.a * clamp(life / lifetime, 0.0, 1.0))));
+            slot = atomicAdd(s_count, 1u);
+        }
+    }
+
+    // One global append per group.
+    memoryBarrierShared();
+    barrier();
+    if (gl_LocalInvocationIndex == 0u)
+        s_base = atomicAdd(draw.instanceCount, s_count);
+    memoryBarrierShared();
+    barrier();
+    if (alive)
+        instances[s_base + slot] = instance;
+}
+)";
+
+        GLuint createBuffer(GLsizeiptr size, const void* data)
+        {
+            GLuint buffer = 0;
+            glCreateBuffers(1, &buffer);
+            glNamedBufferStorage(buffer, size, data, 0);
+            return buffer;
+        }
+
+        void setColor(GLuint program, GLint location, uint32_t rgba)
+        {
+            glProgramUniform4f(program, location, static_cast<float>(rgba & 0xff) / 255.f, static_cast<float>(rgba >> 8 & 0xff) / 255.f,
+                               static_cast<float>(rgba >> 16 & 0xff) / 255.f, static_cast<float>(rgba >> 24) / 255.f);
+        }
+    }
+
+    GpuParticleSystem::~GpuParticleSystem()
+    {
+        release();
+    }
+
+    bool GpuParticleSystem::init(uint32_t capacity)
+    {
+        release();
+        if (capacity == 0)
+            return false;
+
+        m_emitProgram = compileComputeProgram(kEmitShader);
+        m_simulateProgram = compileComputeProgram(kSimulateShader);
+        m_drawProgram = compileParticleProgram();
+        if (!m_emitProgram || !m_simulateProgram || !m_drawProgram)
+        {
+            release();
+            return false;
+        }
+
+        // Zeroed particles are dead ones.
+        std::vector<std::byte> zeros(static_cast<std::size_t>(capacity) * kParticleStride);
+        m_particles = createBuffer(static_cast<GLsizeiptr>(zeros.size()), zeros.data());
+        const State state{};
+        m_state = createBuffer(sizeof(state), &state);
+        const DrawArraysIndirectCommand command{4, 0, 0, 0};
+        m_indirect = createBuffer(sizeof(command), &command);
+        m_instances = createBuffer(static_cast<GLsizeiptr>(capacity) * sizeof(ParticleInstance), nullptr);
+        m_vertexArray = createParticleVertexArray(m_instances);
+
+        m_capacity = capacity;
+        glProgramUniform1ui(m_emitProgram, kCapacityLocation, capacity);
+        glProgramUniform1ui(m_simulateProgram, kCapacityLocation, capacity);
+        setEmitter(m_emitter);
+        setCamera(Mat4::identity(), Mat4::identity());
+
+        // Cleared rather than uploaded, so no unpack state is involved.
+        const float noGround = kNoGround;
+        createHeightField(1, 1);
+        glClearTexImage(m_heightField, 0, GL_RED, GL_FLOAT, &noGround);
+        setHeightRect(HeightFieldRect{});
+        return true;
+    }
+
+    void GpuParticleSystem::release(GLStateCache* state)
+    {
+        for (GLuint* buffer : {&m_particles, &m_state, &m_indirect, &m_instances})
+        {
+            if (*buffer)
+            {
+                if (state)
+                    state->forgetBuffer(*buffer);
+                glDeleteBuffers(1, buffer);
+            }
+            *buffer = 0;
+        }
+        for (GLuint* program : {&m_emitProgram, &m_simulateProgram, &m_drawProgram})
+        {
+            if (*program)
+            {
+                if (state)
+                    state->forgetProgram(*program);
+                glDeleteProgram(*program);
+            }
+            *program = 0;
+        }
+        if (m_vertexArray)
+        {
+            if (state)
+                state->forgetVertexArray(m_vertexArray);
+            glDeleteVertexArrays(1, &m_vertexArray);
+        }
+        if (m_heightField)
+        {
+            if (state)
+                state->forgetTexture(m_heightField);
+            glDeleteTextures(1, &m_heightField);
+        }
+        m_vertexArray = 0;
+        m_heightField = 0;
+        m_capacity = 0;
+    }
+
+    void GpuParticleSystem::setEmitter(const EmitterParams& emitter)
+    {
+        m_emitter = emitter;
+        if (!m_simulateProgram)
+            return;
+
+        const GLuint program = m_simulateProgram;
+        glProgramUniform4f(program, kEmitterPositionLocation, emitter.position.x, emitter.position.y, emitter.position.z, emitter.lifetime);
+        glProgramUniform4f(program, kEmitterVelocityLocation, emitter.velocity.x, emitter.velocity.y, emitter.velocity.z, emitter.spread);
+        glProgramUniform4f(program, kGravityLocation, emitter.gravity.x, emitter.gravity.y, emitter.gravity.z, emitter.size);
+        glProgramUniform4f(program, kSurfaceLocation, emitter.restitution, emitter.friction, 0.f, 0.f);
+        setColor(program, kColorLocation, emitter.color);
+    }
+
+    bool GpuParticleSystem::setHeightField(GLStateCache& state, const float* heights, int width, int depth, const HeightFieldRect& rect)
+    {
+        if (!m_simulateProgram || width <= 0 || depth <= 0 || rect.width <= 0.f || rect.depth <= 0.f)
+            return false;
+
+        GLint currentWidth = 0;
+        GLint currentDepth = 0;
+        glGetTextureLevelParameteriv(m_heightField, 0, GL_TEXTURE_WIDTH, &currentWidth);
+        glGetTextureLevelParameteriv(m_heightField, 0, GL_TEXTURE_HEIGHT, &currentDepth);
+        if (currentWidth != width || currentDepth != depth)
+        {
+            state.forgetTexture(m_heightField);
+            createHeightField(width, depth);
+        }
+
+        // `heights` is client memory, tightly packed.
+        state.bindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+        state.pixelStore(GL_UNPACK_ALIGNMENT, 4);
+        state.pixelStore(GL_UNPACK_ROW_LENGTH, 0);
+        glTextureSubImage2D(m_heightField, 0, 0, 0, width, depth, GL_RED, GL_FLOAT, heights);
+        setHeightRect(rect);
+        return true;
+    }
+
+    // Storage is immutable, so a new size needs a new texture.
+    void GpuParticleSystem::createHeightField(int width, int depth)
+    {
+        if (m_heightField)
+            glDeleteTextures(1, &m_heightField);
+        glCreateTextures(GL_TEXTURE_2D, 1, &m_heightField);
+        glTextureStorage2D(m_heightField, 1, GL_R32F, width, depth);
+        glTextureParameteri(m_heightField, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+        glTextureParameteri(m_heightField, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+        glTextureParameteri(m_heightField, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+        glTextureParameteri(m_heightField, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+    }
+
+    void GpuParticleSystem::setHeightRect(const HeightFieldRect& rect)
+    {
+        glProgramUniform4f(m_simulateProgram, kHeightRectLocation, rect.x, rect.z, 1.f / rect.width, 1.f / rect.depth);
+    }
+
+    void GpuParticleSystem::recordStep(CommandBuffer& bucket, uint64_t key, float deltaTime) const
+    {
+        if (!m_capacity)
+            return;
+
+        DispatchCommand emit;
+        emit.program = m_emitProgram;
+        emit.barrier = GL_SHADER_STORAGE_BARRIER_BIT;
+        emit.storageBuffers[kStateBinding] = BufferRange{m_state};
+        emit.storageBuffers[kIndirectBinding] = BufferRange{m_indirect};
+        emit.hasConstants = true;
+        emit.constants[0] = deltaTime;
+        emit.constants[1] = m_emitter.rate;
+        bucket.record(key, emit);
+
+        DispatchCommand simulate;
+        simulate.program = m_simulateProgram;
+        simulate.groups[0] = (m_capacity + kGroupSize - 1) / kGroupSize;
+        simulate.barrier = GL_SHADER_STORAGE_BARRIER_BIT | GL_COMMAND_BARRIER_BIT | GL_VERTEX_ATTRIB_ARRAY_BARRIER_BIT;
+        simulate.storageBuffers[kParticleBinding] = BufferRange{m_particles};
+        simulate.storageBuffers[kStateBinding] = BufferRange{m_state};
+        simulate.storageBuffers[kIndirectBinding] = BufferRange{m_indirect};
+        simulate.storageBuffers[kInstanceBinding] = BufferRange{m_instances};
+        simulate.textures[0] = m_heightField;
+        simulate.hasConstants = true;
+        simulate.constants[0] = deltaTime;
+        bucket.record(key + 1, simulate);
+    }
+
+    void GpuParticleSystem::setCamera(const Mat4& view, const Mat4& projection)
+    {
+        setParticleCamera(m_drawProgram, view, projection);
+    }
+
+    DrawCommand GpuParticleSystem::draw() const
+    {
+        DrawCommand draw;
+        draw.program = m_drawProgram;
+        draw.vertexArray = m_vertexArray;
+        draw.mode = GL_TRIANGLE_STRIP;
+        draw.indirectBuffer = m_indirect;
+        draw.state.depthTest = true;
+        draw.state.depthWrite = false;
+        draw.state.blend = BlendMode::Additive;
+        return draw;
+    }
+}
@@ -0,0 +1,112 @@
+#pragma once
+
+#include <cstdint>
+
+#include "glad/glad.h"
+
+#include "math/mat4.hpp"
+#include "math/vec.hpp"
+#include "render/gl_state_cache.hpp"
+#include "render/render_commands.hpp"
+#include "render/render_queue.hpp"
+
+namespace bloom
+{
+    struct EmitterParams
+    {
+        Vec3 position;
+        float rate = 1000.f;            // particles per second
+        Vec3 velocity{0.f, 4.f, 0.f};   // initial velocity...
+        float spread = 1.f;             // ...plus up to this much in a random direction
+        Vec3 gravity{0.f, -9.81f, 0.f};
+        float lifetime = 3.f;           // seconds
+        float size = 0.02f;             // quad half-extent
+        float restitution = 0.4f;       // normal velocity kept by a bounce
+        float friction = 0.2f;          // tangential velocity lost by a bounce
+        uint32_t color = 0xff40a0ffu;   // RGBA8, faded out over the lifetime
+    };
+
+    // World-space rectangle a height map covers, in the XZ plane.
+    struct HeightFieldRect
+    {
+        float x = -1.f;
+        float z = -1.f;
+        float width = 2.f;
+        float depth = 2.f;
+    };
+
+    // Particles simulated entirely by compute shaders.
+    //
+    // Each step is two dispatches. A single-invocation "emit" kernel turns
+    // the emitter rate into a number of slots to respawn this step (taken
+    // round-robin from a ring cursor, so a pool too small for
+    // rate * lifetime recycles its oldest particles first) and resets the
+    // indirect draw count. The "simulate" kernel then, per slot, spawns or
+    // integrates the particle, bounces it off the height field, ages it,
+    // and appends the survivors as ParticleInstances to a compacted buffer.
+    // The draw reads its instance count from that append counter with
+    // glDrawArraysIndirect, so nothing is ever read back.
+    //
+    // The CPU only sets emitter parameters and the height field; no
+    // particle data crosses the bus.
+    class GpuParticleSystem
+    {
+    public:
+        static constexpr uint32_t kGroupSize = 256;
+
+        GpuParticleSystem() = default;
+        ~GpuParticleSystem();
+
+        GpuParticleSystem(const GpuParticleSystem&) = delete;
+        GpuParticleSystem& operator=(const GpuParticleSystem&) = delete;
+
+        // Render thread. Starts with every particle dead and a height field
+        // nothing collides with. release() reports the objects it deletes
+        // to `state` when given one; the destructor passes none.
+        bool init(uint32_t capacity);
+        void release(GLStateCache* state = nullptr);
+
+        uint32_t capacity() const { return m_capacity; }
+
+        void setEmitter(const EmitterParams& emitter);
+        const EmitterParams& emitter() const { return m_emitter; }
+
+        // `heights` is a row-major width x depth grid of world Y values,
+        // row 0 at rect.z; sampled bilinearly and clamped at the edges.
+        // Uploads through `state`'s unpack buffer and pixel store shadow.
+        bool setHeightField(GLStateCache& state, const float* heights, int width, int depth, const HeightFieldRect& rect);
+
+        // Records one simulation step of `deltaTime` seconds as two
+        // dispatches at `key` and `key + 1`; order the draw after them.
+        void recordStep(CommandBuffer& bucket, uint64_t key, float deltaTime) const;
+
+        void setCamera(const Mat4& view, const Mat4& projection);
+        // Indirect, additive, depth-tested and not depth-writing.
+        DrawCommand draw() const;
+
+        // For inspection (tests, tools): the particle pool
+        // (vec4 position + remaining life, vec4 velocity + size, per slot),
+        // the compacted ParticleInstance buffer and the indirect command.
+        GLuint particleBuffer() const { return m_particles; }
+        GLuint instanceBuffer() const { return m_instances; }
+        GLuint indirectBuffer() const { return m_indirect; }
+
+    private:
+        void createHeightField(int width, int depth);
+        void setHeightRect(const HeightFieldRect& rect);
+
+        GLuint m_emitProgram = 0;
+        GLuint m_simulateProgram = 0;
+        GLuint m_drawProgram = 0;
+        GLuint m_vertexArray = 0;
+
+        GLuint m_particles = 0;
+        GLuint m_state = 0;
+        GLuint m_indirect = 0;
+        GLuint m_instances = 0;
+        GLuint m_heightField = 0;
+
+        uint32_t m_capacity = 0;
+        EmitterParams m_emitter;
+    };
+}
@@ -0,0 +1,128 @@
+#include "render/gpu_profiler.hpp"
+
+#include "core/clock.hpp"
+
+namespace bloom
+{
+    namespace
+    {
+        // Re-anchor the GPU clock to the CPU clock every so often; the two
+        // drift apart slowly and the anchor query itself is not free.
+        constexpr uint64_t kCalibrationInterval = 256;
+    }
+
+    bool GpuProfiler::init()
+    {
+        if (!GLAD_GL_VERSION_3_3)
+            return false;
+
+        for (FrameQueries& frame : m_frames)
+            glGenQueries(static_cast<GLsizei>(frame.queries.size()), frame.queries.data());
+
+        m_track = Profiler::createTrack("GPU");
+        calibrate();
+        m_ready = true;
+        return true;
+    }
+
+    void GpuProfiler::release()
+    {
+        if (!m_ready)
+            return;
+
+        for (FrameQueries& frame : m_frames)
+        {
+            glDeleteQueries(static_cast<GLsizei>(frame.queries.size()), frame.queries.data());
+            frame = {};
+        }
+        m_ready = false;
+        m_recording = false;
+    }
+
+    void GpuProfiler::beginFrame()
+    {
+        if (!m_ready)
+            return;
+
+        FrameQueries& frame = m_frames[m_frameIndex % kFrameLatency];
+        if (frame.pending)
+            collect(frame);
+        frame.count = 0;
+        frame.pending = false;
+
+        if (m_frameIndex % kCalibrationInterval == 0)
+            calibrate();
+        m_recording = Profiler::enabled();
+    }
+
+    void GpuProfiler::endFrame()
+    {
+        if (!m_ready)
+            return;
+
+        m_frames[m_frameIndex % kFrameLatency].pending = m_recording;
+        m_recording = false;
+        ++m_frameIndex;
+    }
+
+    int GpuProfiler::begin(const char* name)
+    {
+        FrameQueries& frame = m_frames[m_frameIndex % kFrameLatency];
+        if (!m_recording || frame.count == kMaxZonesPerFrame)
+            return -1;
+
+        const int zone = frame.count++;
+        frame.names[zone] = name;
+        glQueryCounter(frame.queries[zone * 2], GL_TIMESTAMP);
+        return zone;
+    }
+
+    void GpuProfiler::end(int zone)
+    {
+        if (zone < 0)
+            return;
+
+        glQueryCounter(m_frames[m_frameIndex % kFrameLatency].queries[zone * 2 + 1], GL_TIMESTAMP);
+    }
+
+    void GpuProfiler::collect(FrameQueries& frame)
+    {
+        // Nested zones finish out of index order, so every end query has to
+        // be checked; asking for a result that is not ready would stall.
+        for (int zone = 0; zone < frame.count; ++zone)
+        {
+            GLint available = GL_FALSE;
+            glGetQueryObjectiv(frame.queries[zone * 2 + 1], GL_QUERY_RESULT_AVAILABLE, &available);
+            if (!available)
+            {
+                ++m_droppedFrames;
+                return;
+            }
+        }
+
+        if (!m_track)
+            return;
+
+        const double ticksPerNs = static_cast<double>(Clock::frequency()) / 1e9;
+        for (int zone = 0; zone < frame.count; ++zone)
+        {
+            GLuint64 begin = 0;
+            GLuint64 end = 0;
+            glGetQueryObjectui64v(frame.queries[zone * 2], GL_QUERY_RESULT, &begin);
+            glGetQueryObjectui64v(frame.queries[zone * 2 + 1], GL_QUERY_RESULT, &end);
+
+            const double offset = static_cast<double>(static_cast<int64_t>(begin) - m_gpuOrigin) * ticksPerNs;
+            const uint64_t cpuBegin = m_cpuOrigin + static_cast<int64_t>(offset);
+            const uint64_t cpuEnd = cpuBegin + static_cast<uint64_t>(static_cast<double>(end - begin) * ticksPerNs);
+            m_track->record(frame.names[zone], cpuBegin, cpuEnd);
+        }
+    }
+
+    void GpuProfiler::calibrate()
+    {
+        GLint64 gpuNow = 0;
+        glGetInteger64v(GL_TIMESTAMP, &gpuNow);
+        m_cpuOrigin = Clock::now();
+        m_gpuOrigin = gpuNow;
+    }
+}
@@ -0,0 +1,90 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+
+#include "glad/glad.h"
+
+#include "core/profiler.hpp"
+
+namespace bloom
+{
+    // GPU zones timed with GL_TIMESTAMP queries. Each zone brackets its
+    // commands with two glQueryCounter calls, so zones can nest (unlike
+    // GL_TIME_ELAPSED, which allows one active query). Results are read
+    // kFrameLatency frames later, converted to the CPU clock and handed to
+    // the Profiler on a "GPU" track, so they line up with the CPU zones in
+    // the trace. Frames whose queries are still pending by then are dropped
+    // rather than stalling the render thread.
+    //
+    // Every method must run on the thread that owns the GL context.
+    class GpuProfiler
+    {
+    public:
+        static constexpr int kFrameLatency = 4;
+        static constexpr int kMaxZonesPerFrame = 64;
+
+        GpuProfiler() = default;
+
+        GpuProfiler(const GpuProfiler&) = delete;
+        GpuProfiler& operator=(const GpuProfiler&) = delete;
+
+        // Needs GL 3.3; returns false (and every zone becomes a no-op)
+        // without it. release() must run before the context is destroyed.
+        bool init();
+        void release();
+
+        void beginFrame();
+        void endFrame();
+
+        // Returns a handle for end(), or -1 when the zone is not recorded.
+        int begin(const char* name);
+        void end(int zone);
+
+        uint64_t droppedFrames() const { return m_droppedFrames; }
+
+    private:
+        struct FrameQueries
+        {
+            std::array<GLuint, kMaxZonesPerFrame * 2> queries{};
+            std::array<const char*, kMaxZonesPerFrame> names{};
+            int count = 0;
+            bool pending = false;
+        };
+
+        void collect(FrameQueries& frame);
+        void calibrate();
+
+        std::array<FrameQueries, kFrameLatency> m_frames;
+        ProfileTrack* m_track = nullptr;
+        uint64_t m_frameIndex = 0;
+        uint64_t m_droppedFrames = 0;
+        bool m_ready = false;
+        bool m_recording = false;
+
+        // CPU clock value and GPU timestamp (ns) taken at the same moment.
+        uint64_t m_cpuOrigin = 0;
+        int64_t m_gpuOrigin = 0;
+    };
+
+    // Times the GL commands issued within its scope.
+    class GpuZone
+    {
+    public:
+        GpuZone(GpuProfiler& profiler, const char* name)
+            : m_profiler(profiler), m_zone(profiler.begin(name))
+        {
+        }
+
+        ~GpuZone() { m_profiler.end(m_zone); }
+
+        GpuZone(const GpuZone&) = delete;
+        GpuZone& operator=(const GpuZone&) = delete;
+
+    private:
+        GpuProfiler& m_profiler;
+        int m_zone;
+    };
+}
+
+#define BLOOM_PROFILE_GPU_ZONE(profiler, name) ::bloom::GpuZone BLOOM_PROFILE_CONCAT(bloomGpuZone_, __LINE__)(profiler, name)
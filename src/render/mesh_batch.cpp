@@ -0,0 +1,334 @@
+#include "render/mesh_batch.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+
+#include "render/asset_upload.hpp"
+#include "render/gl_shader.hpp"
+#include "render/sort_key.hpp"
+
+namespace bloom
+{
+    namespace
+    {
+        constexpr GLint kViewProjectionLocation = 1;
+
+        const char* const kBatchVertexShader = R"(#version 450 core
+struct Instance { mat4 transform; vec4 params; };
+layout(std430, binding = 0) readonly buffer Instances { Instance instances[]; };
+layout(location = 0) in vec3 a_position;
+layout(location = 1) in vec3 a_normal;
+layout(location = 15) in uint a_instance;
+layout(location = 1) uniform mat4 u_viewProjection;
+out vec3 v_color;
+void main()
+{
+    Instance instance = instances[a_instance];
+    vec3 normal = normalize(mat3(instance.transform) * a_normal);
+    float light = 0.35 + 0.65 * max(dot(normal, normalize(vec3(0.4, 0.8, 0.3))), 0.0);
+    v_color = instance.params.rgb * light;
+    gl_Position = u_viewProjection * (instance.transform * vec4(a_position, 1.0));
+}
+)";
+
+        const char* const kBatchFragmentShader = R"(#version 450 core
+in vec3 v_color;
+out vec4 o_color;
+void main()
+{
+    o_color = vec4(v_color, 1.0);
+}
+)";
+
+        constexpr int kKeyShift = 32;
+        constexpr int kMeshBits = 20;
+
+        bool sameLayout(const MeshInfo& a, const MeshInfo& b)
+        {
+            if (a.vertexStride != b.vertexStride || a.attributeCount != b.attributeCount)
+                return false;
+            return std::memcmp(a.attributes, b.attributes, a.attributeCount * sizeof(VertexAttribute)) == 0;
+        }
+    }
+
+    MeshBatchRenderer::~MeshBatchRenderer()
+    {
+        release();
+    }
+
+    bool MeshBatchRenderer::init(const MeshInfo& layout, const Capacity& capacity)
+    {
+        release();
+
+        for (uint32_t i = 0; i < layout.attributeCount; ++i)
+        {
+            if (layout.attributes[i].location == kInstanceAttribute)
+            {
+                std::fprintf(stderr, "Mesh batch: attribute location %u is reserved for the instance index\n", kInstanceAttribute);
+                return false;
+            }
+        }
+
+        m_defaultProgram = compileProgram(kBatchVertexShader, kBatchFragmentShader);
+        if (!m_defaultProgram)
+            return false;
+
+        GLint alignment = 0;
+        glGetIntegerv(GL_SHADER_STORAGE_BUFFER_OFFSET_ALIGNMENT, &alignment);
+        const uint64_t instances = capacity.instancesPerFrame;
+        const uint64_t frameBytes = instances * (sizeof(MeshInstance) + sizeof(uint32_t) + sizeof(DrawElementsIndirectCommand)) +
+                                    static_cast<uint64_t>(std::max(alignment, 16)) * 3;
+        if (!m_ring.init(static_cast<GLsizeiptr>(frameBytes * kFramesInFlight)))
+        {
+            release();
+            return false;
+        }
+
+        glCreateBuffers(1, &m_vertexBuffer);
+        glNamedBufferStorage(m_vertexBuffer, static_cast<GLsizeiptr>(capacity.vertexBytes), nullptr, GL_DYNAMIC_STORAGE_BIT);
+        glCreateBuffers(1, &m_indexBuffer);
+        glNamedBufferStorage(m_indexBuffer, static_cast<GLsizeiptr>(capacity.indices) * sizeof(uint32_t), nullptr, GL_DYNAMIC_STORAGE_BIT);
+
+        // Binding 0 is the shared vertex buffer; binding 1 the frame's remap
+        // from sorted position to submission slot, pointed into the ring by
+        // record().
+        m_vertexArray = createVertexArray(layout, m_vertexBuffer, m_indexBuffer);
+        glVertexArrayBindingDivisor(m_vertexArray, 1, 1);
+        glVertexArrayAttribIFormat(m_vertexArray, kInstanceAttribute, 1, GL_UNSIGNED_INT, 0);
+        glVertexArrayAttribBinding(m_vertexArray, kInstanceAttribute, 1);
+        glEnableVertexArrayAttrib(m_vertexArray, kInstanceAttribute);
+
+        m_layout = layout;
+        m_capacity = capacity;
+        m_storageAlignment = std::max(alignment, 4);
+        m_keys.resize(instances);
+        m_scratch.resize(instances);
+        m_commands.reserve(instances);
+        m_commandMaterials.reserve(instances);
+        return true;
+    }
+
+    void MeshBatchRenderer::release(GLStateCache* state)
+    {
+        if (state)
+        {
+            if (m_ring.isOpen())
+                state->forgetBuffer(m_ring.buffer());
+            state->forgetVertexArray(m_vertexArray);
+            state->forgetBuffer(m_vertexBuffer);
+            state->forgetBuffer(m_indexBuffer);
+            state->forgetProgram(m_defaultProgram);
+        }
+        m_ring.release();
+        if (m_vertexArray)
+            glDeleteVertexArrays(1, &m_vertexArray);
+        if (m_vertexBuffer)
+            glDeleteBuffers(1, &m_vertexBuffer);
+        if (m_indexBuffer)
+            glDeleteBuffers(1, &m_indexBuffer);
+        if (m_defaultProgram)
+            glDeleteProgram(m_defaultProgram);
+
+        m_vertexArray = 0;
+        m_vertexBuffer = 0;
+        m_indexBuffer = 0;
+        m_defaultProgram = 0;
+        m_vertexUsed = 0;
+        m_indexUsed = 0;
+        m_meshes.clear();
+        m_materials.clear();
+        m_instances = nullptr;
+    }
+
+    uint32_t MeshBatchRenderer::addMesh(const MeshView& mesh)
+    {
+        const MeshInfo& info = *mesh.info;
+        if (!sameLayout(info, m_layout))
+        {
+            std::fprintf(stderr, "Mesh batch: mesh vertex layout differs from the batch's\n");
+            return kInvalid;
+        }
+
+        if (info.indexType == GL_UNSIGNED_INT)
+            return addMesh(mesh.vertices, info.vertexCount, reinterpret_cast<const uint32_t*>(mesh.indices), info.indexCount);
+
+        // The shared index buffer is 32-bit.
+        std::vector<uint32_t> widened(info.indexCount);
+        const auto* narrow = reinterpret_cast<const uint16_t*>(mesh.indices);
+        std::copy(narrow, narrow + info.indexCount, widened.begin());
+        return addMesh(mesh.vertices, info.vertexCount, widened.data(), info.indexCount);
+    }
+
+    uint32_t MeshBatchRenderer::addMesh(const void* vertices, uint32_t vertexCount, const uint32_t* indices, uint32_t indexCount)
+    {
+        const uint64_t stride = m_layout.vertexStride;
+        const uint64_t vertexBytes = vertexCount * stride;
+        // Vertices are placed at a multiple of the stride so baseVertex can
+        // address them.
+        const uint64_t vertexStart = (m_vertexUsed + stride - 1) / stride * stride;
+        if (!m_vertexBuffer || m_meshes.size() >= kMaxMeshes || vertexStart + vertexBytes > m_capacity.vertexBytes ||
+            static_cast<uint64_t>(m_indexUsed) + indexCount > m_capacity.indices)
+        {
+            std::fprintf(stderr, "Mesh batch: out of shared buffer space\n");
+            return kInvalid;
+        }
+
+        glNamedBufferSubData(m_vertexBuffer, static_cast<GLintptr>(vertexStart), static_cast<GLsizeiptr>(vertexBytes), vertices);
+        glNamedBufferSubData(m_indexBuffer, static_cast<GLintptr>(m_indexUsed) * sizeof(uint32_t),
+                             static_cast<GLsizeiptr>(indexCount) * sizeof(uint32_t), indices);
+
+        Mesh mesh;
+        mesh.firstIndex = m_indexUsed;
+        mesh.indexCount = indexCount;
+        mesh.baseVertex = static_cast<int32_t>(vertexStart / stride);
+        m_meshes.push_back(mesh);
+
+        m_vertexUsed = vertexStart + vertexBytes;
+        m_indexUsed += indexCount;
+        return static_cast<uint32_t>(m_meshes.size() - 1);
+    }
+
+    uint32_t MeshBatchRenderer::addMaterial(const BatchMaterial& material)
+    {
+        if (m_materials.size() >= kMaxMaterials)
+            return kInvalid;
+        m_materials.push_back(material);
+        return static_cast<uint32_t>(m_materials.size() - 1);
+    }
+
+    void MeshBatchRenderer::setCamera(const Mat4& viewProjection)
+    {
+        glProgramUniformMatrix4fv(m_defaultProgram, kViewProjectionLocation, 1, GL_FALSE, viewProjection.data());
+    }
+
+    void MeshBatchRenderer::beginFrame()
+    {
+        m_stats = {};
+        m_submitted.store(0, std::memory_order_relaxed);
+        if (!m_ring.isOpen())
+            return;
+
+        const StagingRing::Allocation allocation =
+            m_ring.allocate(static_cast<GLsizeiptr>(m_capacity.instancesPerFrame * sizeof(MeshInstance)), m_storageAlignment);
+        m_instanceOffset = allocation.offset;
+        m_instances = reinterpret_cast<MeshInstance*>(allocation.pointer);
+    }
+
+    void MeshBatchRenderer::submit(uint32_t mesh, uint32_t material, const MeshInstance& instance)
+    {
+        if (!m_instances || mesh >= m_meshes.size() || material >= m_materials.size())
+            return;
+
+        const uint32_t slot = m_submitted.fetch_add(1, std::memory_order_relaxed);
+        if (slot >= m_capacity.instancesPerFrame)
+            return;
+
+        // One whole-struct store: the ring is write-combined memory.
+        m_instances[slot] = instance;
+        m_keys[slot] = (uint64_t{material} << kMeshBits | mesh) << kKeyShift | slot;
+    }
+
+    void MeshBatchRenderer::record(CommandBuffer& bucket, uint32_t pass)
+    {
+        const uint32_t submitted = m_submitted.load(std::memory_order_relaxed);
+        const uint32_t count = std::min(submitted, m_capacity.instancesPerFrame);
+        m_stats.instances = count;
+        m_stats.dropped = submitted - count;
+        if (count == 0 || !m_instances)
+            return;
+
+        // LSD radix sort on the (material, mesh) half, one byte per pass,
+        // skipping bytes every key shares. Stable, so instances keep their
+        // submission order within a run.
+        for (int shift = kKeyShift; shift < 64; shift += 8)
+        {
+            uint32_t counts[256] = {};
+            for (uint32_t i = 0; i < count; ++i)
+                ++counts[(m_keys[i] >> shift) & 0xff];
+            if (counts[(m_keys[0] >> shift) & 0xff] == count)
+                continue;
+
+            uint32_t offset = 0;
+            for (uint32_t& value : counts)
+            {
+                const uint32_t digits = value;
+                value = offset;
+                offset += digits;
+            }
+            for (uint32_t i = 0; i < count; ++i)
+                m_scratch[counts[(m_keys[i] >> shift) & 0xff]++] = m_keys[i];
+            m_keys.swap(m_scratch);
+        }
+
+        // Remap from sorted position to slot, and one command per run.
+        const StagingRing::Allocation remap = m_ring.allocate(static_cast<GLsizeiptr>(count * sizeof(uint32_t)), sizeof(uint32_t));
+        if (!remap.pointer || remap.offset < 0)
+        {
+            std::fprintf(stderr, "Mesh batch: no ring space for the instance remap; batch skipped\n");
+            return;
+        }
+        auto* slots = reinterpret_cast<uint32_t*>(remap.pointer);
+        m_commands.clear();
+        m_commandMaterials.clear();
+        uint64_t previous = ~0ull;
+        for (uint32_t i = 0; i < count; ++i)
+        {
+            const uint64_t key = m_keys[i] >> kKeyShift;
+            slots[i] = static_cast<uint32_t>(m_keys[i]);
+            if (key != previous)
+            {
+                const Mesh& mesh = m_meshes[key & ((1u << kMeshBits) - 1)];
+                m_commands.push_back(DrawElementsIndirectCommand{mesh.indexCount, 0, mesh.firstIndex, mesh.baseVertex, i});
+                m_commandMaterials.push_back(static_cast<uint32_t>(key >> kMeshBits));
+                previous = key;
+            }
+            ++m_commands.back().instanceCount;
+        }
+
+        const auto commandBytes = static_cast<GLsizeiptr>(m_commands.size() * sizeof(DrawElementsIndirectCommand));
+        const StagingRing::Allocation commands = m_ring.allocate(commandBytes, sizeof(uint32_t));
+        if (!commands.pointer || commands.offset < 0)
+        {
+            std::fprintf(stderr, "Mesh batch: no ring space for the indirect commands; batch skipped\n");
+            return;
+        }
+        std::memcpy(commands.pointer, m_commands.data(), static_cast<std::size_t>(commandBytes));
+        glVertexArrayVertexBuffer(m_vertexArray, 1, m_ring.buffer(), remap.offset, sizeof(uint32_t));
+
+        // One multi-draw per material.
+        const auto total = static_cast<uint32_t>(m_commands.size());
+        for (uint32_t first = 0; first < total;)
+        {
+            const uint32_t material = m_commandMaterials[first];
+            uint32_t last = first + 1;
+            while (last < total && m_commandMaterials[last] == material)
+                ++last;
+
+            const BatchMaterial& source = m_materials[material];
+            DrawCommand draw;
+            draw.program = source.program;
+            draw.vertexArray = m_vertexArray;
+            draw.indexType = GL_UNSIGNED_INT;
+            draw.state = source.state;
+            std::copy(std::begin(source.textures), std::end(source.textures), draw.textures);
+            draw.storageBuffers[kInstanceBinding] = BufferRange{m_ring.buffer(), m_instanceOffset,
+                                                                static_cast<GLsizeiptr>(count * sizeof(MeshInstance))};
+            draw.indirectBuffer = m_ring.buffer();
+            draw.indirectOffset = commands.offset + static_cast<GLintptr>(first * sizeof(DrawElementsIndirectCommand));
+            draw.drawCount = static_cast<GLsizei>(last - first);
+            bucket.record(SortKey::encode(pass, 0, material, 0), draw);
+
+            ++m_stats.multiDraws;
+            first = last;
+        }
+        m_stats.commands = total;
+    }
+
+    void MeshBatchRenderer::endFrame()
+    {
+        if (m_ring.isOpen())
+            m_ring.fence();
+        m_instances = nullptr;
+    }
+}
@@ -0,0 +1,147 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <vector>
+
+#include "glad/glad.h"
+
+#include "asset/asset_file.hpp"
+#include "math/mat4.hpp"
+#include "render/gl_state_cache.hpp"
+#include "render/render_commands.hpp"
+#include "render/render_queue.hpp"
+#include "render/staging_ring.hpp"
+
+namespace bloom
+{
+    // Per-instance data, read by the vertex shader from a storage buffer.
+    // Matches std430 `struct { mat4 transform; vec4 params; }`.
+    struct MeshInstance
+    {
+        Mat4 transform;
+        float params[4] = {};
+    };
+
+    struct BatchMaterial
+    {
+        GLuint program = 0;
+        RenderState state;
+        GLuint textures[DrawCommand::kMaxTextures] = {};
+    };
+
+    // Draws many instances of many static meshes with one
+    // glMultiDrawElementsIndirect per material.
+    //
+    // Every mesh lives in one shared vertex buffer and one shared 32-bit
+    // index buffer, so all of them must have the same vertex layout and a
+    // single vertex array serves every draw. Each frame, submit() writes
+    // instances straight into a persistently mapped StagingRing region; it
+    // is thread-safe, so jobs can submit in parallel. record() then sorts
+    // the submissions by material and mesh, writes one
+    // DrawElementsIndirectCommand per (material, mesh) run and records a
+    // single multi-draw DrawCommand per material.
+    //
+    // Shader interface: the instance's slot arrives as a uint attribute at
+    // kInstanceAttribute and indexes `MeshInstance instances[]` at storage
+    // binding kInstanceBinding. The attribute is fed from a per-frame remap
+    // buffer with divisor 1, so it is baseInstance + gl_InstanceID of the
+    // sub-draw mapped back to the submission slot; no gl_DrawID or
+    // ARB_shader_draw_parameters needed.
+    class MeshBatchRenderer
+    {
+    public:
+        static constexpr uint32_t kInvalid = ~0u;
+        static constexpr GLuint kInstanceAttribute = 15;
+        static constexpr GLuint kInstanceBinding = 0;
+        static constexpr uint32_t kMaxMaterials = 4096;
+        static constexpr uint32_t kMaxMeshes = 1u << 20;
+        // Frames of instance data the ring holds before submit() has to
+        // wait for the GPU.
+        static constexpr int kFramesInFlight = 3;
+
+        struct Capacity
+        {
+            uint64_t vertexBytes = 64ull << 20;
+            uint32_t indices = 16u << 20;
+            uint32_t instancesPerFrame = 65536;
+        };
+
+        struct Stats
+        {
+            uint32_t instances = 0;
+            uint32_t dropped = 0;       // submitted past instancesPerFrame
+            uint32_t commands = 0;      // indirect sub-draws
+            uint32_t multiDraws = 0;    // GL draw calls
+        };
+
+        MeshBatchRenderer() = default;
+        ~MeshBatchRenderer();
+
+        MeshBatchRenderer(const MeshBatchRenderer&) = delete;
+        MeshBatchRenderer& operator=(const MeshBatchRenderer&) = delete;
+
+        // Render thread. Meshes must share `layout`'s stride and attributes;
+        // attribute location kInstanceAttribute is reserved.
+        bool init(const MeshInfo& layout, const Capacity& capacity);
+        // Reports the objects it deletes to `state` when given one.
+        void release(GLStateCache* state = nullptr);
+
+        // Render thread. Return kInvalid when the shared buffers are full or
+        // the layout differs.
+        uint32_t addMesh(const MeshView& mesh);
+        uint32_t addMesh(const void* vertices, uint32_t vertexCount, const uint32_t* indices, uint32_t indexCount);
+        uint32_t addMaterial(const BatchMaterial& material);
+
+        // A flat-shaded program following the interface above: position at
+        // location 0, normal at location 1, params.rgb as the colour.
+        GLuint defaultProgram() const { return m_defaultProgram; }
+        void setCamera(const Mat4& viewProjection);
+
+        // Render thread, before any submit() of the frame. May wait for the
+        // GPU to release the oldest frame's region.
+        void beginFrame();
+        // Any thread, between beginFrame() and record().
+        void submit(uint32_t mesh, uint32_t material, const MeshInstance& instance);
+        // Render thread. The commands read the ring, so execute them before
+        // endFrame().
+        void record(CommandBuffer& bucket, uint32_t pass);
+        void endFrame();
+
+        const Stats& stats() const { return m_stats; }
+
+    private:
+        struct Mesh
+        {
+            uint32_t firstIndex = 0;
+            uint32_t indexCount = 0;
+            int32_t baseVertex = 0;
+        };
+
+        MeshInfo m_layout{};
+        Capacity m_capacity;
+        GLuint m_vertexBuffer = 0;
+        GLuint m_indexBuffer = 0;
+        GLuint m_vertexArray = 0;
+        GLuint m_defaultProgram = 0;
+        uint64_t m_vertexUsed = 0;
+        uint32_t m_indexUsed = 0;
+
+        std::vector<Mesh> m_meshes;
+        std::vector<BatchMaterial> m_materials;
+
+        StagingRing m_ring;
+        GLsizeiptr m_storageAlignment = 4;
+        GLintptr m_instanceOffset = -1;
+        MeshInstance* m_instances = nullptr;
+
+        // (material << 20 | mesh) << 32 | slot, one per submission.
+        std::vector<uint64_t> m_keys;
+        std::vector<uint64_t> m_scratch;
+        std::vector<DrawElementsIndirectCommand> m_commands;
+        std::vector<uint32_t> m_commandMaterials;
+        std::atomic<uint32_t> m_submitted{0};
+
+        Stats m_stats;
+    };
+}
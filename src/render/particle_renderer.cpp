@@ -0,0 +1,196 @@
+#include "render/particle_renderer.hpp"
+
+#include <cstddef>
+#include <cstdio>
+
+#include "render/gl_shader.hpp"
+
+namespace bloom
+{
+    namespace
+    {
+        // Location 0 is left to DrawCommand constants.
+        constexpr GLint kViewLocation = 1;
+        constexpr GLint kProjectionLocation = 2;
+
+        const char* const kParticleVertexShader = R"(#version 450 core
+layout(location = 0) in vec4 a_particle;    // xyz position, w size
+layout(location = 1) in vec4 a_color;
+layout(location = 1) uniform mat4 u_view;
+layout(location = 2) uniform mat4 u_projection;
+out vec2 v_corner;
+out vec4 v_color;
+void main()
+{
+    // Strip order: (-1,-1) (1,-1) (-1,1) (1,1). Expanded in view space so
+    // the quad always faces the camera.
+    v_corner = vec2(gl_VertexID & 1, gl_VertexID >> 1) * 2.0 - 1.0;
+    v_color = a_color;
+    vec4 center = u_view * vec4(a_particle.xyz, 1.0);
+    gl_Position = u_projection * (center + vec4(v_corner * a_particle.w, 0.0, 0.0));
+}
+)";
+
+        const char* const kParticleFragmentShader = R"(#version 450 core
+in vec2 v_corner;
+in vec4 v_color;
+out vec4 o_color;
+void main()
+{
+    float falloff = 1.0 - dot(v_corner, v_corner);
+    if (falloff <= 0.0)
+        discard;
+    // Premultiplied for additive blending.
+    o_color = vec4(v_color.rgb * v_color.a * falloff, 0.0);
+}
+)";
+    }
+
+    GLuint compileParticleProgram()
+    {
+        return compileProgram(kParticleVertexShader, kParticleFragmentShader);
+    }
+
+    GLuint createParticleVertexArray(GLuint instanceBuffer)
+    {
+        GLuint vertexArray = 0;
+        glCreateVertexArrays(1, &vertexArray);
+        glVertexArrayVertexBuffer(vertexArray, 0, instanceBuffer, 0, sizeof(ParticleInstance));
+        glVertexArrayBindingDivisor(vertexArray, 0, 1);
+        glEnableVertexArrayAttrib(vertexArray, 0);
+        glVertexArrayAttribFormat(vertexArray, 0, 4, GL_FLOAT, GL_FALSE, offsetof(ParticleInstance, position));
+        glVertexArrayAttribBinding(vertexArray, 0, 0);
+        glEnableVertexArrayAttrib(vertexArray, 1);
+        glVertexArrayAttribFormat(vertexArray, 1, 4, GL_UNSIGNED_BYTE, GL_TRUE, offsetof(ParticleInstance, color));
+        glVertexArrayAttribBinding(vertexArray, 1, 0);
+        return vertexArray;
+    }
+
+    void setParticleCamera(GLuint program, const Mat4& view, const Mat4& projection)
+    {
+        glProgramUniformMatrix4fv(program, kViewLocation, 1, GL_FALSE, view.data());
+        glProgramUniformMatrix4fv(program, kProjectionLocation, 1, GL_FALSE, projection.data());
+    }
+
+    ParticleRenderer::~ParticleRenderer()
+    {
+        release();
+    }
+
+    bool ParticleRenderer::init(uint32_t capacity)
+    {
+        release();
+
+        m_program = compileParticleProgram();
+        if (!m_program)
+            return false;
+
+        const GLsizeiptr size = static_cast<GLsizeiptr>(capacity) * kRegionCount * sizeof(ParticleInstance);
+        const GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+        glCreateBuffers(1, &m_buffer);
+        glNamedBufferStorage(m_buffer, size, nullptr, flags);
+        m_mapped = static_cast<ParticleInstance*>(glMapNamedBufferRange(m_buffer, 0, size, flags));
+        if (!m_mapped)
+        {
+            std::fprintf(stderr, "Failed to map %u particles\n", capacity);
+            release();
+            return false;
+        }
+
+        m_vertexArray = createParticleVertexArray(m_buffer);
+
+        m_capacity = capacity;
+        m_region = 0;
+        m_count = 0;
+        setCamera(Mat4::identity(), Mat4::identity());
+        return true;
+    }
+
+    void ParticleRenderer::release()
+    {
+        for (GLsync& fence : m_fences)
+        {
+            if (fence)
+                glDeleteSync(fence);
+            fence = nullptr;
+        }
+        if (m_buffer)
+        {
+            glUnmapNamedBuffer(m_buffer);
+            glDeleteBuffers(1, &m_buffer);
+        }
+        if (m_vertexArray)
+            glDeleteVertexArrays(1, &m_vertexArray);
+        if (m_program)
+            glDeleteProgram(m_program);
+
+        m_buffer = 0;
+        m_vertexArray = 0;
+        m_program = 0;
+        m_mapped = nullptr;
+        m_capacity = 0;
+        m_count = 0;
+    }
+
+    std::span<ParticleInstance> ParticleRenderer::begin()
+    {
+        if (!m_mapped)
+            return {};
+
+        GLsync& fence = m_fences[m_region];
+        if (fence)
+        {
+            if (glClientWaitSync(fence, 0, 0) == GL_TIMEOUT_EXPIRED)
+            {
+                ++m_stalls;
+                // Same slicing as FramePacer.
+                GLbitfield flags = GL_SYNC_FLUSH_COMMANDS_BIT;
+                while (glClientWaitSync(fence, flags, 1000000) == GL_TIMEOUT_EXPIRED)
+                    flags = 0;
+            }
+            glDeleteSync(fence);
+            fence = nullptr;
+        }
+
+        m_count = 0;
+        return {m_mapped + static_cast<std::size_t>(m_region) * m_capacity, m_capacity};
+    }
+
+    void ParticleRenderer::end(uint32_t count)
+    {
+        m_count = count < m_capacity ? count : m_capacity;
+    }
+
+    void ParticleRenderer::setCamera(const Mat4& view, const Mat4& projection)
+    {
+        setParticleCamera(m_program, view, projection);
+    }
+
+    DrawCommand ParticleRenderer::draw() const
+    {
+        DrawCommand draw;
+        draw.program = m_program;
+        draw.vertexArray = m_vertexArray;
+        draw.mode = GL_TRIANGLE_STRIP;
+        draw.count = 4;
+        draw.instanceCount = static_cast<GLsizei>(m_count);
+        draw.baseInstance = static_cast<GLuint>(m_region) * m_capacity;
+        draw.state.depthTest = true;
+        draw.state.depthWrite = false;
+        draw.state.blend = BlendMode::Additive;
+        return draw;
+    }
+
+    void ParticleRenderer::endFrame()
+    {
+        if (!m_mapped)
+            return;
+
+        // Still set if begin() was skipped this frame; the new fence covers it.
+        if (m_fences[m_region])
+            glDeleteSync(m_fences[m_region]);
+        m_fences[m_region] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+        m_region = (m_region + 1) % kRegionCount;
+        m_count = 0;
+    }
+}
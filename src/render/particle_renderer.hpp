@@ -0,0 +1,91 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <span>
+
+#include "glad/glad.h"
+
+#include "math/mat4.hpp"
+#include "render/render_commands.hpp"
+
+namespace bloom
+{
+    // One camera-facing quad. 20 bytes, read straight from the mapped buffer
+    // as per-instance attributes.
+    struct ParticleInstance
+    {
+        float position[3];
+        float size;             // half-extent in world units
+        uint32_t color;         // RGBA8, red in the low byte
+    };
+
+    // The quad program and instance layout ParticleRenderer draws with, for
+    // other producers of ParticleInstance arrays. Render thread only.
+    GLuint compileParticleProgram();
+    GLuint createParticleVertexArray(GLuint instanceBuffer);
+    void setParticleCamera(GLuint program, const Mat4& view, const Mat4& projection);
+
+    // Streams CPU-written particles to the GPU without a synchronous upload.
+    //
+    // The instance buffer is immutable storage holding three regions of
+    // `capacity` particles, mapped persistently and coherently once at
+    // init(). Each frame writes one region in place and draws it as
+    // instanced triangle-strip quads, selecting the region with the draw's
+    // base instance; a fence placed after the draw guards the region until
+    // the GPU has read it, three frames later. begin() waits on that fence
+    // only if the GPU has fallen that far behind.
+    //
+    // Per frame, on the render thread:
+    //     std::span<ParticleInstance> out = particles.begin();
+    //     ... fill out[0, n), from any number of jobs ...
+    //     particles.end(n);
+    //     queue.record(key, particles.draw());
+    //     ... execute the queue ...
+    //     particles.endFrame();
+    class ParticleRenderer
+    {
+    public:
+        static constexpr int kRegionCount = 3;
+
+        ParticleRenderer() = default;
+        ~ParticleRenderer();
+
+        ParticleRenderer(const ParticleRenderer&) = delete;
+        ParticleRenderer& operator=(const ParticleRenderer&) = delete;
+
+        bool init(uint32_t capacity);
+        void release();
+
+        uint32_t capacity() const { return m_capacity; }
+
+        // The region to write this frame, `capacity()` particles long. The
+        // memory is write-combined: write it sequentially and never read it.
+        std::span<ParticleInstance> begin();
+        void end(uint32_t count);
+
+        void setCamera(const Mat4& view, const Mat4& projection);
+
+        // Additive, depth-tested and not depth-writing. Empty (count 0)
+        // until end().
+        DrawCommand draw() const;
+
+        // After the draw has been submitted.
+        void endFrame();
+
+        // begin() calls that had to wait on the GPU.
+        uint64_t stalls() const { return m_stalls; }
+
+    private:
+        GLuint m_program = 0;
+        GLuint m_vertexArray = 0;
+        GLuint m_buffer = 0;
+        ParticleInstance* m_mapped = nullptr;
+        uint32_t m_capacity = 0;
+
+        std::array<GLsync, kRegionCount> m_fences{};
+        int m_region = 0;
+        uint32_t m_count = 0;
+        uint64_t m_stalls = 0;
+    };
+}
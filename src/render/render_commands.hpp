@@ -0,0 +1,153 @@
+#pragma once
+
+#include <cstdint>
+
+#include "glad/glad.h"
+
+namespace bloom
+{
+    enum class CommandType : uint8_t
+    {
+        Clear,
+        Draw,
+        Dispatch,
+    };
+
+    enum class BlendMode : uint8_t
+    {
+        Opaque,
+        Alpha,
+        Additive,
+    };
+
+    enum class CullMode : uint8_t
+    {
+        None,
+        Back,
+        Front,
+    };
+
+    // Fixed-function state a draw needs. Applied by the backend before the
+    // draw call; redundant changes are filtered out there.
+    struct RenderState
+    {
+        bool depthTest = false;
+        bool depthWrite = true;
+        BlendMode blend = BlendMode::Opaque;
+        CullMode cull = CullMode::None;
+    };
+
+    // A buffer bound to an indexed binding point. size 0 binds the whole
+    // buffer (glBindBufferBase), anything else the range (glBindBufferRange).
+    struct BufferRange
+    {
+        GLuint buffer = 0;
+        GLintptr offset = 0;
+        GLsizeiptr size = 0;
+    };
+
+    struct ClearCommand
+    {
+        static constexpr CommandType kType = CommandType::Clear;
+
+        GLbitfield mask = GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT;
+        float color[4] = {0.f, 0.f, 0.f, 1.f};
+        float depth = 1.f;
+    };
+
+    struct DrawCommand
+    {
+        static constexpr CommandType kType = CommandType::Draw;
+        static constexpr int kMaxTextures = 4;
+        static constexpr int kMaxStorageBuffers = 4;
+        static constexpr int kMaxUniformBuffers = 2;
+
+        GLuint program = 0;
+        GLuint vertexArray = 0;
+        GLenum mode = GL_TRIANGLES;
+        // GL_NONE draws arrays; otherwise the element type of the bound
+        // index buffer, and `first` is the first index.
+        GLenum indexType = GL_NONE;
+        GLint first = 0;
+        GLsizei count = 0;
+        GLsizei instanceCount = 1;
+        GLint baseVertex = 0;
+        GLuint baseInstance = 0;
+
+        RenderState state;
+        GLuint textures[kMaxTextures] = {};
+        // Bound to shader storage binding i when `buffer` is non-zero.
+        BufferRange storageBuffers[kMaxStorageBuffers];
+        // Bound to uniform block binding i the same way; see UniformRing.
+        BufferRange uniformBuffers[kMaxUniformBuffers];
+
+        // Small per-draw constant block, uploaded to uniform location 0 as a
+        // vec4 when `hasConstants` is set.
+        bool hasConstants = false;
+        float constants[4] = {};
+
+        // When set, the draw parameters are read by the GPU from this
+        // buffer at `indirectOffset` (a DrawArraysIndirectCommand, or a
+        // DrawElementsIndirectCommand for indexed draws) and first, count,
+        // instanceCount, baseVertex and baseInstance are ignored. More than
+        // one `drawCount` issues a multi-draw over consecutive, tightly
+        // packed commands.
+        GLuint indirectBuffer = 0;
+        GLintptr indirectOffset = 0;
+        GLsizei drawCount = 1;
+    };
+
+    // Layouts glDrawArraysIndirect and glDrawElementsIndirect read.
+    struct DrawArraysIndirectCommand
+    {
+        GLuint count = 0;
+        GLuint instanceCount = 0;
+        GLuint first = 0;
+        GLuint baseInstance = 0;
+    };
+
+    struct DrawElementsIndirectCommand
+    {
+        GLuint count = 0;
+        GLuint instanceCount = 0;
+        GLuint firstIndex = 0;
+        GLint baseVertex = 0;
+        GLuint baseInstance = 0;
+    };
+
+    // An image unit binding for load/store; `format` must match the
+    // shader's layout qualifier.
+    struct ImageBinding
+    {
+        GLuint texture = 0;
+        GLint level = 0;
+        GLenum access = GL_READ_WRITE;
+        GLenum format = GL_RGBA16F;
+    };
+
+    struct DispatchCommand
+    {
+        static constexpr CommandType kType = CommandType::Dispatch;
+        static constexpr int kMaxStorageBuffers = 4;
+        static constexpr int kMaxTextures = 4;
+        static constexpr int kMaxImages = 8;
+        static constexpr int kMaxUniformBuffers = 2;
+
+        GLuint program = 0;
+        GLuint groups[3] = {1, 1, 1};
+        // Issued with glMemoryBarrier after the dispatch, if non-zero.
+        GLbitfield barrier = 0;
+
+        // Bound as for DrawCommand.
+        BufferRange storageBuffers[kMaxStorageBuffers];
+        BufferRange uniformBuffers[kMaxUniformBuffers];
+        // Bound to texture unit i when non-zero.
+        GLuint textures[kMaxTextures] = {};
+        // Bound to image unit i when the texture is non-zero.
+        ImageBinding images[kMaxImages];
+
+        // Same as DrawCommand::constants.
+        bool hasConstants = false;
+        float constants[4] = {};
+    };
+}
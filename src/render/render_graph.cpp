@@ -0,0 +1,692 @@
+#include "render/render_graph.hpp"
+
+#include <algorithm>
+#include <cstdio>
+
+#include "render/sort_key.hpp"
+
+namespace bloom
+{
+    namespace
+    {
+        bool incoherent(bool texture, uint8_t access)
+        {
+            return texture ? access == static_cast<uint8_t>(TextureAccess::Image)
+                           : access == static_cast<uint8_t>(BufferAccess::Storage);
+        }
+
+        // The barrier that makes earlier image or storage writes visible to
+        // this kind of access.
+        GLbitfield barrierFor(bool texture, uint8_t access)
+        {
+            if (texture)
+            {
+                switch (static_cast<TextureAccess>(access))
+                {
+                case TextureAccess::Sampled: return GL_TEXTURE_FETCH_BARRIER_BIT;
+                case TextureAccess::Image: return GL_SHADER_IMAGE_ACCESS_BARRIER_BIT;
+                case TextureAccess::ColorTarget:
+                case TextureAccess::DepthTarget: return GL_FRAMEBUFFER_BARRIER_BIT;
+                }
+                return 0;
+            }
+            switch (static_cast<BufferAccess>(access))
+            {
+            case BufferAccess::Storage: return GL_SHADER_STORAGE_BARRIER_BIT;
+            case BufferAccess::Uniform: return GL_UNIFORM_BARRIER_BIT;
+            case BufferAccess::Indirect: return GL_COMMAND_BARRIER_BIT;
+            case BufferAccess::Vertex: return GL_VERTEX_ATTRIB_ARRAY_BARRIER_BIT;
+            case BufferAccess::Index: return GL_ELEMENT_ARRAY_BARRIER_BIT;
+            }
+            return 0;
+        }
+
+        bool hasStencil(GLenum format)
+        {
+            return format == GL_DEPTH24_STENCIL8 || format == GL_DEPTH32F_STENCIL8;
+        }
+
+        uint32_t bytesPerTexel(GLenum format)
+        {
+            switch (format)
+            {
+            case GL_R8:
+                return 1;
+            case GL_RG8:
+            case GL_R16F:
+            case GL_DEPTH_COMPONENT16:
+                return 2;
+            case GL_RGBA16F:
+            case GL_RG32F:
+            case GL_DEPTH32F_STENCIL8:
+                return 8;
+            case GL_RGBA32F:
+                return 16;
+            default:
+                // RGBA8, RGB10_A2, R11F_G11F_B10F, R32F, RG16F, 24/32-bit depth.
+                return 4;
+            }
+        }
+    }
+
+    uint64_t PassContext::key(uint32_t shader, uint32_t material, uint32_t depth) const
+    {
+        return SortKey::encode(pass, shader, material, depth);
+    }
+
+    GLuint PassContext::texture(GraphTexture texture) const
+    {
+        return graph->texture(texture);
+    }
+
+    GLuint PassContext::buffer(GraphBuffer buffer) const
+    {
+        return graph->buffer(buffer);
+    }
+
+    RenderGraph::~RenderGraph()
+    {
+        release();
+    }
+
+    void RenderGraph::reset(int backbufferWidth, int backbufferHeight)
+    {
+        m_backbufferWidth = backbufferWidth;
+        m_backbufferHeight = backbufferHeight;
+        m_compiled = false;
+        m_textures.clear();
+        m_buffers.clear();
+        m_passes.clear();
+        m_uses.clear();
+        m_order.clear();
+        m_textureSlots.clear();
+        m_bufferSlots.clear();
+        m_stats = {};
+    }
+
+    void RenderGraph::release()
+    {
+        for (Framebuffer& framebuffer : m_framebuffers)
+            glDeleteFramebuffers(1, &framebuffer.object);
+        for (PooledTexture& texture : m_texturePool)
+            glDeleteTextures(1, &texture.object);
+        for (PooledBuffer& buffer : m_bufferPool)
+            glDeleteBuffers(1, &buffer.object);
+        m_framebuffers.clear();
+        m_texturePool.clear();
+        m_bufferPool.clear();
+        reset(0, 0);
+    }
+
+    GraphTexture RenderGraph::createTexture(const char* name, const GraphTextureDesc& desc)
+    {
+        Texture texture;
+        texture.name = name;
+        texture.desc = desc;
+        m_textures.push_back(texture);
+        return {static_cast<uint32_t>(m_textures.size() - 1)};
+    }
+
+    GraphTexture RenderGraph::importTexture(const char* name, GLuint object, const GraphTextureDesc& desc)
+    {
+        const GraphTexture texture = createTexture(name, desc);
+        m_textures[texture.index].imported = object;
+        return texture;
+    }
+
+    GraphBuffer RenderGraph::createBuffer(const char* name, GLsizeiptr size)
+    {
+        Buffer buffer;
+        buffer.name = name;
+        buffer.size = size;
+        m_buffers.push_back(buffer);
+        return {static_cast<uint32_t>(m_buffers.size() - 1)};
+    }
+
+    GraphBuffer RenderGraph::importBuffer(const char* name, GLuint object, GLsizeiptr size)
+    {
+        const GraphBuffer buffer = createBuffer(name, size);
+        m_buffers[buffer.index].imported = object;
+        return buffer;
+    }
+
+    uint32_t RenderGraph::addPass(const char* name, PassKind kind, PassExecute execute, void* user)
+    {
+        Pass pass;
+        pass.name = name;
+        pass.kind = kind;
+        pass.execute = execute;
+        pass.user = user;
+        m_passes.push_back(pass);
+        return static_cast<uint32_t>(m_passes.size() - 1);
+    }
+
+    void RenderGraph::markOutput(uint32_t pass)
+    {
+        m_passes[pass].output = true;
+    }
+
+    void RenderGraph::read(uint32_t pass, GraphTexture texture, TextureAccess access, int level)
+    {
+        addUse(pass, texture.index, static_cast<uint8_t>(access), true, false, level);
+    }
+
+    void RenderGraph::write(uint32_t pass, GraphTexture texture, TextureAccess access, int level)
+    {
+        addUse(pass, texture.index, static_cast<uint8_t>(access), true, true, level);
+    }
+
+    void RenderGraph::read(uint32_t pass, GraphBuffer buffer, BufferAccess access)
+    {
+        addUse(pass, buffer.index, static_cast<uint8_t>(access), false, false, 0);
+    }
+
+    void RenderGraph::write(uint32_t pass, GraphBuffer buffer, BufferAccess access)
+    {
+        addUse(pass, buffer.index, static_cast<uint8_t>(access), false, true, 0);
+    }
+
+    void RenderGraph::addUse(uint32_t pass, uint32_t resource, uint8_t access, bool texture, bool write, int level)
+    {
+        Use use;
+        use.pass = pass;
+        use.resource = resource;
+        use.access = access;
+        use.texture = texture;
+        use.write = write;
+        use.level = level;
+        m_uses.push_back(use);
+    }
+
+    bool RenderGraph::compile()
+    {
+        // Group the uses by pass; declarations may interleave.
+        for (Pass& pass : m_passes)
+            pass.useCount = 0;
+        for (const Use& use : m_uses)
+            ++m_passes[use.pass].useCount;
+        uint32_t offset = 0;
+        for (Pass& pass : m_passes)
+        {
+            pass.firstUse = offset;
+            offset += pass.useCount;
+            pass.useCount = 0;
+        }
+        m_passUses.resize(m_uses.size());
+        for (uint32_t i = 0; i < m_uses.size(); ++i)
+        {
+            Pass& pass = m_passes[m_uses[i].pass];
+            m_passUses[pass.firstUse + pass.useCount++] = i;
+        }
+
+        if (!resolveDependencies())
+            return false;
+        cull();
+
+        m_order.clear();
+        for (uint32_t pass = 0; pass < m_passes.size(); ++pass)
+        {
+            if (m_passes[pass].live)
+                m_order.push_back(pass);
+        }
+        computeBarriers();
+        assignSlots();
+
+        m_stats.passes = static_cast<uint32_t>(m_order.size());
+        m_stats.culled = static_cast<uint32_t>(m_passes.size() - m_order.size());
+        m_compiled = true;
+        return true;
+    }
+
+    bool RenderGraph::resolveDependencies()
+    {
+        // Last writer of every resource as the passes run in declaration
+        // order. Reads see the writer before their own pass; writes record
+        // the one they replace, which only matters for barriers.
+        // Textures first, then buffers.
+        m_writers.assign(m_textures.size() + m_buffers.size(), Writer{});
+
+        for (uint32_t p = 0; p < m_passes.size(); ++p)
+        {
+            const Pass& pass = m_passes[p];
+            int colorTargets = 0;
+            for (int writes = 0; writes < 2; ++writes)
+            {
+                for (uint32_t k = 0; k < pass.useCount; ++k)
+                {
+                    Use& use = m_uses[m_passUses[pass.firstUse + k]];
+                    if (use.write != (writes == 1))
+                        continue;
+
+                    Writer& writer = m_writers[use.texture ? use.resource : m_textures.size() + use.resource];
+                    use.producer = writer.pass;
+                    use.producerAccess = writer.access;
+                    if (use.write)
+                    {
+                        writer = {p, use.access};
+                        if (use.texture && use.access == static_cast<uint8_t>(TextureAccess::ColorTarget))
+                            ++colorTargets;
+                        continue;
+                    }
+
+                    const bool imported = use.texture ? m_textures[use.resource].imported != 0 : m_buffers[use.resource].imported != 0;
+                    if (writer.pass == kNone && !imported)
+                    {
+                        std::fprintf(stderr, "Render graph: pass %s reads %s before any pass writes it\n", pass.name,
+                                     use.texture ? m_textures[use.resource].name : m_buffers[use.resource].name);
+                        return false;
+                    }
+                }
+            }
+            if (colorTargets > kMaxColorTargets)
+            {
+                std::fprintf(stderr, "Render graph: pass %s writes %d color targets, at most %d fit\n", pass.name, colorTargets,
+                             kMaxColorTargets);
+                return false;
+            }
+        }
+        return true;
+    }
+
+    void RenderGraph::cull()
+    {
+        // Roots are outputs and writers of imported resources; everything
+        // else lives only if a live pass reads what it wrote.
+        m_stack.clear();
+        for (uint32_t p = 0; p < m_passes.size(); ++p)
+        {
+            Pass& pass = m_passes[p];
+            pass.live = pass.output;
+            for (uint32_t k = 0; k < pass.useCount && !pass.live; ++k)
+            {
+                const Use& use = m_uses[m_passUses[pass.firstUse + k]];
+                if (use.write)
+                    pass.live = use.texture ? m_textures[use.resource].imported != 0 : m_buffers[use.resource].imported != 0;
+            }
+            if (pass.live)
+                m_stack.push_back(p);
+        }
+
+        while (!m_stack.empty())
+        {
+            const Pass& pass = m_passes[m_stack.back()];
+            m_stack.pop_back();
+            for (uint32_t k = 0; k < pass.useCount; ++k)
+            {
+                const Use& use = m_uses[m_passUses[pass.firstUse + k]];
+                if (use.write || use.producer == kNone || m_passes[use.producer].live)
+                    continue;
+                m_passes[use.producer].live = true;
+                m_stack.push_back(use.producer);
+            }
+        }
+    }
+
+    void RenderGraph::computeBarriers()
+    {
+        for (uint32_t p : m_order)
+        {
+            Pass& pass = m_passes[p];
+            pass.barrier = 0;
+            for (uint32_t k = 0; k < pass.useCount; ++k)
+            {
+                const Use& use = m_uses[m_passUses[pass.firstUse + k]];
+                if (use.producer != kNone && use.producer != p && m_passes[use.producer].live &&
+                    incoherent(use.texture, use.producerAccess))
+                    pass.barrier |= barrierFor(use.texture, use.access);
+            }
+            if (pass.barrier)
+                ++m_stats.barriers;
+        }
+    }
+
+    void RenderGraph::assignSlots()
+    {
+        for (uint32_t position = 0; position < m_order.size(); ++position)
+        {
+            const Pass& pass = m_passes[m_order[position]];
+            for (uint32_t k = 0; k < pass.useCount; ++k)
+            {
+                const Use& use = m_uses[m_passUses[pass.firstUse + k]];
+                uint32_t& first = use.texture ? m_textures[use.resource].firstUse : m_buffers[use.resource].firstUse;
+                uint32_t& last = use.texture ? m_textures[use.resource].lastUse : m_buffers[use.resource].lastUse;
+                first = std::min(first, position);
+                last = std::max(last, position);
+            }
+        }
+
+        // Textures and buffers share m_starts: bit 31 of the low word marks
+        // a buffer.
+        constexpr uint32_t kBufferBit = 1u << 31;
+        m_starts.clear();
+        for (uint32_t i = 0; i < m_textures.size(); ++i)
+        {
+            if (!m_textures[i].imported && m_textures[i].firstUse != kNone)
+                m_starts.push_back(uint64_t{m_textures[i].firstUse} << 32 | i);
+        }
+        for (uint32_t i = 0; i < m_buffers.size(); ++i)
+        {
+            if (!m_buffers[i].imported && m_buffers[i].firstUse != kNone)
+                m_starts.push_back(uint64_t{m_buffers[i].firstUse} << 32 | i | kBufferBit);
+        }
+        std::sort(m_starts.begin(), m_starts.end());
+
+        // Greedy in order of first use. A slot whose last user ran before
+        // this resource's first use is free; for buffers prefer the smallest
+        // one that fits, else grow the largest free one.
+        for (uint64_t start : m_starts)
+        {
+            const auto position = static_cast<uint32_t>(start >> 32);
+            const auto low = static_cast<uint32_t>(start);
+            if (low & kBufferBit)
+            {
+                Buffer& buffer = m_buffers[low & ~kBufferBit];
+                uint32_t best = kNone;
+                for (uint32_t s = 0; s < m_bufferSlots.size(); ++s)
+                {
+                    const BufferSlot& slot = m_bufferSlots[s];
+                    if (slot.freeAfter >= position)
+                        continue;
+                    if (best == kNone)
+                    {
+                        best = s;
+                        continue;
+                    }
+                    const BufferSlot& current = m_bufferSlots[best];
+                    const bool fits = slot.size >= buffer.size;
+                    const bool currentFits = current.size >= buffer.size;
+                    if ((fits && (!currentFits || slot.size < current.size)) || (!fits && !currentFits && slot.size > current.size))
+                        best = s;
+                }
+                if (best == kNone)
+                {
+                    best = static_cast<uint32_t>(m_bufferSlots.size());
+                    m_bufferSlots.push_back({});
+                }
+                BufferSlot& slot = m_bufferSlots[best];
+                slot.size = std::max(slot.size, buffer.size);
+                slot.freeAfter = buffer.lastUse;
+                buffer.slot = best;
+                ++m_stats.transientBuffers;
+                m_stats.transientBytes += static_cast<uint64_t>(buffer.size);
+            }
+            else
+            {
+                Texture& texture = m_textures[low];
+                uint32_t best = kNone;
+                for (uint32_t s = 0; s < m_textureSlots.size() && best == kNone; ++s)
+                {
+                    if (m_textureSlots[s].freeAfter < position && m_textureSlots[s].desc == texture.desc)
+                        best = s;
+                }
+                if (best == kNone)
+                {
+                    best = static_cast<uint32_t>(m_textureSlots.size());
+                    m_textureSlots.push_back({texture.desc, 0, 0});
+                    m_stats.allocatedBytes += textureBytes(texture.desc);
+                }
+                m_textureSlots[best].freeAfter = texture.lastUse;
+                texture.slot = best;
+                ++m_stats.transientTextures;
+                m_stats.transientBytes += textureBytes(texture.desc);
+            }
+        }
+
+        for (const BufferSlot& slot : m_bufferSlots)
+            m_stats.allocatedBytes += static_cast<uint64_t>(slot.size);
+        m_stats.textureSlots = static_cast<uint32_t>(m_textureSlots.size());
+        m_stats.bufferSlots = static_cast<uint32_t>(m_bufferSlots.size());
+    }
+
+    uint32_t RenderGraph::execute(RenderQueue& queue, GLBackend& backend, uint32_t firstPass)
+    {
+        if (!m_compiled)
+            return firstPass;
+        if (firstPass + m_order.size() > GLBackend::kMaxPasses)
+        {
+            std::fprintf(stderr, "Render graph: %zu passes from pass %u do not fit the sort key\n", m_order.size(), firstPass);
+            return firstPass;
+        }
+
+        ++m_frame;
+        bindPool();
+
+        CommandBuffer& commands = queue.acquireBucket();
+        for (uint32_t position = 0; position < m_order.size(); ++position)
+        {
+            const Pass& pass = m_passes[m_order[position]];
+
+            Attachment colors[kMaxColorTargets];
+            Attachment depth;
+            int colorCount = 0;
+            int width = m_backbufferWidth;
+            int height = m_backbufferHeight;
+            if (pass.kind == PassKind::Graphics)
+            {
+                // Targets a pass reads are blended or depth-tested against,
+                // so they are attached just like the ones it writes.
+                for (uint32_t k = 0; k < pass.useCount; ++k)
+                {
+                    const Use& use = m_uses[m_passUses[pass.firstUse + k]];
+                    const auto access = static_cast<TextureAccess>(use.access);
+                    if (!use.texture || (access != TextureAccess::ColorTarget && access != TextureAccess::DepthTarget))
+                        continue;
+
+                    const Attachment attachment{texture({use.resource}), use.level};
+                    if (access == TextureAccess::DepthTarget)
+                        depth = attachment;
+                    else if (std::find(colors, colors + colorCount, attachment) == colors + colorCount)
+                        colors[colorCount++] = attachment;
+
+                    const GraphTextureDesc& desc = m_textures[use.resource].desc;
+                    width = std::max(desc.width >> use.level, 1);
+                    height = std::max(desc.height >> use.level, 1);
+                }
+            }
+
+            PassDesc desc;
+            desc.framebuffer = colorCount > 0 || depth.texture ? framebufferFor(colors, colorCount, depth) : 0;
+            desc.viewport[2] = pass.kind == PassKind::Graphics ? width : 0;
+            desc.viewport[3] = pass.kind == PassKind::Graphics ? height : 0;
+            desc.barrier = pass.barrier;
+            desc.name = pass.name;
+            backend.setPass(firstPass + position, desc);
+
+            if (pass.execute)
+            {
+                PassContext context;
+                context.graph = this;
+                context.queue = &queue;
+                context.commands = &commands;
+                context.pass = firstPass + position;
+                context.width = width;
+                context.height = height;
+                pass.execute(context, pass.user);
+            }
+        }
+
+        trimPool(backend.state());
+        return firstPass + static_cast<uint32_t>(m_order.size());
+    }
+
+    GLuint RenderGraph::texture(GraphTexture handle) const
+    {
+        const Texture& texture = m_textures[handle.index];
+        if (texture.imported)
+            return texture.imported;
+        return texture.slot != kNone ? m_textureSlots[texture.slot].object : 0;
+    }
+
+    GLuint RenderGraph::buffer(GraphBuffer handle) const
+    {
+        const Buffer& buffer = m_buffers[handle.index];
+        if (buffer.imported)
+            return buffer.imported;
+        return buffer.slot != kNone ? m_bufferSlots[buffer.slot].object : 0;
+    }
+
+    uint64_t RenderGraph::textureBytes(const GraphTextureDesc& desc)
+    {
+        uint64_t bytes = 0;
+        for (int level = 0; level < desc.levels; ++level)
+        {
+            const auto width = static_cast<uint64_t>(std::max(desc.width >> level, 1));
+            const auto height = static_cast<uint64_t>(std::max(desc.height >> level, 1));
+            bytes += width * height * bytesPerTexel(desc.format);
+        }
+        return bytes;
+    }
+
+    void RenderGraph::bindPool()
+    {
+        for (TextureSlot& slot : m_textureSlots)
+        {
+            PooledTexture* match = nullptr;
+            for (PooledTexture& pooled : m_texturePool)
+            {
+                if (pooled.lastFrame != m_frame && pooled.desc == slot.desc)
+                {
+                    match = &pooled;
+                    break;
+                }
+            }
+            if (!match)
+            {
+                PooledTexture pooled;
+                pooled.desc = slot.desc;
+                glCreateTextures(GL_TEXTURE_2D, 1, &pooled.object);
+                glTextureStorage2D(pooled.object, slot.desc.levels, slot.desc.format, slot.desc.width, slot.desc.height);
+                glTextureParameteri(pooled.object, GL_TEXTURE_MIN_FILTER, slot.desc.levels > 1 ? GL_LINEAR_MIPMAP_LINEAR : GL_LINEAR);
+                glTextureParameteri(pooled.object, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+                glTextureParameteri(pooled.object, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+                glTextureParameteri(pooled.object, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+                glTextureParameteri(pooled.object, GL_TEXTURE_MAX_LEVEL, slot.desc.levels - 1);
+                m_texturePool.push_back(pooled);
+                match = &m_texturePool.back();
+            }
+            match->lastFrame = m_frame;
+            slot.object = match->object;
+        }
+
+        for (BufferSlot& slot : m_bufferSlots)
+        {
+            PooledBuffer* match = nullptr;
+            for (PooledBuffer& pooled : m_bufferPool)
+            {
+                if (pooled.lastFrame != m_frame && pooled.size >= slot.size && (!match || pooled.size < match->size))
+                    match = &pooled;
+            }
+            if (!match)
+            {
+                PooledBuffer pooled;
+                pooled.size = slot.size;
+                glCreateBuffers(1, &pooled.object);
+                glNamedBufferStorage(pooled.object, slot.size, nullptr, 0);
+                m_bufferPool.push_back(pooled);
+                match = &m_bufferPool.back();
+            }
+            match->lastFrame = m_frame;
+            slot.object = match->object;
+        }
+    }
+
+    GLuint RenderGraph::framebufferFor(const Attachment* colors, int colorCount, const Attachment& depth)
+    {
+        Framebuffer key;
+        std::copy(colors, colors + colorCount, key.colors);
+        key.depth = depth;
+        for (Framebuffer& framebuffer : m_framebuffers)
+        {
+            if (std::equal(key.colors, key.colors + kMaxColorTargets, framebuffer.colors) && framebuffer.depth == key.depth)
+            {
+                framebuffer.lastFrame = m_frame;
+                return framebuffer.object;
+            }
+        }
+
+        glCreateFramebuffers(1, &key.object);
+        GLenum drawBuffers[kMaxColorTargets];
+        for (int i = 0; i < colorCount; ++i)
+        {
+            glNamedFramebufferTexture(key.object, GL_COLOR_ATTACHMENT0 + i, colors[i].texture, colors[i].level);
+            drawBuffers[i] = GL_COLOR_ATTACHMENT0 + i;
+        }
+        if (colorCount > 0)
+            glNamedFramebufferDrawBuffers(key.object, colorCount, drawBuffers);
+        else
+            glNamedFramebufferDrawBuffer(key.object, GL_NONE);
+
+        if (depth.texture)
+        {
+            GLenum format = GL_DEPTH_COMPONENT24;
+            for (const PooledTexture& pooled : m_texturePool)
+            {
+                if (pooled.object == depth.texture)
+                    format = pooled.desc.format;
+            }
+            glNamedFramebufferTexture(key.object, hasStencil(format) ? GL_DEPTH_STENCIL_ATTACHMENT : GL_DEPTH_ATTACHMENT,
+                                      depth.texture, depth.level);
+        }
+
+        const GLenum status = glCheckNamedFramebufferStatus(key.object, GL_DRAW_FRAMEBUFFER);
+        if (status != GL_FRAMEBUFFER_COMPLETE)
+            std::fprintf(stderr, "Render graph: framebuffer incomplete (0x%x)\n", status);
+
+        key.lastFrame = m_frame;
+        m_framebuffers.push_back(key);
+        return key.object;
+    }
+
+    void RenderGraph::trimPool(GLStateCache& state)
+    {
+        const auto idle = [this](uint64_t lastFrame) { return lastFrame + kIdleFrames < m_frame; };
+
+        std::size_t kept = 0;
+        for (PooledTexture& pooled : m_texturePool)
+        {
+            if (!idle(pooled.lastFrame))
+            {
+                m_texturePool[kept++] = pooled;
+                continue;
+            }
+            // Framebuffers with this attachment go with it.
+            for (Framebuffer& framebuffer : m_framebuffers)
+            {
+                const bool attached = framebuffer.depth.texture == pooled.object ||
+                                      std::any_of(framebuffer.colors, framebuffer.colors + kMaxColorTargets,
+                                                  [&](const Attachment& color) { return color.texture == pooled.object; });
+                if (attached)
+                    framebuffer.lastFrame = 0;
+            }
+            state.forgetTexture(pooled.object);
+            glDeleteTextures(1, &pooled.object);
+        }
+        m_texturePool.resize(kept);
+
+        kept = 0;
+        for (PooledBuffer& pooled : m_bufferPool)
+        {
+            if (!idle(pooled.lastFrame))
+            {
+                m_bufferPool[kept++] = pooled;
+                continue;
+            }
+            state.forgetBuffer(pooled.object);
+            glDeleteBuffers(1, &pooled.object);
+        }
+        m_bufferPool.resize(kept);
+
+        kept = 0;
+        for (Framebuffer& framebuffer : m_framebuffers)
+        {
+            if (framebuffer.lastFrame != 0 && !idle(framebuffer.lastFrame))
+            {
+                m_framebuffers[kept++] = framebuffer;
+                continue;
+            }
+            state.forgetFramebuffer(framebuffer.object);
+            glDeleteFramebuffers(1, &framebuffer.object);
+        }
+        m_framebuffers.resize(kept);
+    }
+}
@@ -0,0 +1,310 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "glad/glad.h"
+
+#include "render/gl_backend.hpp"
+#include "render/render_queue.hpp"
+
+namespace bloom
+{
+    struct GraphTexture
+    {
+        uint32_t index = ~0u;
+        bool valid() const { return index != ~0u; }
+    };
+
+    struct GraphBuffer
+    {
+        uint32_t index = ~0u;
+        bool valid() const { return index != ~0u; }
+    };
+
+    struct GraphTextureDesc
+    {
+        int width = 0;
+        int height = 0;
+        GLenum format = GL_RGBA8;
+        int levels = 1;
+
+        bool operator==(const GraphTextureDesc&) const = default;
+    };
+
+    enum class PassKind : uint8_t
+    {
+        Graphics,
+        Compute,
+    };
+
+    // How a pass touches a texture. Image and Storage accesses are shader
+    // writes GL does not order on its own; anything that consumes them gets
+    // a glMemoryBarrier.
+    enum class TextureAccess : uint8_t
+    {
+        Sampled,
+        Image,
+        ColorTarget,
+        DepthTarget,
+    };
+
+    enum class BufferAccess : uint8_t
+    {
+        Storage,
+        Uniform,
+        Indirect,
+        Vertex,
+        Index,
+    };
+
+    class RenderGraph;
+
+    // What a pass's execute callback gets. Commands recorded into
+    // `commands` with key() land in this pass's sort-key range; passes that
+    // want to record from jobs can acquire more buckets from `queue`.
+    struct PassContext
+    {
+        const RenderGraph* graph = nullptr;
+        RenderQueue* queue = nullptr;
+        CommandBuffer* commands = nullptr;
+        uint32_t pass = 0;      // sort-key pass
+        int width = 0;          // render target size, or the backbuffer's
+        int height = 0;
+
+        uint64_t key(uint32_t shader = 0, uint32_t material = 0, uint32_t depth = 0) const;
+        GLuint texture(GraphTexture texture) const;
+        GLuint buffer(GraphBuffer buffer) const;
+    };
+
+    using PassExecute = void (*)(const PassContext& context, void* user);
+
+    // A frame graph over the command layer.
+    //
+    // Each frame, passes are declared together with the textures and
+    // buffers they read and write; resources are either transient (created
+    // by the graph, alive for the frame) or imported GL objects. compile()
+    // then works out the frame from those declarations alone:
+    //
+    //   - culling: passes whose results nothing reads are dropped, walking
+    //     back from passes marked as outputs and from writes to imported
+    //     resources;
+    //   - order: the surviving passes keep their declaration order, which
+    //     is what read/write dependencies are defined against;
+    //   - barriers: a read of something an earlier pass wrote through an
+    //     image or storage buffer gets the matching glMemoryBarrier bits,
+    //     issued by the backend as the pass begins;
+    //   - aliasing: transient resources are given slots in execution order
+    //     and a slot is free again after its last reader, so resources whose
+    //     lifetimes do not overlap share one allocation. GL cannot place two
+    //     textures in the same memory, so texture slots are shared by
+    //     targets of identical size and format; buffer slots take any
+    //     transient buffer that fits and grow to the largest.
+    //
+    // execute() binds the slots to pooled GL objects that persist across
+    // frames, builds (and caches) a framebuffer for every graphics pass's
+    // targets, sets the backend's pass descriptions and runs the execute
+    // callbacks in order. Sorting and executing the queue stay with the
+    // caller, as for any other recording. Render thread only.
+    //
+    // GLFW's examples/offscreen.c is the hand-managed case the graph
+    // replaces: it sets up the one framebuffer it draws into itself and
+    // reads it back. Here that is a graphics pass writing a target, with
+    // the framebuffer built and cached by execute().
+    class RenderGraph
+    {
+    public:
+        static constexpr int kMaxColorTargets = 4;
+        // Pooled objects no frame has used for this long are deleted.
+        static constexpr uint64_t kIdleFrames = 60;
+
+        struct Stats
+        {
+            uint32_t passes = 0;
+            uint32_t culled = 0;
+            uint32_t barriers = 0;          // passes that begin with a barrier
+            uint32_t transientTextures = 0;
+            uint32_t textureSlots = 0;
+            uint32_t transientBuffers = 0;
+            uint32_t bufferSlots = 0;
+            uint64_t transientBytes = 0;    // if nothing were aliased
+            uint64_t allocatedBytes = 0;    // what the slots need
+        };
+
+        RenderGraph() = default;
+        ~RenderGraph();
+
+        RenderGraph(const RenderGraph&) = delete;
+        RenderGraph& operator=(const RenderGraph&) = delete;
+
+        // Starts a new frame's declarations; keeps the pool.
+        void reset(int backbufferWidth, int backbufferHeight);
+        void release();
+
+        GraphTexture createTexture(const char* name, const GraphTextureDesc& desc);
+        GraphTexture importTexture(const char* name, GLuint texture, const GraphTextureDesc& desc);
+        GraphBuffer createBuffer(const char* name, GLsizeiptr size);
+        GraphBuffer importBuffer(const char* name, GLuint buffer, GLsizeiptr size);
+
+        uint32_t addPass(const char* name, PassKind kind, PassExecute execute, void* user);
+        // Keeps the pass alive even if nothing reads what it writes, e.g. a
+        // graphics pass drawing to the backbuffer (one without targets).
+        void markOutput(uint32_t pass);
+
+        // `level` is the mip level a target or image access uses.
+        void read(uint32_t pass, GraphTexture texture, TextureAccess access, int level = 0);
+        void write(uint32_t pass, GraphTexture texture, TextureAccess access, int level = 0);
+        void read(uint32_t pass, GraphBuffer buffer, BufferAccess access);
+        void write(uint32_t pass, GraphBuffer buffer, BufferAccess access);
+
+        // Fails, printing why, on a read of a transient nothing wrote or on
+        // too many targets.
+        bool compile();
+        // Records the frame into `queue`, with sort-key passes from
+        // `firstPass` on. Returns the first sort-key pass left unused.
+        uint32_t execute(RenderQueue& queue, GLBackend& backend, uint32_t firstPass);
+
+        const Stats& stats() const { return m_stats; }
+        // Live passes in execution order, valid after compile().
+        const std::vector<uint32_t>& order() const { return m_order; }
+        const char* passName(uint32_t pass) const { return m_passes[pass].name; }
+        GLbitfield passBarrier(uint32_t pass) const { return m_passes[pass].barrier; }
+
+        GLuint texture(GraphTexture texture) const;
+        GLuint buffer(GraphBuffer buffer) const;
+        const GraphTextureDesc& textureDesc(GraphTexture texture) const { return m_textures[texture.index].desc; }
+
+        // Bytes a texture of this description occupies, mips included.
+        static uint64_t textureBytes(const GraphTextureDesc& desc);
+
+    private:
+        static constexpr uint32_t kNone = ~0u;
+
+        struct Texture
+        {
+            const char* name = nullptr;
+            GraphTextureDesc desc;
+            GLuint imported = 0;
+            uint32_t slot = kNone;
+            uint32_t firstUse = kNone;  // positions in m_order
+            uint32_t lastUse = 0;
+        };
+
+        struct Buffer
+        {
+            const char* name = nullptr;
+            GLsizeiptr size = 0;
+            GLuint imported = 0;
+            uint32_t slot = kNone;
+            uint32_t firstUse = kNone;
+            uint32_t lastUse = 0;
+        };
+
+        struct Use
+        {
+            uint32_t pass = 0;
+            uint32_t resource = 0;
+            uint8_t access = 0;
+            bool texture = false;
+            bool write = false;
+            int level = 0;
+            uint32_t producer = kNone;  // pass that last wrote it, for reads
+            uint8_t producerAccess = 0;
+        };
+
+        struct Pass
+        {
+            const char* name = nullptr;
+            PassKind kind = PassKind::Graphics;
+            PassExecute execute = nullptr;
+            void* user = nullptr;
+            bool output = false;
+            bool live = false;
+            GLbitfield barrier = 0;
+            uint32_t firstUse = 0;      // range in m_passUses, set by compile()
+            uint32_t useCount = 0;
+        };
+
+        struct Writer
+        {
+            uint32_t pass = kNone;
+            uint8_t access = 0;
+        };
+
+        struct TextureSlot
+        {
+            GraphTextureDesc desc;
+            uint32_t freeAfter = 0;     // order position of the last use
+            GLuint object = 0;
+        };
+
+        struct BufferSlot
+        {
+            GLsizeiptr size = 0;
+            uint32_t freeAfter = 0;
+            GLuint object = 0;
+        };
+
+        struct PooledTexture
+        {
+            GraphTextureDesc desc;
+            GLuint object = 0;
+            uint64_t lastFrame = 0;
+        };
+
+        struct PooledBuffer
+        {
+            GLsizeiptr size = 0;
+            GLuint object = 0;
+            uint64_t lastFrame = 0;
+        };
+
+        struct Attachment
+        {
+            GLuint texture = 0;
+            int level = 0;
+            bool operator==(const Attachment&) const = default;
+        };
+
+        struct Framebuffer
+        {
+            Attachment colors[kMaxColorTargets];
+            Attachment depth;
+            GLuint object = 0;
+            uint64_t lastFrame = 0;
+        };
+
+        void addUse(uint32_t pass, uint32_t resource, uint8_t access, bool texture, bool write, int level);
+        bool resolveDependencies();
+        void cull();
+        void computeBarriers();
+        void assignSlots();
+        void bindPool();
+        GLuint framebufferFor(const Attachment* colors, int colorCount, const Attachment& depth);
+        void trimPool(GLStateCache& state);
+
+        int m_backbufferWidth = 0;
+        int m_backbufferHeight = 0;
+        bool m_compiled = false;
+        uint64_t m_frame = 0;
+
+        std::vector<Texture> m_textures;
+        std::vector<Buffer> m_buffers;
+        std::vector<Pass> m_passes;
+        std::vector<Use> m_uses;
+        std::vector<uint32_t> m_passUses;   // m_uses indices grouped by pass
+        std::vector<uint32_t> m_order;
+        std::vector<uint32_t> m_stack;
+        std::vector<Writer> m_writers;      // last writer per resource, in compile()
+        std::vector<uint64_t> m_starts;     // firstUse << 32 | resource
+        std::vector<TextureSlot> m_textureSlots;
+        std::vector<BufferSlot> m_bufferSlots;
+
+        std::vector<PooledTexture> m_texturePool;
+        std::vector<PooledBuffer> m_bufferPool;
+        std::vector<Framebuffer> m_framebuffers;
+
+        Stats m_stats;
+    };
+}
@@ -0,0 +1,73 @@
+#include "render/render_queue.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+
+namespace bloom
+{
+    RenderQueue::RenderQueue()
+    {
+        m_buckets.reserve(kMaxBuckets);
+        for (unsigned i = 0; i < kMaxBuckets; ++i)
+            m_buckets.push_back(std::make_unique<CommandBuffer>());
+    }
+
+    void RenderQueue::reset()
+    {
+        const unsigned used = std::min(m_acquired.exchange(0, std::memory_order_relaxed), kMaxBuckets);
+        for (unsigned i = 0; i < used; ++i)
+            m_buckets[i]->reset();
+        m_sorted.clear();
+    }
+
+    CommandBuffer& RenderQueue::acquireBucket()
+    {
+        const unsigned index = m_acquired.fetch_add(1, std::memory_order_relaxed);
+        if (index >= kMaxBuckets)
+        {
+            std::fprintf(stderr, "RenderQueue ran out of command buckets (limit is %u)\n", kMaxBuckets);
+            std::abort();
+        }
+        return *m_buckets[index];
+    }
+
+    void RenderQueue::sort()
+    {
+        const unsigned used = std::min(m_acquired.load(std::memory_order_relaxed), kMaxBuckets);
+
+        m_sorted.clear();
+        for (unsigned i = 0; i < used; ++i)
+        {
+            const CommandBuffer& buffer = *m_buckets[i];
+            for (const CommandBuffer::Entry& entry : buffer.entries())
+                m_sorted.push_back(SortedCommand{entry.key, buffer.packet(entry.offset)});
+        }
+
+        // LSD radix sort, one byte per pass. Passes over bytes that are the
+        // same for every key (typically most of the pass and shader bits)
+        // are skipped, so real frames usually need three or four passes.
+        m_scratch.resize(m_sorted.size());
+        for (int shift = 0; shift < 64; shift += 8)
+        {
+            std::size_t counts[256] = {};
+            for (const SortedCommand& command : m_sorted)
+                ++counts[(command.key >> shift) & 0xff];
+
+            if (counts[(m_sorted.empty() ? 0 : m_sorted.front().key >> shift) & 0xff] == m_sorted.size())
+                continue;
+
+            std::size_t offset = 0;
+            for (std::size_t& count : counts)
+            {
+                const std::size_t value = count;
+                count = offset;
+                offset += value;
+            }
+
+            for (const SortedCommand& command : m_sorted)
+                m_scratch[counts[(command.key >> shift) & 0xff]++] = command;
+            m_sorted.swap(m_scratch);
+        }
+    }
+}
@@ -0,0 +1,115 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <vector>
+
+#include "render/render_commands.hpp"
+
+namespace bloom
+{
+    struct CommandHeader
+    {
+        CommandType type;
+        uint16_t size;
+    };
+
+    // Append-only command storage for one recording thread. Packets are a
+    // CommandHeader followed by the command itself; the key/offset pairs are
+    // kept separately so sorting never moves packet data.
+    class CommandBuffer
+    {
+    public:
+        struct Entry
+        {
+            uint64_t key;
+            uint32_t offset;
+        };
+
+        // Returns the stored command for last-moment edits. The reference
+        // lives in growable storage and is only valid until the next
+        // record() into this buffer.
+        template <typename T>
+        T& record(uint64_t key, const T& command)
+        {
+            static_assert(std::is_trivially_copyable_v<T>, "commands are stored as raw bytes");
+
+            const std::size_t offset = alignUp(m_memory.size(), alignof(std::max_align_t));
+            const std::size_t bodyOffset = offset + alignUp(sizeof(CommandHeader), alignof(T));
+            m_memory.resize(bodyOffset + sizeof(T));
+
+            const CommandHeader header{T::kType, static_cast<uint16_t>(sizeof(T))};
+            std::memcpy(m_memory.data() + offset, &header, sizeof(header));
+            T* body = new (m_memory.data() + bodyOffset) T(command);
+
+            m_entries.push_back(Entry{key, static_cast<uint32_t>(offset)});
+            return *body;
+        }
+
+        void reset()
+        {
+            m_memory.clear();
+            m_entries.clear();
+        }
+
+        const std::vector<Entry>& entries() const { return m_entries; }
+        const std::byte* packet(uint32_t offset) const { return m_memory.data() + offset; }
+
+        template <typename T>
+        static const T& body(const std::byte* packet)
+        {
+            return *std::launder(reinterpret_cast<const T*>(packet + alignUp(sizeof(CommandHeader), alignof(T))));
+        }
+
+    private:
+        static constexpr std::size_t alignUp(std::size_t value, std::size_t alignment)
+        {
+            return (value + alignment - 1) & ~(alignment - 1);
+        }
+
+        std::vector<std::byte> m_memory;
+        std::vector<Entry> m_entries;
+    };
+
+    // A frame's worth of commands gathered from many threads. Each recording
+    // task takes its own bucket (lock-free), records into it, and the thread
+    // owning the GL context sorts the union by key before executing it.
+    //
+    // Frame protocol: reset() -> acquireBucket()/record in parallel ->
+    // sort() -> GLBackend::execute(). Storage is reused between frames, so a
+    // steady-state frame does not allocate.
+    class RenderQueue
+    {
+    public:
+        static constexpr unsigned kMaxBuckets = 64;
+
+        struct SortedCommand
+        {
+            uint64_t key;
+            const std::byte* packet;
+        };
+
+        RenderQueue();
+
+        void reset();
+
+        // Hands out a bucket no other task is recording into this frame.
+        CommandBuffer& acquireBucket();
+        CommandBuffer& bucket(unsigned index) { return *m_buckets[index]; }
+
+        void sort();
+
+        const std::vector<SortedCommand>& commands() const { return m_sorted; }
+
+    private:
+        std::vector<std::unique_ptr<CommandBuffer>> m_buckets;
+        std::atomic<unsigned> m_acquired{0};
+        std::vector<SortedCommand> m_sorted;
+        std::vector<SortedCommand> m_scratch;
+    };
+}
@@ -0,0 +1,426 @@
+#include "render/shader_cache.hpp"
+
+#include <cinttypes>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <functional>
+
+#include "GLFW/glfw3.h"
+
+#include "core/clock.hpp"
+#include "core/profiler.hpp"
+#include "memory/memory.hpp"
+
+namespace bloom
+{
+    namespace
+    {
+        constexpr uint32_t kMagic = 0x43534c42;    // "BLSC"
+        constexpr uint32_t kVersion = 1;
+
+        struct BinaryHeader
+        {
+            uint32_t magic;
+            uint32_t version;
+            uint64_t key;
+            uint32_t format;
+            uint32_t length;
+        };
+
+        std::atomic<ShaderCache*> s_installed{nullptr};
+
+        // FNV-1a, 64-bit, continued across calls.
+        uint64_t hashBytes(uint64_t hash, const void* data, std::size_t size)
+        {
+            const auto* bytes = static_cast<const unsigned char*>(data);
+            for (std::size_t i = 0; i < size; ++i)
+            {
+                hash ^= bytes[i];
+                hash *= 0x100000001b3ull;
+            }
+            return hash;
+        }
+
+        uint64_t hashString(uint64_t hash, std::string_view text)
+        {
+            // The terminator keeps ("ab", "c") and ("a", "bc") apart.
+            return hashBytes(hashBytes(hash, text.data(), text.size()), "", 1);
+        }
+
+        const char* glString(GLenum name)
+        {
+            const auto* value = reinterpret_cast<const char*>(glGetString(name));
+            return value ? value : "";
+        }
+    }
+
+    ShaderCache::~ShaderCache()
+    {
+        stop();
+    }
+
+    bool ShaderCache::createContext(GLFWwindow* window)
+    {
+        glfwWindowHint(GLFW_VISIBLE, GLFW_FALSE);
+        m_window = glfwCreateWindow(1, 1, "bloom shaders", nullptr, window);
+        if (!m_window)
+        {
+            std::fprintf(stderr, "No shared context for shader compiles; they will run on the render thread\n");
+            return false;
+        }
+        return true;
+    }
+
+    std::string ShaderCache::defaultDirectory()
+    {
+        std::filesystem::path base;
+#if defined(_WIN32)
+        if (const char* localAppData = std::getenv("LOCALAPPDATA"); localAppData && *localAppData)
+            base = localAppData;
+#elif defined(__APPLE__)
+        if (const char* home = std::getenv("HOME"); home && *home)
+            base = std::filesystem::path(home) / "Library" / "Caches";
+#else
+        // XDG wants an absolute path; a relative one is to be ignored.
+        if (const char* cacheHome = std::getenv("XDG_CACHE_HOME"); cacheHome && *cacheHome == '/')
+            base = cacheHome;
+        else if (const char* home = std::getenv("HOME"); home && *home)
+            base = std::filesystem::path(home) / ".cache";
+#endif
+        if (base.empty())
+            return {};
+        return (base / "bloom" / "shader_cache").string();
+    }
+
+    bool ShaderCache::open(const char* directory)
+    {
+        std::error_code error;
+        std::filesystem::create_directories(directory, error);
+        if (error)
+        {
+            std::fprintf(stderr, "Failed to create shader cache %s: %s\n", directory, error.message().c_str());
+            return false;
+        }
+
+        m_directory = directory;
+        m_driver = std::string(glString(GL_RENDERER)) + '\n' + glString(GL_VERSION);
+
+        GLint formats = 0;
+        glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &formats);
+        m_binaries = formats > 0;
+        if (!m_binaries)
+            std::fprintf(stderr, "The driver has no program binary formats; shaders will not be cached\n");
+
+        if (m_window && !m_thread.joinable())
+            m_thread = std::thread(&ShaderCache::compileMain, this);
+        return true;
+    }
+
+    void ShaderCache::drain()
+    {
+        if (threaded())
+        {
+            std::unique_lock lock(m_mutex);
+            m_idleCondition.wait(lock, [this] { return (m_requests.empty() && !m_busy) || !m_thread.joinable(); });
+        }
+
+        collect();
+        for (Finished& finished : m_pending)
+        {
+            GLbitfield flags = GL_SYNC_FLUSH_COMMANDS_BIT;
+            while (glClientWaitSync(finished.fence, flags, 1000000) == GL_TIMEOUT_EXPIRED)
+                flags = 0;
+            glDeleteSync(finished.fence);
+            if (finished.callback)
+                finished.callback(finished.program, finished.user);
+        }
+        m_pending.clear();
+    }
+
+    void ShaderCache::stop()
+    {
+        if (m_thread.joinable())
+        {
+            {
+                std::lock_guard lock(m_mutex);
+                m_stopping = true;
+            }
+            m_condition.notify_one();
+            m_thread.join();
+        }
+        if (m_window)
+        {
+            glfwDestroyWindow(m_window);
+            m_window = nullptr;
+        }
+    }
+
+    void ShaderCache::install(ShaderCache* cache)
+    {
+        s_installed.store(cache, std::memory_order_release);
+    }
+
+    ShaderCache* ShaderCache::installed()
+    {
+        return s_installed.load(std::memory_order_acquire);
+    }
+
+    GLuint ShaderCache::program(std::span<const ShaderStage> stages, std::string_view defines)
+    {
+        if (!isOpen())
+            return linkProgram(stages, defines, false);
+
+        const uint64_t k = key(stages, defines);
+        uint64_t start = Clock::now();
+        if (const GLuint cached = load(k))
+        {
+            m_loadTicks.fetch_add(Clock::now() - start, std::memory_order_relaxed);
+            m_hits.fetch_add(1, std::memory_order_relaxed);
+            return cached;
+        }
+
+        start = Clock::now();
+        const GLuint program = linkProgram(stages, defines, m_binaries);
+        if (program)
+            store(k, program);
+        else
+            m_failed.fetch_add(1, std::memory_order_relaxed);
+        m_compileTicks.fetch_add(Clock::now() - start, std::memory_order_relaxed);
+        m_misses.fetch_add(1, std::memory_order_relaxed);
+        return program;
+    }
+
+    void ShaderCache::request(std::span<const ShaderStage> stages, std::string_view defines, ProgramCallback callback, void* user)
+    {
+        MemoryTagScope tag(MemoryTag::Render);
+        Request request;
+        for (const ShaderStage& stage : stages)
+        {
+            request.types.push_back(stage.type);
+            request.sources.emplace_back(stage.source);
+        }
+        request.defines = defines;
+        request.callback = callback;
+        request.user = user;
+        {
+            std::lock_guard lock(m_mutex);
+            m_requests.push_back(std::move(request));
+        }
+        m_condition.notify_one();
+    }
+
+    uint32_t ShaderCache::collect()
+    {
+        if (!threaded())
+        {
+            while (true)
+            {
+                Request request;
+                {
+                    std::lock_guard lock(m_mutex);
+                    if (m_requests.empty())
+                        break;
+                    request = std::move(m_requests.front());
+                    m_requests.pop_front();
+                }
+                m_pending.push_back(process(request));
+            }
+        }
+
+        {
+            std::lock_guard lock(m_mutex);
+            m_pending.insert(m_pending.end(), m_finished.begin(), m_finished.end());
+            m_finished.clear();
+        }
+
+        uint32_t delivered = 0;
+        std::size_t kept = 0;
+        for (Finished& finished : m_pending)
+        {
+            if (glClientWaitSync(finished.fence, 0, 0) == GL_TIMEOUT_EXPIRED)
+            {
+                m_pending[kept++] = finished;
+                continue;
+            }
+            glDeleteSync(finished.fence);
+            if (finished.callback)
+                finished.callback(finished.program, finished.user);
+            ++delivered;
+        }
+        m_pending.resize(kept);
+        return delivered;
+    }
+
+    ShaderCache::Stats ShaderCache::stats() const
+    {
+        Stats stats;
+        stats.hits = m_hits.load(std::memory_order_relaxed);
+        stats.misses = m_misses.load(std::memory_order_relaxed);
+        stats.rejected = m_rejected.load(std::memory_order_relaxed);
+        stats.failed = m_failed.load(std::memory_order_relaxed);
+        stats.loadMs = Clock::toMilliseconds(m_loadTicks.load(std::memory_order_relaxed));
+        stats.compileMs = Clock::toMilliseconds(m_compileTicks.load(std::memory_order_relaxed));
+        return stats;
+    }
+
+    uint64_t ShaderCache::key(std::span<const ShaderStage> stages, std::string_view defines) const
+    {
+        uint64_t hash = hashBytes(0xcbf29ce484222325ull, &kVersion, sizeof(kVersion));
+        hash = hashString(hash, m_driver);
+        hash = hashString(hash, defines);
+        for (const ShaderStage& stage : stages)
+        {
+            hash = hashBytes(hash, &stage.type, sizeof(stage.type));
+            hash = hashString(hash, stage.source);
+        }
+        return hash;
+    }
+
+    std::string ShaderCache::path(uint64_t key) const
+    {
+        char name[32];
+        std::snprintf(name, sizeof(name), "%016" PRIx64 ".glbin", key);
+        return (std::filesystem::path(m_directory) / name).string();
+    }
+
+    GLuint ShaderCache::load(uint64_t key)
+    {
+        if (!m_binaries)
+            return 0;
+
+        const std::string file = path(key);
+        std::FILE* in = std::fopen(file.c_str(), "rb");
+        if (!in)
+            return 0;
+
+        BinaryHeader header{};
+        std::vector<char> binary;
+        bool ok = std::fread(&header, sizeof(header), 1, in) == 1 && header.magic == kMagic && header.version == kVersion &&
+                  header.key == key && header.length > 0;
+        if (ok)
+        {
+            binary.resize(header.length);
+            ok = std::fread(binary.data(), 1, binary.size(), in) == binary.size();
+        }
+        std::fclose(in);
+
+        GLuint program = 0;
+        if (ok)
+        {
+            program = glCreateProgram();
+            glProgramBinary(program, header.format, binary.data(), static_cast<GLsizei>(binary.size()));
+            GLint status = GL_FALSE;
+            glGetProgramiv(program, GL_LINK_STATUS, &status);
+            if (status != GL_TRUE)
+            {
+                glDeleteProgram(program);
+                program = 0;
+            }
+        }
+
+        // Truncated, from another cache version or refused by the driver:
+        // drop it so the miss that follows writes a fresh one.
+        if (!program)
+        {
+            m_rejected.fetch_add(1, std::memory_order_relaxed);
+            std::error_code error;
+            std::filesystem::remove(file, error);
+        }
+        return program;
+    }
+
+    void ShaderCache::store(uint64_t key, GLuint program)
+    {
+        if (!m_binaries)
+            return;
+
+        GLint length = 0;
+        glGetProgramiv(program, GL_PROGRAM_BINARY_LENGTH, &length);
+        if (length <= 0)
+            return;
+
+        std::vector<char> binary(static_cast<std::size_t>(length));
+        BinaryHeader header{kMagic, kVersion, key, 0, 0};
+        GLsizei written = 0;
+        glGetProgramBinary(program, length, &written, &header.format, binary.data());
+        if (written <= 0)
+            return;
+        header.length = static_cast<uint32_t>(written);
+
+        // Written under a per-thread name and renamed into place, so a
+        // reader never sees half a file even if two threads store the
+        // same program.
+        const std::string file = path(key);
+        char suffix[32];
+        std::snprintf(suffix, sizeof(suffix), ".%zx.tmp", std::hash<std::thread::id>{}(std::this_thread::get_id()));
+        const std::string temporary = file + suffix;
+
+        std::FILE* out = std::fopen(temporary.c_str(), "wb");
+        if (!out)
+            return;
+        const bool ok = std::fwrite(&header, sizeof(header), 1, out) == 1 &&
+                        std::fwrite(binary.data(), 1, header.length, out) == header.length;
+        const bool closed = std::fclose(out) == 0;
+
+        std::error_code error;
+        if (ok && closed)
+            std::filesystem::rename(temporary, file, error);
+        if (!ok || !closed || error)
+        {
+            std::fprintf(stderr, "Failed to write shader cache entry %s\n", file.c_str());
+            std::filesystem::remove(temporary, error);
+        }
+    }
+
+    ShaderCache::Finished ShaderCache::process(const Request& request)
+    {
+        BLOOM_PROFILE_ZONE("Shader compile");
+
+        std::vector<ShaderStage> stages(request.types.size());
+        for (std::size_t i = 0; i < stages.size(); ++i)
+            stages[i] = {request.types[i], request.sources[i].c_str()};
+
+        Finished finished;
+        finished.program = program(stages, request.defines);
+        finished.callback = request.callback;
+        finished.user = request.user;
+
+        // The render thread may only use the program once this context's
+        // commands have completed; the flush makes sure the fence gets there.
+        finished.fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+        glFlush();
+        return finished;
+    }
+
+    void ShaderCache::compileMain()
+    {
+        Profiler::setThreadName("Shaders");
+        MemoryTagScope tag(MemoryTag::Render);
+        glfwMakeContextCurrent(m_window);
+
+        std::unique_lock lock(m_mutex);
+        while (true)
+        {
+            m_condition.wait(lock, [this] { return !m_requests.empty() || m_stopping; });
+            if (m_requests.empty())
+                break;
+
+            const Request request = std::move(m_requests.front());
+            m_requests.pop_front();
+            m_busy = true;
+            lock.unlock();
+
+            Finished finished = process(request);
+
+            lock.lock();
+            m_finished.push_back(finished);
+            m_busy = false;
+            if (m_requests.empty())
+                m_idleCondition.notify_all();
+        }
+        lock.unlock();
+
+        glfwMakeContextCurrent(nullptr);
+    }
+}
@@ -0,0 +1,145 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <span>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include "glad/glad.h"
+
+#include "render/gl_shader.hpp"
+
+struct GLFWwindow;
+
+namespace bloom
+{
+    // Runs on the render thread, from collect(). `program` is 0 on failure.
+    using ProgramCallback = void (*)(GLuint program, void* user);
+
+    // On-disk cache of linked program binaries.
+    //
+    // A program's key hashes its stage types and sources, the defines and
+    // the GL_RENDERER and GL_VERSION strings, so a driver update or a
+    // different GPU misses instead of feeding the driver a stale binary.
+    // A hit is a file read and one glProgramBinary; a miss compiles from
+    // source, links with the retrievable hint and writes
+    // glGetProgramBinary's output next to the others. A binary the driver
+    // rejects is deleted and recompiled.
+    //
+    // program() works on whichever thread calls it. request() hands the
+    // work to a thread with a hidden shared context, so cold compiles do
+    // not hold up the render thread, and collect() delivers the program
+    // once that context's fence has signalled. Without a shared context
+    // the requests run inside collect() instead.
+    //
+    // install() routes compileProgram() and friends through the cache, so
+    // programs built deep inside renderers are cached too.
+    class ShaderCache
+    {
+    public:
+        struct Stats
+        {
+            uint64_t hits = 0;
+            uint64_t misses = 0;
+            uint64_t rejected = 0;  // binaries the driver refused
+            uint64_t failed = 0;    // compile or link errors
+            double loadMs = 0.0;    // time spent restoring hits
+            double compileMs = 0.0; // time spent on misses, storing included
+        };
+
+        ShaderCache() = default;
+        ~ShaderCache();
+
+        ShaderCache(const ShaderCache&) = delete;
+        ShaderCache& operator=(const ShaderCache&) = delete;
+
+        // Main thread, while `window`'s context is not current anywhere.
+        bool createContext(GLFWwindow* window);
+        // Render thread, once GL is loaded: reads the driver strings and the
+        // binary formats, creates `directory` and starts the compile thread.
+        // With no binary format the cache still works, it just never hits.
+        bool open(const char* directory);
+        // Render thread, at shutdown: waits for queued requests and
+        // delivers them.
+        void drain();
+        // Main thread, after drain(). Destroys the hidden window.
+        void stop();
+
+        static void install(ShaderCache* cache);
+        static ShaderCache* installed();
+
+        // The per-user cache location: bloom/shader_cache under
+        // %LOCALAPPDATA% on Windows, ~/Library/Caches on macOS and
+        // $XDG_CACHE_HOME (falling back to ~/.cache) elsewhere. Empty when
+        // the environment names no such directory.
+        static std::string defaultDirectory();
+
+        bool isOpen() const { return !m_directory.empty(); }
+        bool threaded() const { return m_window != nullptr; }
+
+        // Any thread with a context current. Returns 0 on failure.
+        GLuint program(std::span<const ShaderStage> stages, std::string_view defines = {});
+
+        // Any thread. The sources are copied.
+        void request(std::span<const ShaderStage> stages, std::string_view defines, ProgramCallback callback, void* user);
+        // Render thread, once per frame. Returns how many callbacks ran.
+        uint32_t collect();
+
+        Stats stats() const;
+
+    private:
+        struct Request
+        {
+            std::vector<GLenum> types;
+            std::vector<std::string> sources;
+            std::string defines;
+            ProgramCallback callback = nullptr;
+            void* user = nullptr;
+        };
+
+        struct Finished
+        {
+            GLuint program = 0;
+            GLsync fence = nullptr;
+            ProgramCallback callback = nullptr;
+            void* user = nullptr;
+        };
+
+        uint64_t key(std::span<const ShaderStage> stages, std::string_view defines) const;
+        std::string path(uint64_t key) const;
+        GLuint load(uint64_t key);
+        void store(uint64_t key, GLuint program);
+        Finished process(const Request& request);
+        void compileMain();
+
+        std::string m_directory;
+        std::string m_driver;       // GL_RENDERER and GL_VERSION
+        bool m_binaries = false;    // the driver has at least one format
+
+        GLFWwindow* m_window = nullptr;
+        std::thread m_thread;
+        std::mutex m_mutex;
+        std::condition_variable m_condition;
+        std::condition_variable m_idleCondition;
+        std::deque<Request> m_requests;
+        std::vector<Finished> m_finished;
+        bool m_busy = false;
+        bool m_stopping = false;
+
+        // Render thread.
+        std::vector<Finished> m_pending;
+
+        std::atomic<uint64_t> m_hits{0};
+        std::atomic<uint64_t> m_misses{0};
+        std::atomic<uint64_t> m_rejected{0};
+        std::atomic<uint64_t> m_failed{0};
+        std::atomic<uint64_t> m_loadTicks{0};
+        std::atomic<uint64_t> m_compileTicks{0};
+    };
+}
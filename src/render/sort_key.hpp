@@ -0,0 +1,54 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+
+namespace bloom
+{
+    // 64-bit draw ordering key. From most to least significant:
+    //
+    //   63..56  pass       render pass / layer
+    //   55..44  shader     program index
+    //   43..24  material   material index
+    //   23..0   depth      quantised view depth
+    //
+    // Sorting by the raw integer groups work by pass, then by program and
+    // material, so the backend changes the expensive state least often.
+    // Translucent passes invert the depth bits to sort back to front.
+    struct SortKey
+    {
+        static constexpr int kPassBits = 8;
+        static constexpr int kShaderBits = 12;
+        static constexpr int kMaterialBits = 20;
+        static constexpr int kDepthBits = 24;
+
+        static constexpr int kDepthShift = 0;
+        static constexpr int kMaterialShift = kDepthShift + kDepthBits;
+        static constexpr int kShaderShift = kMaterialShift + kMaterialBits;
+        static constexpr int kPassShift = kShaderShift + kShaderBits;
+
+        static constexpr uint64_t mask(int bits) { return (uint64_t{1} << bits) - 1; }
+
+        static constexpr uint64_t encode(uint32_t pass, uint32_t shader, uint32_t material, uint32_t depth)
+        {
+            return (uint64_t{pass} & mask(kPassBits)) << kPassShift |
+                   (uint64_t{shader} & mask(kShaderBits)) << kShaderShift |
+                   (uint64_t{material} & mask(kMaterialBits)) << kMaterialShift |
+                   (uint64_t{depth} & mask(kDepthBits)) << kDepthShift;
+        }
+
+        // Maps a normalised depth in [0, 1] onto the depth field. Pass
+        // backToFront for blended geometry.
+        static constexpr uint32_t quantizeDepth(float depth, bool backToFront = false)
+        {
+            const float clamped = std::clamp(depth, 0.f, 1.f);
+            const auto value = static_cast<uint32_t>(clamped * static_cast<float>(mask(kDepthBits)));
+            return backToFront ? static_cast<uint32_t>(mask(kDepthBits)) - value : value;
+        }
+
+        static constexpr uint32_t pass(uint64_t key) { return static_cast<uint32_t>((key >> kPassShift) & mask(kPassBits)); }
+        static constexpr uint32_t shader(uint64_t key) { return static_cast<uint32_t>((key >> kShaderShift) & mask(kShaderBits)); }
+        static constexpr uint32_t material(uint64_t key) { return static_cast<uint32_t>((key >> kMaterialShift) & mask(kMaterialBits)); }
+        static constexpr uint32_t depth(uint64_t key) { return static_cast<uint32_t>((key >> kDepthShift) & mask(kDepthBits)); }
+    };
+}
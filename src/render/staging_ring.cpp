@@ -0,0 +1,114 @@
+#include "render/staging_ring.hpp"
+
+#include <cstdio>
+
+namespace bloom
+{
+    StagingRing::~StagingRing()
+    {
+        release();
+    }
+
+    bool StagingRing::init(GLsizeiptr size)
+    {
+        release();
+
+        const GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+        glCreateBuffers(1, &m_buffer);
+        glNamedBufferStorage(m_buffer, size, nullptr, flags);
+        m_mapped = static_cast<std::byte*>(glMapNamedBufferRange(m_buffer, 0, size, flags));
+        if (!m_mapped)
+        {
+            std::fprintf(stderr, "Failed to map a %lld byte staging ring\n", static_cast<long long>(size));
+            release();
+            return false;
+        }
+
+        m_size = size;
+        m_head = m_tail = m_fenced = 0;
+        return true;
+    }
+
+    void StagingRing::release()
+    {
+        for (; m_count > 0; --m_count)
+        {
+            glDeleteSync(m_segments[m_first].fence);
+            m_first = (m_first + 1) % kMaxFences;
+        }
+        if (m_buffer)
+        {
+            glUnmapNamedBuffer(m_buffer);
+            glDeleteBuffers(1, &m_buffer);
+        }
+        m_buffer = 0;
+        m_mapped = nullptr;
+        m_size = 0;
+    }
+
+    StagingRing::Allocation StagingRing::allocate(GLsizeiptr size, GLsizeiptr alignment)
+    {
+        const uint64_t capacity = static_cast<uint64_t>(m_size);
+        if (!m_mapped || static_cast<uint64_t>(size) > capacity)
+            return {};
+
+        // Align the offset within the buffer, and never straddle its end:
+        // skip to the start of the next lap instead.
+        const uint64_t lap = m_head - m_head % capacity;
+        uint64_t start = lap + (m_head % capacity + alignment - 1) / alignment * alignment;
+        if (start - lap + size > capacity)
+            start = lap + capacity;
+
+        while (start + size - m_tail > capacity)
+        {
+            // The bytes in the way were never fenced; fence them so there is
+            // something to wait for.
+            if (m_count == 0)
+                fence();
+            if (m_count == 0)
+            {
+                // Nothing in flight at all; only the lap skip was in the way.
+                m_tail = start;
+                break;
+            }
+            waitOldest();
+        }
+
+        m_head = start + size;
+        return {static_cast<GLintptr>(start % capacity), m_mapped + start % capacity};
+    }
+
+    void StagingRing::fence()
+    {
+        if (m_head == m_fenced)
+            return;
+        if (m_count == kMaxFences)
+            waitOldest();
+
+        Segment& segment = m_segments[(m_first + m_count) % kMaxFences];
+        segment.fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+        segment.end = m_head;
+        m_fenced = m_head;
+        ++m_count;
+    }
+
+    void StagingRing::waitOldest()
+    {
+        Segment& segment = m_segments[m_first];
+        if (glClientWaitSync(segment.fence, 0, 0) == GL_TIMEOUT_EXPIRED)
+        {
+            ++m_stalls;
+            // Same slicing as FramePacer: flush once so the fence is sure to
+            // signal, then wait in 1 ms steps.
+            GLbitfield flags = GL_SYNC_FLUSH_COMMANDS_BIT;
+            while (glClientWaitSync(segment.fence, flags, 1000000) == GL_TIMEOUT_EXPIRED)
+                flags = 0;
+        }
+
+        glDeleteSync(segment.fence);
+        segment.fence = nullptr;
+        m_tail = segment.end;
+        m_first = (m_first + 1) % kMaxFences;
+        --m_count;
+    }
+}
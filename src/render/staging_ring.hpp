@@ -0,0 +1,74 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "glad/glad.h"
+
+namespace bloom
+{
+    // A persistently mapped buffer used as a ring of CPU-written bytes for
+    // the GPU to read. allocate() hands out aligned ranges in order; fence()
+    // closes everything allocated since the previous call, and that range is
+    // reused only once the GPU has passed the fence. When the ring is full,
+    // allocate() blocks on the oldest fence, so size it for a few frames or
+    // uploads of traffic.
+    //
+    // All methods must run on the thread that owns the GL context the ring
+    // was created on.
+    class StagingRing
+    {
+    public:
+        static constexpr int kMaxFences = 64;
+
+        struct Allocation
+        {
+            GLintptr offset = -1;       // into buffer(); -1 on failure
+            std::byte* pointer = nullptr;
+        };
+
+        StagingRing() = default;
+        ~StagingRing();
+
+        StagingRing(const StagingRing&) = delete;
+        StagingRing& operator=(const StagingRing&) = delete;
+
+        // Coherent write mapping, so CPU writes need no explicit flush.
+        bool init(GLsizeiptr size);
+        void release();
+        bool isOpen() const { return m_buffer != 0; }
+
+        // Fails only for a size larger than the ring.
+        Allocation allocate(GLsizeiptr size, GLsizeiptr alignment);
+        void fence();
+
+        GLuint buffer() const { return m_buffer; }
+        GLsizeiptr size() const { return m_size; }
+        // allocate() calls that had to wait on the GPU.
+        uint64_t stalls() const { return m_stalls; }
+
+    private:
+        struct Segment
+        {
+            GLsync fence = nullptr;
+            uint64_t end = 0;
+        };
+
+        void waitOldest();
+
+        GLuint m_buffer = 0;
+        std::byte* m_mapped = nullptr;
+        GLsizeiptr m_size = 0;
+
+        // Monotonic byte positions; the ring offset is position % size.
+        uint64_t m_head = 0;        // next free byte
+        uint64_t m_tail = 0;        // oldest byte the GPU may still read
+        uint64_t m_fenced = 0;      // end of the last fenced segment
+
+        std::array<Segment, kMaxFences> m_segments{};
+        int m_first = 0;
+        int m_count = 0;
+        uint64_t m_stalls = 0;
+    };
+}
@@ -0,0 +1,134 @@
+#include "render/uniform_ring.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <vector>
+
+namespace bloom
+{
+    UniformRing::~UniformRing()
+    {
+        release();
+    }
+
+    bool UniformRing::init(GLsizeiptr frameBytes)
+    {
+        release();
+
+        GLint uniformAlignment = 0;
+        GLint storageAlignment = 0;
+        glGetIntegerv(GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT, &uniformAlignment);
+        glGetIntegerv(GL_SHADER_STORAGE_BUFFER_OFFSET_ALIGNMENT, &storageAlignment);
+        // Both are powers of two, so regions aligned to the larger suit
+        // either binding.
+        m_uniformAlignment = std::max(uniformAlignment, 16);
+        const GLsizeiptr regionAlignment = std::max<GLsizeiptr>(m_uniformAlignment, storageAlignment);
+        m_frameBytes = (frameBytes + regionAlignment - 1) / regionAlignment * regionAlignment;
+        if (m_frameBytes <= 0 || !m_ring.init(m_frameBytes * kFramesInFlight))
+        {
+            std::fprintf(stderr, "Failed to create a uniform ring of %lld bytes per frame\n", static_cast<long long>(frameBytes));
+            release();
+            return false;
+        }
+
+        // baseInstance + gl_InstanceID, read back through a divisor-1
+        // attribute, gives the element index without draw parameters.
+        m_drawIndexCount = static_cast<uint32_t>(m_frameBytes / 16);
+        std::vector<uint32_t> indices(m_drawIndexCount);
+        for (uint32_t i = 0; i < m_drawIndexCount; ++i)
+            indices[i] = i;
+        glCreateBuffers(1, &m_drawIndices);
+        glNamedBufferStorage(m_drawIndices, static_cast<GLsizeiptr>(indices.size() * sizeof(uint32_t)), indices.data(), 0);
+        return true;
+    }
+
+    void UniformRing::release()
+    {
+        m_ring.release();
+        if (m_drawIndices)
+            glDeleteBuffers(1, &m_drawIndices);
+        m_drawIndices = 0;
+        m_drawIndexCount = 0;
+        m_frameBytes = 0;
+        m_frame = nullptr;
+    }
+
+    void UniformRing::attachDrawIndex(GLuint vertexArray) const
+    {
+        glVertexArrayVertexBuffer(vertexArray, kDrawIndexBinding, m_drawIndices, 0, sizeof(uint32_t));
+        glVertexArrayBindingDivisor(vertexArray, kDrawIndexBinding, 1);
+        glVertexArrayAttribIFormat(vertexArray, kDrawIndexAttribute, 1, GL_UNSIGNED_INT, 0);
+        glVertexArrayAttribBinding(vertexArray, kDrawIndexAttribute, kDrawIndexBinding);
+        glEnableVertexArrayAttrib(vertexArray, kDrawIndexAttribute);
+    }
+
+    void UniformRing::beginFrame()
+    {
+        m_used.store(0, std::memory_order_relaxed);
+        m_allocations.store(0, std::memory_order_relaxed);
+        m_failed.store(0, std::memory_order_relaxed);
+        if (!m_ring.isOpen())
+            return;
+
+        // Regions are exactly m_frameBytes apart, so this never skips bytes
+        // at the end of the ring.
+        const StagingRing::Allocation region = m_ring.allocate(m_frameBytes, m_uniformAlignment);
+        m_frameOffset = region.offset;
+        m_frame = region.pointer;
+    }
+
+    int64_t UniformRing::bump(uint64_t size, uint64_t alignment)
+    {
+        uint64_t used = m_used.load(std::memory_order_relaxed);
+        for (;;)
+        {
+            const uint64_t start = (used + alignment - 1) / alignment * alignment;
+            if (!m_frame || start + size > static_cast<uint64_t>(m_frameBytes))
+            {
+                m_failed.fetch_add(1, std::memory_order_relaxed);
+                return -1;
+            }
+            if (m_used.compare_exchange_weak(used, start + size, std::memory_order_relaxed))
+            {
+                m_allocations.fetch_add(1, std::memory_order_relaxed);
+                return static_cast<int64_t>(start);
+            }
+        }
+    }
+
+    UniformRing::Allocation UniformRing::allocate(GLsizeiptr size)
+    {
+        const int64_t offset = bump(static_cast<uint64_t>(size), static_cast<uint64_t>(m_uniformAlignment));
+        if (offset < 0)
+            return {};
+        return {BufferRange{m_ring.buffer(), m_frameOffset + offset, size}, m_frame + offset};
+    }
+
+    UniformRing::ArrayAllocation UniformRing::allocateArray(uint32_t count, uint32_t stride)
+    {
+        if (count == 0 || stride == 0)
+            return {};
+        // Aligned to the stride itself, so the offset is a whole number of
+        // elements from the start of frameRange().
+        const int64_t offset = bump(uint64_t{count} * stride, stride);
+        if (offset < 0)
+            return {};
+        const auto first = static_cast<uint32_t>(static_cast<uint64_t>(offset) / stride);
+        if (uint64_t{first} + count > m_drawIndexCount)
+        {
+            m_failed.fetch_add(1, std::memory_order_relaxed);
+            return {};
+        }
+        return {first, m_frame + offset};
+    }
+
+    void UniformRing::endFrame()
+    {
+        m_stats.bytes = m_used.load(std::memory_order_relaxed);
+        m_stats.allocations = m_allocations.load(std::memory_order_relaxed);
+        m_stats.failed = m_failed.load(std::memory_order_relaxed);
+        if (m_frame)
+            m_ring.fence();
+        m_frame = nullptr;
+    }
+}
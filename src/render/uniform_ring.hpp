@@ -0,0 +1,138 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+#include "glad/glad.h"
+
+#include "render/render_commands.hpp"
+#include "render/staging_ring.hpp"
+
+namespace bloom
+{
+    // Per-frame constant data for draws, in place of glUniform* calls.
+    //
+    // Each frame, beginFrame() takes one region of a persistently mapped
+    // StagingRing; allocate() and allocateArray() then carve it with a
+    // lock-free bump, so jobs can write per-draw data in parallel while
+    // they record. endFrame() fences the region, which is handed out again
+    // only once the GPU has read it.
+    //
+    // Draws reach their data in one of two ways:
+    //   - allocate() returns a BufferRange aligned for glBindBufferRange;
+    //     put it in DrawCommand::uniformBuffers to bind it as a uniform
+    //     block. The binding changes with every draw.
+    //   - allocateArray() packs elements into frameRange(), bound once as a
+    //     storage buffer, and returns the index of the first. A draw passes
+    //     first + i as its baseInstance; a vertex array set up with
+    //     attachDrawIndex() turns that into a uint attribute at
+    //     kDrawIndexAttribute (the same divisor-1 trick MeshBatchRenderer
+    //     uses), so consecutive draws differ in nothing but baseInstance
+    //     and the backend binds nothing between them.
+    //
+    // The ring is write-combined memory: write each element once, as a
+    // whole, and never read it back.
+    class UniformRing
+    {
+    public:
+        static constexpr GLuint kDrawIndexAttribute = 15;
+        static constexpr GLuint kDrawIndexBinding = 15;
+        // Frames of data the ring holds before beginFrame() has to wait for
+        // the GPU.
+        static constexpr int kFramesInFlight = 3;
+
+        struct Allocation
+        {
+            BufferRange range;          // buffer 0 on failure
+            std::byte* pointer = nullptr;
+        };
+
+        struct ArrayAllocation
+        {
+            uint32_t first = 0;         // element index in frameRange()
+            std::byte* pointer = nullptr;   // null on failure
+        };
+
+        struct Stats
+        {
+            uint64_t bytes = 0;         // carved from the region, padding included
+            uint32_t allocations = 0;
+            uint32_t failed = 0;        // did not fit in the region
+        };
+
+        UniformRing() = default;
+        ~UniformRing();
+
+        UniformRing(const UniformRing&) = delete;
+        UniformRing& operator=(const UniformRing&) = delete;
+
+        // Render thread. `frameBytes` is rounded up to the binding
+        // alignment; arrays can index up to frameBytes / 16 elements.
+        bool init(GLsizeiptr frameBytes);
+        void release();
+        bool isOpen() const { return m_ring.isOpen(); }
+
+        // Render thread. Feeds the draw index attribute of `vertexArray`
+        // from the ring's identity buffer; the binding and attribute are
+        // reserved from then on.
+        void attachDrawIndex(GLuint vertexArray) const;
+
+        // Render thread, before any allocation of the frame. May wait for
+        // the GPU to release the oldest frame's region.
+        void beginFrame();
+        // Any thread, between beginFrame() and endFrame().
+        Allocation allocate(GLsizeiptr size);
+        // `stride` is the std430 array stride of the element type.
+        ArrayAllocation allocateArray(uint32_t count, uint32_t stride);
+        // Render thread, after the commands reading this frame's data have
+        // been executed.
+        void endFrame();
+
+        template <typename T>
+        Allocation push(const T& value)
+        {
+            static_assert(std::is_trivially_copyable_v<T>);
+            const Allocation allocation = allocate(sizeof(T));
+            if (allocation.pointer)
+                std::memcpy(allocation.pointer, &value, sizeof(T));
+            return allocation;
+        }
+
+        template <typename T>
+        T* allocateArray(uint32_t count, uint32_t& first)
+        {
+            static_assert(std::is_trivially_copyable_v<T>);
+            const ArrayAllocation allocation = allocateArray(count, sizeof(T));
+            first = allocation.first;
+            return reinterpret_cast<T*>(allocation.pointer);
+        }
+
+        // The storage buffer range allocateArray() indexes into.
+        BufferRange frameRange() const { return {m_ring.buffer(), m_frameOffset, m_frameBytes}; }
+        // The last completed frame's usage.
+        const Stats& stats() const { return m_stats; }
+        // beginFrame() calls that had to wait on the GPU.
+        uint64_t stalls() const { return m_ring.stalls(); }
+
+    private:
+        // Reserves `size` bytes at a multiple of `alignment` from the
+        // region's start; returns that relative offset, or -1.
+        int64_t bump(uint64_t size, uint64_t alignment);
+
+        StagingRing m_ring;
+        GLuint m_drawIndices = 0;
+        uint32_t m_drawIndexCount = 0;
+        GLsizeiptr m_uniformAlignment = 256;
+        GLsizeiptr m_frameBytes = 0;
+
+        GLintptr m_frameOffset = 0;
+        std::byte* m_frame = nullptr;
+        std::atomic<uint64_t> m_used{0};
+        std::atomic<uint32_t> m_allocations{0};
+        std::atomic<uint32_t> m_failed{0};
+        Stats m_stats;
+    };
+}
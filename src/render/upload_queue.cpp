@@ -0,0 +1,69 @@
+#include "render/upload_queue.hpp"
+
+#include <cstdio>
+
+#include "core/profiler.hpp"
+
+namespace bloom
+{
+    void UploadQueue::push(Function function, void* user, uint64_t bytes)
+    {
+        std::lock_guard lock(m_mutex);
+        Upload* upload = m_pool.create(Upload{function, user, bytes, nullptr});
+        if (!upload)
+        {
+            std::fprintf(stderr, "UploadQueue: out of memory, upload dropped\n");
+            return;
+        }
+        if (m_tail)
+            m_tail->next = upload;
+        else
+            m_head = upload;
+        m_tail = upload;
+        ++m_pending;
+    }
+
+    uint32_t UploadQueue::process(uint64_t byteBudget)
+    {
+        uint32_t count = 0;
+        uint64_t spent = 0;
+        while (count == 0 || spent < byteBudget)
+        {
+            Upload upload;
+            {
+                std::lock_guard lock(m_mutex);
+                if (!m_head)
+                    break;
+                upload = *m_head;
+                m_pool.destroy(m_head);
+                m_head = upload.next;
+                if (!m_head)
+                    m_tail = nullptr;
+                --m_pending;
+            }
+
+            BLOOM_PROFILE_ZONE("Upload");
+            upload.function(upload.user);
+            spent += upload.bytes;
+            ++count;
+        }
+
+        m_uploadCount.fetch_add(count, std::memory_order_relaxed);
+        m_byteCount.fetch_add(spent, std::memory_order_relaxed);
+        return count;
+    }
+
+    std::size_t UploadQueue::pending() const
+    {
+        std::lock_guard lock(m_mutex);
+        return m_pending;
+    }
+
+    UploadQueue::Stats UploadQueue::stats() const
+    {
+        Stats stats;
+        stats.uploads = m_uploadCount.load(std::memory_order_relaxed);
+        stats.bytes = m_byteCount.load(std::memory_order_relaxed);
+        return stats;
+    }
+}
@@ -0,0 +1,60 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+
+#include "memory/pool.hpp"
+
+namespace bloom
+{
+    // GL work produced off the render thread, typically by AsyncReader
+    // callbacks once an asset's bytes have landed. Any thread may push();
+    // the render thread runs the queue at the top of each frame under a
+    // byte budget, so a burst of finished loads is spread over several
+    // frames instead of landing in one.
+    //
+    // Pending uploads live in pool blocks linked in push order, so once the
+    // pool has grown to the deepest backlog the queue stops allocating.
+    class UploadQueue
+    {
+    public:
+        using Function = void (*)(void* user);
+
+        struct Stats
+        {
+            uint64_t uploads = 0;
+            uint64_t bytes = 0;
+        };
+
+        // `bytes` is what the upload costs against the budget.
+        void push(Function function, void* user, uint64_t bytes);
+
+        // GL context thread. Runs uploads in order until `byteBudget` is
+        // spent; always at least one, so an upload larger than the budget
+        // still goes through. Returns how many ran.
+        uint32_t process(uint64_t byteBudget);
+        uint32_t flush() { return process(UINT64_MAX); }
+
+        std::size_t pending() const;
+        Stats stats() const;
+
+    private:
+        struct Upload
+        {
+            Function function;
+            void* user;
+            uint64_t bytes;
+            Upload* next;
+        };
+
+        mutable std::mutex m_mutex;
+        ObjectPool<Upload> m_pool{64, MemoryTag::Render};
+        Upload* m_head = nullptr;
+        Upload* m_tail = nullptr;
+        std::size_t m_pending = 0;
+        std::atomic<uint64_t> m_uploadCount{0};
+        std::atomic<uint64_t> m_byteCount{0};
+    };
+}
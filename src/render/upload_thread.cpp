@@ -0,0 +1,415 @@
+#include "render/upload_thread.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+
+#include "GLFW/glfw3.h"
+
+#include "core/profiler.hpp"
+#include "memory/memory.hpp"
+
+namespace bloom
+{
+    namespace
+    {
+        // Texture rows and buffer ranges go through the ring in pieces of
+        // at most a quarter of it, so one large upload never has to wait
+        // for the whole ring to drain.
+        constexpr uint64_t kPieceFraction = 4;
+        constexpr GLsizeiptr kStagingAlignment = 16;
+    }
+
+    UploadThread::UploadThread(uint64_t stagingSize)
+        : m_stagingSize(stagingSize)
+    {
+    }
+
+    UploadThread::~UploadThread()
+    {
+        stop();
+    }
+
+    bool UploadThread::createContext(GLFWwindow* window)
+    {
+        // The other hints are still the main window's, so the context is
+        // created the same way.
+        glfwWindowHint(GLFW_VISIBLE, GLFW_FALSE);
+        m_window = glfwCreateWindow(1, 1, "bloom upload", nullptr, window);
+        if (!m_window)
+        {
+            std::fprintf(stderr, "No shared context for uploads; they will run on the render thread\n");
+            return false;
+        }
+        return true;
+    }
+
+    void UploadThread::start()
+    {
+        if (!m_window || m_thread.joinable())
+            return;
+        {
+            std::lock_guard lock(m_mutex);
+            m_started = true;
+        }
+        m_thread = std::thread(&UploadThread::uploadMain, this);
+    }
+
+    void UploadThread::stop()
+    {
+        if (m_thread.joinable())
+        {
+            {
+                std::lock_guard lock(m_mutex);
+                m_stopping = true;
+            }
+            m_condition.notify_one();
+            m_thread.join();
+        }
+        if (m_window)
+        {
+            glfwDestroyWindow(m_window);
+            m_window = nullptr;
+        }
+    }
+
+    void UploadThread::uploadBuffer(const void* data, uint64_t size, GLbitfield storageFlags, UploadCallback callback, void* user)
+    {
+        Request request;
+        request.kind = UploadKind::Buffer;
+        request.data = static_cast<const std::byte*>(data);
+        request.size = size;
+        request.storageFlags = storageFlags;
+        request.callback = callback;
+        request.user = user;
+        push(request);
+    }
+
+    void UploadThread::uploadMesh(const MeshView& mesh, UploadCallback callback, void* user)
+    {
+        Request request;
+        request.kind = UploadKind::Mesh;
+        request.data = mesh.vertices;
+        request.size = mesh.info->vertexSize + mesh.info->indexSize;
+        request.mesh = *mesh.info;
+        request.indices = mesh.indices;
+        request.callback = callback;
+        request.user = user;
+        push(request);
+    }
+
+    void UploadThread::uploadTexture(const TextureView& texture, UploadCallback callback, void* user)
+    {
+        Request request;
+        request.kind = UploadKind::Texture;
+        request.data = texture.base;
+        for (uint32_t level = 0; level < texture.info->levels; ++level)
+            request.size += texture.info->levelSize[level];
+        request.texture = *texture.info;
+        request.callback = callback;
+        request.user = user;
+        push(request);
+    }
+
+    void UploadThread::push(const Request& request)
+    {
+        {
+            MemoryTagScope tag(MemoryTag::Render);
+            std::lock_guard lock(m_mutex);
+            m_requests.push_back(request);
+        }
+        m_condition.notify_one();
+    }
+
+    void UploadThread::uploadMain()
+    {
+        Profiler::setThreadName("Upload");
+        MemoryTagScope tag(MemoryTag::Render);
+        glfwMakeContextCurrent(m_window);
+        m_ring.init(static_cast<GLsizeiptr>(m_stagingSize));
+
+        std::unique_lock lock(m_mutex);
+        while (true)
+        {
+            m_condition.wait(lock, [this] { return !m_requests.empty() || m_stopping; });
+            if (m_requests.empty())
+                break;
+
+            const Request request = m_requests.front();
+            m_requests.pop_front();
+            m_busy = true;
+            lock.unlock();
+
+            Finished finished = process(m_state, request);
+
+            lock.lock();
+            m_finished.push_back(finished);
+            m_busy = false;
+            if (m_requests.empty())
+                m_idleCondition.notify_all();
+        }
+        lock.unlock();
+
+        m_ring.release();
+        glfwMakeContextCurrent(nullptr);
+    }
+
+    UploadThread::Finished UploadThread::process(GLStateCache& state, const Request& request)
+    {
+        BLOOM_PROFILE_ZONE("Upload");
+
+        Finished finished;
+        finished.request = request;
+        UploadResult& result = finished.result;
+        result.kind = request.kind;
+        result.user = request.user;
+
+        switch (request.kind)
+        {
+        case UploadKind::Buffer:
+            result.buffer = copyToBuffer(request.data, request.size, request.storageFlags);
+            result.ok = result.buffer != 0;
+            break;
+        case UploadKind::Mesh:
+            result.mesh.vertexBuffer = copyToBuffer(request.data, request.mesh.vertexSize, 0);
+            if (request.mesh.indexCount > 0)
+                result.mesh.indexBuffer = copyToBuffer(request.indices, request.mesh.indexSize, 0);
+            result.mesh.vertexCount = static_cast<GLsizei>(request.mesh.vertexCount);
+            result.mesh.indexCount = static_cast<GLsizei>(request.mesh.indexCount);
+            result.mesh.indexType = request.mesh.indexType;
+            result.ok = result.mesh.vertexBuffer != 0 && (request.mesh.indexCount == 0 || result.mesh.indexBuffer != 0);
+            break;
+        case UploadKind::Texture:
+            result.texture = copyToTexture(state, request.texture, request.data);
+            result.ok = result.texture != 0;
+            break;
+        }
+
+        if (glGetError() != GL_NO_ERROR)
+            result.ok = false;
+        if (!result.ok)
+        {
+            std::fprintf(stderr, "Upload of %llu bytes failed\n", static_cast<unsigned long long>(request.size));
+            if (result.buffer)
+                glDeleteBuffers(1, &result.buffer);
+            if (result.mesh.vertexBuffer)
+                glDeleteBuffers(1, &result.mesh.vertexBuffer);
+            if (result.mesh.indexBuffer)
+                glDeleteBuffers(1, &result.mesh.indexBuffer);
+            if (result.texture)
+                glDeleteTextures(1, &result.texture);
+            result.buffer = result.texture = 0;
+            result.mesh = {};
+        }
+
+        // One fence lets the ring reuse the staging bytes, the other tells
+        // the render thread the objects are complete. The flush makes sure
+        // both reach the GPU, or the other context could wait forever.
+        m_ring.fence();
+        finished.fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+        glFlush();
+
+        m_uploadCount.fetch_add(1, std::memory_order_relaxed);
+        m_byteCount.fetch_add(request.size, std::memory_order_relaxed);
+        m_stallCount.store(m_ring.stalls(), std::memory_order_relaxed);
+        return finished;
+    }
+
+    GLuint UploadThread::copyToBuffer(const std::byte* data, uint64_t size, GLbitfield storageFlags)
+    {
+        GLuint buffer = 0;
+        glCreateBuffers(1, &buffer);
+        glNamedBufferStorage(buffer, static_cast<GLsizeiptr>(size), nullptr, storageFlags);
+
+        const uint64_t piece = std::max<uint64_t>(static_cast<uint64_t>(m_ring.size()) / kPieceFraction, kStagingAlignment);
+        for (uint64_t offset = 0; offset < size;)
+        {
+            const uint64_t count = std::min(piece, size - offset);
+            const StagingRing::Allocation staging = m_ring.allocate(static_cast<GLsizeiptr>(count), kStagingAlignment);
+            if (staging.offset < 0)
+            {
+                glDeleteBuffers(1, &buffer);
+                return 0;
+            }
+
+            std::memcpy(staging.pointer, data + offset, count);
+            glCopyNamedBufferSubData(m_ring.buffer(), buffer, staging.offset, static_cast<GLintptr>(offset),
+                                     static_cast<GLsizeiptr>(count));
+            offset += count;
+        }
+        return buffer;
+    }
+
+    GLuint UploadThread::copyToTexture(GLStateCache& state, const TextureInfo& info, const std::byte* base)
+    {
+        const bool compressed = info.format == 0;
+
+        GLuint texture = 0;
+        glCreateTextures(GL_TEXTURE_2D, 1, &texture);
+        glTextureStorage2D(texture, static_cast<GLsizei>(info.levels), info.internalFormat, static_cast<GLsizei>(info.width),
+                           static_cast<GLsizei>(info.height));
+
+        // Unpack from the ring.
+        state.bindBuffer(GL_PIXEL_UNPACK_BUFFER, m_ring.buffer());
+        state.pixelStore(GL_UNPACK_ALIGNMENT, 1);
+        state.pixelStore(GL_UNPACK_ROW_LENGTH, 0);
+
+        bool ok = true;
+        const uint64_t piece = static_cast<uint64_t>(m_ring.size()) / kPieceFraction;
+        for (uint32_t level = 0; level < info.levels && ok; ++level)
+        {
+            const uint32_t width = std::max(info.width >> level, 1u);
+            const uint32_t height = std::max(info.height >> level, 1u);
+
+            // Compressed levels go in rows of 4x4 blocks.
+            const uint32_t rowHeight = compressed ? 4 : 1;
+            const uint32_t rows = (height + rowHeight - 1) / rowHeight;
+            const uint64_t rowBytes = info.levelSize[level] / rows;
+            const uint32_t rowsPerPiece = static_cast<uint32_t>(std::max<uint64_t>(piece / std::max<uint64_t>(rowBytes, 1), 1));
+            const std::byte* source = base + info.levelOffset[level];
+
+            for (uint32_t row = 0; row < rows;)
+            {
+                const uint32_t count = std::min(rowsPerPiece, rows - row);
+                const GLsizeiptr bytes = static_cast<GLsizeiptr>(count * rowBytes);
+                const StagingRing::Allocation staging = m_ring.allocate(bytes, kStagingAlignment);
+                if (staging.offset < 0)
+                {
+                    ok = false;
+                    break;
+                }
+                std::memcpy(staging.pointer, source + row * rowBytes, static_cast<std::size_t>(bytes));
+
+                const GLint y = static_cast<GLint>(row * rowHeight);
+                const GLsizei pieceHeight = static_cast<GLsizei>(std::min(count * rowHeight, height - row * rowHeight));
+                const void* offset = reinterpret_cast<const void*>(staging.offset);
+                if (compressed)
+                    glCompressedTextureSubImage2D(texture, static_cast<GLint>(level), 0, y, static_cast<GLsizei>(width), pieceHeight,
+                                                  info.internalFormat, static_cast<GLsizei>(bytes), offset);
+                else
+                    glTextureSubImage2D(texture, static_cast<GLint>(level), 0, y, static_cast<GLsizei>(width), pieceHeight, info.format,
+                                        info.type, offset);
+                row += count;
+            }
+        }
+
+        glTextureParameteri(texture, GL_TEXTURE_MAX_LEVEL, static_cast<GLint>(info.levels - 1));
+        glTextureParameteri(texture, GL_TEXTURE_MIN_FILTER, info.levels > 1 ? GL_LINEAR_MIPMAP_LINEAR : GL_LINEAR);
+        glTextureParameteri(texture, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+
+        if (!ok)
+        {
+            glDeleteTextures(1, &texture);
+            return 0;
+        }
+        return texture;
+    }
+
+    uint32_t UploadThread::collect(uint64_t inlineBudget, uint64_t* inlineBytes)
+    {
+        uint64_t spent = 0;
+        if (!threaded())
+        {
+            if (!m_ring.isOpen())
+                m_ring.init(static_cast<GLsizeiptr>(m_stagingSize));
+
+            // A private cache knows nothing of what the rest of the render
+            // thread did since the last frame.
+            GLStateCache& state = m_renderState ? *m_renderState : m_state;
+            if (!m_renderState)
+                m_state.invalidate();
+
+            for (uint32_t count = 0; count == 0 || spent < inlineBudget; ++count)
+            {
+                Request request;
+                {
+                    std::lock_guard lock(m_mutex);
+                    if (m_requests.empty())
+                        break;
+                    request = m_requests.front();
+                    m_requests.pop_front();
+                }
+                m_pending.push_back(process(state, request));
+                spent += request.size;
+            }
+
+            if (!m_renderState && spent > 0)
+            {
+                m_state.bindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+                m_state.pixelStore(GL_UNPACK_ALIGNMENT, 4);
+            }
+        }
+        if (inlineBytes)
+            *inlineBytes = spent;
+
+        {
+            std::lock_guard lock(m_mutex);
+            m_pending.insert(m_pending.end(), m_finished.begin(), m_finished.end());
+            m_finished.clear();
+        }
+
+        // Hand over whatever the GPU has finished; the rest waits for a
+        // later frame rather than stalling this one.
+        uint32_t delivered = 0;
+        std::size_t kept = 0;
+        for (Finished& finished : m_pending)
+        {
+            if (glClientWaitSync(finished.fence, 0, 0) == GL_TIMEOUT_EXPIRED)
+            {
+                m_pending[kept++] = finished;
+                continue;
+            }
+            deliver(finished);
+            ++delivered;
+        }
+        m_pending.resize(kept);
+        return delivered;
+    }
+
+    void UploadThread::drain()
+    {
+        if (threaded())
+        {
+            std::unique_lock lock(m_mutex);
+            m_idleCondition.wait(lock, [this] { return (m_requests.empty() && !m_busy) || !m_started; });
+        }
+
+        collect();
+        for (Finished& finished : m_pending)
+        {
+            GLbitfield flags = GL_SYNC_FLUSH_COMMANDS_BIT;
+            while (glClientWaitSync(finished.fence, flags, 1000000) == GL_TIMEOUT_EXPIRED)
+                flags = 0;
+            deliver(finished);
+        }
+        m_pending.clear();
+
+        if (!threaded())
+        {
+            if (m_renderState)
+                m_renderState->forgetBuffer(m_ring.buffer());
+            m_ring.release();
+        }
+    }
+
+    void UploadThread::deliver(Finished& finished)
+    {
+        glDeleteSync(finished.fence);
+        finished.fence = nullptr;
+
+        UploadResult& result = finished.result;
+        if (result.kind == UploadKind::Mesh && result.ok)
+            result.mesh.vertexArray = createVertexArray(finished.request.mesh, result.mesh.vertexBuffer, result.mesh.indexBuffer);
+        if (finished.request.callback)
+            finished.request.callback(result);
+    }
+
+    UploadThread::Stats UploadThread::stats() const
+    {
+        Stats stats;
+        stats.uploads = m_uploadCount.load(std::memory_order_relaxed);
+        stats.bytes = m_byteCount.load(std::memory_order_relaxed);
+        stats.stagingStalls = m_stallCount.load(std::memory_order_relaxed);
+        return stats;
+    }
+}
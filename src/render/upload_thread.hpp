@@ -0,0 +1,158 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "glad/glad.h"
+
+#include "render/asset_upload.hpp"
+#include "render/gl_state_cache.hpp"
+#include "render/staging_ring.hpp"
+
+struct GLFWwindow;
+
+namespace bloom
+{
+    enum class UploadKind : uint8_t
+    {
+        Buffer,
+        Mesh,
+        Texture,
+    };
+
+    struct UploadResult
+    {
+        UploadKind kind = UploadKind::Buffer;
+        bool ok = false;
+        GLuint buffer = 0;      // Buffer
+        GpuMesh mesh;           // Mesh; the vertex array is the render context's
+        GLuint texture = 0;     // Texture
+        void* user = nullptr;
+    };
+
+    // Runs on the render thread, from collect(). The objects are ready to use.
+    using UploadCallback = void (*)(const UploadResult& result);
+
+    // Creates buffers, meshes and textures on a thread of its own.
+    //
+    // The thread owns a hidden window whose context shares objects with the
+    // main one, and a persistently mapped StagingRing. Each upload is copied
+    // into the ring and from there into freshly created immutable storage
+    // by the GPU (glCopyNamedBufferSubData, or a pixel-unpack-buffer
+    // glTextureSubImage2D), so the render thread never spends time on the
+    // copy or waits for the driver. The upload is fenced and flushed, and
+    // collect() on the render thread hands it to its callback once the
+    // fence has signaled; mesh vertex arrays, which contexts do not share,
+    // are created there.
+    //
+    // Without a shared context (createContext() failed or was never
+    // called) the same uploads run inside collect() instead, up to its byte
+    // budget, through a staging ring on the render context.
+    class UploadThread
+    {
+    public:
+        static constexpr uint64_t kDefaultStagingSize = 64ull << 20;
+
+        struct Stats
+        {
+            uint64_t uploads = 0;
+            uint64_t bytes = 0;
+            uint64_t stagingStalls = 0;
+        };
+
+        explicit UploadThread(uint64_t stagingSize = kDefaultStagingSize);
+        ~UploadThread();
+
+        UploadThread(const UploadThread&) = delete;
+        UploadThread& operator=(const UploadThread&) = delete;
+
+        // Main thread, while `window`'s context is not current anywhere
+        // (some platforms refuse to share with a context in use).
+        bool createContext(GLFWwindow* window);
+        // Once GL is loaded. Uploads queued earlier wait until then.
+        void start();
+        // Main thread, after the last collect(). Destroys the hidden window.
+        void stop();
+
+        bool threaded() const { return m_window != nullptr; }
+
+        // Render thread. The render context's state cache, which uploads
+        // run inside collect() bind through. Without one they use a cache
+        // of their own and leave the unpack state as they found it.
+        void setRenderState(GLStateCache* state) { m_renderState = state; }
+
+        // Any thread. The source bytes must stay valid until the callback;
+        // views must point into an AssetFile that stays open until then.
+        void uploadBuffer(const void* data, uint64_t size, GLbitfield storageFlags, UploadCallback callback, void* user);
+        void uploadMesh(const MeshView& mesh, UploadCallback callback, void* user);
+        void uploadTexture(const TextureView& texture, UploadCallback callback, void* user);
+
+        // Render thread, once per frame. Returns how many callbacks ran;
+        // `inlineBudget` only matters without an upload thread, and
+        // `inlineBytes`, when given, receives how much of it was spent.
+        uint32_t collect(uint64_t inlineBudget = UINT64_MAX, uint64_t* inlineBytes = nullptr);
+
+        // Render thread, at shutdown: waits for every queued upload,
+        // delivers it and frees the inline staging ring.
+        void drain();
+
+        Stats stats() const;
+
+    private:
+        struct Request
+        {
+            UploadKind kind = UploadKind::Buffer;
+            const std::byte* data = nullptr;
+            uint64_t size = 0;
+            GLbitfield storageFlags = 0;
+            MeshInfo mesh{};
+            const std::byte* indices = nullptr;
+            TextureInfo texture{};
+            UploadCallback callback = nullptr;
+            void* user = nullptr;
+        };
+
+        struct Finished
+        {
+            Request request;
+            UploadResult result;
+            GLsync fence = nullptr;
+        };
+
+        void push(const Request& request);
+        void uploadMain();
+        Finished process(GLStateCache& state, const Request& request);
+        GLuint copyToBuffer(const std::byte* data, uint64_t size, GLbitfield storageFlags);
+        GLuint copyToTexture(GLStateCache& state, const TextureInfo& info, const std::byte* base);
+        void deliver(Finished& finished);
+
+        uint64_t m_stagingSize;
+        GLFWwindow* m_window = nullptr;
+        StagingRing m_ring;         // owned by whichever thread runs process()
+        GLStateCache m_state;       // the upload context's, or inline uploads' without m_renderState
+        GLStateCache* m_renderState = nullptr;
+        std::thread m_thread;
+
+        std::mutex m_mutex;
+        std::condition_variable m_condition;
+        std::condition_variable m_idleCondition;
+        std::deque<Request> m_requests;
+        std::vector<Finished> m_finished;
+        bool m_busy = false;
+        bool m_started = false;
+        bool m_stopping = false;
+
+        // Render thread.
+        std::vector<Finished> m_pending;
+
+        std::atomic<uint64_t> m_uploadCount{0};
+        std::atomic<uint64_t> m_byteCount{0};
+        std::atomic<uint64_t> m_stallCount{0};
+    };
+}
@@ -0,0 +1,379 @@
+#include "scene/culling.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <cstring>
+
+#include "core/clock.hpp"
+#include "core/profiler.hpp"
+#include "math/simd.hpp"
+#include "memory/frame_arena.hpp"
+
+namespace bloom
+{
+    namespace
+    {
+        Vec4 row(const Mat4& m, int i)
+        {
+            return {m.cols[0][i], m.cols[1][i], m.cols[2][i], m.cols[3][i]};
+        }
+
+        Vec4 normalizePlane(Vec4 p)
+        {
+            const float length = std::sqrt(p.x * p.x + p.y * p.y + p.z * p.z);
+            return p * (1.f / length);
+        }
+
+        // Signed distance of the box's farthest point along the plane
+        // normal; negative means the whole box is outside.
+        float planeDistance(const Vec4& p, float cx, float cy, float cz, float ex, float ey, float ez)
+        {
+            return p.x * cx + p.y * cy + p.z * cz + p.w + std::abs(p.x) * ex + std::abs(p.y) * ey + std::abs(p.z) * ez;
+        }
+    }
+
+    Frustum Frustum::fromMatrix(const Mat4& viewProjection)
+    {
+        const Vec4 x = row(viewProjection, 0);
+        const Vec4 y = row(viewProjection, 1);
+        const Vec4 z = row(viewProjection, 2);
+        const Vec4 w = row(viewProjection, 3);
+
+        Frustum frustum;
+        frustum.planes[0] = normalizePlane(w + x);
+        frustum.planes[1] = normalizePlane(w - x);
+        frustum.planes[2] = normalizePlane(w + y);
+        frustum.planes[3] = normalizePlane(w - y);
+        frustum.planes[4] = normalizePlane(w + z);
+        frustum.planes[5] = normalizePlane(w - z);
+        return frustum;
+    }
+
+    uint32_t cullFrustumScalar(const Frustum& frustum, const BoundsArrays& bounds, uint32_t begin, uint32_t end, uint32_t* out)
+    {
+        uint32_t written = 0;
+        for (uint32_t i = begin; i < end; ++i)
+        {
+            bool inside = true;
+            for (const Vec4& plane : frustum.planes)
+            {
+                if (planeDistance(plane, bounds.centerX[i], bounds.centerY[i], bounds.centerZ[i],
+                                  bounds.extentX[i], bounds.extentY[i], bounds.extentZ[i]) < 0.f)
+                {
+                    inside = false;
+                    break;
+                }
+            }
+            if (inside)
+                out[written++] = i;
+        }
+        return written;
+    }
+
+    uint32_t cullFrustum(const Frustum& frustum, const BoundsArrays& bounds, uint32_t begin, uint32_t end, uint32_t* out)
+    {
+        uint32_t i = begin;
+        uint32_t written = 0;
+
+        // Each group keeps the minimum distance over all six planes and
+        // turns its sign into a lane mask. The survivors are appended
+        // without branching: every lane stores its index and only advances
+        // the cursor when it is visible.
+#if defined(BLOOM_MATH_AVX2)
+        {
+            using namespace simd;
+            Float8 nx[6], ny[6], nz[6], nw[6], ax[6], ay[6], az[6];
+            for (int p = 0; p < 6; ++p)
+            {
+                const Vec4& plane = frustum.planes[p];
+                nx[p] = splat8(plane.x), ny[p] = splat8(plane.y), nz[p] = splat8(plane.z), nw[p] = splat8(plane.w);
+                ax[p] = splat8(std::abs(plane.x)), ay[p] = splat8(std::abs(plane.y)), az[p] = splat8(std::abs(plane.z));
+            }
+
+            for (; i + 8 <= end; i += 8)
+            {
+                const Float8 cx = load8(bounds.centerX + i), cy = load8(bounds.centerY + i), cz = load8(bounds.centerZ + i);
+                const Float8 ex = load8(bounds.extentX + i), ey = load8(bounds.extentY + i), ez = load8(bounds.extentZ + i);
+
+                Float8 nearest = splat8(0.f);
+                for (int p = 0; p < 6; ++p)
+                {
+                    const Float8 distance = madd(nz[p], cz, madd(ny[p], cy, madd(nx[p], cx, nw[p])));
+                    const Float8 radius = madd(az[p], ez, madd(ay[p], ey, mul(ax[p], ex)));
+                    const Float8 d = add(distance, radius);
+                    nearest = p == 0 ? d : min(nearest, d);
+                }
+
+                const int outside = negativeMask(nearest);
+                for (uint32_t lane = 0; lane < 8; ++lane)
+                {
+                    out[written] = i + lane;
+                    written += ((outside >> lane) & 1) ^ 1;
+                }
+            }
+        }
+#endif
+
+        {
+            using namespace simd;
+            Float4 nx[6], ny[6], nz[6], nw[6], ax[6], ay[6], az[6];
+            for (int p = 0; p < 6; ++p)
+            {
+                const Vec4& plane = frustum.planes[p];
+                nx[p] = splat(plane.x), ny[p] = splat(plane.y), nz[p] = splat(plane.z), nw[p] = splat(plane.w);
+                ax[p] = splat(std::abs(plane.x)), ay[p] = splat(std::abs(plane.y)), az[p] = splat(std::abs(plane.z));
+            }
+
+            for (; i + 4 <= end; i += 4)
+            {
+                const Float4 cx = loadu(bounds.centerX + i), cy = loadu(bounds.centerY + i), cz = loadu(bounds.centerZ + i);
+                const Float4 ex = loadu(bounds.extentX + i), ey = loadu(bounds.extentY + i), ez = loadu(bounds.extentZ + i);
+
+                Float4 nearest = zero();
+                for (int p = 0; p < 6; ++p)
+                {
+                    const Float4 distance = madd(nz[p], cz, madd(ny[p], cy, madd(nx[p], cx, nw[p])));
+                    const Float4 radius = madd(az[p], ez, madd(ay[p], ey, mul(ax[p], ex)));
+                    const Float4 d = add(distance, radius);
+                    nearest = p == 0 ? d : min(nearest, d);
+                }
+
+                const int outside = negativeMask(nearest);
+                for (uint32_t lane = 0; lane < 4; ++lane)
+                {
+                    out[written] = i + lane;
+                    written += ((outside >> lane) & 1) ^ 1;
+                }
+            }
+        }
+
+        return written + cullFrustumScalar(frustum, bounds, i, end, out + written);
+    }
+
+    void DepthPyramid::build(const float* depth, int width, int height, const Mat4& viewProjection)
+    {
+        clear();
+        if (width <= 0 || height <= 0)
+            return;
+
+        m_width = width;
+        m_height = height;
+        m_viewProjection = viewProjection;
+
+        // Level L texel (x, y) covers pixels [x << L, (x + 1) << L) on each
+        // axis; rounding the sizes up keeps that true for odd sizes, with the
+        // missing neighbours clamped to the edge.
+        std::size_t total = 0;
+        for (int w = width, h = height;; w = (w + 1) / 2, h = (h + 1) / 2)
+        {
+            m_levels.push_back({w, h, total});
+            total += static_cast<std::size_t>(w) * static_cast<std::size_t>(h);
+            if (w == 1 && h == 1)
+                break;
+        }
+        m_texels.resize(total);
+        std::memcpy(m_texels.data(), depth, static_cast<std::size_t>(width) * static_cast<std::size_t>(height) * sizeof(float));
+
+        for (std::size_t l = 1; l < m_levels.size(); ++l)
+        {
+            const Level& src = m_levels[l - 1];
+            const Level& dst = m_levels[l];
+            const float* in = m_texels.data() + src.offset;
+            float* outTexels = m_texels.data() + dst.offset;
+            for (int y = 0; y < dst.height; ++y)
+            {
+                const float* row0 = in + static_cast<std::size_t>(2 * y) * src.width;
+                const float* row1 = in + static_cast<std::size_t>(std::min(2 * y + 1, src.height - 1)) * src.width;
+                for (int x = 0; x < dst.width; ++x)
+                {
+                    const int x0 = 2 * x;
+                    const int x1 = std::min(x0 + 1, src.width - 1);
+                    outTexels[static_cast<std::size_t>(y) * dst.width + x] =
+                        std::max(std::max(row0[x0], row0[x1]), std::max(row1[x0], row1[x1]));
+                }
+            }
+        }
+    }
+
+    void DepthPyramid::clear()
+    {
+        m_texels.clear();
+        m_levels.clear();
+        m_width = 0;
+        m_height = 0;
+    }
+
+    bool DepthPyramid::occluded(float centerX, float centerY, float centerZ, float extentX, float extentY, float extentZ) const
+    {
+        if (m_levels.empty())
+            return false;
+
+        using namespace simd;
+
+        // Corner clip positions are the centre's plus or minus each scaled
+        // column. The corners start one per register and two 4x4 transposes
+        // turn them into x, y, z and w of all eight in two registers each.
+        const Float4 axisX = mul(m_viewProjection.cols[0].simd(), splat(extentX));
+        const Float4 axisY = mul(m_viewProjection.cols[1].simd(), splat(extentY));
+        const Float4 axisZ = mul(m_viewProjection.cols[2].simd(), splat(extentZ));
+        const Float4 center = madd(m_viewProjection.cols[2].simd(), splat(centerZ),
+                                   madd(m_viewProjection.cols[1].simd(), splat(centerY),
+                                        madd(m_viewProjection.cols[0].simd(), splat(centerX), m_viewProjection.cols[3].simd())));
+
+        const Float4 lowSide = sub(center, axisZ);
+        const Float4 highSide = add(center, axisZ);
+        Float4 lowX = sub(sub(lowSide, axisX), axisY), lowY = sub(add(lowSide, axisX), axisY);
+        Float4 lowZ = add(sub(lowSide, axisX), axisY), lowW = add(add(lowSide, axisX), axisY);
+        Float4 highX = sub(sub(highSide, axisX), axisY), highY = sub(add(highSide, axisX), axisY);
+        Float4 highZ = add(sub(highSide, axisX), axisY), highW = add(add(highSide, axisX), axisY);
+        transpose(lowX, lowY, lowZ, lowW);
+        transpose(highX, highY, highZ, highW);
+
+        // Crossing the near plane: the projection is meaningless, and the
+        // box is right in front of the camera anyway.
+        const Float4 epsilon = splat(1e-5f);
+        if (negativeMask(min(sub(lowW, epsilon), sub(highW, epsilon))) != 0)
+            return false;
+
+        const Float4 inverseLow = div(splat(1.f), lowW);
+        const Float4 inverseHigh = div(splat(1.f), highW);
+        const Float4 ndcLowX = mul(lowX, inverseLow), ndcHighX = mul(highX, inverseHigh);
+        const Float4 ndcLowY = mul(lowY, inverseLow), ndcHighY = mul(highY, inverseHigh);
+        const Float4 ndcZ = min(mul(lowZ, inverseLow), mul(highZ, inverseHigh));
+
+        const auto horizontalMin = [](Float4 a)
+        {
+            a = min(a, swizzle<1, 0, 3, 2>(a));
+            return lane<0>(min(a, swizzle<2, 3, 0, 1>(a)));
+        };
+        const auto horizontalMax = [](Float4 a)
+        {
+            a = max(a, swizzle<1, 0, 3, 2>(a));
+            return lane<0>(max(a, swizzle<2, 3, 0, 1>(a)));
+        };
+        const float minX = horizontalMin(min(ndcLowX, ndcHighX));
+        const float maxX = horizontalMax(max(ndcLowX, ndcHighX));
+        const float minY = horizontalMin(min(ndcLowY, ndcHighY));
+        const float maxY = horizontalMax(max(ndcLowY, ndcHighY));
+        const float minZ = horizontalMin(ndcZ);
+
+        if (minX >= 1.f || minY >= 1.f || maxX <= -1.f || maxY <= -1.f)
+            return false;
+
+        const float nearest = minZ * 0.5f + 0.5f;
+        const float left = std::max(0.f, (minX * 0.5f + 0.5f) * static_cast<float>(m_width));
+        const float right = std::min(static_cast<float>(m_width - 1), (maxX * 0.5f + 0.5f) * static_cast<float>(m_width));
+        const float bottom = std::max(0.f, (minY * 0.5f + 0.5f) * static_cast<float>(m_height));
+        const float top = std::min(static_cast<float>(m_height - 1), (maxY * 0.5f + 0.5f) * static_cast<float>(m_height));
+
+        // One texel at this level is at least as large as the rectangle,
+        // so it touches at most two texels per axis.
+        const float size = std::max(right - left, top - bottom);
+        const auto span = static_cast<uint32_t>(std::ceil(size));
+        const int level = std::min(span > 1 ? static_cast<int>(std::bit_width(span - 1)) : 0, levelCount() - 1);
+
+        const Level& l = m_levels[static_cast<std::size_t>(level)];
+        const float* texels = m_texels.data() + l.offset;
+        const int x0 = static_cast<int>(left) >> level;
+        const int x1 = std::min(static_cast<int>(right) >> level, l.width - 1);
+        const int y0 = static_cast<int>(bottom) >> level;
+        const int y1 = std::min(static_cast<int>(top) >> level, l.height - 1);
+
+        float farthest = 0.f;
+        for (int y = y0; y <= y1; ++y)
+        {
+            for (int x = x0; x <= x1; ++x)
+                farthest = std::max(farthest, texels[static_cast<std::size_t>(y) * l.width + x]);
+        }
+        return nearest > farthest;
+    }
+
+    std::span<const uint32_t> Culler::cull(JobSystem& jobs, const Frustum& frustum, const BoundsArrays& bounds, uint32_t count,
+                                           const DepthPyramid* occlusion)
+    {
+        BLOOM_PROFILE_ZONE("Cull");
+
+        const uint32_t chunks = (count + kGrain - 1) / kGrain;
+        if (m_visible.size() < count)
+            m_visible.resize(count);
+
+        // Per-chunk survivors before compaction, on the calling thread's
+        // frame arena.
+        ArenaScope arenaScope;
+        FrameArena& arena = FrameArena::thread();
+        uint32_t* scratch = arena.allocateArray<uint32_t>(count);
+        uint32_t* chunkCounts = arena.allocateArray<uint32_t>(chunks);
+        uint32_t* chunkOffsets = arena.allocateArray<uint32_t>(chunks);
+        if (!scratch || !chunkCounts || !chunkOffsets)
+        {
+            m_stats = {};
+            return {};
+        }
+
+        m_stats = {};
+        m_stats.tested = count;
+
+        uint64_t start = Clock::now();
+        jobs.parallelFor(chunks, 1, [&](uint32_t first, uint32_t last)
+        {
+            for (uint32_t chunk = first; chunk < last; ++chunk)
+            {
+                const uint32_t begin = chunk * kGrain;
+                const uint32_t end = std::min(count, begin + kGrain);
+                chunkCounts[chunk] = cullFrustum(frustum, bounds, begin, end, scratch + begin);
+            }
+        });
+        uint64_t now = Clock::now();
+        m_stats.frustumMs = Clock::toMilliseconds(now - start);
+
+        uint32_t survivors = 0;
+        for (uint32_t chunk = 0; chunk < chunks; ++chunk)
+            survivors += chunkCounts[chunk];
+        m_stats.frustumCulled = count - survivors;
+
+        if (occlusion && !occlusion->empty())
+        {
+            start = now;
+            jobs.parallelFor(chunks, 1, [&](uint32_t first, uint32_t last)
+            {
+                for (uint32_t chunk = first; chunk < last; ++chunk)
+                {
+                    uint32_t* indices = scratch + chunk * kGrain;
+                    uint32_t kept = 0;
+                    for (uint32_t k = 0; k < chunkCounts[chunk]; ++k)
+                    {
+                        const uint32_t i = indices[k];
+                        indices[kept] = i;
+                        kept += occlusion->occluded(bounds.centerX[i], bounds.centerY[i], bounds.centerZ[i],
+                                                    bounds.extentX[i], bounds.extentY[i], bounds.extentZ[i]) ? 0 : 1;
+                    }
+                    chunkCounts[chunk] = kept;
+                }
+            });
+            now = Clock::now();
+            m_stats.occlusionMs = Clock::toMilliseconds(now - start);
+        }
+
+        start = now;
+        uint32_t total = 0;
+        for (uint32_t chunk = 0; chunk < chunks; ++chunk)
+        {
+            chunkOffsets[chunk] = total;
+            total += chunkCounts[chunk];
+        }
+        jobs.parallelFor(chunks, 1, [&](uint32_t first, uint32_t last)
+        {
+            for (uint32_t chunk = first; chunk < last; ++chunk)
+            {
+                std::memcpy(m_visible.data() + chunkOffsets[chunk], scratch + chunk * kGrain,
+                            chunkCounts[chunk] * sizeof(uint32_t));
+            }
+        });
+        m_stats.compactMs = Clock::toMilliseconds(Clock::now() - start);
+
+        m_stats.occlusionCulled = survivors - total;
+        m_stats.visible = total;
+        return visible();
+    }
+}
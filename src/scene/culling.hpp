@@ -0,0 +1,120 @@
+#pragma once
+
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include "jobs/job_system.hpp"
+#include "math/mat4.hpp"
+
+namespace bloom
+{
+    // World-space axis-aligned boxes as structure-of-arrays, centre and
+    // half-size per axis, so the frustum test loads eight (or four) boxes
+    // per register.
+    struct BoundsArrays
+    {
+        const float* centerX;
+        const float* centerY;
+        const float* centerZ;
+        const float* extentX;
+        const float* extentY;
+        const float* extentZ;
+    };
+
+    struct Frustum
+    {
+        // (a, b, c, d) with a*x + b*y + c*z + d >= 0 on the inside, (a, b, c)
+        // unit length. Left, right, bottom, top, near, far.
+        Vec4 planes[6];
+
+        // Gribb-Hartmann extraction from a GL clip-space matrix.
+        static Frustum fromMatrix(const Mat4& viewProjection);
+    };
+
+    // Writes the indices in [begin, end) whose boxes are not entirely
+    // outside one plane to `out`, ascending, and returns how many. Boxes
+    // straddling a corner of the frustum are kept. `out` needs room for
+    // end - begin indices.
+    uint32_t cullFrustum(const Frustum& frustum, const BoundsArrays& bounds, uint32_t begin, uint32_t end, uint32_t* out);
+    // The same test one box at a time; the reference for the SIMD path.
+    uint32_t cullFrustumScalar(const Frustum& frustum, const BoundsArrays& bounds, uint32_t begin, uint32_t end, uint32_t* out);
+
+    // Hierarchical-Z occlusion from an earlier frame's depth buffer.
+    //
+    // build() keeps a mip chain of the depth where every texel holds the
+    // farthest depth of the pixels it covers. occluded() projects a box
+    // with the matrix the depth was rendered with, picks the level where
+    // its screen rectangle spans at most 2x2 texels and reports it hidden
+    // when its nearest point is behind all of them. The depth is a frame
+    // old, so objects that were just uncovered pop in a frame late; the
+    // usual source is a fenced pixel-pack readback like FrameCapture's.
+    class DepthPyramid
+    {
+    public:
+        // `depth` is width * height window-space depths in [0, 1], rows
+        // bottom-up as glReadPixels returns them.
+        void build(const float* depth, int width, int height, const Mat4& viewProjection);
+        void clear();
+
+        bool empty() const { return m_levels.empty(); }
+        int width() const { return m_width; }
+        int height() const { return m_height; }
+        int levelCount() const { return static_cast<int>(m_levels.size()); }
+
+        bool occluded(float centerX, float centerY, float centerZ, float extentX, float extentY, float extentZ) const;
+
+    private:
+        struct Level
+        {
+            int width = 0;
+            int height = 0;
+            std::size_t offset = 0;
+        };
+
+        std::vector<float> m_texels;
+        std::vector<Level> m_levels;
+        Mat4 m_viewProjection;
+        int m_width = 0;
+        int m_height = 0;
+    };
+
+    // Frustum and occlusion culling of many boxes across the job system.
+    //
+    // cull() splits the boxes into kGrain chunks. The first stage runs the
+    // SIMD frustum test on every chunk, compacting survivors into the
+    // chunk's own slice of a scratch array; the second runs the Hi-Z test
+    // over those survivors in place; the last concatenates the slices. The
+    // result is the visible indices in ascending order, ready to be split
+    // across jobs again and fed to MeshBatchRenderer::submit or a
+    // RenderQueue without another pass. Allocation only happens when the
+    // box count grows.
+    class Culler
+    {
+    public:
+        static constexpr uint32_t kGrain = 16384;
+
+        struct Stats
+        {
+            uint32_t tested = 0;
+            uint32_t frustumCulled = 0;
+            uint32_t occlusionCulled = 0;
+            uint32_t visible = 0;
+            double frustumMs = 0.0;
+            double occlusionMs = 0.0;
+            double compactMs = 0.0;
+        };
+
+        // `occlusion` may be null or empty to skip the Hi-Z stage. The span
+        // stays valid until the next cull().
+        std::span<const uint32_t> cull(JobSystem& jobs, const Frustum& frustum, const BoundsArrays& bounds, uint32_t count,
+                                       const DepthPyramid* occlusion = nullptr);
+
+        std::span<const uint32_t> visible() const { return {m_visible.data(), m_stats.visible}; }
+        const Stats& stats() const { return m_stats; }
+
+    private:
+        std::vector<uint32_t> m_visible;
+        Stats m_stats;
+    };
+}
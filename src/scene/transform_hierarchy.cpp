@@ -0,0 +1,416 @@
+#include "scene/transform_hierarchy.hpp"
+
+#include <algorithm>
+#include <cstdio>
+
+#include "math/batch.hpp"
+#include "memory/frame_arena.hpp"
+#include "memory/memory.hpp"
+
+namespace bloom
+{
+    namespace
+    {
+        constexpr uint32_t kUnknownDepth = ~0u;
+        constexpr uint32_t kDeadDepth = ~0u - 1;
+        constexpr Mat4 kIdentity = Mat4::identity();
+
+        // rebuild()'s working arrays, on the calling thread's frame arena.
+        using ScratchVector = std::vector<uint32_t, ArenaAllocator<uint32_t>>;
+
+        template <typename T>
+        void permute(std::vector<T>& values, const ScratchVector& order)
+        {
+            std::vector<T> sorted(order.size());
+            for (std::size_t i = 0; i < order.size(); ++i)
+                sorted[i] = values[order[i]];
+            values.swap(sorted);
+        }
+    }
+
+    TransformHandle TransformHierarchy::create(TransformHandle parent, const LocalTransform& local)
+    {
+        MemoryTagScope tag(MemoryTag::Scene);
+        uint32_t parentIndex = kNone;
+        if (parent.valid())
+        {
+            if (!alive(parent))
+            {
+                std::fprintf(stderr, "TransformHierarchy: parent node is not alive\n");
+                return {};
+            }
+            parentIndex = parent.index;
+        }
+
+        uint32_t index;
+        if (!m_freeNodes.empty())
+        {
+            index = m_freeNodes.back();
+            m_freeNodes.pop_back();
+        }
+        else
+        {
+            index = static_cast<uint32_t>(m_nodes.size());
+            m_nodes.emplace_back();
+        }
+
+        Node& node = m_nodes[index];
+        node.slot = static_cast<uint32_t>(m_slotNode.size());
+        node.parent = parentIndex;
+        node.alive = true;
+
+        m_slotNode.push_back(index);
+        m_parentSlot.push_back(kNone);    // resolved by rebuild()
+        m_positionX.push_back(local.position.x);
+        m_positionY.push_back(local.position.y);
+        m_positionZ.push_back(local.position.z);
+        m_rotationX.push_back(local.rotation.x);
+        m_rotationY.push_back(local.rotation.y);
+        m_rotationZ.push_back(local.rotation.z);
+        m_rotationW.push_back(local.rotation.w);
+        m_scaleX.push_back(local.scale.x);
+        m_scaleY.push_back(local.scale.y);
+        m_scaleZ.push_back(local.scale.z);
+        m_local.emplace_back();
+        m_world.emplace_back();
+        m_localDirty.push_back(0);
+        m_changedFrame.push_back(m_frame);
+
+        m_layoutDirty = true;
+        markDirty(node.slot);
+        return {index, node.generation};
+    }
+
+    void TransformHierarchy::destroy(TransformHandle node)
+    {
+        if (!alive(node))
+            return;
+        // The slot stays until rebuild() drops it along with the subtree.
+        m_nodes[node.index].alive = false;
+        m_layoutDirty = true;
+    }
+
+    bool TransformHierarchy::alive(TransformHandle node) const
+    {
+        return node.index < m_nodes.size() && m_nodes[node.index].alive && m_nodes[node.index].generation == node.generation;
+    }
+
+    bool TransformHierarchy::setParent(TransformHandle node, TransformHandle parent)
+    {
+        if (!alive(node))
+            return false;
+
+        uint32_t parentIndex = kNone;
+        if (parent.valid())
+        {
+            if (!alive(parent))
+                return false;
+            for (uint32_t ancestor = parent.index; ancestor != kNone; ancestor = m_nodes[ancestor].parent)
+            {
+                if (ancestor == node.index)
+                    return false;
+            }
+            parentIndex = parent.index;
+        }
+
+        Node& entry = m_nodes[node.index];
+        if (entry.parent != parentIndex)
+        {
+            entry.parent = parentIndex;
+            m_layoutDirty = true;
+            markDirty(entry.slot);
+        }
+        return true;
+    }
+
+    TransformHandle TransformHierarchy::parent(TransformHandle node) const
+    {
+        if (!alive(node))
+            return {};
+        const uint32_t index = m_nodes[node.index].parent;
+        if (index == kNone)
+            return {};
+        return {index, m_nodes[index].generation};
+    }
+
+    void TransformHierarchy::setLocal(TransformHandle node, const LocalTransform& local)
+    {
+        const uint32_t slot = slotOf(node);
+        if (slot == kNone)
+            return;
+        m_positionX[slot] = local.position.x;
+        m_positionY[slot] = local.position.y;
+        m_positionZ[slot] = local.position.z;
+        m_rotationX[slot] = local.rotation.x;
+        m_rotationY[slot] = local.rotation.y;
+        m_rotationZ[slot] = local.rotation.z;
+        m_rotationW[slot] = local.rotation.w;
+        m_scaleX[slot] = local.scale.x;
+        m_scaleY[slot] = local.scale.y;
+        m_scaleZ[slot] = local.scale.z;
+        markDirty(slot);
+    }
+
+    void TransformHierarchy::setPosition(TransformHandle node, Vec3 position)
+    {
+        const uint32_t slot = slotOf(node);
+        if (slot == kNone)
+            return;
+        m_positionX[slot] = position.x;
+        m_positionY[slot] = position.y;
+        m_positionZ[slot] = position.z;
+        markDirty(slot);
+    }
+
+    void TransformHierarchy::setRotation(TransformHandle node, Quat rotation)
+    {
+        const uint32_t slot = slotOf(node);
+        if (slot == kNone)
+            return;
+        m_rotationX[slot] = rotation.x;
+        m_rotationY[slot] = rotation.y;
+        m_rotationZ[slot] = rotation.z;
+        m_rotationW[slot] = rotation.w;
+        markDirty(slot);
+    }
+
+    void TransformHierarchy::setScale(TransformHandle node, Vec3 scale)
+    {
+        const uint32_t slot = slotOf(node);
+        if (slot == kNone)
+            return;
+        m_scaleX[slot] = scale.x;
+        m_scaleY[slot] = scale.y;
+        m_scaleZ[slot] = scale.z;
+        markDirty(slot);
+    }
+
+    LocalTransform TransformHierarchy::local(TransformHandle node) const
+    {
+        const uint32_t slot = slotOf(node);
+        if (slot == kNone)
+            return {};
+        return {{m_positionX[slot], m_positionY[slot], m_positionZ[slot]},
+                {m_rotationX[slot], m_rotationY[slot], m_rotationZ[slot], m_rotationW[slot]},
+                {m_scaleX[slot], m_scaleY[slot], m_scaleZ[slot]}};
+    }
+
+    const Mat4& TransformHierarchy::world(TransformHandle node) const
+    {
+        const uint32_t slot = slotOf(node);
+        return slot == kNone ? kIdentity : m_world[slot];
+    }
+
+    bool TransformHierarchy::changed(TransformHandle node) const
+    {
+        const uint32_t slot = slotOf(node);
+        return slot != kNone && m_changedFrame[slot] == m_frame;
+    }
+
+    void TransformHierarchy::reserve(std::size_t nodes)
+    {
+        MemoryTagScope tag(MemoryTag::Scene);
+        m_nodes.reserve(nodes);
+        m_slotNode.reserve(nodes);
+        m_parentSlot.reserve(nodes);
+        for (std::vector<float>* values : {&m_positionX, &m_positionY, &m_positionZ, &m_rotationX, &m_rotationY,
+                                           &m_rotationZ, &m_rotationW, &m_scaleX, &m_scaleY, &m_scaleZ})
+            values->reserve(nodes);
+        m_local.reserve(nodes);
+        m_world.reserve(nodes);
+        m_localDirty.reserve(nodes);
+        m_changedFrame.reserve(nodes);
+    }
+
+    void TransformHierarchy::markDirty(uint32_t slot)
+    {
+        m_localDirty[slot] = 1;
+        // Test first so concurrent setters only share the line for reading.
+        if (!m_anyDirty.load(std::memory_order_relaxed))
+            m_anyDirty.store(true, std::memory_order_relaxed);
+    }
+
+    void TransformHierarchy::rebuild()
+    {
+        MemoryTagScope tag(MemoryTag::Scene);
+        ArenaScope arenaScope;
+
+        // Depth of every node, walking up each chain only until it meets a
+        // node already resolved; a destroyed ancestor condemns the subtree.
+        ScratchVector depth(m_nodes.size(), kUnknownDepth);
+        ScratchVector chain;
+        chain.reserve(64);
+        uint32_t maxDepth = 0;
+        for (uint32_t index : m_slotNode)
+        {
+            uint32_t current = index;
+            uint32_t next;
+            for (;;)
+            {
+                if (depth[current] != kUnknownDepth)
+                {
+                    next = depth[current] == kDeadDepth ? kDeadDepth : depth[current] + 1;
+                    break;
+                }
+                chain.push_back(current);
+                const Node& node = m_nodes[current];
+                if (!node.alive)
+                {
+                    next = kDeadDepth;
+                    break;
+                }
+                if (node.parent == kNone)
+                {
+                    next = 0;
+                    break;
+                }
+                current = node.parent;
+            }
+            for (; !chain.empty(); chain.pop_back())
+            {
+                depth[chain.back()] = next;
+                if (next != kDeadDepth)
+                {
+                    maxDepth = std::max(maxDepth, next);
+                    ++next;
+                }
+            }
+        }
+
+        // Counting sort of the surviving slots by depth.
+        m_levelStart.assign(maxDepth + 2, 0);
+        for (uint32_t index : m_slotNode)
+        {
+            if (depth[index] != kDeadDepth)
+                ++m_levelStart[depth[index] + 1];
+        }
+        for (std::size_t level = 1; level < m_levelStart.size(); ++level)
+            m_levelStart[level] += m_levelStart[level - 1];
+
+        ScratchVector cursor(m_levelStart.begin(), m_levelStart.end() - 1);
+        ScratchVector order(m_levelStart.back());
+        for (uint32_t slot = 0; slot < m_slotNode.size(); ++slot)
+        {
+            Node& node = m_nodes[m_slotNode[slot]];
+            const uint32_t d = depth[m_slotNode[slot]];
+            if (d == kDeadDepth)
+            {
+                node = {kNone, node.generation + 1, kNone, false};
+                m_freeNodes.push_back(m_slotNode[slot]);
+                continue;
+            }
+            const uint32_t sorted = cursor[d]++;
+            order[sorted] = slot;
+            node.slot = sorted;
+        }
+        if (order.empty())
+            m_levelStart.clear();
+
+        permute(m_slotNode, order);
+        permute(m_positionX, order);
+        permute(m_positionY, order);
+        permute(m_positionZ, order);
+        permute(m_rotationX, order);
+        permute(m_rotationY, order);
+        permute(m_rotationZ, order);
+        permute(m_rotationW, order);
+        permute(m_scaleX, order);
+        permute(m_scaleY, order);
+        permute(m_scaleZ, order);
+        permute(m_local, order);
+        permute(m_world, order);
+        permute(m_localDirty, order);
+        permute(m_changedFrame, order);
+
+        m_parentSlot.resize(order.size());
+        for (uint32_t slot = 0; slot < order.size(); ++slot)
+        {
+            const uint32_t parent = m_nodes[m_slotNode[slot]].parent;
+            m_parentSlot[slot] = parent == kNone ? kNone : m_nodes[parent].slot;
+        }
+
+        m_layoutDirty = false;
+    }
+
+    void TransformHierarchy::update(JobSystem& jobs)
+    {
+        m_stats = {};
+        if (m_layoutDirty)
+        {
+            rebuild();
+            m_stats.rebuilt = true;
+        }
+        ++m_frame;
+        m_stats.levels = static_cast<uint32_t>(levelCount());
+        m_stats.nodes = static_cast<uint32_t>(size());
+
+        // Nothing was set since the last update: every world matrix stands.
+        if (!m_anyDirty.exchange(false, std::memory_order_relaxed))
+            return;
+
+        // Levels run one after another since each reads its parents' world
+        // matrices; the nodes within a level are independent.
+        m_recomputed.store(0, std::memory_order_relaxed);
+        for (std::size_t level = 0; level < levelCount(); ++level)
+        {
+            const uint32_t begin = m_levelStart[level];
+            const uint32_t end = m_levelStart[level + 1];
+            jobs.parallelFor(end - begin, kGrain, [this, begin](uint32_t first, uint32_t last)
+            {
+                updateRange(begin + first, begin + last);
+            });
+        }
+        m_stats.recomputed = m_recomputed.load(std::memory_order_relaxed);
+    }
+
+    void TransformHierarchy::updateRange(uint32_t begin, uint32_t end)
+    {
+        const uint32_t count = end - begin;
+
+        // Rebuild the local matrices that were set. When most of the range
+        // is animated the SoA batch kernel composes all of it faster than
+        // picking out the dirty ones; clean entries come out unchanged.
+        uint32_t dirty = 0;
+        for (uint32_t i = begin; i < end; ++i)
+            dirty += m_localDirty[i];
+        if (dirty * 2 > count)
+        {
+            const TransformArrays in{m_positionX.data() + begin, m_positionY.data() + begin, m_positionZ.data() + begin,
+                                     m_rotationX.data() + begin, m_rotationY.data() + begin, m_rotationZ.data() + begin,
+                                     m_rotationW.data() + begin, m_scaleX.data() + begin, m_scaleY.data() + begin,
+                                     m_scaleZ.data() + begin};
+            composeTransforms(in, m_local.data() + begin, count);
+        }
+        else if (dirty > 0)
+        {
+            for (uint32_t i = begin; i < end; ++i)
+            {
+                if (m_localDirty[i])
+                {
+                    m_local[i] = Mat4::trs({m_positionX[i], m_positionY[i], m_positionZ[i]},
+                                           {m_rotationX[i], m_rotationY[i], m_rotationZ[i], m_rotationW[i]},
+                                           {m_scaleX[i], m_scaleY[i], m_scaleZ[i]});
+                }
+            }
+        }
+
+        // World matrices for the nodes set directly and for the children of
+        // anything the previous level recomputed; the rest keep last
+        // frame's matrix.
+        uint32_t recomputed = 0;
+        for (uint32_t i = begin; i < end; ++i)
+        {
+            const uint32_t parent = m_parentSlot[i];
+            const bool parentChanged = parent != kNone && m_changedFrame[parent] == m_frame;
+            if (!m_localDirty[i] && !parentChanged)
+                continue;
+
+            m_world[i] = parent == kNone ? m_local[i] : m_world[parent] * m_local[i];
+            m_changedFrame[i] = m_frame;
+            m_localDirty[i] = 0;
+            ++recomputed;
+        }
+        if (recomputed > 0)
+            m_recomputed.fetch_add(recomputed, std::memory_order_relaxed);
+    }
+}
@@ -0,0 +1,128 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "jobs/job_system.hpp"
+#include "math/mat4.hpp"
+
+namespace bloom
+{
+    struct TransformHandle
+    {
+        uint32_t index = ~0u;
+        uint32_t generation = 0;
+
+        bool valid() const { return index != ~0u; }
+        bool operator==(const TransformHandle&) const = default;
+    };
+
+    struct LocalTransform
+    {
+        Vec3 position;
+        Quat rotation;
+        Vec3 scale{1.f};
+    };
+
+    // Parent-relative transforms and their world matrices for a forest of
+    // nodes.
+    //
+    // Nodes live in structure-of-arrays storage sorted by depth, so every
+    // parent precedes its children and each depth level is one contiguous
+    // range. update() walks the levels in order and splits each one across
+    // the job system; a node is recomputed only if its local transform was
+    // set since the last update or its parent's world matrix changed in
+    // this one, so untouched subtrees cost a flag check per node and a
+    // fully static hierarchy costs nothing.
+    //
+    // Structural changes (create, destroy, setParent) are deferred: they
+    // mark the layout stale and update() re-sorts it in one O(n) pass.
+    // They must not overlap update(). The local setters may be called from
+    // several threads at once as long as each node has one writer.
+    class TransformHierarchy
+    {
+    public:
+        struct UpdateStats
+        {
+            uint32_t levels = 0;
+            uint32_t nodes = 0;
+            uint32_t recomputed = 0;
+            bool rebuilt = false;
+        };
+
+        // Nodes per job when a level is split across workers.
+        static constexpr uint32_t kGrain = 2048;
+
+        TransformHandle create(TransformHandle parent = {}, const LocalTransform& local = {});
+        // Also destroys every descendant, which stay alive() until the next
+        // update().
+        void destroy(TransformHandle node);
+        bool alive(TransformHandle node) const;
+
+        // Fails (returning false) if it would create a cycle.
+        bool setParent(TransformHandle node, TransformHandle parent);
+        TransformHandle parent(TransformHandle node) const;
+
+        // Setters ignore handles that are not alive(); getters return
+        // defaults for them.
+        void setLocal(TransformHandle node, const LocalTransform& local);
+        void setPosition(TransformHandle node, Vec3 position);
+        void setRotation(TransformHandle node, Quat rotation);
+        void setScale(TransformHandle node, Vec3 scale);
+        LocalTransform local(TransformHandle node) const;
+
+        // Valid after update().
+        const Mat4& world(TransformHandle node) const;
+        // Whether update() recomputed the node's world matrix.
+        bool changed(TransformHandle node) const;
+
+        void update(JobSystem& jobs);
+
+        void reserve(std::size_t nodes);
+        std::size_t size() const { return m_slotNode.size(); }
+        std::size_t levelCount() const { return m_levelStart.empty() ? 0 : m_levelStart.size() - 1; }
+        const UpdateStats& lastUpdate() const { return m_stats; }
+
+    private:
+        static constexpr uint32_t kNone = ~0u;
+
+        struct Node
+        {
+            uint32_t slot = kNone;
+            uint32_t generation = 0;
+            uint32_t parent = kNone;    // node index
+            bool alive = false;
+        };
+
+        // kNone unless the handle is alive().
+        uint32_t slotOf(TransformHandle node) const { return alive(node) ? m_nodes[node.index].slot : kNone; }
+        void markDirty(uint32_t slot);
+        void rebuild();
+        void updateRange(uint32_t begin, uint32_t end);
+
+        std::vector<Node> m_nodes;
+        std::vector<uint32_t> m_freeNodes;
+
+        // Slot-indexed, depth-sorted after rebuild(); new nodes are appended
+        // until then.
+        std::vector<uint32_t> m_slotNode;
+        std::vector<uint32_t> m_parentSlot;
+        std::vector<float> m_positionX, m_positionY, m_positionZ;
+        std::vector<float> m_rotationX, m_rotationY, m_rotationZ, m_rotationW;
+        std::vector<float> m_scaleX, m_scaleY, m_scaleZ;
+        std::vector<Mat4> m_local;
+        std::vector<Mat4> m_world;
+        std::vector<uint8_t> m_localDirty;
+        std::vector<uint32_t> m_changedFrame;
+
+        std::vector<uint32_t> m_levelStart;
+        bool m_layoutDirty = false;
+        std::atomic<bool> m_anyDirty{false};
+        uint32_t m_frame = 0;
+
+        std::atomic<uint32_t> m_recomputed{0};
+        UpdateStats m_stats;
+    };
+}
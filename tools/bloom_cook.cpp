@@ -0,0 +1,405 @@
+// Offline asset cook: reads a manifest and writes one container for
+// AssetFile. Every conversion (OBJ parsing, index deduplication, mip
+// generation) happens here, so loading at run time is a mapping and a few
+// range checks.
+//
+//   bloom_cook MANIFEST OUTPUT
+//
+// Manifest lines, '#' starts a comment, paths are relative to the manifest:
+//
+//   mesh    NAME obj PATH                   Wavefront OBJ, triangulated
+//   mesh    NAME grid COLUMNS ROWS          rolling terrain grid
+//   texture NAME rgba8 WIDTH HEIGHT PATH    raw RGBA8 pixels, mips generated
+//   texture NAME checker SIZE CELL          checkerboard, mips generated
+//   blob    NAME PATH                       file contents as-is
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "glad/glad.h"
+
+#include "asset/asset_writer.hpp"
+
+namespace
+{
+    // Every cooked mesh uses this layout.
+    struct Vertex
+    {
+        float position[3];
+        float normal[3];
+        float uv[2];
+    };
+
+    constexpr bloom::VertexAttribute kVertexLayout[] = {
+        {0, 3, GL_FLOAT, 0, 0, offsetof(Vertex, position)},
+        {1, 3, GL_FLOAT, 0, 0, offsetof(Vertex, normal)},
+        {2, 2, GL_FLOAT, 0, 0, offsetof(Vertex, uv)},
+    };
+
+    struct Mesh
+    {
+        std::vector<Vertex> vertices;
+        std::vector<uint32_t> indices;
+    };
+
+    bool readFile(const std::filesystem::path& path, std::vector<std::byte>& data)
+    {
+        std::ifstream file(path, std::ios::binary);
+        if (!file)
+        {
+            std::fprintf(stderr, "Failed to open %s\n", path.string().c_str());
+            return false;
+        }
+        file.seekg(0, std::ios::end);
+        data.resize(static_cast<std::size_t>(file.tellg()));
+        file.seekg(0);
+        file.read(reinterpret_cast<char*>(data.data()), static_cast<std::streamsize>(data.size()));
+        return static_cast<bool>(file);
+    }
+
+    // OBJ index: 1-based, negative counts back from the end, 0 is absent.
+    int resolveIndex(int index, std::size_t count)
+    {
+        return index > 0 ? index - 1 : (index < 0 ? static_cast<int>(count) + index : -1);
+    }
+
+    bool loadObj(const std::filesystem::path& path, Mesh& mesh)
+    {
+        std::ifstream file(path);
+        if (!file)
+        {
+            std::fprintf(stderr, "Failed to open %s\n", path.string().c_str());
+            return false;
+        }
+
+        std::vector<float> positions, normals, uvs;
+        // Each distinct position/uv/normal triple becomes one vertex.
+        std::unordered_map<std::string, uint32_t> unique;
+        std::vector<uint32_t> polygon;
+        std::string line;
+        bool hasNormals = false;
+
+        for (int number = 1; std::getline(file, line); ++number)
+        {
+            std::istringstream words(line);
+            std::string keyword;
+            words >> keyword;
+            if (keyword == "v" || keyword == "vn")
+            {
+                float x = 0.f, y = 0.f, z = 0.f;
+                words >> x >> y >> z;
+                std::vector<float>& target = keyword == "v" ? positions : normals;
+                target.insert(target.end(), {x, y, z});
+            }
+            else if (keyword == "vt")
+            {
+                float u = 0.f, v = 0.f;
+                words >> u >> v;
+                uvs.insert(uvs.end(), {u, v});
+            }
+            else if (keyword == "f")
+            {
+                polygon.clear();
+                std::string corner;
+                while (words >> corner)
+                {
+                    auto [it, inserted] = unique.try_emplace(corner, static_cast<uint32_t>(mesh.vertices.size()));
+                    if (inserted)
+                    {
+                        int p = 0, t = 0, n = 0;
+                        if (std::sscanf(corner.c_str(), "%d/%d/%d", &p, &t, &n) != 3 &&
+                            std::sscanf(corner.c_str(), "%d//%d", &p, &n) != 2 &&
+                            std::sscanf(corner.c_str(), "%d/%d", &p, &t) != 2 &&
+                            std::sscanf(corner.c_str(), "%d", &p) != 1)
+                        {
+                            std::fprintf(stderr, "%s:%d: bad face corner '%s'\n", path.string().c_str(), number, corner.c_str());
+                            return false;
+                        }
+
+                        const int pi = resolveIndex(p, positions.size() / 3);
+                        const int ti = resolveIndex(t, uvs.size() / 2);
+                        const int ni = resolveIndex(n, normals.size() / 3);
+                        if (pi < 0 || pi * 3 >= static_cast<int>(positions.size()))
+                        {
+                            std::fprintf(stderr, "%s:%d: position index out of range\n", path.string().c_str(), number);
+                            return false;
+                        }
+
+                        Vertex vertex{};
+                        std::memcpy(vertex.position, &positions[pi * 3], sizeof(vertex.position));
+                        if (ti >= 0 && ti * 2 < static_cast<int>(uvs.size()))
+                            std::memcpy(vertex.uv, &uvs[ti * 2], sizeof(vertex.uv));
+                        if (ni >= 0 && ni * 3 < static_cast<int>(normals.size()))
+                        {
+                            std::memcpy(vertex.normal, &normals[ni * 3], sizeof(vertex.normal));
+                            hasNormals = true;
+                        }
+                        mesh.vertices.push_back(vertex);
+                    }
+                    polygon.push_back(it->second);
+                }
+
+                // Fan triangulation; fine for the convex faces exporters write.
+                for (std::size_t i = 2; i < polygon.size(); ++i)
+                    mesh.indices.insert(mesh.indices.end(), {polygon[0], polygon[i - 1], polygon[i]});
+            }
+        }
+
+        // No normals in the file: accumulate face normals per vertex.
+        if (!hasNormals)
+        {
+            for (std::size_t i = 0; i + 2 < mesh.indices.size(); i += 3)
+            {
+                Vertex& a = mesh.vertices[mesh.indices[i]];
+                Vertex& b = mesh.vertices[mesh.indices[i + 1]];
+                Vertex& c = mesh.vertices[mesh.indices[i + 2]];
+                const float e1[3] = {b.position[0] - a.position[0], b.position[1] - a.position[1], b.position[2] - a.position[2]};
+                const float e2[3] = {c.position[0] - a.position[0], c.position[1] - a.position[1], c.position[2] - a.position[2]};
+                const float n[3] = {e1[1] * e2[2] - e1[2] * e2[1], e1[2] * e2[0] - e1[0] * e2[2], e1[0] * e2[1] - e1[1] * e2[0]};
+                for (Vertex* v : {&a, &b, &c})
+                {
+                    for (int k = 0; k < 3; ++k)
+                        v->normal[k] += n[k];
+                }
+            }
+            for (Vertex& v : mesh.vertices)
+            {
+                const float length = std::sqrt(v.normal[0] * v.normal[0] + v.normal[1] * v.normal[1] + v.normal[2] * v.normal[2]);
+                if (length > 0.f)
+                {
+                    for (float& component : v.normal)
+                        component /= length;
+                }
+            }
+        }
+        return true;
+    }
+
+    // A grid of columns x rows vertices over [-1, 1] with sine-sum hills, in
+    // the spirit of heightmap.c's generated terrain.
+    void makeGrid(uint32_t columns, uint32_t rows, Mesh& mesh)
+    {
+        auto height = [](float x, float z)
+        {
+            return 0.15f * std::sin(3.1f * x) * std::cos(2.3f * z) + 0.05f * std::sin(9.7f * x + 4.1f * z);
+        };
+
+        const float dx = 2.f / static_cast<float>(columns - 1);
+        const float dz = 2.f / static_cast<float>(rows - 1);
+        mesh.vertices.reserve(std::size_t{columns} * rows);
+        for (uint32_t r = 0; r < rows; ++r)
+        {
+            for (uint32_t c = 0; c < columns; ++c)
+            {
+                const float x = -1.f + c * dx;
+                const float z = -1.f + r * dz;
+                // Central differences for the normal.
+                const float hx = height(x + dx, z) - height(x - dx, z);
+                const float hz = height(x, z + dz) - height(x, z - dz);
+                float n[3] = {-hx / (2.f * dx), 1.f, -hz / (2.f * dz)};
+                const float length = std::sqrt(n[0] * n[0] + n[1] * n[1] + n[2] * n[2]);
+                mesh.vertices.push_back(Vertex{{x, height(x, z), z}, {n[0] / length, n[1] / length, n[2] / length},
+                                               {static_cast<float>(c) / (columns - 1), static_cast<float>(r) / (rows - 1)}});
+            }
+        }
+
+        mesh.indices.reserve(std::size_t{columns - 1} * (rows - 1) * 6);
+        for (uint32_t r = 0; r + 1 < rows; ++r)
+        {
+            for (uint32_t c = 0; c + 1 < columns; ++c)
+            {
+                const uint32_t i = r * columns + c;
+                mesh.indices.insert(mesh.indices.end(), {i, i + columns, i + 1, i + 1, i + columns, i + columns + 1});
+            }
+        }
+    }
+
+    bool writeMesh(bloom::AssetWriter& writer, const std::string& name, const Mesh& mesh)
+    {
+        bloom::MeshSource source;
+        source.vertices = mesh.vertices.data();
+        source.vertexCount = static_cast<uint32_t>(mesh.vertices.size());
+        source.vertexStride = sizeof(Vertex);
+        source.attributes = kVertexLayout;
+        source.indexCount = static_cast<uint32_t>(mesh.indices.size());
+
+        // 16-bit indices whenever they fit: half the bytes to map and upload.
+        std::vector<uint16_t> shortIndices;
+        if (mesh.vertices.size() <= 0xffff)
+        {
+            shortIndices.assign(mesh.indices.begin(), mesh.indices.end());
+            source.indices = shortIndices.data();
+            source.indexType = GL_UNSIGNED_SHORT;
+        }
+        else
+        {
+            source.indices = mesh.indices.data();
+            source.indexType = GL_UNSIGNED_INT;
+        }
+        return writer.addMesh(name, source);
+    }
+
+    // RGBA8 chain down to 1x1 with a 2x2 box filter.
+    bool writeTexture(bloom::AssetWriter& writer, const std::string& name, uint32_t width, uint32_t height,
+                      std::vector<uint8_t> pixels)
+    {
+        std::vector<std::vector<uint8_t>> chain;
+        chain.push_back(std::move(pixels));
+        uint32_t w = width, h = height;
+        while ((w > 1 || h > 1) && chain.size() < bloom::kMaxTextureLevels)
+        {
+            const uint32_t nw = std::max(w / 2, 1u), nh = std::max(h / 2, 1u);
+            const std::vector<uint8_t>& src = chain.back();
+            std::vector<uint8_t> dst(std::size_t{nw} * nh * 4);
+            for (uint32_t y = 0; y < nh; ++y)
+            {
+                for (uint32_t x = 0; x < nw; ++x)
+                {
+                    const uint32_t x0 = std::min(2 * x, w - 1), x1 = std::min(2 * x + 1, w - 1);
+                    const uint32_t y0 = std::min(2 * y, h - 1), y1 = std::min(2 * y + 1, h - 1);
+                    for (uint32_t k = 0; k < 4; ++k)
+                    {
+                        const uint32_t sum = src[(y0 * w + x0) * 4 + k] + src[(y0 * w + x1) * 4 + k] +
+                                             src[(y1 * w + x0) * 4 + k] + src[(y1 * w + x1) * 4 + k];
+                        dst[(std::size_t{y} * nw + x) * 4 + k] = static_cast<uint8_t>((sum + 2) / 4);
+                    }
+                }
+            }
+            chain.push_back(std::move(dst));
+            w = nw;
+            h = nh;
+        }
+
+        std::vector<std::span<const std::byte>> levels;
+        for (const std::vector<uint8_t>& level : chain)
+            levels.push_back(std::as_bytes(std::span(level)));
+
+        bloom::TextureSource source;
+        source.width = width;
+        source.height = height;
+        source.internalFormat = GL_RGBA8;
+        source.format = GL_RGBA;
+        source.type = GL_UNSIGNED_BYTE;
+        source.levels = levels;
+        return writer.addTexture(name, source);
+    }
+
+    bool cookLine(bloom::AssetWriter& writer, const std::filesystem::path& base, std::istringstream& words)
+    {
+        std::string kind, name, source;
+        words >> kind >> name;
+        if (kind == "blob")
+        {
+            std::string path;
+            std::vector<std::byte> data;
+            return words >> path && readFile(base / path, data) && writer.addBlob(name, data);
+        }
+
+        words >> source;
+        if (kind == "mesh" && source == "obj")
+        {
+            std::string path;
+            Mesh mesh;
+            return words >> path && loadObj(base / path, mesh) && writeMesh(writer, name, mesh);
+        }
+        if (kind == "mesh" && source == "grid")
+        {
+            uint32_t columns = 0, rows = 0;
+            if (!(words >> columns >> rows) || columns < 2 || rows < 2)
+                return false;
+            Mesh mesh;
+            makeGrid(columns, rows, mesh);
+            return writeMesh(writer, name, mesh);
+        }
+        if (kind == "texture" && source == "rgba8")
+        {
+            uint32_t width = 0, height = 0;
+            std::string path;
+            std::vector<std::byte> data;
+            if (!(words >> width >> height >> path) || width == 0 || height == 0 || !readFile(base / path, data))
+                return false;
+            if (data.size() != std::size_t{width} * height * 4)
+            {
+                std::fprintf(stderr, "%s is not %ux%u RGBA8\n", path.c_str(), width, height);
+                return false;
+            }
+            const auto* bytes = reinterpret_cast<const uint8_t*>(data.data());
+            return writeTexture(writer, name, width, height, std::vector<uint8_t>(bytes, bytes + data.size()));
+        }
+        if (kind == "texture" && source == "checker")
+        {
+            uint32_t size = 0, cell = 0;
+            if (!(words >> size >> cell) || size == 0 || cell == 0)
+                return false;
+            std::vector<uint8_t> pixels(std::size_t{size} * size * 4);
+            for (uint32_t y = 0; y < size; ++y)
+            {
+                for (uint32_t x = 0; x < size; ++x)
+                {
+                    const uint8_t value = ((x / cell) ^ (y / cell)) & 1 ? 230 : 40;
+                    uint8_t* pixel = &pixels[(std::size_t{y} * size + x) * 4];
+                    pixel[0] = pixel[1] = pixel[2] = value;
+                    pixel[3] = 255;
+                }
+            }
+            return writeTexture(writer, name, size, size, std::move(pixels));
+        }
+
+        std::fprintf(stderr, "Unknown asset kind '%s %s'\n", kind.c_str(), source.c_str());
+        return false;
+    }
+}
+
+int main(int argc, char** argv)
+{
+    if (argc != 3)
+    {
+        std::fprintf(stderr, "usage: %s MANIFEST OUTPUT\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    std::ifstream manifest(argv[1]);
+    if (!manifest)
+    {
+        std::fprintf(stderr, "Failed to open %s\n", argv[1]);
+        return EXIT_FAILURE;
+    }
+    const std::filesystem::path base = std::filesystem::path(argv[1]).parent_path();
+
+    bloom::AssetWriter writer;
+    if (!writer.open(argv[2]))
+        return EXIT_FAILURE;
+
+    std::string line;
+    for (int number = 1; std::getline(manifest, line); ++number)
+    {
+        line = line.substr(0, line.find('#'));
+        std::istringstream words(line);
+        std::string first;
+        if (!(words >> first))
+            continue;
+
+        words.seekg(0);
+        if (!cookLine(writer, base, words))
+        {
+            std::fprintf(stderr, "%s:%d: failed to cook '%s'\n", argv[1], number, line.c_str());
+            return EXIT_FAILURE;
+        }
+    }
+
+    if (!writer.finish())
+        return EXIT_FAILURE;
+
+    std::printf("Cooked %zu assets into %s (%.1f MiB)\n", writer.assetCount(), argv[2], writer.bytesWritten() / (1024.0 * 1024.0));
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,129 @@
+#!/usr/bin/env python3
+"""Generates src/glad_lazy.c from the glad loader in this tree.
+
+Every GL entry point gets a trampoline that resolves the real function the
+first time it is called, patches the glad_gl* pointer and forwards the call.
+gladLoadGLLoaderLazy() in src/glad.c installs the trampolines instead of
+resolving every entry point up front.
+
+Run from the repository root after regenerating glad:
+
+    python3 tools/gen_glad_lazy.py
+"""
+
+import re
+import sys
+from pathlib import Path
+
+ROOT = Path(__file__).resolve().parent.parent
+HEADER = ROOT / "include" / "glad" / "glad.h"
+LOADER = ROOT / "src" / "glad.c"
+OUTPUT = ROOT / "src" / "glad_lazy.c"
+
+TYPEDEF = re.compile(r"^typedef (.+?)\s*\(APIENTRYP (PFN\w+PROC)\)\((.*)\);$")
+POINTER = re.compile(r"^GLAPI (PFN\w+PROC) glad_(\w+);$")
+VERSION = re.compile(r"^static void load_GL_VERSION_(\d+)_(\d+)\(GLADloadproc load\) \{$")
+LOAD = re.compile(r"^\tglad_(\w+) = \(PFN\w+PROC\)load\(\"\w+\"\);$")
+
+# Resolved eagerly by the loader itself to find the context version.
+EAGER = {"glGetString"}
+
+
+def parameter_names(params):
+    if params.strip() in ("", "void"):
+        return []
+    names = []
+    for param in params.split(","):
+        match = re.search(r"(\w+)\s*(\[\s*\d*\s*\])?\s*$", param.strip())
+        if not match:
+            sys.exit(f"cannot parse parameter '{param}'")
+        names.append(match.group(1))
+    return names
+
+
+def main():
+    typedefs = {}
+    functions = {}
+    for line in HEADER.read_text().splitlines():
+        match = TYPEDEF.match(line)
+        if match:
+            typedefs[match.group(2)] = (match.group(1).strip(), match.group(3))
+            continue
+        match = POINTER.match(line)
+        if match:
+            functions[match.group(2)] = match.group(1)
+
+    versions = []
+    for line in LOADER.read_text().splitlines():
+        match = VERSION.match(line)
+        if match:
+            versions.append((match.group(1), match.group(2), []))
+            continue
+        match = LOAD.match(line)
+        if match and versions:
+            versions[-1][2].append(match.group(1))
+
+    out = [
+        "/*",
+        "    Lazy entry point trampolines for the glad loader in src/glad.c.",
+        "    Generated by tools/gen_glad_lazy.py -- do not edit.",
+        "*/",
+        "",
+        "#include <stdio.h>",
+        "#include <stdlib.h>",
+        "#include <glad/glad.h>",
+        "",
+        "static GLADloadproc glad_lazy_load;",
+        "",
+        "static void* glad_lazy_resolve(const char *name) {",
+        "    void* result = glad_lazy_load(name);",
+        "    if(result == NULL) {",
+        "        fprintf(stderr, \"glad: %s is not exported by the current context\\n\", name);",
+        "        abort();",
+        "    }",
+        "    return result;",
+        "}",
+        "",
+        "#define GLAD_LAZY_VOID(name, pfn, params, args) \\",
+        "    static void APIENTRY glad_lazy_##name params { \\",
+        "        glad_##name = (pfn)glad_lazy_resolve(#name); \\",
+        "        glad_##name args; \\",
+        "    }",
+        "",
+        "#define GLAD_LAZY_RET(type, name, pfn, params, args) \\",
+        "    static type APIENTRY glad_lazy_##name params { \\",
+        "        glad_##name = (pfn)glad_lazy_resolve(#name); \\",
+        "        return glad_##name args; \\",
+        "    }",
+        "",
+    ]
+
+    for name in sorted(functions):
+        if name in EAGER:
+            continue
+        pfn = functions[name]
+        result, params = typedefs[pfn]
+        args = ", ".join(parameter_names(params))
+        if result == "void":
+            out.append(f"GLAD_LAZY_VOID({name}, {pfn}, ({params}), ({args}))")
+        else:
+            out.append(f"GLAD_LAZY_RET({result}, {name}, {pfn}, ({params}), ({args}))")
+
+    out += [
+        "",
+        "void glad_install_lazy_GL(GLADloadproc load) {",
+        "    glad_lazy_load = load;",
+    ]
+    for major, minor, names in versions:
+        out.append(f"    if(GLAD_GL_VERSION_{major}_{minor}) {{")
+        for name in names:
+            if name not in EAGER:
+                out.append(f"        glad_{name} = glad_lazy_{name};")
+        out.append("    }")
+    out += ["}", ""]
+
+    OUTPUT.write_text("\n".join(out))
+
+
+if __name__ == "__main__":
+    main()